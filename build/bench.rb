@@ -0,0 +1,147 @@
+#  Phusion Passenger - https://www.phusionpassenger.com/
+#  Copyright (c) 2021 Phusion Holding B.V.
+#
+#  "Passenger", "Phusion Passenger" and "Union Station" are registered
+#  trademarks of Phusion Holding B.V.
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+
+### Controller load benchmark ###
+
+BENCH_TARGET = "#{TEST_OUTPUT_DIR}bench/passenger-bench"
+BENCH_OBJECTS = {
+  "#{TEST_OUTPUT_DIR}bench/BenchMain.o" =>
+    "test/bench/BenchMain.cpp"
+}
+
+# Define compilation tasks for object files.
+BENCH_OBJECTS.each_pair do |object, source|
+  define_cxx_object_compilation_task(
+    object,
+    source,
+    lambda { {
+      :include_paths => [
+        'src/agent',
+        *CXX_SUPPORTLIB_INCLUDE_PATHS
+      ],
+      :flags => basic_test_cxx_flags
+    } }
+  )
+end
+
+# Define compilation task for the benchmark executable.
+dependencies = [
+  BENCH_OBJECTS.keys,
+  LIBEV_TARGET,
+  LIBUV_TARGET,
+  TEST_BOOST_OXT_LIBRARY,
+  TEST_COMMON_LIBRARY.link_objects,
+  AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT]
+].flatten.compact
+file(BENCH_TARGET => dependencies) do
+  create_cxx_executable(
+    BENCH_TARGET,
+    BENCH_OBJECTS.keys + AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT],
+    :flags => test_cxx_ldflags
+  )
+end
+
+desc "Run the end-to-end Core controller load benchmark (pass options with ARGS)"
+task 'bench' => BENCH_TARGET do
+  sh "#{File.expand_path(BENCH_TARGET)} #{ENV['ARGS']}".strip
+end
+
+
+### cxx_supportlib microbenchmarks ###
+
+MICROBENCH_TARGET = "#{TEST_OUTPUT_DIR}bench/microbench"
+MICROBENCH_OBJECTS = {
+  "#{TEST_OUTPUT_DIR}bench/micro/MicroBenchMain.o" =>
+    "test/bench/micro/MicroBenchMain.cpp",
+  "#{TEST_OUTPUT_DIR}bench/micro/AlgorithmsBench.o" =>
+    "test/bench/micro/AlgorithmsBench.cpp",
+  "#{TEST_OUTPUT_DIR}bench/micro/DataStructuresBench.o" =>
+    "test/bench/micro/DataStructuresBench.cpp",
+  "#{TEST_OUTPUT_DIR}bench/micro/MemoryKitBench.o" =>
+    "test/bench/micro/MemoryKitBench.cpp",
+  "#{TEST_OUTPUT_DIR}bench/micro/ResponseCacheBench.o" =>
+    "test/bench/micro/ResponseCacheBench.cpp",
+  "#{TEST_OUTPUT_DIR}bench/micro/ServerKitBench.o" =>
+    "test/bench/micro/ServerKitBench.cpp",
+  "#{TEST_OUTPUT_DIR}bench/micro/StrIntToolsBench.o" =>
+    "test/bench/micro/StrIntToolsBench.cpp"
+}
+
+# The microbenchmarks are compiled and linked like the agent, so that
+# OPTIMIZE=1 yields the same code as in production.
+MICROBENCH_OBJECTS.each_pair do |object, source|
+  define_cxx_object_compilation_task(
+    object,
+    source,
+    lambda { {
+      :include_paths => [
+        'src/agent',
+        *CXX_SUPPORTLIB_INCLUDE_PATHS
+      ],
+      :flags => [
+        agent_cflags,
+        libev_cflags,
+        libuv_cflags,
+        PlatformInfo.curl_flags,
+        PlatformInfo.openssl_extra_cflags,
+        PlatformInfo.zlib_flags
+      ]
+    } }
+  )
+end
+
+microbench_libs = COMMON_LIBRARY.
+  only(:base, :base64, :union_station_filter, :process_management_ruby, :other).
+  exclude('WatchdogLauncher.o')
+dependencies = MICROBENCH_OBJECTS.keys + [
+  LIBBOOST_OXT,
+  microbench_libs.link_objects,
+  LIBEV_TARGET,
+  LIBUV_TARGET
+].flatten.compact
+file(MICROBENCH_TARGET => dependencies) do
+  create_cxx_executable(MICROBENCH_TARGET,
+    [
+      MICROBENCH_OBJECTS.keys,
+      microbench_libs.link_objects_as_string,
+      LIBBOOST_OXT_LINKARG
+    ],
+    :flags => [
+      libev_libs,
+      libuv_libs,
+      PlatformInfo.curl_libs,
+      PlatformInfo.zlib_libs,
+      PlatformInfo.crypto_libs,
+      PlatformInfo.portability_cxx_ldflags,
+      agent_ldflags
+    ]
+  )
+end
+
+desc "Run the cxx_supportlib microbenchmarks (build with OPTIMIZE=1; " \
+  "pass options with ARGS; the JSON report is written to OUTPUT)"
+task 'bench:micro' => MICROBENCH_TARGET do
+  output = ENV['OUTPUT'] || "#{TEST_OUTPUT_DIR}bench/microbench.json"
+  sh "#{File.expand_path(MICROBENCH_TARGET)} --out #{output} #{ENV['ARGS']}".strip
+end
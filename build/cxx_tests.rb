@@ -61,10 +61,28 @@
     "test/cxx/Core/TelemetryCollectorTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/Core/ControllerTest.o" =>
     "test/cxx/Core/ControllerTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/EventLoopStallDetectorTest.o" =>
+    "test/cxx/Core/EventLoopStallDetectorTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/CpuProfilerTest.o" =>
+    "test/cxx/Core/CpuProfilerTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/RequestTracingTest.o" =>
+    "test/cxx/Core/RequestTracingTest.cpp",
 
   "#{TEST_OUTPUT_DIR}cxx/SpawnEnvSetupperTest.o" =>
     "test/cxx/SpawnEnvSetupperTest.cpp",
 
+  "#{TEST_OUTPUT_DIR}cxx/Apache2Module/BucketStateTest.o" =>
+    "test/cxx/Apache2Module/BucketStateTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Apache2Module/ChunkedBodyDecoderTest.o" =>
+    "test/cxx/Apache2Module/ChunkedBodyDecoderTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Apache2Module/CoreConnectionPoolTest.o" =>
+    "test/cxx/Apache2Module/CoreConnectionPoolTest.cpp",
+
+  "#{TEST_OUTPUT_DIR}cxx/Shared/ListenerHandoffTest.o" =>
+    "test/cxx/Shared/ListenerHandoffTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Watchdog/AgentWatcherTest.o" =>
+    "test/cxx/Watchdog/AgentWatcherTest.cpp",
+
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/ChannelTest.o" =>
     "test/cxx/ServerKit/ChannelTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/FileBufferedChannelTest.o" =>
@@ -77,6 +95,8 @@
     "test/cxx/ServerKit/HttpServerTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/CookieUtilsTest.o" =>
     "test/cxx/ServerKit/CookieUtilsTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/ServerKit/RequestPoolSizerTest.o" =>
+    "test/cxx/ServerKit/RequestPoolSizerTest.cpp",
 
   "#{TEST_OUTPUT_DIR}cxx/ConfigKit/SchemaTest.o" =>
     "test/cxx/ConfigKit/SchemaTest.cpp",
@@ -94,12 +114,16 @@
     "test/cxx/MemoryKit/MbufTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/MemoryKit/PallocTest.o" =>
     "test/cxx/MemoryKit/PallocTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Algorithms/LatencyHistogramTest.o" =>
+    "test/cxx/Algorithms/LatencyHistogramTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/LStringTest.o" =>
     "test/cxx/DataStructures/LStringTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/StringKeyTableTest.o" =>
     "test/cxx/DataStructures/StringKeyTableTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/StringMapTest.o" =>
     "test/cxx/DataStructures/StringMapTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/JsonTools/JsonWriterTest.o" =>
+    "test/cxx/JsonTools/JsonWriterTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/FileTools/PathSecurityCheckTest.o" =>
     "test/cxx/FileTools/PathSecurityCheckTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOTools/MessageSerializationTest.o" =>
@@ -116,6 +140,8 @@
     "test/cxx/SystemTools/SystemTimeTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/CachedFileStatTest.o" =>
     "test/cxx/CachedFileStatTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/AppTypeDetector/ResultCacheTest.o" =>
+    "test/cxx/AppTypeDetector/ResultCacheTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOTools/BufferedIOTest.o" =>
     "test/cxx/IOTools/BufferedIOTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOTools/IOUtilsTest.o" =>
@@ -124,6 +150,8 @@
     "test/cxx/IOTools/MessageIOTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/MessagePassingTest.o" =>
     "test/cxx/MessagePassingTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/OpenMetricsTest.o" =>
+    "test/cxx/OpenMetricsTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/VariantMapTest.o" =>
     "test/cxx/VariantMapTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DateParsingTest.o" =>
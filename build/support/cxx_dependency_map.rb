@@ -13,12 +13,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -34,6 +39,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -42,6 +48,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
@@ -69,6 +76,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Context.h",
@@ -106,6 +114,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -124,6 +134,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -158,14 +169,21 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/ConfigChange.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -180,6 +198,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -190,8 +209,10 @@
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -215,6 +236,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Context.h",
@@ -251,6 +273,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -269,6 +293,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -663,6 +688,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -671,6 +697,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -737,7 +765,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/InitializationAndShutdown.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/DemandForecasting.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -761,6 +789,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -769,6 +798,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -835,7 +866,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/InternalUtils.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/InitializationAndShutdown.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -859,6 +890,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -867,6 +899,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -933,7 +967,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/LifetimeAndBasics.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/InternalUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -957,6 +991,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -965,6 +1000,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -984,6 +1021,7 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -1031,7 +1069,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/Miscellaneous.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/LifetimeAndBasics.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1055,6 +1093,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1063,6 +1102,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1129,7 +1170,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/OutOfBandWork.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1153,6 +1194,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1161,6 +1203,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1180,7 +1224,6 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -1228,7 +1271,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/ProcessListManagement.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/OutOfBandWork.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1252,6 +1295,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1260,6 +1304,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1279,6 +1325,7 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -1326,7 +1373,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/SessionManagement.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/ProcessListManagement.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1350,6 +1397,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1358,6 +1406,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1424,7 +1474,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/SpawningAndRestarting.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/RollingRestart.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1448,6 +1498,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1456,6 +1507,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1522,7 +1575,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/StateInspection.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/SessionManagement.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1546,6 +1599,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1554,6 +1608,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1620,7 +1676,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Group/Verification.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/SpawningAndRestarting.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1644,6 +1700,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1652,6 +1709,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1718,34 +1777,14 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Implementation.cpp"=>
+ "src/agent/Core/ApplicationPool/Group/StateInspection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Group/InitializationAndShutdown.cpp",
-   "src/agent/Core/ApplicationPool/Group/InternalUtils.cpp",
-   "src/agent/Core/ApplicationPool/Group/LifetimeAndBasics.cpp",
-   "src/agent/Core/ApplicationPool/Group/Miscellaneous.cpp",
-   "src/agent/Core/ApplicationPool/Group/OutOfBandWork.cpp",
-   "src/agent/Core/ApplicationPool/Group/ProcessListManagement.cpp",
-   "src/agent/Core/ApplicationPool/Group/SessionManagement.cpp",
-   "src/agent/Core/ApplicationPool/Group/SpawningAndRestarting.cpp",
-   "src/agent/Core/ApplicationPool/Group/StateInspection.cpp",
-   "src/agent/Core/ApplicationPool/Group/Verification.cpp",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Pool/AnalyticsCollection.cpp",
-   "src/agent/Core/ApplicationPool/Pool/GarbageCollection.cpp",
-   "src/agent/Core/ApplicationPool/Pool/GeneralUtils.cpp",
-   "src/agent/Core/ApplicationPool/Pool/GroupUtils.cpp",
-   "src/agent/Core/ApplicationPool/Pool/InitializationAndShutdown.cpp",
-   "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp",
-   "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp",
-   "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp",
-   "src/agent/Core/ApplicationPool/Process.cpp",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
@@ -1754,7 +1793,6 @@
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/ErrorRenderer.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
@@ -1763,6 +1801,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1771,6 +1810,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1780,10 +1821,8 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -1792,7 +1831,6 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -1808,7 +1846,6 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1819,7 +1856,6 @@
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -1842,27 +1878,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Options.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool.h"=>
+ "src/agent/Core/ApplicationPool/Group/Verification.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -1886,6 +1902,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1894,6 +1911,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1938,7 +1957,6 @@
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -1961,23 +1979,48 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/AnalyticsCollection.cpp"=>
+ "src/agent/Core/ApplicationPool/Implementation.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Group/DemandForecasting.cpp",
+   "src/agent/Core/ApplicationPool/Group/InitializationAndShutdown.cpp",
+   "src/agent/Core/ApplicationPool/Group/InternalUtils.cpp",
+   "src/agent/Core/ApplicationPool/Group/LifetimeAndBasics.cpp",
+   "src/agent/Core/ApplicationPool/Group/Miscellaneous.cpp",
+   "src/agent/Core/ApplicationPool/Group/OutOfBandWork.cpp",
+   "src/agent/Core/ApplicationPool/Group/ProcessListManagement.cpp",
+   "src/agent/Core/ApplicationPool/Group/RollingRestart.cpp",
+   "src/agent/Core/ApplicationPool/Group/SessionManagement.cpp",
+   "src/agent/Core/ApplicationPool/Group/SpawningAndRestarting.cpp",
+   "src/agent/Core/ApplicationPool/Group/StateInspection.cpp",
+   "src/agent/Core/ApplicationPool/Group/Verification.cpp",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Pool/AnalyticsCollection.cpp",
+   "src/agent/Core/ApplicationPool/Pool/FairSharing.cpp",
+   "src/agent/Core/ApplicationPool/Pool/GarbageCollection.cpp",
+   "src/agent/Core/ApplicationPool/Pool/GeneralUtils.cpp",
+   "src/agent/Core/ApplicationPool/Pool/GroupUtils.cpp",
+   "src/agent/Core/ApplicationPool/Pool/InitializationAndShutdown.cpp",
+   "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp",
+   "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp",
+   "src/agent/Core/ApplicationPool/Pool/Snapshot.cpp",
+   "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp",
+   "src/agent/Core/ApplicationPool/Process.cpp",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/ErrorRenderer.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
@@ -1986,6 +2029,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -1994,6 +2038,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2003,8 +2049,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -2013,7 +2061,9 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2028,6 +2078,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2039,6 +2090,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2061,7 +2113,27 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/GarbageCollection.cpp"=>
+ "src/agent/Core/ApplicationPool/Options.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/Pool.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2069,9 +2141,9 @@
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2086,6 +2158,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2094,6 +2167,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2114,6 +2189,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2139,6 +2215,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2161,7 +2238,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/GeneralUtils.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/AnalyticsCollection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2172,6 +2249,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2186,6 +2264,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2194,6 +2273,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2214,6 +2295,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2239,6 +2321,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2261,7 +2344,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/GroupUtils.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/FairSharing.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2272,6 +2355,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2286,6 +2370,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2294,6 +2379,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2314,6 +2401,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2339,6 +2427,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2361,7 +2450,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/InitializationAndShutdown.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/GarbageCollection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2372,6 +2461,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2386,6 +2476,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2394,6 +2485,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2414,6 +2507,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2439,6 +2533,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2461,7 +2556,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/GeneralUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2472,6 +2567,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2486,6 +2582,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2494,6 +2591,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2514,6 +2613,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2539,6 +2639,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2561,7 +2662,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/GroupUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2572,6 +2673,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2586,6 +2688,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2594,6 +2697,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2614,6 +2719,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2639,6 +2745,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2661,7 +2768,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/InitializationAndShutdown.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2672,6 +2779,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2686,6 +2794,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2694,6 +2803,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2714,6 +2825,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2739,6 +2851,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2761,7 +2874,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Process.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -2769,8 +2882,10 @@
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2785,6 +2900,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2793,6 +2909,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2813,6 +2931,7 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2837,6 +2956,8 @@
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2859,14 +2980,18 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Process.h"=>
+ "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2881,6 +3006,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2889,6 +3015,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2904,10 +3032,12 @@
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -2932,6 +3062,8 @@
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -2948,18 +3080,24 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Session.h"=>
+ "src/agent/Core/ApplicationPool/Pool/Snapshot.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -2974,6 +3112,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -2982,6 +3121,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2997,10 +3138,12 @@
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -3025,6 +3168,8 @@
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -3041,15 +3186,25 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Socket.h"=>
-  ["src/agent/Core/ApplicationPool/Common.h",
+ "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -3063,13 +3218,17 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -3085,10 +3244,12 @@
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -3112,6 +3273,9 @@
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -3128,58 +3292,23 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/TestSession.h"=>
+ "src/agent/Core/ApplicationPool/Process.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Config.h"=>
-  ["src/agent/Core/AdminPanelConnector.h",
-   "src/agent/Core/ApiServer.h",
-   "src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/ConfigChange.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SecurityUpdateChecker.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -3193,33 +3322,27 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/TelemetryCollector.h",
-   "src/agent/Shared/ApiAccountUtils.h",
-   "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -3229,52 +3352,19 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
@@ -3284,17 +3374,13 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -3313,30 +3399,15 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ConfigChange.cpp"=>
-  ["src/agent/Core/AdminPanelConnector.h",
-   "src/agent/Core/ApiServer.h",
-   "src/agent/Core/ApplicationPool/AbstractSession.h",
+ "src/agent/Core/ApplicationPool/Process.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Config.h",
-   "src/agent/Core/ConfigChange.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SecurityUpdateChecker.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -3356,82 +3427,39 @@
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/TelemetryCollector.h",
-   "src/agent/Shared/ApiAccountUtils.h",
-   "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
@@ -3441,17 +3469,13 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -3464,56 +3488,19 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ConfigChange.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller.h"=>
+ "src/agent/Core/ApplicationPool/Session.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -3535,69 +3522,37 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
@@ -3608,10 +3563,8 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -3628,14 +3581,47 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/AppResponse.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/agent/Core/ApplicationPool/Snapshot.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -3645,11 +3631,13 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
@@ -3657,30 +3645,32 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -3691,30 +3681,16 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/BufferBody.cpp"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
+ "src/agent/Core/ApplicationPool/Socket.h"=>
+  ["src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -3734,71 +3710,38 @@
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
@@ -3809,10 +3752,7 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -3829,14 +3769,39 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/CheckoutSession.cpp"=>
+ "src/agent/Core/ApplicationPool/TestSession.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/Config.h"=>
+  ["src/agent/Core/AdminPanelConnector.h",
+   "src/agent/Core/ApiServer.h",
+   "src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
@@ -3846,20 +3811,28 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ConfigChange.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.h",
    "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SecurityUpdateChecker.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/ErrorRenderer.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
@@ -3868,30 +3841,37 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/TelemetryCollector.h",
+   "src/agent/Shared/ApiAccountUtils.h",
+   "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -3901,20 +3881,26 @@
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
@@ -3937,13 +3923,14 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3951,15 +3938,18 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -3978,8 +3968,10 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Client.h"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+ "src/agent/Core/ConfigChange.cpp"=>
+  ["src/agent/Core/AdminPanelConnector.h",
+   "src/agent/Core/ApiServer.h",
+   "src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
@@ -3989,10 +3981,24 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Config.h",
+   "src/agent/Core/ConfigChange.h",
+   "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SecurityUpdateChecker.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -4006,22 +4012,31 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/TelemetryCollector.h",
+   "src/agent/Shared/ApiAccountUtils.h",
+   "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
@@ -4036,26 +4051,34 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
@@ -4071,9 +4094,12 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
@@ -4083,15 +4109,18 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -4110,7 +4139,33 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Config.cpp"=>
+ "src/agent/Core/ConfigChange.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/Controller.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -4121,12 +4176,16 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -4142,6 +4201,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -4150,6 +4210,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4175,6 +4236,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -4209,6 +4271,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -4227,6 +4291,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -4249,14 +4314,12 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Config.h"=>
+ "src/agent/Core/Controller/AppResponse.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
@@ -4269,7 +4332,6 @@
    "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -4281,7 +4343,6 @@
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
@@ -4290,27 +4351,17 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -4326,7 +4377,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/ForwardResponse.cpp"=>
+ "src/agent/Core/Controller/BufferBody.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -4337,12 +4388,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -4358,6 +4414,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -4366,6 +4423,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4391,6 +4449,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -4425,6 +4484,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -4443,6 +4504,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -4465,7 +4527,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Hooks.cpp"=>
+ "src/agent/Core/Controller/CheckoutSession.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -4476,12 +4538,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -4489,6 +4556,7 @@
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/ErrorRenderer.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
@@ -4497,6 +4565,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -4505,6 +4574,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4516,9 +4586,11 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -4530,6 +4602,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -4564,12 +4637,15 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4582,6 +4658,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -4604,7 +4681,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Implementation.cpp"=>
+ "src/agent/Core/Controller/Client.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -4615,31 +4692,19 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/BufferBody.cpp",
-   "src/agent/Core/Controller/CheckoutSession.cpp",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.cpp",
    "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/ForwardResponse.cpp",
-   "src/agent/Core/Controller/Hooks.cpp",
-   "src/agent/Core/Controller/InitRequest.cpp",
-   "src/agent/Core/Controller/InitializationAndShutdown.cpp",
-   "src/agent/Core/Controller/InternalUtils.cpp",
-   "src/agent/Core/Controller/Miscellaneous.cpp",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
    "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/SendRequest.cpp",
-   "src/agent/Core/Controller/StateInspection.cpp",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/ErrorRenderer.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
@@ -4648,6 +4713,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -4656,9 +4722,9 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -4668,11 +4734,9 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -4681,9 +4745,9 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -4702,7 +4766,6 @@
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
@@ -4718,13 +4781,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4732,12 +4795,12 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -4760,7 +4823,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/InitRequest.cpp"=>
+ "src/agent/Core/Controller/Config.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -4771,12 +4834,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -4792,6 +4860,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -4800,9 +4869,9 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -4812,11 +4881,9 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -4828,6 +4895,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -4862,6 +4930,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -4875,12 +4945,12 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -4903,48 +4973,10 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/InitializationAndShutdown.cpp"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/agent/Core/Controller/Config.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -4959,26 +4991,18 @@
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
@@ -4986,9 +5010,7 @@
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
@@ -5002,27 +5024,18 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
@@ -5036,13 +5049,25 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/InternalUtils.cpp"=>
+ "src/agent/Core/Controller/ConfigSnapshot.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Core/Controller/ForwardResponse.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -5053,12 +5078,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -5074,6 +5104,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -5082,6 +5113,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5107,6 +5139,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -5141,6 +5174,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -5159,6 +5194,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -5181,7 +5217,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Miscellaneous.cpp"=>
+ "src/agent/Core/Controller/Hooks.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -5192,12 +5228,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -5213,6 +5254,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -5221,6 +5263,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5246,6 +5289,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -5280,6 +5324,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -5298,6 +5344,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -5320,7 +5367,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/Request.h"=>
+ "src/agent/Core/Controller/Implementation.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -5331,14 +5378,36 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/BufferBody.cpp",
+   "src/agent/Core/Controller/CheckoutSession.cpp",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.cpp",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/ForwardResponse.cpp",
+   "src/agent/Core/Controller/Hooks.cpp",
+   "src/agent/Core/Controller/InitRequest.cpp",
+   "src/agent/Core/Controller/InitializationAndShutdown.cpp",
+   "src/agent/Core/Controller/InternalUtils.cpp",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Miscellaneous.cpp",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/SendRequest.cpp",
+   "src/agent/Core/Controller/StateInspection.cpp",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/ErrorRenderer.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
@@ -5347,6 +5416,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -5355,8 +5425,10 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -5366,9 +5438,11 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -5377,8 +5451,10 @@
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -5397,6 +5473,7 @@
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
@@ -5412,11 +5489,15 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5424,12 +5505,15 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -5451,7 +5535,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/SendRequest.cpp"=>
+ "src/agent/Core/Controller/InitRequest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -5462,12 +5546,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -5483,6 +5572,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -5491,8 +5581,10 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -5502,9 +5594,11 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -5516,6 +5610,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -5550,6 +5645,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -5563,12 +5660,15 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -5590,7 +5690,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/StateInspection.cpp"=>
+ "src/agent/Core/Controller/InitializationAndShutdown.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
@@ -5601,12 +5701,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -5622,6 +5727,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -5630,6 +5736,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5655,6 +5762,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -5689,6 +5797,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -5707,6 +5817,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -5729,13 +5840,60 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller/TurboCaching.h"=>
-  ["src/agent/Core/ResponseCache.h",
+ "src/agent/Core/Controller/InternalUtils.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
@@ -5745,30 +5903,77 @@
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -5779,15 +5984,28 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/CoreMain.cpp"=>
-  ["src/agent/Core/AdminPanelConnector.h",
-   "src/agent/Core/ApiServer.h",
-   "src/agent/Core/ApplicationPool/AbstractSession.h",
+ "src/agent/Core/Controller/LatencyStats.h"=>
+  ["src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/Controller/Metrics.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Core/Controller/Miscellaneous.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
@@ -5797,19 +6015,19 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Config.h",
-   "src/agent/Core/ConfigChange.cpp",
-   "src/agent/Core/ConfigChange.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/OptionParser.h",
    "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SecurityUpdateChecker.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -5823,74 +6041,55 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/TelemetryCollector.h",
-   "src/agent/Shared/ApiAccountUtils.h",
-   "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/agent/Shared/Fundamentals/AbortHandler.h",
-   "src/agent/Shared/Fundamentals/Initialization.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/AppTypeDetector/Detector.h",
-   "src/cxx_supportlib/BackgroundEventLoop.cpp",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/SubComponentUtils.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
-   "src/cxx_supportlib/JsonTools/Autocast.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/ClientRef.h",
@@ -5912,6 +6111,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -5925,19 +6126,16 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -5956,60 +6154,131 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/OptionParser.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/JsonTools/Autocast.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ResponseCache.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/agent/Core/Controller/Request.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/agent/Core/SecurityUpdateChecker.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -6020,111 +6289,138 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Config.h"=>
-  ["src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h"=>
-  [],
- "src/agent/Core/SpawningKit/Context.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+ "src/agent/Core/Controller/RequestTracing.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/DirectSpawner.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
+ "src/agent/Core/Controller/SendRequest.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Handshake/Perform.h",
    "src/agent/Core/SpawningKit/Handshake/Prepare.h",
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
@@ -6132,7 +6428,11 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -6149,138 +6449,179 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/DummySpawner.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
+ "src/agent/Core/Controller/StateInspection.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/ErrorRenderer.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/StrIntTools/Template.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Exceptions.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Journey.h",
+ "src/agent/Core/Controller/TurboCaching.h"=>
+  ["src/agent/Core/ResponseCache.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
@@ -6288,77 +6629,185 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Factory.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
+ "src/agent/Core/CoreMain.cpp"=>
+  ["src/agent/Core/AdminPanelConnector.h",
+   "src/agent/Core/ApiServer.h",
+   "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Config.h",
+   "src/agent/Core/ConfigChange.cpp",
+   "src/agent/Core/ConfigChange.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.cpp",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.cpp",
+   "src/agent/Core/EventLoopStallDetector.h",
+   "src/agent/Core/OptionParser.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SecurityUpdateChecker.h",
+   "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Handshake/Perform.h",
    "src/agent/Core/SpawningKit/Handshake/Prepare.h",
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/TelemetryCollector.h",
+   "src/agent/Shared/ApiAccountUtils.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/agent/Shared/ListenerHandoff.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
+   "src/cxx_supportlib/BackgroundEventLoop.cpp",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/SubComponentUtils.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/Autocast.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
@@ -6368,12 +6817,21 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -6386,84 +6844,125 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/agent/Core/CpuProfiler.cpp"=>
+  ["src/agent/Core/CpuProfiler.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp"],
+ "src/agent/Core/CpuProfiler.h"=>
+  [],
+ "src/agent/Core/EventLoopStallDetector.cpp"=>
+  ["src/agent/Core/EventLoopStallDetector.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Handshake/Perform.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+ "src/agent/Core/EventLoopStallDetector.h"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/OptionParser.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/JsonTools/Autocast.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ResponseCache.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Core/SecurityUpdateChecker.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -6479,19 +6978,19 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Handshake/Prepare.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+ "src/agent/Core/SpawningKit/Config.h"=>
+  ["src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h"=>
+  [],
+ "src/agent/Core/SpawningKit/Context.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
@@ -6503,7 +7002,6 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
@@ -6511,23 +7009,17 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
@@ -6539,15 +7031,23 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Handshake/Session.h"=>
+ "src/agent/Core/SpawningKit/DirectSpawner.h"=>
   ["src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -6561,6 +7061,7 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
@@ -6568,43 +7069,70 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Handshake/WorkDir.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Journey.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/agent/Core/SpawningKit/DummySpawner.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
@@ -6612,13 +7140,25 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -6627,48 +7167,67 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/PipeWatcher.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/agent/Core/SpawningKit/ErrorRenderer.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/StrIntTools/Template.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Result.h"=>
+ "src/agent/Core/SpawningKit/Exceptions.h"=>
   ["src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Journey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -6682,20 +7241,19 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -6704,12 +7262,12 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h"=>
-  [],
- "src/agent/Core/SpawningKit/SmartSpawner.h"=>
+ "src/agent/Core/SpawningKit/Factory.h"=>
   ["src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Handshake/Perform.h",
@@ -6720,6 +7278,7 @@
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
@@ -6785,15 +7344,39 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/Spawner.h"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+ "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/SpawningKit/Handshake/Perform.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -6815,32 +7398,53 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/SpawningKit/UserSwitchingRules.h"=>
-  ["src/agent/Core/SpawningKit/Context.h",
+ "src/agent/Core/SpawningKit/Handshake/Prepare.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
@@ -6860,17 +7464,23 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
@@ -6882,168 +7492,86 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/TelemetryCollector.h"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SpawningKit/Config.h",
+ "src/agent/Core/SpawningKit/Handshake/Session.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/ExecHelper/ExecHelperMain.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
+ "src/agent/Core/SpawningKit/Handshake/WorkDir.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/agent/FileReadHelper/FileReadHelperMain.cpp"=>
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/SpawningKit/Journey.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -7052,86 +7580,49 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/ApiAccountUtils.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+ "src/agent/Core/SpawningKit/JourneyStats.h"=>
+  ["src/agent/Core/SpawningKit/Journey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/ApiServerUtils.h"=>
-  ["src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+ "src/agent/Core/SpawningKit/PipeWatcher.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -7147,17 +7638,12 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/ApplicationPoolApiKey.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Fundamentals/AbortHandler.cpp"=>
-  ["src/agent/Shared/Fundamentals/AbortHandler.h",
-   "src/agent/Shared/Fundamentals/Utils.h",
+ "src/agent/Core/SpawningKit/Result.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -7170,49 +7656,57 @@
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Fundamentals/AbortHandler.h"=>
+ "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h"=>
   [],
- "src/agent/Shared/Fundamentals/Implementation.cpp"=>
-  ["src/agent/Shared/Fundamentals/AbortHandler.cpp",
-   "src/agent/Shared/Fundamentals/AbortHandler.h",
-   "src/agent/Shared/Fundamentals/Initialization.cpp",
-   "src/agent/Shared/Fundamentals/Initialization.h",
-   "src/agent/Shared/Fundamentals/Utils.cpp",
-   "src/agent/Shared/Fundamentals/Utils.h",
+ "src/agent/Core/SpawningKit/SmartSpawner.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -7226,27 +7720,39 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -7257,17 +7763,21 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Fundamentals/Initialization.cpp"=>
-  ["src/agent/Shared/Fundamentals/AbortHandler.h",
-   "src/agent/Shared/Fundamentals/Initialization.h",
-   "src/agent/Shared/Fundamentals/Utils.h",
+ "src/agent/Core/SpawningKit/Spawner.h"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -7281,14 +7791,15 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
@@ -7299,67 +7810,21 @@
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Fundamentals/Initialization.h"=>
-  ["src/agent/Shared/Fundamentals/AbortHandler.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Fundamentals/Utils.cpp"=>
-  ["src/agent/Shared/Fundamentals/Utils.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/agent/Shared/Fundamentals/Utils.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/agent/SpawnEnvSetupper/SpawnEnvSetupperMain.cpp"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
+ "src/agent/Core/SpawningKit/UserSwitchingRules.h"=>
+  ["src/agent/Core/SpawningKit/Context.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
@@ -7376,72 +7841,85 @@
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/SystemMetrics/SystemMetricsMain.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/TempDirToucher/TempDirToucherMain.cpp"=>
-  ["src/cxx_supportlib/Constants.h"],
- "src/agent/Watchdog/AgentWatcher.cpp"=>
-  [],
- "src/agent/Watchdog/ApiServer.h"=>
-  ["src/agent/Shared/ApiAccountUtils.h",
-   "src/agent/Shared/ApiServerUtils.h",
+ "src/agent/Core/TelemetryCollector.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
@@ -7451,20 +7929,27 @@
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
@@ -7472,7 +7957,9 @@
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
@@ -7486,16 +7973,34 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -7506,71 +8011,79 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Watchdog/Config.h"=>
-  ["src/agent/Core/AdminPanelConnector.h",
-   "src/agent/Core/ApiServer.h",
-   "src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Config.h",
-   "src/agent/Core/ConfigChange.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SecurityUpdateChecker.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/TelemetryCollector.h",
-   "src/agent/Shared/ApiAccountUtils.h",
-   "src/agent/Shared/ApiServerUtils.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/agent/Watchdog/ApiServer.h",
+ "src/agent/ExecHelper/ExecHelperMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/FileReadHelper/FileReadHelperMain.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Shared/ApiAccountUtils.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Shared/ApiServerUtils.h"=>
+  ["src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
@@ -7579,80 +8092,99 @@
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Shared/ApplicationPoolApiKey.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Shared/Fundamentals/AbortHandler.cpp"=>
+  ["src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Utils.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -7663,197 +8195,107 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Watchdog/CoreWatcher.cpp"=>
-  ["src/agent/Shared/Fundamentals/Utils.h",
+ "src/agent/Shared/Fundamentals/AbortHandler.h"=>
+  [],
+ "src/agent/Shared/Fundamentals/Implementation.cpp"=>
+  ["src/agent/Shared/Fundamentals/AbortHandler.cpp",
+   "src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.cpp",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/agent/Shared/Fundamentals/Utils.cpp",
+   "src/agent/Shared/Fundamentals/Utils.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Watchdog/InstanceDirToucher.cpp"=>
-  ["src/agent/Shared/Fundamentals/Utils.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/agent/Watchdog/WatchdogMain.cpp"=>
-  ["src/agent/Core/AdminPanelConnector.h",
-   "src/agent/Core/ApiServer.h",
-   "src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Config.h",
-   "src/agent/Core/ConfigChange.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/OptionParser.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SecurityUpdateChecker.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/TelemetryCollector.h",
-   "src/agent/Shared/ApiAccountUtils.h",
-   "src/agent/Shared/ApiServerUtils.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/agent/Shared/Fundamentals/AbortHandler.h",
+ "src/agent/Shared/Fundamentals/Initialization.cpp"=>
+  ["src/agent/Shared/Fundamentals/AbortHandler.h",
    "src/agent/Shared/Fundamentals/Initialization.h",
    "src/agent/Shared/Fundamentals/Utils.h",
-   "src/agent/Watchdog/AgentWatcher.cpp",
-   "src/agent/Watchdog/ApiServer.h",
-   "src/agent/Watchdog/Config.h",
-   "src/agent/Watchdog/CoreWatcher.cpp",
-   "src/agent/Watchdog/InstanceDirToucher.cpp",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
-   "src/cxx_supportlib/JsonTools/Autocast.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ContainerHelpers.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -7864,23 +8306,30 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Bucket.cpp"=>
-  ["src/apache2_module/Bucket.h",
+ "src/agent/Shared/Fundamentals/Initialization.h"=>
+  ["src/agent/Shared/Fundamentals/AbortHandler.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -7888,235 +8337,608 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Bucket.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+ "src/agent/Shared/Fundamentals/Utils.cpp"=>
+  ["src/agent/Shared/Fundamentals/Utils.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/CBindings.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/Hooks.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Shared/Fundamentals/Utils.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Shared/ListenerHandoff.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Config.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/AutoGeneratedDefinitions.cpp",
-   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
-   "src/apache2_module/ConfigGeneral/AutoGeneratedSetterFuncs.cpp",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
-   "src/apache2_module/ConfigGeneral/SetterFuncs.h",
-   "src/apache2_module/DirConfig/AutoGeneratedCreateFunction.cpp",
-   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/DirConfig/AutoGeneratedMergeFunction.cpp",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/Utils.h",
+ "src/agent/SpawnEnvSetupper/SpawnEnvSetupperMain.cpp"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/JsonTools/Autocast.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Config.h"=>
-  ["src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+ "src/agent/SystemMetrics/SystemMetricsMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/ConfigGeneral/AutoGeneratedDefinitions.cpp"=>
-  [],
- "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
-   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/Utils.h",
+ "src/agent/TempDirToucher/TempDirToucherMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h"],
+ "src/agent/Watchdog/AgentWatcher.cpp"=>
+  [],
+ "src/agent/Watchdog/ApiServer.h"=>
+  ["src/agent/Shared/ApiAccountUtils.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/ConfigGeneral/AutoGeneratedSetterFuncs.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+ "src/agent/Watchdog/Config.h"=>
+  ["src/agent/Core/AdminPanelConnector.h",
+   "src/agent/Core/ApiServer.h",
+   "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Config.h",
+   "src/agent/Core/ConfigChange.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SecurityUpdateChecker.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/TelemetryCollector.h",
+   "src/agent/Shared/ApiAccountUtils.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Watchdog/ApiServer.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/ConfigGeneral/Common.h"=>
-  [],
- "src/apache2_module/ConfigGeneral/ManifestGeneration.h"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
-   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/Utils.h",
+ "src/agent/Watchdog/CoreWatcher.cpp"=>
+  ["src/agent/Shared/Fundamentals/Utils.h",
+   "src/agent/Shared/ListenerHandoff.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/ConfigGeneral/SetterFuncs.h"=>
-  [],
- "src/apache2_module/DirConfig/AutoGeneratedCreateFunction.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
+ "src/agent/Watchdog/InstanceDirToucher.cpp"=>
+  ["src/agent/Shared/Fundamentals/Utils.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Watchdog/WatchdogMain.cpp"=>
+  ["src/agent/Core/AdminPanelConnector.h",
+   "src/agent/Core/ApiServer.h",
+   "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Config.h",
+   "src/agent/Core/ConfigChange.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.h",
+   "src/agent/Core/OptionParser.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SecurityUpdateChecker.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/TelemetryCollector.h",
+   "src/agent/Shared/ApiAccountUtils.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/agent/Shared/Fundamentals/Utils.h",
+   "src/agent/Shared/ListenerHandoff.h",
+   "src/agent/Watchdog/AgentWatcher.cpp",
+   "src/agent/Watchdog/ApiServer.h",
+   "src/agent/Watchdog/Config.h",
+   "src/agent/Watchdog/CoreWatcher.cpp",
+   "src/agent/Watchdog/InstanceDirToucher.cpp",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/Autocast.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ContainerHelpers.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/DirConfig/AutoGeneratedHeaderSerialization.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+ "src/apache2_module/Bucket.cpp"=>
+  ["src/apache2_module/Bucket.h",
+   "src/apache2_module/BucketState.h",
+   "src/apache2_module/ChunkedBodyDecoder.h",
+   "src/apache2_module/CoreConnectionPool.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -8124,28 +8946,22 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp"=>
-  ["src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
-   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
-   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/Utils.h",
+ "src/apache2_module/Bucket.h"=>
+  ["src/apache2_module/BucketState.h",
+   "src/apache2_module/ChunkedBodyDecoder.h",
+   "src/apache2_module/CoreConnectionPool.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -8153,11 +8969,35 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/DirConfig/AutoGeneratedMergeFunction.cpp"=>
+ "src/apache2_module/BucketState.h"=>
+  ["src/apache2_module/ChunkedBodyDecoder.h",
+   "src/apache2_module/CoreConnectionPool.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/CBindings.cpp"=>
   ["src/apache2_module/Config.h",
    "src/apache2_module/ConfigGeneral/Common.h",
    "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/Hooks.h",
    "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Constants.h",
@@ -8177,122 +9017,70 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/DirConfig/AutoGeneratedStruct.h"=>
-  ["src/apache2_module/ConfigGeneral/Common.h"],
- "src/apache2_module/DirectoryMapper.h"=>
+ "src/apache2_module/ChunkedBodyDecoder.h"=>
+  [],
+ "src/apache2_module/Config.cpp"=>
   ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/AutoGeneratedDefinitions.cpp",
+   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
+   "src/apache2_module/ConfigGeneral/AutoGeneratedSetterFuncs.cpp",
    "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
+   "src/apache2_module/ConfigGeneral/SetterFuncs.h",
+   "src/apache2_module/DirConfig/AutoGeneratedCreateFunction.cpp",
+   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/DirConfig/AutoGeneratedMergeFunction.cpp",
    "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
    "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/Utils.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/JsonTools/Autocast.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Hooks.cpp"=>
-  ["src/apache2_module/Bucket.h",
-   "src/apache2_module/Config.h",
-   "src/apache2_module/ConfigGeneral/Common.h",
-   "src/apache2_module/DirConfig/AutoGeneratedHeaderSerialization.cpp",
+ "src/apache2_module/Config.h"=>
+  ["src/apache2_module/ConfigGeneral/Common.h",
    "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/DirectoryMapper.h",
    "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
-   "src/apache2_module/Utils.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/AppTypeDetector/Detector.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/CBindings.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/ClassUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/WatchdogLauncher.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Hooks.h"=>
+ "src/apache2_module/ConfigGeneral/AutoGeneratedDefinitions.cpp"=>
   [],
- "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp"=>
+ "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp"=>
   ["src/apache2_module/Config.h",
    "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
    "src/apache2_module/ConfigGeneral/Common.h",
@@ -8321,112 +9109,73 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/ServerConfig/AutoGeneratedStruct.h"=>
-  ["src/apache2_module/ConfigGeneral/Common.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/apache2_module/Utils.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/apache2_module/mod_passenger.c"=>
-  [],
- "src/cxx_supportlib/Algorithms/Hasher.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h"],
- "src/cxx_supportlib/Algorithms/Hasher.h"=>
-  [],
- "src/cxx_supportlib/Algorithms/MovingAverage.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/AppLocalConfigFileUtils.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/apache2_module/ConfigGeneral/AutoGeneratedSetterFuncs.cpp"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/AppTypeDetector/CBindings.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/AppTypeDetector/CBindings.h",
-   "src/cxx_supportlib/AppTypeDetector/Detector.h",
+ "src/apache2_module/ConfigGeneral/Common.h"=>
+  [],
+ "src/apache2_module/ConfigGeneral/ManifestGeneration.h"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
+   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/Utils.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/WrapperRegistry/CBindings.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/AppTypeDetector/CBindings.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/WrapperRegistry/CBindings.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/AppTypeDetector/Detector.h"=>
+ "src/apache2_module/ConfigGeneral/SetterFuncs.h"=>
+  [],
+ "src/apache2_module/CoreConnectionPool.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -8435,59 +9184,44 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/BackgroundEventLoop.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
+ "src/apache2_module/DirConfig/AutoGeneratedCreateFunction.cpp"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/BackgroundEventLoop.h"=>
-  [],
- "src/cxx_supportlib/ConfigKit/AsyncUtils.h"=>
-  ["src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/Common.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/ConfigKit.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+ "src/apache2_module/DirConfig/AutoGeneratedHeaderSerialization.cpp"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -8496,31 +9230,27 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ConfigKit/DummyTranslator.h"=>
-  ["src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/PrefixTranslator.h"=>
-  ["src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/Schema.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+ "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
+   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/Utils.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -8529,23 +9259,21 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ConfigKit/SchemaUtils.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+ "src/apache2_module/DirConfig/AutoGeneratedMergeFunction.cpp"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -8554,207 +9282,148 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ConfigKit/Store.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+ "src/apache2_module/DirConfig/AutoGeneratedStruct.h"=>
+  ["src/apache2_module/ConfigGeneral/Common.h"],
+ "src/apache2_module/DirectoryMapper.h"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
+   "src/cxx_supportlib/AppTypeDetector/ResultCache.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ConfigKit/SubComponentUtils.h"=>
-  ["src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/TableTranslator.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/apache2_module/Hooks.cpp"=>
+  ["src/apache2_module/Bucket.h",
+   "src/apache2_module/BucketState.h",
+   "src/apache2_module/ChunkedBodyDecoder.h",
+   "src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/CoreConnectionPool.h",
+   "src/apache2_module/DirConfig/AutoGeneratedHeaderSerialization.cpp",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/DirectoryMapper.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/Utils.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
+   "src/cxx_supportlib/AppTypeDetector/ResultCache.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/Translator.h"=>
-  ["src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ConfigKit/Utils.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Constants.h"=>
-  [],
- "src/cxx_supportlib/DataStructures/HashMap.h"=>
-  [],
- "src/cxx_supportlib/DataStructures/HashedStaticString.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/DataStructures/LString.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/DataStructures/LString.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/DataStructures/StringKeyTable.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/DataStructures/StringMap.h"=>
-  ["src/cxx_supportlib/DataStructures/HashMap.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Exceptions.cpp"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Exceptions.h"=>
-  ["src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/FileDescriptor.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/FileTools/FileManip.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/CBindings.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/WatchdogLauncher.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/FileTools/FileManip.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/FileTools/LargeFiles.cpp"=>
-  ["src/cxx_supportlib/FileTools/LargeFiles.h"],
- "src/cxx_supportlib/FileTools/LargeFiles.h"=>
-  [],
- "src/cxx_supportlib/FileTools/PathManip.cpp"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/FileTools/PathManip.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/FileTools/PathManipCBindings.cpp"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/FileTools/PathManipCBindings.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/FileTools/PathManipCBindings.h"=>
+ "src/apache2_module/Hooks.h"=>
   [],
- "src/cxx_supportlib/FileTools/PathSecurityCheck.cpp"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/FileTools/PathSecurityCheck.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Hooks.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp"=>
+  ["src/apache2_module/Config.h",
+   "src/apache2_module/ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.cpp",
+   "src/apache2_module/ConfigGeneral/Common.h",
+   "src/apache2_module/ConfigGeneral/ManifestGeneration.h",
+   "src/apache2_module/DirConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/DirConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/ServerConfig/AutoGeneratedManifestGeneration.cpp",
+   "src/apache2_module/ServerConfig/AutoGeneratedStruct.h",
+   "src/apache2_module/Utils.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -8764,8 +9433,26 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/IOTools/BufferedIO.h"=>
+ "src/apache2_module/ServerConfig/AutoGeneratedStruct.h"=>
+  ["src/apache2_module/ConfigGeneral/Common.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/apache2_module/Utils.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/apache2_module/mod_passenger.c"=>
+  [],
+ "src/cxx_supportlib/Algorithms/Hasher.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h"],
+ "src/cxx_supportlib/Algorithms/Hasher.h"=>
+  [],
+ "src/cxx_supportlib/Algorithms/LatencyHistogram.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Algorithms/MovingAverage.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/AppLocalConfigFileUtils.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -8776,6 +9463,7 @@
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -8784,12 +9472,20 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/IOTools/IOUtils.cpp"=>
+ "src/cxx_supportlib/AppTypeDetector/CBindings.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/CBindings.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -8798,9 +9494,14 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
+   "src/cxx_supportlib/WrapperRegistry/CBindings.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -8809,40 +9510,75 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/IOTools/IOUtils.h"=>
+ "src/cxx_supportlib/AppTypeDetector/CBindings.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/WrapperRegistry/CBindings.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/AppTypeDetector/Detector.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/IOTools/MessageIO.h"=>
+ "src/cxx_supportlib/AppTypeDetector/ResultCache.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -8851,102 +9587,88 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/IOTools/MessageSerialization.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/InstanceDirectory.h"=>
+ "src/cxx_supportlib/BackgroundEventLoop.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Integrations/LibevJsonUtils.h"=>
+ "src/cxx_supportlib/BackgroundEventLoop.h"=>
   ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/JsonTools/Autocast.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/JsonTools/CBindings.cpp"=>
-  ["src/cxx_supportlib/JsonTools/Autocast.h",
-   "src/cxx_supportlib/JsonTools/CBindings.h",
+ "src/cxx_supportlib/ConfigKit/AsyncUtils.h"=>
+  ["src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/JsonTools/CBindings.h"=>
-  [],
- "src/cxx_supportlib/JsonTools/JsonUtils.h"=>
+ "src/cxx_supportlib/ConfigKit/Common.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ConfigKit/ConfigKit.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/LoggingKit/Assert.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
+ "src/cxx_supportlib/ConfigKit/DummyTranslator.h"=>
+  ["src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/LoggingKit/Config.h"=>
+ "src/cxx_supportlib/ConfigKit/PrefixTranslator.h"=>
+  ["src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ConfigKit/Schema.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
@@ -8966,10 +9688,9 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/LoggingKit/Context.h"=>
+ "src/cxx_supportlib/ConfigKit/SchemaUtils.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
@@ -8979,159 +9700,142 @@
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/LoggingKit/Forward.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/LoggingKit/Implementation.cpp"=>
+ "src/cxx_supportlib/ConfigKit/Store.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/LoggingKit/Logging.h"=>
+ "src/cxx_supportlib/ConfigKit/SubComponentUtils.h"=>
+  ["src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ConfigKit/TableTranslator.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/LoggingKit/LoggingKit.h"=>
+ "src/cxx_supportlib/ConfigKit/Translator.h"=>
+  ["src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ConfigKit/Utils.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Constants.h"=>
+  [],
+ "src/cxx_supportlib/DataStructures/HashMap.h"=>
+  [],
+ "src/cxx_supportlib/DataStructures/HashedStaticString.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/DataStructures/LString.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/LveLoggingDecorator.h"=>
+ "src/cxx_supportlib/DataStructures/LString.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/MemoryKit/mbuf.cpp"=>
+ "src/cxx_supportlib/DataStructures/StringKeyTable.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/DataStructures/StringMap.h"=>
+  ["src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Exceptions.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Exceptions.h"=>
+  ["src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/FileDescriptor.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/MemoryKit/mbuf.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/MemoryKit/palloc.cpp"=>
-  ["src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/MemoryKit/palloc.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ProcessManagement/Ruby.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ProcessManagement/Ruby.h"=>
-  [],
- "src/cxx_supportlib/ProcessManagement/Spawn.cpp"=>
+ "src/cxx_supportlib/FileTools/FileManip.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -9140,7 +9844,11 @@
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -9149,15 +9857,52 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ProcessManagement/Spawn.h"=>
+ "src/cxx_supportlib/FileTools/FileManip.h"=>
   ["src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ProcessManagement/Utils.cpp"=>
-  ["src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h"],
- "src/cxx_supportlib/ProcessManagement/Utils.h"=>
+ "src/cxx_supportlib/FileTools/LargeFiles.cpp"=>
+  ["src/cxx_supportlib/FileTools/LargeFiles.h"],
+ "src/cxx_supportlib/FileTools/LargeFiles.h"=>
   [],
- "src/cxx_supportlib/RandomGenerator.h"=>
+ "src/cxx_supportlib/FileTools/PathManip.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/FileTools/PathManip.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/FileTools/PathManipCBindings.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileTools/PathManipCBindings.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/FileTools/PathManipCBindings.h"=>
+  [],
+ "src/cxx_supportlib/FileTools/PathSecurityCheck.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/FileTools/PathSecurityCheck.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Hooks.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -9165,8 +9910,11 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -9174,54 +9922,62 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ResourceLocator.h"=>
-  ["src/cxx_supportlib/Constants.h",
+ "src/cxx_supportlib/IOTools/BufferedIO.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/SafeLibev.h"=>
+ "src/cxx_supportlib/IOTools/IOUtils.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/SecurityKit/Crypto.cpp"=>
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/IOTools/IOUtils.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -9231,14 +9987,8 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/SecurityKit/Crypto.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/SecurityKit/MemZeroGuard.h"=>
-  [],
- "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h"=>
+ "src/cxx_supportlib/IOTools/MessageIO.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9247,153 +9997,129 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Channel.h"=>
+ "src/cxx_supportlib/IOTools/MessageSerialization.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/InstanceDirectory.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Client.h"=>
+ "src/cxx_supportlib/Integrations/LibevJsonUtils.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/JsonTools/Autocast.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/JsonTools/CBindings.cpp"=>
+  ["src/cxx_supportlib/JsonTools/Autocast.h",
+   "src/cxx_supportlib/JsonTools/CBindings.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/JsonTools/CBindings.h"=>
+  [],
+ "src/cxx_supportlib/JsonTools/JsonUtils.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/ClientRef.h"=>
-  [],
- "src/cxx_supportlib/ServerKit/Config.h"=>
+ "src/cxx_supportlib/JsonTools/JsonWriter.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/LoggingKit/Assert.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/LoggingKit/Config.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -9402,7 +10128,7 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Context.h"=>
+ "src/cxx_supportlib/LoggingKit/Context.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9411,30 +10137,18 @@
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -9450,20 +10164,10 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/CookieUtils.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/Errors.h"=>
-  ["src/cxx_supportlib/ServerKit/http_parser.h"],
- "src/cxx_supportlib/ServerKit/FdSinkChannel.h"=>
+ "src/cxx_supportlib/LoggingKit/Forward.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/LoggingKit/Implementation.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9476,29 +10180,18 @@
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -9514,42 +10207,211 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/FdSourceChannel.h"=>
+ "src/cxx_supportlib/LoggingKit/Logging.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/LoggingKit/LoggingKit.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/LveLoggingDecorator.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MemoryKit/mbuf.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/MemoryKit/mbuf.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MemoryKit/palloc.cpp"=>
+  ["src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MemoryKit/palloc.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ProcessManagement/Ruby.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ProcessManagement/Ruby.h"=>
+  [],
+ "src/cxx_supportlib/ProcessManagement/Spawn.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ProcessManagement/Spawn.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ProcessManagement/Utils.cpp"=>
+  ["src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h"],
+ "src/cxx_supportlib/ProcessManagement/Utils.h"=>
+  [],
+ "src/cxx_supportlib/RandomGenerator.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ResourceLocator.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/SafeLibev.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/SecurityKit/Crypto.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/SecurityKit/Crypto.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/SecurityKit/MemZeroGuard.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -9565,7 +10427,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/FileBufferedChannel.h"=>
+ "src/cxx_supportlib/ServerKit/Channel.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9590,12 +10452,10 @@
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9618,7 +10478,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h"=>
+ "src/cxx_supportlib/ServerKit/Client.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9647,8 +10507,11 @@
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9672,27 +10535,38 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HeaderTable.h"=>
+ "src/cxx_supportlib/ServerKit/ClientRef.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/Config.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/Hooks.h"=>
-  [],
- "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h"=>
-  ["src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h"],
- "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h"=>
-  [],
- "src/cxx_supportlib/ServerKit/HttpClient.h"=>
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/Context.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9703,7 +10577,6 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9716,23 +10589,75 @@
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/CookieUtils.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/Errors.h"=>
+  ["src/cxx_supportlib/ServerKit/http_parser.h"],
+ "src/cxx_supportlib/ServerKit/FdSinkChannel.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9755,7 +10680,7 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HttpHeaderParser.h"=>
+ "src/cxx_supportlib/ServerKit/FdSourceChannel.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9766,7 +10691,6 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9779,23 +10703,13 @@
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9818,18 +10732,61 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h"=>
+ "src/cxx_supportlib/ServerKit/FileBufferedChannel.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/HttpRequest.h"=>
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -9840,7 +10797,6 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9853,21 +10809,15 @@
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9891,11 +10841,28 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HttpRequestRef.h"=>
+ "src/cxx_supportlib/ServerKit/HeaderTable.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/Hooks.h"=>
   [],
- "src/cxx_supportlib/ServerKit/HttpServer.h"=>
+ "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h"=>
+  ["src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h"],
+ "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/HttpClient.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -9912,7 +10879,6 @@
    "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -9924,7 +10890,6 @@
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
@@ -9933,21 +10898,16 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -9965,14 +10925,8 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Implementation.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/Server.h"=>
+ "src/cxx_supportlib/ServerKit/HttpHeaderParser.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -9982,6 +10936,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9994,18 +10949,23 @@
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -10029,30 +10989,266 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/http_parser.cpp"=>
-  ["src/cxx_supportlib/ServerKit/http_parser.h"],
- "src/cxx_supportlib/ServerKit/http_parser.h"=>
-  [],
- "src/cxx_supportlib/StaticString.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/StrIntTools/DateParsing.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/StrIntTools/StrIntUtils.cpp"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/StrIntTools/StrIntUtils.h"=>
-  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/StrIntTools/StrIntUtilsNoStrictAliasing.cpp"=>
+ "src/cxx_supportlib/ServerKit/HttpRequest.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/HttpRequestRef.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/HttpServer.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/Implementation.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/IoUring.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/RequestPoolSizer.h"=>
+  ["src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/Server.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/http_parser.cpp"=>
+  ["src/cxx_supportlib/ServerKit/http_parser.h"],
+ "src/cxx_supportlib/ServerKit/http_parser.h"=>
+  [],
+ "src/cxx_supportlib/StaticString.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/StrIntTools/DateParsing.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/StrIntTools/StrIntUtils.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/StrIntTools/StrIntUtils.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/StrIntTools/StrIntUtilsNoStrictAliasing.cpp"=>
   ["src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
@@ -10254,6 +11450,10 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/OpenMetrics.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/Utils/OptionParsing.h"=>
   [],
  "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h"=>
@@ -10272,6 +11472,20 @@
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/cxx_supportlib/Utils/SpeedMeter.h"=>
   ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -10610,7 +11824,8 @@
    "src/nginx_module/LocationConfig/AutoGeneratedStruct.h",
    "src/nginx_module/MainConfig/AutoGeneratedCreateFunction.c",
    "src/nginx_module/MainConfig/AutoGeneratedManifestGeneration.c",
-   "src/nginx_module/MainConfig/AutoGeneratedStruct.h"],
+   "src/nginx_module/MainConfig/AutoGeneratedStruct.h",
+   "src/nginx_module/UpstreamKeepalive.h"],
  "src/nginx_module/Configuration.h"=>
   ["src/nginx_module/LocationConfig/AutoGeneratedStruct.h",
    "src/nginx_module/MainConfig/AutoGeneratedStruct.h"],
@@ -10627,7 +11842,8 @@
    "src/nginx_module/ContentHandler.h",
    "src/nginx_module/LocationConfig/AutoGeneratedStruct.h",
    "src/nginx_module/MainConfig/AutoGeneratedStruct.h",
-   "src/nginx_module/StaticContentHandler.h"],
+   "src/nginx_module/StaticContentHandler.h",
+   "src/nginx_module/UpstreamKeepalive.h"],
  "src/nginx_module/ContentHandler.h"=>
   ["src/cxx_supportlib/AppTypeDetector/CBindings.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -10659,6 +11875,20 @@
   ["src/nginx_module/StaticContentHandler.h"],
  "src/nginx_module/StaticContentHandler.h"=>
   [],
+ "src/nginx_module/UpstreamKeepalive.c"=>
+  ["src/cxx_supportlib/AppTypeDetector/CBindings.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/WrapperRegistry/CBindings.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "src/nginx_module/Configuration.h",
+   "src/nginx_module/ContentHandler.h",
+   "src/nginx_module/LocationConfig/AutoGeneratedStruct.h",
+   "src/nginx_module/MainConfig/AutoGeneratedStruct.h",
+   "src/nginx_module/UpstreamKeepalive.h"],
+ "src/nginx_module/UpstreamKeepalive.h"=>
+  [],
  "src/nginx_module/ngx_http_passenger_module.c"=>
   ["src/cxx_supportlib/AppTypeDetector/CBindings.h",
    "src/cxx_supportlib/Constants.h",
@@ -10742,6 +11972,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Config.h",
    "src/agent/Core/ConfigChange.h",
@@ -10749,8 +11980,14 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/CpuProfiler.h",
+   "src/agent/Core/EventLoopStallDetector.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SecurityUpdateChecker.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -10766,6 +12003,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -10779,97 +12017,750 @@
    "src/agent/Watchdog/ApiServer.h",
    "src/agent/Watchdog/Config.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Ruby.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "test/bench/BenchMain.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
-   "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "test/bench/micro/AlgorithmsBench.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/bench/micro/Corpus.h",
+   "test/bench/micro/MicroBench.h"],
+ "test/bench/micro/Corpus.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "test/bench/micro/DataStructuresBench.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/bench/micro/Corpus.h",
+   "test/bench/micro/MicroBench.h"],
+ "test/bench/micro/MemoryKitBench.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/bench/micro/MicroBench.h"],
+ "test/bench/micro/MicroBench.h"=>
+  [],
+ "test/bench/micro/MicroBenchMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/bench/micro/MicroBench.h"],
+ "test/bench/micro/ResponseCacheBench.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/bench/micro/MicroBench.h"],
+ "test/bench/micro/ServerKitBench.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.cpp",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/bench/micro/Corpus.h",
+   "test/bench/micro/MicroBench.h"],
+ "test/bench/micro/StrIntToolsBench.cpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/bench/micro/Corpus.h",
+   "test/bench/micro/MicroBench.h"],
+ "test/cxx/Algorithms/LatencyHistogramTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Apache2Module/BucketStateTest.cpp"=>
+  ["src/apache2_module/BucketState.h",
+   "src/apache2_module/ChunkedBodyDecoder.h",
+   "src/apache2_module/CoreConnectionPool.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Apache2Module/ChunkedBodyDecoderTest.cpp"=>
+  ["src/apache2_module/ChunkedBodyDecoder.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Apache2Module/CoreConnectionPoolTest.cpp"=>
+  ["src/apache2_module/CoreConnectionPool.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/AppTypeDetector/ResultCacheTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
+   "src/cxx_supportlib/AppTypeDetector/ResultCache.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/ProcessManagement/Ruby.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WebSocketCommandReverseServer.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -10882,12 +12773,13 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
  "test/cxx/Base64DecodingTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -10958,6 +12850,7 @@
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ShardedCachedFileStat.hpp",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -11373,6 +13266,7 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -11387,6 +13281,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -11395,6 +13290,8 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -11418,6 +13315,7 @@
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Config.h",
    "src/cxx_supportlib/LoggingKit/Context.h",
@@ -11445,6 +13343,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -11581,13 +13480,18 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/ApplicationPool/TestSession.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -11603,6 +13507,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -11611,6 +13516,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -11638,6 +13544,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -11649,53 +13556,187 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/CpuProfilerTest.cpp"=>
+  ["src/agent/Core/CpuProfiler.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/EventLoopStallDetectorTest.cpp"=>
+  ["src/agent/Core/EventLoopStallDetector.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/RequestTracingTest.cpp"=>
+  ["src/agent/Core/Controller/RequestTracing.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -11706,7 +13747,6 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -11725,10 +13765,14 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -11743,6 +13787,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -11751,6 +13796,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -11777,6 +13823,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -11811,6 +13858,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -11829,6 +13878,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -12188,7 +14238,9 @@
    "test/tut/tut.h"],
  "test/cxx/Core/SpawningKit/JourneyTest.cpp"=>
   ["src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
@@ -12395,12 +14447,17 @@
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/ConfigSnapshot.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/RequestTracing.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -12416,6 +14473,7 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/JourneyStats.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
@@ -12425,6 +14483,7 @@
    "src/agent/Core/TelemetryCollector.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -12452,6 +14511,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -12486,6 +14546,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -12505,6 +14567,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -13066,6 +15129,49 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
+ "test/cxx/JsonTools/JsonWriterTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
  "test/cxx/MemoryKit/MbufTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -13196,6 +15302,49 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
+ "test/cxx/OpenMetricsTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/OpenMetrics.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
  "test/cxx/ServerKit/ChannelTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -13232,6 +15381,7 @@
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13342,6 +15492,7 @@
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -13417,6 +15568,7 @@
    "test/tut/tut.h"],
  "test/cxx/ServerKit/HttpServerTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -13440,6 +15592,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -13471,6 +15624,8 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -13500,6 +15655,51 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
+ "test/cxx/ServerKit/RequestPoolSizerTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ServerKit/RequestPoolSizer.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
  "test/cxx/ServerKit/ServerTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
@@ -13522,6 +15722,7 @@
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonWriter.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -13543,6 +15744,7 @@
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/IoUring.h",
    "src/cxx_supportlib/ServerKit/Server.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
@@ -13571,6 +15773,52 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
+ "test/cxx/Shared/ListenerHandoffTest.cpp"=>
+  ["src/agent/Shared/ListenerHandoff.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
  "test/cxx/SpawnEnvSetupperTest.cpp"=>
   ["src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
@@ -14035,6 +16283,53 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
+ "test/cxx/Watchdog/AgentWatcherTest.cpp"=>
+  ["src/agent/Watchdog/AgentWatcher.cpp",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
  "test/oxt/backtrace_test.cpp"=>
   ["src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
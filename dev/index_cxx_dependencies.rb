@@ -13,6 +13,7 @@
 SCAN_FILES = Dir[
   "src/**/*.{c,cpp,h,hpp}",
   "test/oxt/**/*.{c,cpp,h,hpp}",
+  "test/bench/**/*.{c,cpp,h,hpp}",
   "test/cxx/**/*.{c,cpp,h,hpp}"
 ]
 EXCLUDE_FILES = Dir[
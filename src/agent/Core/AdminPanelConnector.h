@@ -53,6 +53,7 @@
 #include <IOTools/IOUtils.h>
 #include <Utils/AsyncSignalSafeUtils.h>
 #include <LoggingKit/Context.h>
+#include <JsonTools/JsonWriter.h>
 
 #include <jsoncpp/json.h>
 
@@ -314,14 +315,24 @@ private:
 	}
 
 	bool onGetGlobalStatistics(const ConnectionPtr &conn, const Json::Value &doc) {
-		Json::Value reply;
-		reply["result"] = "ok";
-		reply["request_id"] = doc["request_id"];
-		reply["data"]["message"] = Json::arrayValue;
-
+		string reply;
+		JsonWriter writer(reply);
+
+		writer.beginObject();
+		writer.key("result");
+		writer.value("ok");
+		writer.key("request_id");
+		writer.value(doc["request_id"]);
+		writer.key("data");
+		writer.beginObject();
+		writer.key("message");
+		writer.beginArray();
 		for (unsigned int i = 0; i < controllers.size(); i++) {
-			reply["data"]["message"].append(controllers[i]->inspectStateAsJson());
+			controllers[i]->writeStateAsJson(writer);
 		}
+		writer.endArray();
+		writer.endObject();
+		writer.endObject();
 
 		sendJsonReply(conn, reply);
 		return true;
@@ -333,6 +344,7 @@ private:
 		Json::Value args(Json::objectValue), reply;
 		ApplicationPool2::Pool::ToJsonOptions inspectOptions =
 			ApplicationPool2::Pool::ToJsonOptions::makeAuthorized();
+		inspectOptions.maxSnapshotAge = ApplicationPool2::Pool::POLLING_SNAPSHOT_MAX_AGE;
 
 		if (doc.isMember("arguments")) {
 			ConfigKit::Store store(argumentsSchema);
@@ -350,11 +362,21 @@ private:
 			}
 		}
 
-		reply["result"] = "ok";
-		reply["request_id"] = doc["request_id"];
-		reply["data"]["applications"] = appPool->inspectPropertiesInAdminPanelFormat(
-			inspectOptions);
-		sendJsonReply(conn, reply);
+		string replyStr;
+		JsonWriter writer(replyStr);
+		writer.beginObject();
+		writer.key("result");
+		writer.value("ok");
+		writer.key("request_id");
+		writer.value(doc["request_id"]);
+		writer.key("data");
+		writer.beginObject();
+		writer.key("applications");
+		appPool->writePropertiesInAdminPanelFormat(writer, inspectOptions);
+		writer.endObject();
+		writer.endObject();
+
+		sendJsonReply(conn, replyStr);
 		return true;
 	}
 
@@ -573,6 +595,12 @@ private:
 		conn->send(str);
 	}
 
+	/** Sends a reply that is already serialized with a JsonWriter. */
+	void sendJsonReply(const ConnectionPtr &conn, const string &str) {
+		WCRS_DEBUG_FRAME(&server, "Replying with:", str);
+		conn->send(str);
+	}
+
 	void readInstanceDirProperties(const string &instanceDir) {
 		Json::Value doc;
 		Json::Reader reader;
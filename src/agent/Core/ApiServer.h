@@ -28,6 +28,7 @@
 
 #include <boost/config.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/function.hpp>
 #include <boost/regex.hpp>
 #include <oxt/thread.hpp>
 #include <string>
@@ -39,11 +40,16 @@
 #include <modp_b64.h>
 
 #include <Core/Controller.h>
+#include <Core/Controller/LatencyStats.h>
+#include <Core/Controller/RequestTracing.h>
 #include <Core/ConfigChange.h>
+#include <Core/CpuProfiler.h>
+#include <Core/EventLoopStallDetector.h>
 #include <Core/ApplicationPool/Pool.h>
 #include <Shared/ApiServerUtils.h>
 #include <Shared/ApiAccountUtils.h>
 #include <ServerKit/HttpServer.h>
+#include <JsonTools/JsonWriter.h>
 #include <DataStructures/LString.h>
 #include <Exceptions.h>
 #include <StaticString.h>
@@ -53,6 +59,7 @@
 #include <IOTools/BufferedIO.h>
 #include <IOTools/MessageIO.h>
 #include <StrIntTools/StrIntUtils.h>
+#include <Utils/OpenMetrics.h>
 
 namespace Passenger {
 namespace Core {
@@ -116,7 +123,14 @@ public:
 	Json::Value jsonBody;
 	Authorization authorization;
 	unsigned int controllerStatesGathered;
-	vector<Json::Value> controllerStates;
+	// Serialized JSON documents, one per Controller.
+	vector<string> controllerStates;
+	LatencyStatsSnapshotPtr latencyStats;
+	RequestTraceSnapshotPtr requestTraces;
+	unsigned int requestTraceLimit;
+	bool chromeTraceFormat;
+	CpuProfilerPtr cpuProfiler;
+	bool foldedStacksFormat;
 
 	DEFINE_SERVER_KIT_BASE_HTTP_REQUEST_FOOTER(Passenger::Core::ApiServer::Request);
 };
@@ -129,7 +143,18 @@ public:
 
 	typedef Passenger::Core::ApiServer::ConfigChangeRequest ConfigChangeRequest;
 
+	/**
+	 * Called on a Controller's thread with the Controller and its index.
+	 * Returns a function that stores the gathered result in the request.
+	 */
+	typedef boost::function<boost::function<void ()> (Controller *, unsigned int)>
+		ControllerGatherFunction;
+	typedef boost::function<void (Client *, Request *)> ControllerGatherFinishFunction;
+
 private:
+	// About 7 MB worth of CpuProfiler samples.
+	static const unsigned int MAX_CPU_PROFILE_SAMPLES = 16384;
+
 	ApiAccountUtils::ApiAccountDatabase apiAccountDatabase;
 	boost::regex serverConnectionPath;
 
@@ -157,12 +182,22 @@ private:
 	void route(Client *client, Request *req, const StaticString &path) {
 		if (path == P_STATIC_STRING("/server.json")) {
 			processServerStatus(client, req);
+		} else if (path == P_STATIC_STRING("/server/latency.json")) {
+			processServerLatency(client, req);
+		} else if (path == P_STATIC_STRING("/server/traces.json")) {
+			processServerTraces(client, req);
+		} else if (path == P_STATIC_STRING("/server/profile.json")) {
+			processServerProfile(client, req);
+		} else if (path == P_STATIC_STRING("/metrics")) {
+			processMetrics(client, req);
 		} else if (regex_match(path, serverConnectionPath)) {
 			processServerConnectionOperation(client, req);
 		} else if (path == P_STATIC_STRING("/pool.xml")) {
 			processPoolStatusXml(client, req);
 		} else if (path == P_STATIC_STRING("/pool.txt")) {
 			processPoolStatusTxt(client, req);
+		} else if (path == P_STATIC_STRING("/pool/spawn_stats.json")) {
+			processPoolSpawnStats(client, req);
 		} else if (path == P_STATIC_STRING("/pool/restart_app_group.json")) {
 			processPoolRestartAppGroup(client, req);
 		} else if (path == P_STATIC_STRING("/pool/detach_process.json")) {
@@ -233,16 +268,35 @@ private:
 		}
 	}
 
-	void gatherControllerState(Client *client, Request *req,
-		Controller *controller, unsigned int i)
+	/**
+	 * Calls `gather` on every Controller's thread. `gather` returns a function
+	 * that stores its result in the request, which is called on this server's
+	 * thread. Once all Controllers' results are stored, `finish` is called to
+	 * respond, after which the request is ended.
+	 */
+	void gatherFromControllers(Client *client, Request *req,
+		const ControllerGatherFunction &gather,
+		const ControllerGatherFinishFunction &finish)
 	{
-		Json::Value state = controller->inspectStateAsJson();
-		getContext()->libev->runLater(boost::bind(&ApiServer::controllerStateGathered,
-			this, client, req, i, state));
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			refRequest(req, __FILE__, __LINE__);
+			controllers[i]->getContext()->libev->runLater(boost::bind(
+				&ApiServer::gatherFromController, this,
+				client, req, i, gather, finish));
+		}
 	}
 
-	void controllerStateGathered(Client *client, Request *req,
-		unsigned int i, Json::Value state)
+	void gatherFromController(Client *client, Request *req, unsigned int i,
+		ControllerGatherFunction gather, ControllerGatherFinishFunction finish)
+	{
+		boost::function<void ()> store = gather(controllers[i], i);
+		getContext()->libev->runLater(boost::bind(
+			&ApiServer::gatheredFromController, this,
+			client, req, store, finish));
+	}
+
+	void gatheredFromController(Client *client, Request *req,
+		boost::function<void ()> store, ControllerGatherFinishFunction finish)
 	{
 		if (req->ended()) {
 			unrefRequest(req, __FILE__, __LINE__);
@@ -250,22 +304,10 @@ private:
 		}
 
 		req->controllerStatesGathered++;
-		req->controllerStates[i] = state;
+		store();
 
 		if (req->controllerStatesGathered == controllers.size()) {
-			HeaderTable headers;
-			headers.insert(req->pool, "Content-Type", "application/json");
-
-			Json::Value response;
-			response["threads"] = (Json::UInt) controllers.size();
-
-			for (unsigned int i = 0; i < controllers.size(); i++) {
-				string key = "thread" + toString(i + 1);
-				response[key] = req->controllerStates[i];
-			}
-
-			writeSimpleResponse(client, 200, &headers,
-				psg_pstrdup(req->pool, response.toStyledString()));
+			finish(client, req);
 			if (!req->ended()) {
 				Request *req2 = req;
 				endRequest(&client, &req2);
@@ -275,14 +317,380 @@ private:
 		unrefRequest(req, __FILE__, __LINE__);
 	}
 
+	static void storeControllerState(Request *req, unsigned int i,
+		boost::shared_ptr<string> state)
+	{
+		req->controllerStates[i].swap(*state);
+	}
+
+	static boost::function<void ()> gatherControllerState(Request *req,
+		Controller *controller, unsigned int i)
+	{
+		// Serialized on the Controller's thread, one client at a time,
+		// so that we never hold all client states in memory as a tree.
+		boost::shared_ptr<string> state = boost::make_shared<string>();
+		JsonWriter writer(*state, true);
+		controller->writeStateAsJson(writer);
+		return boost::bind(storeControllerState, req, i, state);
+	}
+
+	void respondWithControllerStates(Client *client, Request *req) {
+		HeaderTable headers;
+		headers.insert(req->pool, "Content-Type", "application/json");
+
+		string body;
+		JsonWriter writer(body, true);
+		body.reserve(totalControllerStatesSize(req) + 16 * controllers.size() + 16);
+		writer.beginObject();
+		writer.key("threads");
+		writer.value((unsigned int) controllers.size());
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			writer.key("thread" + toString(i + 1));
+			writer.rawValue(req->controllerStates[i]);
+		}
+		writer.endObject();
+
+		writeSimpleResponse(client, 200, &headers,
+			psg_pstrdup(req->pool, body));
+	}
+
+	size_t totalControllerStatesSize(const Request *req) const {
+		size_t result = 0;
+		for (unsigned int i = 0; i < req->controllerStates.size(); i++) {
+			result += req->controllerStates[i].size();
+		}
+		return result;
+	}
+
 	void processServerStatus(Client *client, Request *req) {
 		if (authorizeStateInspectionOperation(this, client, req)) {
 			req->controllerStates.resize(controllers.size());
-			for (unsigned int i = 0; i < controllers.size(); i++) {
-				refRequest(req, __FILE__, __LINE__);
-				controllers[i]->getContext()->libev->runLater(boost::bind(
-					&ApiServer::gatherControllerState, this,
-					client, req, controllers[i], i));
+			gatherFromControllers(client, req,
+				boost::bind(gatherControllerState, req,
+					boost::placeholders::_1, boost::placeholders::_2),
+				boost::bind(&ApiServer::respondWithControllerStates, this,
+					boost::placeholders::_1, boost::placeholders::_2));
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
+	static void mergeLatencyStats(Request *req, LatencyStatsSnapshotPtr snapshot) {
+		req->latencyStats->merge(*snapshot);
+	}
+
+	static boost::function<void ()> gatherControllerLatencyStats(Request *req,
+		Controller *controller)
+	{
+		LatencyStatsSnapshotPtr snapshot = boost::make_shared<LatencyStatsSnapshot>();
+		controller->snapshotLatencyStats(*snapshot);
+		return boost::bind(mergeLatencyStats, req, snapshot);
+	}
+
+	void respondWithLatencyStats(Client *client, Request *req) {
+		HeaderTable headers;
+		headers.insert(req->pool, "Content-Type", "application/json");
+
+		Json::Value response = req->latencyStats->inspectAsJson();
+		response["threads"] = (Json::UInt) controllers.size();
+
+		writeSimpleResponse(client, 200, &headers,
+			psg_pstrdup(req->pool, response.toStyledString()));
+	}
+
+	/**
+	 * Responds with the request phase latency histograms of all
+	 * Controller threads, merged, overall and per app group.
+	 */
+	void processServerLatency(Client *client, Request *req) {
+		if (authorizeStateInspectionOperation(this, client, req)) {
+			req->latencyStats = boost::make_shared<LatencyStatsSnapshot>();
+			gatherFromControllers(client, req,
+				boost::bind(gatherControllerLatencyStats, req,
+					boost::placeholders::_1),
+				boost::bind(&ApiServer::respondWithLatencyStats, this,
+					boost::placeholders::_1, boost::placeholders::_2));
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
+	static void addRequestTraces(Request *req, unsigned int threadNumber,
+		boost::shared_ptr< vector<RequestTraceEvent> > events)
+	{
+		req->requestTraces->add(threadNumber, *events);
+	}
+
+	static boost::function<void ()> gatherControllerRequestTraces(Request *req,
+		Controller *controller)
+	{
+		boost::shared_ptr< vector<RequestTraceEvent> > events =
+			boost::make_shared< vector<RequestTraceEvent> >();
+		controller->copyRequestTraceEvents(*events);
+		return boost::bind(addRequestTraces, req, controller->getThreadNumber(),
+			events);
+	}
+
+	void respondWithRequestTraces(Client *client, Request *req) {
+		HeaderTable headers;
+		headers.insert(req->pool, "Content-Type", "application/json");
+
+		Json::Value response;
+		req->requestTraces->keepMostRecent(req->requestTraceLimit);
+		if (req->chromeTraceFormat) {
+			response = req->requestTraces->inspectAsChromeTrace();
+		} else {
+			response = req->requestTraces->inspectAsJson();
+		}
+
+		writeSimpleResponse(client, 200, &headers,
+			psg_pstrdup(req->pool, response.toStyledString()));
+	}
+
+	/**
+	 * Responds with the most recently finished requests in the request
+	 * trace flight recorders of all Controller threads. Accepts the query
+	 * parameters `limit` (default 100), `min_duration` (in microseconds,
+	 * default 0) and `format` ("json" or "chrome", default "json").
+	 */
+	void processServerTraces(Client *client, Request *req) {
+		if (authorizeStateInspectionOperation(this, client, req)) {
+			VariantMap params = parseQueryString(req->getQueryString());
+			string format = params.get("format", false, "json");
+
+			if (format != "json" && format != "chrome") {
+				apiServerRespondWith422(this, client, req,
+					"The 'format' parameter must be either 'json' or 'chrome'");
+				return;
+			}
+
+			req->requestTraces = boost::make_shared<RequestTraceSnapshot>(
+				params.getULL("min_duration", false, 0));
+			req->requestTraceLimit = params.getUint("limit", false, 100);
+			req->chromeTraceFormat = format == "chrome";
+			gatherFromControllers(client, req,
+				boost::bind(gatherControllerRequestTraces, req,
+					boost::placeholders::_1),
+				boost::bind(&ApiServer::respondWithRequestTraces, this,
+					boost::placeholders::_1, boost::placeholders::_2));
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
+	/**
+	 * Samples the CPU usage of all threads in this process and responds
+	 * with the folded stacks, for use in flame graphs. Accepts the query
+	 * parameters `seconds` (default 10, at most 60), `frequency` (samples
+	 * per second of CPU time, default 99, at most 1000) and `format`
+	 * ("json" or "folded", default "json"). The "folded" format is plain
+	 * text that can be piped into flamegraph.pl directly.
+	 */
+	void processServerProfile(Client *client, Request *req) {
+		if (!authorizeAdminOperation(this, client, req)) {
+			apiServerRespondWith401(this, client, req);
+			return;
+		}
+
+		VariantMap params = parseQueryString(req->getQueryString());
+		unsigned int seconds = params.getUint("seconds", false, 10);
+		unsigned int frequency = params.getUint("frequency", false, 99);
+		string format = params.get("format", false, "json");
+
+		if (seconds < 1 || seconds > 60) {
+			apiServerRespondWith422(this, client, req,
+				"The 'seconds' parameter must be between 1 and 60");
+			return;
+		} else if (frequency < 1 || frequency > 1000) {
+			apiServerRespondWith422(this, client, req,
+				"The 'frequency' parameter must be between 1 and 1000");
+			return;
+		} else if (format != "json" && format != "folded") {
+			apiServerRespondWith422(this, client, req,
+				"The 'format' parameter must be either 'json' or 'folded'");
+			return;
+		}
+
+		// Enough room for all CPUs being busy the entire time.
+		unsigned int maxSamples = seconds * frequency
+			* std::max(boost::thread::hardware_concurrency(), 1u);
+		if (maxSamples > MAX_CPU_PROFILE_SAMPLES) {
+			maxSamples = MAX_CPU_PROFILE_SAMPLES;
+		}
+		req->cpuProfiler = boost::make_shared<CpuProfiler>(frequency, maxSamples);
+		if (!req->cpuProfiler->start()) {
+			req->cpuProfiler.reset();
+			apiServerRespondWith409(this, client, req,
+				"Another CPU profile is already being taken");
+			return;
+		}
+
+		SKC_NOTICE(client, "Taking a CPU profile of " << seconds
+			<< " seconds at " << frequency << " Hz");
+		req->foldedStacksFormat = format == "folded";
+		refRequest(req, __FILE__, __LINE__);
+		getContext()->libev->runAfter(seconds * 1000,
+			boost::bind(&ApiServer::cpuProfileFinished, this, client, req));
+	}
+
+	void cpuProfileFinished(Client *client, Request *req) {
+		if (req->ended()) {
+			unrefRequest(req, __FILE__, __LINE__);
+			return;
+		}
+
+		HeaderTable headers;
+		string body;
+
+		req->cpuProfiler->stop();
+		if (req->foldedStacksFormat) {
+			headers.insert(req->pool, "Content-Type", "text/plain; charset=utf-8");
+			body = req->cpuProfiler->formatFoldedStacks();
+		} else {
+			headers.insert(req->pool, "Content-Type", "application/json");
+			body = req->cpuProfiler->inspectAsJson().toStyledString();
+		}
+		req->cpuProfiler.reset();
+
+		writeSimpleResponse(client, 200, &headers, psg_pstrdup(req->pool, body));
+		if (!req->ended()) {
+			Request *req2 = req;
+			endRequest(&client, &req2);
+		}
+
+		unrefRequest(req, __FILE__, __LINE__);
+	}
+
+	void writeControllerMetric(OpenMetricsWriter &writer, const StaticString &family,
+		const StaticString &type, const StaticString &help,
+		MetricCounter ControllerMetrics::*counter)
+	{
+		writer.declare(family, type, help);
+		string name = family.toString() + "_total";
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			writer.sample(name, (controllers[i]->metrics.*counter).get(),
+				"thread", toString(controllers[i]->getThreadNumber()));
+		}
+	}
+
+	void writeControllerMetric(OpenMetricsWriter &writer, const StaticString &name,
+		const StaticString &help, MetricGauge ControllerMetrics::*gauge)
+	{
+		writer.declare(name, "gauge", help);
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			writer.sample(name, (controllers[i]->metrics.*gauge).get(),
+				"thread", toString(controllers[i]->getThreadNumber()));
+		}
+	}
+
+	void writeControllerMetrics(OpenMetricsWriter &writer) {
+		writeControllerMetric(writer, "passenger_requests", "counter",
+			"Number of requests received.",
+			&ControllerMetrics::requestsBegun);
+		writer.declare("passenger_requests_in_progress", "gauge",
+			"Number of requests currently being handled.");
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			const ControllerMetrics &metrics = controllers[i]->metrics;
+			// The counters are read independently of each other, so `finished`
+			// may be ahead of `begun`.
+			boost::uint64_t begun = metrics.requestsBegun.get();
+			boost::uint64_t finished = metrics.requestsFinished.get();
+			writer.sample("passenger_requests_in_progress",
+				begun > finished ? begun - finished : 0,
+				"thread", toString(controllers[i]->getThreadNumber()));
+		}
+		writeControllerMetric(writer, "passenger_turbocache_hits", "counter",
+			"Number of requests served from the turbocache.",
+			&ControllerMetrics::turboCacheHits);
+		writeControllerMetric(writer, "passenger_session_checkout_errors", "counter",
+			"Number of requests for which no application process session could be obtained.",
+			&ControllerMetrics::sessionCheckoutErrors);
+		writeControllerMetric(writer, "passenger_active_clients",
+			"Number of connected clients.",
+			&ControllerMetrics::activeClients);
+		writeControllerMetric(writer, "passenger_mbuf_active_bytes",
+			"Memory used by mbuf blocks that are in use.",
+			&ControllerMetrics::mbufActiveBytes);
+		writeControllerMetric(writer, "passenger_mbuf_spare_bytes",
+			"Memory used by mbuf blocks that are kept in the freelist.",
+			&ControllerMetrics::mbufSpareBytes);
+	}
+
+	void writePoolMetrics(OpenMetricsWriter &writer) {
+		const ApplicationPool2::Pool::Metrics &metrics = appPool->metrics;
+
+		writer.declare("passenger_pool_spawns", "counter",
+			"Number of application processes spawned.");
+		writer.sample("passenger_pool_spawns_total", metrics.processesSpawned.get());
+		writer.declare("passenger_pool_spawn_errors", "counter",
+			"Number of failed application process spawn attempts.");
+		writer.sample("passenger_pool_spawn_errors_total", metrics.spawnErrors.get());
+		writer.declare("passenger_pool_groups", "gauge",
+			"Number of application groups.");
+		writer.sample("passenger_pool_groups", metrics.groups.get());
+		writer.declare("passenger_pool_processes", "gauge",
+			"Number of application processes.");
+		writer.sample("passenger_pool_processes", metrics.processes.get());
+		writer.declare("passenger_pool_processes_being_spawned", "gauge",
+			"Number of application processes that are being spawned.");
+		writer.sample("passenger_pool_processes_being_spawned",
+			metrics.processesBeingSpawned.get());
+		writer.declare("passenger_pool_capacity_used", "gauge",
+			"Pool capacity in use.");
+		writer.sample("passenger_pool_capacity_used", metrics.capacityUsed.get());
+		writer.declare("passenger_pool_max_capacity", "gauge",
+			"Maximum pool capacity.");
+		writer.sample("passenger_pool_max_capacity", metrics.maxCapacity.get());
+		writer.declare("passenger_pool_busy_sessions", "gauge",
+			"Number of open sessions with application processes.");
+		writer.sample("passenger_pool_busy_sessions", metrics.busySessions.get());
+		writer.declare("passenger_pool_queued_requests", "gauge",
+			"Number of requests waiting for an application process.");
+		writer.sample("passenger_pool_queued_requests", metrics.queuedRequests.get());
+	}
+
+	void writeEventLoopMetrics(OpenMetricsWriter &writer) {
+		if (eventLoopStallDetector == NULL) {
+			return;
+		}
+
+		writer.declare("passenger_event_loop_stalls", "counter",
+			"Number of times that an event loop was blocked for longer than the stall threshold.");
+		for (unsigned int i = 0; i < eventLoopStallDetector->getLoopCount(); i++) {
+			writer.sample("passenger_event_loop_stalls_total",
+				eventLoopStallDetector->getStallCount(i),
+				"loop", eventLoopStallDetector->getLoopName(i));
+		}
+		writer.declare("passenger_event_loop_longest_stall_seconds", "gauge",
+			"Longest time that an event loop was blocked.");
+		for (unsigned int i = 0; i < eventLoopStallDetector->getLoopCount(); i++) {
+			writer.sample("passenger_event_loop_longest_stall_seconds",
+				eventLoopStallDetector->getLongestStall(i) / 1000000.0,
+				"loop", eventLoopStallDetector->getLoopName(i));
+		}
+	}
+
+	/**
+	 * Unlike most other inspection endpoints, this does not lock the pool
+	 * nor go through the Controllers' event loops: it only reads counters,
+	 * so that it is cheap enough to be scraped frequently.
+	 */
+	void processMetrics(Client *client, Request *req) {
+		if (authorizeStateInspectionOperation(this, client, req)) {
+			OpenMetricsWriter writer;
+			writeControllerMetrics(writer);
+			writePoolMetrics(writer);
+			writeEventLoopMetrics(writer);
+			writer.finish();
+
+			HeaderTable headers;
+			headers.insert(req->pool, "Content-Type",
+				"application/openmetrics-text; version=1.0.0; charset=utf-8");
+			headers.insert(req->pool, "Cache-Control", "no-cache, no-store, must-revalidate");
+			writeSimpleResponse(client, 200, &headers,
+				psg_pstrdup(req->pool, writer.getOutput()));
+			if (!req->ended()) {
+				endRequest(&client, &req);
 			}
 		} else {
 			apiServerRespondWith401(this, client, req);
@@ -296,6 +704,7 @@ private:
 				parseQueryString(req->getQueryString()));
 			options.uid = auth.uid;
 			options.apiKey = auth.apiKey;
+			options.maxSnapshotAge = ApplicationPool2::Pool::POLLING_SNAPSHOT_MAX_AGE;
 
 			HeaderTable headers;
 			headers.insert(req->pool, "Content-Type", "text/xml");
@@ -328,6 +737,7 @@ private:
 				parseQueryString(req->getQueryString()));
 			options.uid = auth.uid;
 			options.apiKey = auth.apiKey;
+			options.maxSnapshotAge = ApplicationPool2::Pool::POLLING_SNAPSHOT_MAX_AGE;
 
 			HeaderTable headers;
 			headers.insert(req->pool, "Content-Type", "text/plain");
@@ -353,6 +763,28 @@ private:
 		}
 	}
 
+	void processPoolSpawnStats(Client *client, Request *req) {
+		Authorization auth(authorize(this, client, req));
+		if (auth.canReadPool) {
+			ApplicationPool2::Pool::AuthenticationOptions options;
+			options.uid = auth.uid;
+			options.apiKey = auth.apiKey;
+
+			Json::Value response;
+			response["app_groups"] = appPool->inspectSpawnStatsAsJson(options);
+
+			HeaderTable headers;
+			headers.insert(req->pool, "Content-Type", "application/json");
+			writeSimpleResponse(client, 200, &headers,
+				psg_pstrdup(req->pool, response.toStyledString()));
+			if (!req->ended()) {
+				endRequest(&client, &req);
+			}
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
 	void processPoolRestartAppGroup(Client *client, Request *req) {
 		Authorization auth(authorize(this, client, req));
 		if (!auth.canModifyPool) {
@@ -465,30 +897,47 @@ private:
 		}
 	}
 
-	static void garbageCollect(Controller *controller) {
-		ServerKit::Context *ctx = controller->getContext();
-		unsigned int count;
+	static boost::function<void ()> garbageCollect(Request *req,
+		Controller *controller, unsigned int i)
+	{
+		boost::shared_ptr<string> result = boost::make_shared<string>();
+		JsonWriter writer(*result);
+		writer.value(controller->compactMemory(LoggingKit::NOTICE));
+		return boost::bind(storeControllerState, req, i, result);
+	}
+
+	void respondWithGarbageCollectionResults(Client *client, Request *req) {
+		HeaderTable headers;
+		headers.insert(req->pool, "Content-Type", "application/json");
 
-		count = mbuf_pool_compact(&ctx->mbuf_pool);
-		SKS_NOTICE_FROM_STATIC(controller, "Freed " << count << " mbufs");
+		string body;
+		JsonWriter writer(body);
+		body.reserve(totalControllerStatesSize(req) + 32);
+		writer.beginObject();
+		writer.key("status");
+		writer.value("ok");
+		writer.key("threads");
+		writer.beginArray();
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			writer.rawValue(req->controllerStates[i]);
+		}
+		writer.endArray();
+		writer.endObject();
 
-		controller->compact(LoggingKit::NOTICE);
+		writeSimpleResponse(client, 200, &headers,
+			psg_pstrdup(req->pool, body));
 	}
 
 	void processGc(Client *client, Request *req) {
 		if (req->method != HTTP_PUT) {
 			apiServerRespondWith405(this, client, req);
 		} else if (authorizeAdminOperation(this, client, req)) {
-			HeaderTable headers;
-			headers.insert(req->pool, "Content-Type", "application/json");
-			for (unsigned int i = 0; i < controllers.size(); i++) {
-				controllers[i]->getContext()->libev->runLater(boost::bind(
-					garbageCollect, controllers[i]));
-			}
-			writeSimpleResponse(client, 200, &headers, "{ \"status\": \"ok\" }");
-			if (!req->ended()) {
-				endRequest(&client, &req);
-			}
+			req->controllerStates.resize(controllers.size());
+			gatherFromControllers(client, req,
+				boost::bind(garbageCollect, req,
+					boost::placeholders::_1, boost::placeholders::_2),
+				boost::bind(&ApiServer::respondWithGarbageCollectionResults, this,
+					boost::placeholders::_1, boost::placeholders::_2));
 		} else {
 			apiServerRespondWith401(this, client, req);
 		}
@@ -674,6 +1123,11 @@ protected:
 		}
 		req->authorization = Authorization();
 		req->controllerStates.clear();
+		req->latencyStats.reset();
+		req->requestTraces.reset();
+		// Stops the profiler if the client disconnected before
+		// the profile was finished.
+		req->cpuProfiler.reset();
 		ParentClass::deinitializeRequest(client, req);
 	}
 
@@ -684,13 +1138,16 @@ public:
 	vector<Controller *> controllers;
 	ApplicationPool2::PoolPtr appPool;
 	EventFd *exitEvent;
+	// Optional.
+	EventLoopStallDetector *eventLoopStallDetector;
 
 	ApiServer(ServerKit::Context *context, const Schema &schema,
 		const Json::Value &initialConfig,
 		const ConfigKit::Translator &translator = ConfigKit::DummyTranslator())
 		: ParentClass(context, schema, initialConfig, translator),
 		  serverConnectionPath("^/server/(.+)\\.json$"),
-		  exitEvent(NULL)
+		  exitEvent(NULL),
+		  eventLoopStallDetector(NULL)
 	{
 		apiAccountDatabase = ApiAccountUtils::ApiAccountDatabase(
 			config["authorizations"]);
@@ -49,6 +49,8 @@
 #include <WrapperRegistry/Registry.h>
 #include <Hooks.h>
 #include <Utils.h>
+#include <Utils/SpeedMeter.h>
+#include <Algorithms/MovingAverage.h>
 #include <Core/ApplicationPool/Common.h>
 #include <Core/ApplicationPool/Context.h>
 #include <Core/ApplicationPool/BasicGroupInfo.h>
@@ -56,6 +58,7 @@
 #include <Core/ApplicationPool/Options.h>
 #include <Core/SpawningKit/Factory.h>
 #include <Core/SpawningKit/Result.h>
+#include <Core/SpawningKit/JourneyStats.h>
 #include <Core/SpawningKit/UserSwitchingRules.h>
 #include <Shared/ApplicationPoolApiKey.h>
 
@@ -142,6 +145,13 @@ public:
 	 *     if processesBeingSpawned > 0: m_spawning
 	 */
 	short processesBeingSpawned;
+	/**
+	 * The number of replacement processes that a rolling restart is spawning
+	 * and warming up right now. These count towards `capacityUsed()` so that
+	 * their capacity stays reserved until they are attached.
+	 * See Group/RollingRestart.cpp.
+	 */
+	short replacementsBeingSpawned;
 	/**
 	 * A Group object progresses through a life.
 	 *
@@ -192,6 +202,27 @@ public:
 	Callback shutdownCallback;
 	GroupPtr selfPointer;
 
+	/**
+	 * Demand forecasting state, used for spawning processes ahead of demand.
+	 * See Group/DemandForecasting.cpp.
+	 *
+	 * `requestsArrived` is the total number of get() requests so far. The
+	 * arrival rate meters sample it over the last ~8 seconds and the last
+	 * ~2 minutes, respectively. `avgServiceTime` is the moving average of
+	 * session durations in microseconds, or -1 if not yet known.
+	 */
+	unsigned long long requestsArrived;
+	SpeedMeter<unsigned long long, 8, 1000000, 60 * 1000000, 1000000> shortTermArrivalRate;
+	SpeedMeter<unsigned long long, 8, 15 * 1000000, 5 * 60 * 1000000, 1000000> longTermArrivalRate;
+	double avgServiceTime;
+	unsigned int predictedProcessesNeeded;
+
+	/**
+	 * Per-step timing histograms of the successful spawns of this Group.
+	 * Protected by the Pool lock. See Pool::inspectSpawnStatsAsJson().
+	 */
+	SpawningKit::JourneyStats spawnJourneyStats;
+
 
 	/****** Initialization and shutdown ******/
 
@@ -220,6 +251,18 @@ public:
 		RestartMethod method, SpawningKit::FactoryPtr spawningKitFactory,
 		unsigned int restartsInitiated, boost::container::vector<Callback> postLockActions);
 
+	/****** Rolling restarts ******/
+
+	void startRollingRestart(const Options &newOptions);
+	void rollingRestartThreadMain(GroupPtr self, Options oldOptions, Options newOptions,
+		SpawningKit::FactoryPtr spawningKitFactory, unsigned int restartsInitiated);
+	bool rollingRestartAborted(unsigned int restartsInitiated) const;
+	ProcessPtr findOldProcessToReplace(ProcessList &oldProcesses) const;
+	unsigned int spareCapacityForReplacements() const;
+	void warmUpProcess(const ProcessPtr &process, const Options &options);
+	void sendWarmupRequest(Socket *socket, const Options &options,
+		const StaticString &uri, unsigned long long *timeout);
+
 	/****** Process list management ******/
 
 	Process *findProcessWithStickySessionId(unsigned int id) const;
@@ -248,6 +291,12 @@ public:
 	void spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process);
 	void initiateNextOobwRequest();
 
+	/****** Demand forecasting ******/
+
+	void recordRequestArrival(unsigned long long now);
+	void recordServiceTime(const Session *session, unsigned long long now);
+	unsigned int forecastProcessesNeeded() const;
+
 	/****** Internal utilities ******/
 
 	static void runAllActions(const boost::container::vector<Callback> &actions);
@@ -276,6 +325,8 @@ public:
 	void assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions);
 	bool testOverflowRequestQueue() const;
 	void callAbortLongRunningConnectionsCallback(const ProcessPtr &process);
+	void writeSessionProtocolRequest(int fd, const StaticString headers[],
+		unsigned int nheaders, unsigned long long *timeout) const;
 
 	/****** Correctness verification ******/
 
@@ -326,9 +377,9 @@ public:
 	 *    nEnabledProcessesTotallyBusy <= enabledCount
      *
 	 *    if (enabledCount == 0):
-	 *       processesBeingSpawned > 0 || restarting() || poolAtFullCapacity()
+	 *       processesBeingSpawned > 0 || replacementsBeingSpawned > 0 || restarting() || poolAtFullCapacity()
 	 *    if (enabledCount == 0) and (disablingCount > 0):
-	 *       processesBeingSpawned > 0
+	 *       processesBeingSpawned > 0 || replacementsBeingSpawned > 0
 	 *    if !m_spawning:
 	 *       (enabledCount > 0) || (disablingCount == 0)
 	 *
@@ -389,7 +440,7 @@ public:
 	 * The only reason why there are no enabled processes, while at the same time we're
 	 * not spawning or waiting for pool capacity, is because there is nothing to do.
 	 *
-	 *    if enabledProcesses.empty() && !m_spawning && !restarting() && !poolAtFullCapacity():
+	 *    if enabledProcesses.empty() && !m_spawning && replacementsBeingSpawned == 0 && !restarting() && !poolAtFullCapacity():
 	 *       getWaitlist is empty
 	 *
 	 * Equivalently:
@@ -398,7 +449,7 @@ public:
 	 * unable to do that because of resource limits.
 	 *
 	 *    if getWaitlist is non-empty:
-	 *       !enabledProcesses.empty() || m_spawning || restarting() || poolAtFullCapacity()
+	 *       !enabledProcesses.empty() || m_spawning || replacementsBeingSpawned > 0 || restarting() || poolAtFullCapacity()
 	 */
 	deque<GetWaiter> getWaitlist;
 	/**
@@ -458,6 +509,12 @@ public:
 	bool shouldSpawnForGetAction() const;
 	bool allowSpawn() const;
 
+	/****** Demand forecasting ******/
+
+	void updateDemandForecast(unsigned long long now = 0);
+	bool predictedDemandSatisfied() const;
+	unsigned int getPredictedProcessesNeeded() const;
+
 	/****** Process list management ******/
 
 	AttachResult attach(const ProcessPtr &process,
@@ -478,12 +535,10 @@ public:
 	bool allEnabledProcessesAreTotallyBusy() const;
 
 	unsigned int capacityUsed() const;
+	unsigned int getFairShareWeight() const;
 	bool isWaitingForCapacity() const;
 	bool garbageCollectable(unsigned long long now = 0) const;
 
-	void inspectXml(std::ostream &stream, bool includeSecrets = true) const;
-	void inspectPropertiesInAdminPanelFormat(Json::Value &result) const;
-	void inspectConfigInAdminPanelFormat(Json::Value &result) const;
 
 	/****** Out-of-band work ******/
 
@@ -0,0 +1,168 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/ApplicationPool/Group.h>
+#include <cmath>
+
+/*************************************************************************
+ *
+ * Demand forecasting for ApplicationPool2::Group
+ *
+ * Spawning is normally reactive: a process is only spawned when all
+ * processes are totally busy or when requests are queued, so during a
+ * traffic ramp-up requests queue up while new processes boot.
+ *
+ * The forecaster estimates how many processes will be needed in the near
+ * future using Little's law: the average number of requests in progress
+ * equals the request arrival rate multiplied by the average service time.
+ * The arrival rate is measured over a short and a long window. If the
+ * short-term rate exceeds the long-term rate then traffic is ramping up,
+ * and the difference is added once more in order to extrapolate the trend.
+ *
+ * The forecast can only cause processes to be spawned earlier; it never
+ * causes processes to be shut down. Spawning still respects `maxProcesses`
+ * and the pool capacity, and surplus processes are garbage collected as
+ * usual once the forecast drops.
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+using namespace boost;
+
+
+// Spawn enough processes to handle this much more than the forecasted load.
+static const double DEMAND_FORECAST_HEADROOM = 1.25;
+// Weight of every new session duration in the service time moving average.
+static const double SERVICE_TIME_AVERAGE_ALPHA = 0.05;
+
+
+/****************************
+ *
+ * Private methods
+ *
+ ****************************/
+
+
+void
+Group::recordRequestArrival(unsigned long long now) {
+	requestsArrived++;
+	updateDemandForecast(now);
+}
+
+void
+Group::recordServiceTime(const Session *session, unsigned long long now) {
+	unsigned long long startTime = session->getStartTime();
+	if (startTime != 0 && now > startTime) {
+		avgServiceTime = expMovingAverage(avgServiceTime, now - startTime,
+			SERVICE_TIME_AVERAGE_ALPHA);
+	}
+}
+
+unsigned int
+Group::forecastProcessesNeeded() const {
+	double shortTermRate = shortTermArrivalRate.currentSpeed();
+	double longTermRate = longTermArrivalRate.currentSpeed();
+	if (shortTermRate == SpeedMeter<unsigned long long>::unknownSpeed()
+	 || avgServiceTime < 0
+	 || enabledCount == 0)
+	{
+		return 0;
+	}
+
+	// Processes with unlimited concurrency (0) or unknown
+	// concurrency (-1) don't need more processes to handle more load.
+	int concurrency = enabledProcesses[0]->getConcurrency();
+	if (concurrency <= 0) {
+		return 0;
+	}
+
+	double rate = shortTermRate;
+	if (longTermRate != SpeedMeter<unsigned long long>::unknownSpeed()
+	 && shortTermRate > longTermRate)
+	{
+		rate += shortTermRate - longTermRate;
+	}
+
+	double sessionsInProgress = rate * avgServiceTime / 1000000.0;
+	double needed = ceil(sessionsInProgress * DEMAND_FORECAST_HEADROOM / concurrency);
+	if (options.maxProcesses != 0 && needed > options.maxProcesses) {
+		needed = options.maxProcesses;
+	}
+	if (needed > getPool()->max) {
+		needed = getPool()->max;
+	}
+	return (unsigned int) needed;
+}
+
+
+/****************************
+ *
+ * Public methods
+ *
+ ****************************/
+
+
+/**
+ * Samples the request arrival rate and recalculates the number of processes
+ * that are predicted to be needed. Sampling is throttled by the arrival rate
+ * meters, so this is cheap to call often. Should also be called periodically
+ * when no requests arrive, so that the forecast decays.
+ */
+void
+Group::updateDemandForecast(unsigned long long now) {
+	bool shortTermSampled = shortTermArrivalRate.addSample(requestsArrived, now);
+	bool longTermSampled = longTermArrivalRate.addSample(requestsArrived, now);
+	if (shortTermSampled || longTermSampled) {
+		unsigned int oldPrediction = predictedProcessesNeeded;
+		predictedProcessesNeeded = forecastProcessesNeeded();
+		if (predictedProcessesNeeded > oldPrediction
+		 && predictedProcessesNeeded > (unsigned int) capacityUsed())
+		{
+			P_DEBUG("Group " << getName() << " is predicted to need " <<
+				predictedProcessesNeeded << " processes soon");
+		}
+	}
+}
+
+/**
+ * Returns whether this group has at least as much capacity as the
+ * demand forecast predicts it needs.
+ */
+bool
+Group::predictedDemandSatisfied() const {
+	return capacityUsed() >= predictedProcessesNeeded;
+}
+
+unsigned int
+Group::getPredictedProcessesNeeded() const {
+	return predictedProcessesNeeded;
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
@@ -112,6 +112,7 @@ Group::Group(Pool *_pool, const Options &_options)
 	spawner        = getContext()->spawningKitFactory->create(options);
 	restartsInitiated = 0;
 	processesBeingSpawned = 0;
+	replacementsBeingSpawned = 0;
 	m_spawning     = false;
 	m_restarting   = false;
 	lifeStatus.store(ALIVE, boost::memory_order_relaxed);
@@ -130,6 +131,9 @@ Group::Group(Pool *_pool, const Options &_options)
 	}
 
 	detachedProcessesCheckerActive = false;
+	requestsArrived = 0;
+	avgServiceTime = -1;
+	predictedProcessesNeeded = 0;
 }
 
 Group::~Group() {
@@ -24,6 +24,7 @@
  *  THE SOFTWARE.
  */
 #include <Core/ApplicationPool/Group.h>
+#include <IOTools/MessageSerialization.h>
 
 /*************************************************************************
  *
@@ -86,6 +87,8 @@ void
 Group::mergeOptions(const Options &other) {
 	options.maxRequests      = other.maxRequests;
 	options.minProcesses     = other.minProcesses;
+	options.fairShareWeight  = other.fairShareWeight;
+	options.rollingRestart   = other.rollingRestart;
 	options.statThrottleRate = other.statThrottleRate;
 	options.maxPreloaderIdleTime = other.maxPreloaderIdleTime;
 }
@@ -371,6 +374,38 @@ Group::callAbortLongRunningConnectionsCallback(const ProcessPtr &process) {
 	}
 }
 
+/**
+ * Writes a request in the "session" protocol, the way Core::Controller does,
+ * to the given connection. `headers` contains `nheaders` name-value pairs.
+ * The PASSENGER_CONNECT_PASSWORD header is added automatically.
+ */
+void
+Group::writeSessionProtocolRequest(int fd, const StaticString headers[],
+	unsigned int nheaders, unsigned long long *timeout) const
+{
+	char sizeField[sizeof(boost::uint32_t)];
+	boost::container::small_vector<StaticString, 64> data;
+
+	data.push_back(StaticString(sizeField, sizeof(boost::uint32_t)));
+	for (unsigned int i = 0; i < nheaders; i++) {
+		data.push_back(headers[i * 2]);
+		data.push_back(StaticString("", 1));
+		data.push_back(headers[i * 2 + 1]);
+		data.push_back(StaticString("", 1));
+	}
+	data.push_back(P_STATIC_STRING_WITH_NULL("PASSENGER_CONNECT_PASSWORD"));
+	data.push_back(getApiKey().toStaticString());
+	data.push_back(StaticString("", 1));
+
+	boost::uint32_t dataSize = 0;
+	for (unsigned int i = 1; i < data.size(); i++) {
+		dataSize += (boost::uint32_t) data[i].size();
+	}
+	Uint32Message::generate(sizeField, dataSize);
+
+	gatheredWrite(fd, &data[0], data.size(), timeout);
+}
+
 
 } // namespace ApplicationPool2
 } // namespace Passenger
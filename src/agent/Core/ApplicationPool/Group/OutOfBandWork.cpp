@@ -225,26 +225,10 @@ Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
 		connection.fail = true;
 		ScopeGuard guard(boost::bind(&Socket::checkinConnection, socket, connection));
 
-		// This is copied from Core::Controller when it is sending data using the
-		// "session" protocol.
-		char sizeField[sizeof(boost::uint32_t)];
-		boost::container::small_vector<StaticString, 10> data;
-
-		data.push_back(StaticString(sizeField, sizeof(boost::uint32_t)));
-		data.push_back(P_STATIC_STRING_WITH_NULL("REQUEST_METHOD"));
-		data.push_back(P_STATIC_STRING_WITH_NULL("OOBW"));
-
-		data.push_back(P_STATIC_STRING_WITH_NULL("PASSENGER_CONNECT_PASSWORD"));
-		data.push_back(getApiKey().toStaticString());
-		data.push_back(StaticString("", 1));
-
-		boost::uint32_t dataSize = 0;
-		for (unsigned int i = 1; i < data.size(); i++) {
-			dataSize += (boost::uint32_t) data[i].size();
-		}
-		Uint32Message::generate(sizeField, dataSize);
-
-		gatheredWrite(connection.fd, &data[0], data.size(), &timeout);
+		const StaticString headers[] = {
+			P_STATIC_STRING("REQUEST_METHOD"), P_STATIC_STRING("OOBW")
+		};
+		writeSessionProtocolRequest(connection.fd, headers, 1, &timeout);
 
 		// We do not care what the actual response is ... just wait for it.
 		UPDATE_TRACE_POINT();
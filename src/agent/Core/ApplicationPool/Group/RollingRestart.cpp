@@ -0,0 +1,451 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/ApplicationPool/Group.h>
+
+/*************************************************************************
+ *
+ * Rolling restarts for ApplicationPool2::Group
+ *
+ * A blocking restart detaches all processes at once, so until the first
+ * new process has been spawned, requests have to wait. A rolling restart
+ * instead keeps the old processes serving requests while replacements are
+ * spawned in batches. Each replacement is sent the requests configured in
+ * `options.warmupURIs` before it is attached (and thus becomes `ENABLED`),
+ * and only then is one old process detached. The number of processes
+ * therefore never drops below the pre-restart level, except when there is
+ * no spare capacity at all: then one old process is detached right before
+ * its replacement is spawned.
+ *
+ * Replacements that are being spawned are counted in
+ * `replacementsBeingSpawned`, which makes them part of `capacityUsed()`.
+ *
+ * If a replacement fails to spawn, the rolling restart is aborted and the
+ * remaining old processes are kept so that the application stays up. If a
+ * replacement cannot be attached, the remaining old processes are detached
+ * just like a blocking restart would, and the regular spawning mechanism
+ * takes over.
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+using namespace boost;
+
+
+/****************************
+ *
+ * Private methods
+ *
+ ****************************/
+
+
+/**
+ * Initiates a rolling restart. Must be called with the pool lock held.
+ * The caller must ensure that there is at least one enabled process.
+ */
+void
+Group::startRollingRestart(const Options &newOptions) {
+	assert(isAlive());
+	assert(enabledCount > 0);
+	P_DEBUG("Rolling restarting group " << getName());
+
+	// If there is currently a restarter thread or a spawner thread active,
+	// the following tells them to abort their current work as soon as possible.
+	restartsInitiated++;
+
+	processesBeingSpawned = 0;
+	replacementsBeingSpawned = 0;
+	m_spawning = false;
+	uuid       = generateUuid(pool);
+	this->options.groupUuid = uuid;
+	getPool()->interruptableThreads.create_thread(
+		boost::bind(&Group::rollingRestartThreadMain, this, shared_from_this(),
+			this->options.copyAndPersist().clearPerRequestFields(),
+			newOptions.copyAndPersist().clearPerRequestFields(),
+			getContext()->spawningKitFactory, restartsInitiated),
+		"Group rolling restarter: " + getName(),
+		POOL_HELPER_THREAD_STACK_SIZE
+	);
+}
+
+// The 'self' parameter is for keeping the current Group object alive while this thread is running.
+void
+Group::rollingRestartThreadMain(GroupPtr self, Options oldOptions, Options newOptions,
+	SpawningKit::FactoryPtr spawningKitFactory, unsigned int restartsInitiated)
+{
+	TRACE_POINT();
+	boost::this_thread::disable_interruption di;
+	boost::this_thread::disable_syscall_interruption dsi;
+
+	// Create a new spawner.
+	Options spawnerOptions = oldOptions;
+	resetOptions(newOptions, &spawnerOptions);
+	SpawningKit::SpawnerPtr newSpawner = spawningKitFactory->create(spawnerOptions);
+	SpawningKit::SpawnerPtr oldSpawner;
+	ProcessList oldProcesses;
+
+	UPDATE_TRACE_POINT();
+	Pool *pool = getPool();
+	{
+		ScopedLock l(pool->syncher);
+		if (rollingRestartAborted(restartsInitiated)) {
+			return;
+		}
+
+		// Atomically swap the new spawner with the old one. From now on,
+		// all newly spawned processes run the new application version.
+		resetOptions(newOptions);
+		oldSpawner = spawner;
+		spawner    = newSpawner;
+
+		oldProcesses.insert(oldProcesses.end(),
+			enabledProcesses.begin(), enabledProcesses.end());
+		oldProcesses.insert(oldProcesses.end(),
+			disablingProcesses.begin(), disablingProcesses.end());
+		oldProcesses.insert(oldProcesses.end(),
+			disabledProcesses.begin(), disabledProcesses.end());
+
+		if (shouldSpawn()) {
+			spawn();
+		}
+		verifyInvariants();
+	}
+	oldSpawner.reset();
+
+	while (true) {
+		boost::container::vector<Callback> actions;
+		unsigned int batchSize;
+		unsigned int oldProcessesAlreadyDetached = 0;
+
+		UPDATE_TRACE_POINT();
+		{
+			ScopedLock l(pool->syncher);
+			if (rollingRestartAborted(restartsInitiated)) {
+				return;
+			}
+
+			ProcessPtr process = findOldProcessToReplace(oldProcesses);
+			if (process == NULL) {
+				break;
+			}
+
+			batchSize = std::min<unsigned int>(oldProcesses.size(),
+				spareCapacityForReplacements());
+			if (batchSize == 0) {
+				// Reserve the capacity before detaching so that it is not
+				// handed out to another group in the mean time.
+				P_DEBUG("No spare capacity for rolling restart of group " << getName() <<
+					", so detaching old process " << process->inspect() << " first");
+				batchSize = 1;
+				replacementsBeingSpawned++;
+				pool->detachProcessUnlocked(process, actions);
+				oldProcessesAlreadyDetached++;
+			} else {
+				replacementsBeingSpawned += batchSize;
+			}
+			P_DEBUG("Spawning " << batchSize << " replacement process(es) for group " <<
+				getName() << "; " << oldProcesses.size() << " old process(es) remaining");
+		}
+		runAllActions(actions);
+		actions.clear();
+
+		UPDATE_TRACE_POINT();
+		ProcessList replacements;
+		ExceptionPtr exception;
+		bool spawnFailed = false;
+		try {
+			boost::this_thread::restore_interruption ri(di);
+			boost::this_thread::restore_syscall_interruption rsi(dsi);
+			for (unsigned int i = 0; i < batchSize; i++) {
+				ProcessPtr process = createProcessObject(*newSpawner,
+					newSpawner->spawn(newOptions));
+				replacements.push_back(process);
+				warmUpProcess(process, newOptions);
+			}
+		} catch (const boost::thread_interrupted &) {
+			for_each(replacements.begin(), replacements.end(),
+				Process::forceTriggerShutdownAndCleanup);
+			return;
+		} catch (SpawningKit::SpawnException &e) {
+			processAndLogNewSpawnException(e, newOptions, pool->getContext());
+			exception = copyException(e);
+			spawnFailed = true;
+		} catch (const tracable_exception &e) {
+			P_ERROR("Cannot spawn replacement process for group " << getName() <<
+				": " << e.what() << "\n" << e.backtrace());
+			exception = copyException(e);
+			spawnFailed = true;
+		}
+
+		UPDATE_TRACE_POINT();
+		bool attachFailed = false;
+		{
+			ScopedLock l(pool->syncher);
+			if (rollingRestartAborted(restartsInitiated)) {
+				l.unlock();
+				for_each(replacements.begin(), replacements.end(),
+					Process::forceTriggerShutdownAndCleanup);
+				return;
+			}
+
+			assert(replacementsBeingSpawned >= (short) batchSize);
+			replacementsBeingSpawned -= batchSize;
+
+			ProcessList::const_iterator it, end = replacements.end();
+			for (it = replacements.begin(); it != end; it++) {
+				const ProcessPtr &process = *it;
+				if (attachFailed || attach(process, actions) != AR_OK) {
+					P_DEBUG("Unable to attach replacement process " << process->inspect());
+					actions.push_back(boost::bind(Process::forceTriggerShutdownAndCleanup,
+						process));
+					attachFailed = true;
+					continue;
+				}
+
+				assignSessionsToGetWaiters(actions);
+				if (oldProcessesAlreadyDetached > 0) {
+					oldProcessesAlreadyDetached--;
+					continue;
+				}
+				ProcessPtr oldProcess = findOldProcessToReplace(oldProcesses);
+				if (oldProcess != NULL) {
+					P_DEBUG("Process " << process->inspect() << " replaces old process " <<
+						oldProcess->inspect());
+					pool->detachProcessUnlocked(oldProcess, actions);
+				}
+			}
+
+			if (spawnFailed) {
+				P_ERROR("Rolling restart of group " << getName() << " aborted because a "
+					"replacement process could not be spawned. The remaining " <<
+					oldProcesses.size() << " old process(es) are kept alive");
+				if (enabledCount == 0) {
+					// The old process that was detached in advance was the
+					// last one, so the get waiters cannot be served.
+					Pool::assignExceptionToGetWaiters(getWaitlist, exception, actions);
+				}
+			} else if (attachFailed) {
+				P_WARN("Rolling restart of group " << getName() << " could not attach "
+					"all replacement processes, so detaching the remaining old processes");
+				ProcessPtr oldProcess;
+				while ((oldProcess = findOldProcessToReplace(oldProcesses)) != NULL) {
+					pool->detachProcessUnlocked(oldProcess, actions);
+				}
+				if (shouldSpawn()) {
+					spawn();
+				}
+			}
+
+			// Capacity that was reserved but not used may be handed out now.
+			pool->assignSessionsToGetWaiters(actions);
+			pool->possiblySpawnMoreProcessesForExistingGroups();
+			pool->fullVerifyInvariants();
+		}
+		runAllActions(actions);
+
+		if (spawnFailed || attachFailed) {
+			return;
+		}
+	}
+
+	P_INFO("Rolling restart of group " << getName() << " done");
+}
+
+bool
+Group::rollingRestartAborted(unsigned int restartsInitiated) const {
+	if (!isAlive()) {
+		P_DEBUG("Group " << getName() << " is shutting down, so aborting rolling restart");
+		return true;
+	} else if (restartsInitiated != this->restartsInitiated) {
+		P_DEBUG("Rolling restart of group " << getName() << " aborted because a "
+			"new restart was initiated concurrently");
+		return true;
+	} else {
+		return false;
+	}
+}
+
+/**
+ * Removes the processes that are no longer part of this group (e.g. because
+ * they were garbage collected in the mean time) from `oldProcesses`, and
+ * returns the remaining old process with the fewest sessions, so that
+ * replacing it disturbs the fewest requests. Returns NULL if all old
+ * processes are gone.
+ */
+ProcessPtr
+Group::findOldProcessToReplace(ProcessList &oldProcesses) const {
+	ProcessList::iterator it = oldProcesses.begin();
+	ProcessPtr result;
+
+	while (it != oldProcesses.end()) {
+		const ProcessPtr &process = *it;
+		if (process->enabled == Process::DETACHED || !process->isAlive()) {
+			it = oldProcesses.erase(it);
+		} else {
+			if (result == NULL || process->sessions < result->sessions) {
+				result = process;
+			}
+			it++;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Returns the number of replacement processes that can be spawned without
+ * exceeding the group's and the pool's process limits.
+ */
+unsigned int
+Group::spareCapacityForReplacements() const {
+	if (anotherGroupIsWaitingForCapacity()) {
+		return 0;
+	}
+
+	int result = (int) pool->max - (int) pool->capacityUsedUnlocked();
+	if (options.maxProcesses != 0) {
+		result = std::min<int>(result,
+			(int) options.maxProcesses - (int) capacityUsed());
+	}
+	return std::max(result, 0);
+}
+
+/**
+ * Sends the requests configured in `options.warmupURIs` to the given process,
+ * which must not have been attached yet. Errors are logged but otherwise
+ * ignored: a process that fails to warm up is still usable. The total time
+ * spent is limited by `options.startTimeout`.
+ */
+void
+Group::warmUpProcess(const ProcessPtr &process, const Options &options) {
+	if (options.warmupURIs.empty() || process->isDummy()) {
+		return;
+	}
+
+	Socket *socket = process->findSocketsAcceptingHttpRequestsAndWithLowestBusyness();
+	if (socket == NULL) {
+		return;
+	}
+
+	vector<StaticString> uris;
+	split(options.warmupURIs, ' ', uris);
+
+	unsigned long long timeout = options.startTimeout * 1000ull;
+	vector<StaticString>::const_iterator it, end = uris.end();
+	for (it = uris.begin(); it != end; it++) {
+		if (it->empty()) {
+			continue;
+		}
+
+		P_DEBUG("Warming up process " << process->inspect() << " with request to " << *it);
+		try {
+			sendWarmupRequest(socket, options, *it, &timeout);
+		} catch (const SystemException &e) {
+			P_WARN("Cannot warm up process " << process->inspect() <<
+				" with request to " << *it << ": " << e.what());
+		} catch (const TimeoutException &e) {
+			P_WARN("Timeout warming up process " << process->inspect() <<
+				" with request to " << *it);
+			return;
+		}
+	}
+}
+
+void
+Group::sendWarmupRequest(Socket *socket, const Options &options,
+	const StaticString &uri, unsigned long long *timeout)
+{
+	TRACE_POINT();
+	// The connection is marked as fail in order to ensure that it is closed
+	// after this request instead of being reused.
+	Connection connection = socket->checkoutConnection();
+	connection.fail = true;
+	ScopeGuard guard(boost::bind(&Socket::checkinConnection, socket, connection));
+
+	if (socket->protocol == P_STATIC_STRING("session")) {
+		// This is a subset of what Core::Controller sends when using the
+		// "session" protocol.
+		StaticString path = uri, query;
+		const char *pos = (const char *) memchr(uri.data(), '?', uri.size());
+		if (pos != NULL) {
+			path  = StaticString(uri.data(), pos - uri.data());
+			query = StaticString(pos + 1, uri.data() + uri.size() - pos - 1);
+		}
+		StaticString scriptName;
+		if (options.baseURI != P_STATIC_STRING("/") && startsWith(path, options.baseURI)) {
+			scriptName = options.baseURI;
+			path = path.substr(options.baseURI.size());
+		}
+
+		const StaticString headers[] = {
+			P_STATIC_STRING("REQUEST_URI"), uri,
+			P_STATIC_STRING("PATH_INFO"), path,
+			P_STATIC_STRING("SCRIPT_NAME"), scriptName,
+			P_STATIC_STRING("QUERY_STRING"), query,
+			P_STATIC_STRING("REQUEST_METHOD"), P_STATIC_STRING("GET"),
+			P_STATIC_STRING("SERVER_NAME"), P_STATIC_STRING("localhost"),
+			P_STATIC_STRING("SERVER_PORT"), P_STATIC_STRING("80"),
+			P_STATIC_STRING("SERVER_SOFTWARE"), P_STATIC_STRING(SERVER_TOKEN_NAME),
+			P_STATIC_STRING("SERVER_PROTOCOL"), P_STATIC_STRING("HTTP/1.1"),
+			P_STATIC_STRING("REMOTE_ADDR"), P_STATIC_STRING("127.0.0.1"),
+			P_STATIC_STRING("REMOTE_PORT"), P_STATIC_STRING("0"),
+			P_STATIC_STRING("HTTP_HOST"), P_STATIC_STRING("localhost"),
+			P_STATIC_STRING("HTTP_USER_AGENT"), P_STATIC_STRING(SERVER_TOKEN_NAME " warm-up")
+		};
+		writeSessionProtocolRequest(connection.fd, headers,
+			sizeof(headers) / sizeof(headers[0]) / 2, timeout);
+	} else {
+		string request = "GET " + uri + " HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"User-Agent: " SERVER_TOKEN_NAME " warm-up\r\n"
+			"Connection: close\r\n"
+			"\r\n";
+		writeExact(connection.fd, request, timeout);
+	}
+
+	// We do not care what the actual response is ... just read it until
+	// the application closes the connection.
+	UPDATE_TRACE_POINT();
+	char buf[1024 * 8];
+	while (true) {
+		if (!waitUntilReadable(connection.fd, timeout)) {
+			throw TimeoutException("Timeout reading warm-up response");
+		}
+		ssize_t ret = syscalls::read(connection.fd, buf, sizeof(buf));
+		if (ret == -1) {
+			int e = errno;
+			throw SystemException("Cannot read warm-up response", e);
+		} else if (ret == 0) {
+			break;
+		}
+	}
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
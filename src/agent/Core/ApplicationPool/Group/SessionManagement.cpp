@@ -153,6 +153,7 @@ Group::onSessionClose(Process *process, Session *session) {
 
 	/* Update statistics. */
 	bool wasTotallyBusy = process->isTotallyBusy();
+	recordServiceTime(session, SystemTime::getUsec());
 	process->sessionClosed(session);
 	assert(process->getLifeStatus() == Process::ALIVE);
 	assert(process->enabled == Process::ENABLED
@@ -258,6 +259,10 @@ Group::get(const Options &newOptions, const GetCallback &callback,
 {
 	assert(isAlive());
 
+	if (OXT_LIKELY(!newOptions.noop)) {
+		recordRequestArrival(newOptions.currentTime);
+	}
+
 	if (OXT_LIKELY(!restarting())) {
 		if (OXT_UNLIKELY(needsRestart(newOptions))) {
 			restart(newOptions);
@@ -268,17 +273,26 @@ Group::get(const Options &newOptions, const GetCallback &callback,
 			// If we're trying to spawn the first process for this group, and
 			// spawning failed because the pool is at full capacity, then we
 			// try to kill some random idle process in the pool and try again.
-			if (spawn() == SR_ERR_POOL_AT_FULL_CAPACITY && enabledCount == 0) {
-				P_INFO("Unable to spawn the the sole process for group " << info.name <<
-					" because the max pool size has been reached. Trying " <<
-					"to shutdown another idle process to free capacity...");
-				if (poolForceFreeCapacity(this, postLockActions) != NULL) {
+			// If this group already has processes, but is below its fair share
+			// of the pool capacity, then we try to take an idle process away
+			// from a group that is above its fair share.
+			if (spawn() == SR_ERR_POOL_AT_FULL_CAPACITY) {
+				if (enabledCount == 0) {
+					P_INFO("Unable to spawn the the sole process for group " << info.name <<
+						" because the max pool size has been reached. Trying " <<
+						"to shutdown another idle process to free capacity...");
+					if (poolForceFreeCapacity(this, postLockActions) != NULL) {
+						SpawnResult result = spawn();
+						assert(result == SR_OK);
+						(void) result;
+					} else {
+						P_INFO("There are no processes right now that are eligible "
+							"for shutdown. Will try again later.");
+					}
+				} else if (getPool()->reclaimCapacityForFairShare(this, postLockActions) != NULL) {
 					SpawnResult result = spawn();
 					assert(result == SR_OK);
 					(void) result;
-				} else {
-					P_INFO("There are no processes right now that are eligible "
-						"for shutdown. Will try again later.");
 				}
 			}
 		}
@@ -301,7 +315,7 @@ Group::get(const Options &newOptions, const GetCallback &callback,
 		 * after a process has been spawned or has failed to spawn, or
 		 * when a disabling process becomes available.
 		 */
-		assert(m_spawning || restarting() || poolAtFullCapacity());
+		assert(m_spawning || replacementsBeingSpawned > 0 || restarting() || poolAtFullCapacity());
 
 		if (disablingCount > 0 && !restarting()) {
 			Process *process = findProcessWithLowestBusyness(disablingProcesses);
@@ -91,6 +91,7 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 
 		ProcessPtr process;
 		ExceptionPtr exception;
+		SpawningKit::Result spawnResult;
 		try {
 			UPDATE_TRACE_POINT();
 			boost::this_thread::restore_interruption ri(di);
@@ -104,7 +105,8 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 				e.setSummary("Simulated failure");
 				throw e.finalize();
 			} else {
-				process = createProcessObject(*spawner, spawner->spawn(options));
+				spawnResult = spawner->spawn(options);
+				process = createProcessObject(*spawner, spawnResult);
 			}
 		} catch (const boost::thread_interrupted &) {
 			break;
@@ -121,6 +123,16 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 		ScopeGuard guard(boost::bind(Process::forceTriggerShutdownAndCleanup, process));
 		boost::unique_lock<boost::mutex> lock(pool->syncher);
 
+		if (process != NULL) {
+			pool->metrics.processesSpawned.add();
+			spawnJourneyStats.record(spawnResult.journeyStepDurations,
+				(spawnResult.spawnEndTimeMonotonic > spawnResult.spawnStartTimeMonotonic)
+				? spawnResult.spawnEndTimeMonotonic - spawnResult.spawnStartTimeMonotonic
+				: 0);
+		} else {
+			pool->metrics.spawnErrors.add();
+		}
+
 		if (!isAlive()) {
 			if (process != NULL) {
 				P_DEBUG("Group is being shut down so dropping process " <<
@@ -186,7 +198,8 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 		}
 
 		done = done
-			|| (processLowerLimitsSatisfied() && getWaitlist.empty())
+			|| (processLowerLimitsSatisfied() && predictedDemandSatisfied()
+				&& getWaitlist.empty())
 			|| processUpperLimitsReached()
 			|| pool->atFullCapacityUnlocked();
 		m_spawning = !done;
@@ -199,6 +212,7 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 
 		UPDATE_TRACE_POINT();
 		pool->fullVerifyInvariants();
+		pool->publishMetricsUnlocked();
 		lock.unlock();
 		UPDATE_TRACE_POINT();
 		runAllActions(actions);
@@ -307,6 +321,16 @@ Group::restart(const Options &options, RestartMethod method) {
 	boost::container::vector<Callback> actions;
 
 	assert(isAlive());
+
+	// A rolling restart only makes sense if there are processes to keep
+	// serving requests in the mean time.
+	if ((method == RM_ROLLING || (method == RM_DEFAULT && this->options.rollingRestart))
+	 && enabledCount > 0)
+	{
+		startRollingRestart(options);
+		return;
+	}
+
 	P_DEBUG("Restarting group " << getName());
 
 	// If there is currently a restarter thread or a spawner thread active,
@@ -314,6 +338,7 @@ Group::restart(const Options &options, RestartMethod method) {
 	restartsInitiated++;
 
 	processesBeingSpawned = 0;
+	replacementsBeingSpawned = 0;
 	m_spawning   = false;
 	m_restarting = true;
 	uuid         = generateUuid(pool);
@@ -460,6 +485,7 @@ Group::shouldSpawn() const {
 			!processLowerLimitsSatisfied()
 			|| allEnabledProcessesAreTotallyBusy()
 			|| !getWaitlist.empty()
+			|| !predictedDemandSatisfied()
 		);
 }
 
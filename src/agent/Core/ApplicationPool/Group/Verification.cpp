@@ -64,15 +64,15 @@ Group::verifyInvariants() const {
 	assert(disablingCount >= 0);
 	assert(disabledCount >= 0);
 	assert(nEnabledProcessesTotallyBusy >= 0);
-	assert(!( enabledCount == 0 && disablingCount > 0 ) || ( processesBeingSpawned > 0) );
+	assert(!( enabledCount == 0 && disablingCount > 0 ) || ( processesBeingSpawned > 0 || replacementsBeingSpawned > 0 ) );
 	assert(!( !m_spawning ) || ( enabledCount > 0 || disablingCount == 0 ));
 
 	assert((lifeStatus == ALIVE) == (spawner != NULL));
 
 	// Verify getWaitlist invariants.
 	assert(!( !getWaitlist.empty() ) || ( enabledProcesses.empty() || verifyNoRequestsOnGetWaitlistAreRoutable() ));
-	assert(!( enabledProcesses.empty() && !m_spawning && !restarting() && !poolAtFullCapacity() ) || ( getWaitlist.empty() ));
-	assert(!( !getWaitlist.empty() ) || ( !enabledProcesses.empty() || m_spawning || restarting() || poolAtFullCapacity() ));
+	assert(!( enabledProcesses.empty() && !m_spawning && replacementsBeingSpawned == 0 && !restarting() && !poolAtFullCapacity() ) || ( getWaitlist.empty() ));
+	assert(!( !getWaitlist.empty() ) || ( !enabledProcesses.empty() || m_spawning || replacementsBeingSpawned > 0 || restarting() || poolAtFullCapacity() ));
 
 	// Verify disableWaitlist invariants.
 	assert((int) disableWaitlist.size() >= disablingCount);
@@ -51,14 +51,18 @@
 #include <Core/ApplicationPool/Pool/GeneralUtils.cpp>
 #include <Core/ApplicationPool/Pool/GroupUtils.cpp>
 #include <Core/ApplicationPool/Pool/ProcessUtils.cpp>
+#include <Core/ApplicationPool/Pool/FairSharing.cpp>
 #include <Core/ApplicationPool/Pool/StateInspection.cpp>
+#include <Core/ApplicationPool/Pool/Snapshot.cpp>
 #include <Core/ApplicationPool/Pool/Miscellaneous.cpp>
 #include <Core/ApplicationPool/Group/InitializationAndShutdown.cpp>
 #include <Core/ApplicationPool/Group/LifetimeAndBasics.cpp>
 #include <Core/ApplicationPool/Group/SessionManagement.cpp>
 #include <Core/ApplicationPool/Group/SpawningAndRestarting.cpp>
+#include <Core/ApplicationPool/Group/RollingRestart.cpp>
 #include <Core/ApplicationPool/Group/ProcessListManagement.cpp>
 #include <Core/ApplicationPool/Group/OutOfBandWork.cpp>
+#include <Core/ApplicationPool/Group/DemandForecasting.cpp>
 #include <Core/ApplicationPool/Group/Miscellaneous.cpp>
 #include <Core/ApplicationPool/Group/InternalUtils.cpp>
 #include <Core/ApplicationPool/Group/StateInspection.cpp>
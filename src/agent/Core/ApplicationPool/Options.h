@@ -117,6 +117,7 @@ private:
 		result.push_back(&options.uri);
 
 		result.push_back(&options.stickySessionsCookieAttributes);
+		result.push_back(&options.warmupURIs);
 
 		return result;
 	}
@@ -312,6 +313,12 @@ public:
 	 */
 	bool loadShellEnvvars;
 
+	/** The number of seconds for which the environment variables loaded from
+	 * the shell startup files may be cached and reused by later spawns.
+	 * 0 means no caching.
+	 */
+	unsigned int shellEnvvarsCacheTtl;
+
 	bool userSwitching;
 
 	/**
@@ -341,6 +348,17 @@ public:
 	 */
 	unsigned int maxProcesses;
 
+	/**
+	 * The relative weight of this group when the pool has to divide its
+	 * capacity between groups. A group with weight 2 is entitled to twice
+	 * as many processes as a group with weight 1. `minProcesses` acts as a
+	 * guaranteed reservation and `maxProcesses` as the burst maximum.
+	 * See Pool/FairSharing.cpp.
+	 *
+	 * A value of 0 is treated as 1.
+	 */
+	unsigned int fairShareWeight;
+
 	/** The number of seconds that preloader processes may stay alive idling. */
 	long maxPreloaderIdleTime;
 
@@ -368,6 +386,19 @@ public:
 	 */
 	StaticString stickySessionsCookieAttributes;
 
+	/**
+	 * Whether Group::restart() performs a rolling restart when called
+	 * with RM_DEFAULT. See Group/RollingRestart.cpp.
+	 */
+	bool rollingRestart;
+
+	/**
+	 * A space-separated list of URIs that are requested on every new
+	 * process during a rolling restart, before that process receives
+	 * any traffic.
+	 */
+	StaticString warmupURIs;
+
 	/*-----------------*/
 
 
@@ -460,16 +491,19 @@ public:
 		  forceMaxConcurrentRequestsPerProcess(-1),
 		  debugger(false),
 		  loadShellEnvvars(true),
+		  shellEnvvarsCacheTtl(0),
 		  userSwitching(true),
 		  raiseInternalError(false),
 
 		  minProcesses(1),
 		  maxProcesses(0),
+		  fairShareWeight(1),
 		  maxPreloaderIdleTime(-1),
 		  maxOutOfBandWorkInstances(1),
 		  maxRequestQueueSize(DEFAULT_MAX_REQUEST_QUEUE_SIZE),
 		  abortWebsocketsOnProcessShutdown(true),
 		  stickySessionsCookieAttributes(DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES, sizeof(DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES) - 1),
+		  rollingRestart(false),
 
 		  stickySessionId(0),
 		  statThrottleRate(DEFAULT_STAT_THROTTLE_RATE),
@@ -598,9 +632,12 @@ public:
 		if (fields & PER_GROUP_POOL_OPTIONS) {
 			appendKeyValue3(vec, "min_processes",       minProcesses);
 			appendKeyValue3(vec, "max_processes",       maxProcesses);
+			appendKeyValue3(vec, "fair_share_weight",   fairShareWeight);
 			appendKeyValue2(vec, "max_preloader_idle_time", maxPreloaderIdleTime);
 			appendKeyValue3(vec, "max_out_of_band_work_instances", maxOutOfBandWorkInstances);
 			appendKeyValue (vec, "sticky_sessions_cookie_attributes", stickySessionsCookieAttributes);
+			appendKeyValue4(vec, "rolling_restart",     rollingRestart);
+			appendKeyValue (vec, "warmup_uris",         warmupURIs);
 		}
 
 		/*********************************/
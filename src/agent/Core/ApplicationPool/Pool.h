@@ -59,12 +59,15 @@
 #include <Utils/AnsiColorConstants.h>
 #include <Utils/MessagePassing.h>
 #include <Utils/VariantMap.h>
+#include <Utils/OpenMetrics.h>
+#include <JsonTools/JsonWriter.h>
 #include <Core/ApplicationPool/Common.h>
 #include <Core/ApplicationPool/Context.h>
 #include <Core/ApplicationPool/Process.h>
 #include <Core/ApplicationPool/Group.h>
 #include <Core/ApplicationPool/Session.h>
 #include <Core/ApplicationPool/Options.h>
+#include <Core/ApplicationPool/Snapshot.h>
 #include <Core/SpawningKit/Factory.h>
 #include <Shared/ApplicationPoolApiKey.h>
 
@@ -112,23 +115,37 @@ public:
 
 	/****** State inspection ******/
 
+	/**
+	 * The `maxSnapshotAge` that consumers which poll the Pool state
+	 * periodically (the API server pool endpoints used by passenger-status,
+	 * and the admin panel connector) pass to the state inspection methods,
+	 * in microseconds. It bounds the rate at which they take the Pool lock
+	 * to capture a snapshot, no matter how many of them there are.
+	 */
+	static const unsigned long long POLLING_SNAPSHOT_MAX_AGE = 250000;
+
 	struct InspectOptions: public AuthenticationOptions {
 		bool colorize;
 		bool verbose;
+		/** See `Pool::getSnapshot()`. */
+		unsigned long long maxSnapshotAge;
 
 		InspectOptions()
 			: colorize(false),
-			  verbose(false)
+			  verbose(false),
+			  maxSnapshotAge(0)
 			{ }
 
 		InspectOptions(const VariantMap &options)
 			: colorize(options.getBool("colorize", false, false)),
-			  verbose(options.getBool("verbose", false, false))
+			  verbose(options.getBool("verbose", false, false)),
+			  maxSnapshotAge(0)
 			{ }
 
 		InspectOptions(const Json::Value &options)
 			: colorize(options.get("colorize", false).asBool()),
-			  verbose(options.get("verbose", false).asBool())
+			  verbose(options.get("verbose", false).asBool()),
+			  maxSnapshotAge(0)
 			{ }
 
 		static InspectOptions makeAuthorized() {
@@ -140,13 +157,17 @@ public:
 
 	struct ToXmlOptions: public AuthenticationOptions {
 		bool secrets;
+		/** See `Pool::getSnapshot()`. */
+		unsigned long long maxSnapshotAge;
 
 		ToXmlOptions()
-			: secrets(true)
+			: secrets(true),
+			  maxSnapshotAge(0)
 			{ }
 
 		ToXmlOptions(const VariantMap &options)
-			: secrets(options.getBool("secrets", false, false))
+			: secrets(options.getBool("secrets", false, false)),
+			  maxSnapshotAge(0)
 			{ }
 
 		static ToXmlOptions makeAuthorized() {
@@ -159,10 +180,13 @@ public:
 	struct ToJsonOptions: public AuthenticationOptions {
 		bool hasApplicationIdsFilter;
 		StringKeyTable<bool> applicationIdsFilter;
+		/** See `Pool::getSnapshot()`. */
+		unsigned long long maxSnapshotAge;
 
 		ToJsonOptions()
 			: hasApplicationIdsFilter(false),
-			  applicationIdsFilter(0, 0)
+			  applicationIdsFilter(0, 0),
+			  maxSnapshotAge(0)
 			{ }
 
 		void set(const Json::Value &_options) {
@@ -234,6 +258,14 @@ public:
 	mutable GroupMap groups;
 	psg_pool_t *palloc;
 
+	/**
+	 * The most recently captured state snapshot. Protected by
+	 * `snapshotSyncher` instead of `syncher`, so that it can be handed out
+	 * without contending with the Pool lock.
+	 */
+	mutable boost::mutex snapshotSyncher;
+	mutable PoolSnapshotPtr latestSnapshot;
+
 	/**
 	 * get() requests that...
 	 * - cannot be immediately satisfied because the pool is at full
@@ -322,6 +354,7 @@ public:
 		const ProcessMetricMap &allMetrics,
 		vector<ProcessPtr> &processesToDetach);
 	void realCollectAnalytics();
+	void publishMetricsUnlocked();
 
 
 	/****** Garbage collection ******/
@@ -403,7 +436,6 @@ public:
 		}
 	};
 
-	ProcessPtr findOldestIdleProcess(const Group *exclude = NULL) const;
 	ProcessPtr findBestProcessToTrash() const;
 	ProcessPtr forceFreeCapacity(const Group *exclude,
 		boost::container::vector<Callback> &postLockActions);
@@ -414,6 +446,24 @@ public:
 	void possiblySpawnMoreProcessesForExistingGroups();
 
 
+	/****** Fair sharing ******/
+
+	unsigned int totalFairShareWeightUnlocked() const;
+	double fairShareUnlocked(const Group *group, unsigned int totalWeight) const;
+	double fairShareUsageUnlocked(const Group *group, unsigned int totalWeight) const;
+	bool belowFairShareUnlocked(const Group *group) const;
+	ProcessPtr findIdleProcessToEvict(const Group *exclude, bool onlyAboveFairShare) const;
+	ProcessPtr reclaimCapacityForFairShare(const Group *group,
+		boost::container::vector<Callback> &postLockActions);
+	void findGroupsInFairShareOrder(vector<Group *> &result,
+		bool (Group::*predicate)() const) const;
+	static bool compareFairShareUsage(const pair<double, Group *> &a,
+		const pair<double, Group *> &b);
+	void sortGetWaitlistInFairShareOrder();
+	static bool compareGetWaiterFairShareUsage(const pair<double, unsigned int> &a,
+		const pair<double, unsigned int> &b);
+
+
 	/****** State inspection ******/
 
 	static Json::Value makeSingleValueJsonConfigFormat(const Json::Value &v,
@@ -424,12 +474,34 @@ public:
 	static Json::Value makeSingleNonEmptyStrValueJsonConfigFormat(const StaticString &val);
 	unsigned int capacityUsedUnlocked() const;
 	bool atFullCapacityUnlocked() const;
-	void inspectProcessList(const InspectOptions &options, stringstream &result,
-		const Group *group, const ProcessList &processes) const;
+	static void inspectProcessList(const InspectOptions &options, stringstream &result,
+		const GroupSnapshot &group, const vector<ProcessSnapshot> &processes);
+	PoolSnapshotPtr captureSnapshotUnlocked() const;
 
 public:
+	/**
+	 * Pool-wide counters and gauges which can be read from any thread without
+	 * grabbing `syncher`. They are only written while holding `syncher`.
+	 * Counters are updated as the events happen, while gauges are published
+	 * by publishMetricsUnlocked() after spawns and on every analytics
+	 * collection.
+	 */
+	struct Metrics {
+		MetricCounter processesSpawned;
+		MetricCounter spawnErrors;
+
+		MetricGauge groups;
+		MetricGauge processes;
+		MetricGauge processesBeingSpawned;
+		MetricGauge capacityUsed;
+		MetricGauge maxCapacity;
+		MetricGauge busySessions;
+		MetricGauge queuedRequests;
+	};
+
 	typedef void (*AbortLongRunningConnectionsCallback)(const ProcessPtr &process);
 	AbortLongRunningConnectionsCallback abortLongRunningConnectionsCallback;
+	Metrics metrics;
 
 
 	/****** Initialization and shutdown ******/
@@ -480,12 +552,15 @@ public:
 	bool atFullCapacity() const;
 	unsigned int getProcessCount(bool lock = true) const;
 	unsigned int getGroupCount() const;
+	PoolSnapshotPtr getSnapshot(unsigned long long maxAge = 0, bool lock = true) const;
 	string inspect(const InspectOptions &options = InspectOptions::makeAuthorized(),
 		bool lock = true) const;
 	string toXml(const ToXmlOptions &options = ToXmlOptions::makeAuthorized(),
 		bool lock = true) const;
-	Json::Value inspectPropertiesInAdminPanelFormat(const ToJsonOptions &options = ToJsonOptions::makeAuthorized()) const;
+	void writePropertiesInAdminPanelFormat(JsonWriter &writer,
+		const ToJsonOptions &options = ToJsonOptions::makeAuthorized()) const;
 	Json::Value inspectConfigInAdminPanelFormat(const ToJsonOptions &options = ToJsonOptions::makeAuthorized()) const;
+	Json::Value inspectSpawnStatsAsJson(const AuthenticationOptions &options = AuthenticationOptions::makeAuthorized()) const;
 
 
 	/****** Miscellaneous ******/
@@ -105,6 +105,42 @@ Pool::updateProcessMetrics(const ProcessList &processes,
 	}
 }
 
+/**
+ * Publishes the current values of the gauges in `metrics`.
+ */
+void
+Pool::publishMetricsUnlocked() {
+	GroupMap::ConstIterator g_it(groups);
+	unsigned int processCount = 0;
+	unsigned int processesBeingSpawned = 0;
+	unsigned int capacityUsed = 0;
+	unsigned int busySessions = 0;
+	unsigned int queuedRequests = getWaitlist.size();
+
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		processCount += group->getProcessCount();
+		processesBeingSpawned += group->processesBeingSpawned;
+		capacityUsed += group->capacityUsed();
+		queuedRequests += group->getWaitlist.size();
+		foreach (const ProcessPtr &process, group->enabledProcesses) {
+			busySessions += process->sessions;
+		}
+		foreach (const ProcessPtr &process, group->disablingProcesses) {
+			busySessions += process->sessions;
+		}
+		g_it.next();
+	}
+
+	metrics.groups.set(groups.size());
+	metrics.processes.set(processCount);
+	metrics.processesBeingSpawned.set(processesBeingSpawned);
+	metrics.capacityUsed.set(capacityUsed);
+	metrics.maxCapacity.set(max);
+	metrics.busySessions.set(busySessions);
+	metrics.queuedRequests.set(queuedRequests);
+}
+
 void
 Pool::realCollectAnalytics() {
 	TRACE_POINT();
@@ -126,6 +162,8 @@ Pool::realCollectAnalytics() {
 		LockGuard l(syncher);
 		GroupMap::ConstIterator g_it(groups);
 
+		publishMetricsUnlocked();
+
 		while (*g_it != NULL) {
 			const GroupPtr &group = g_it.getValue();
 			collectPids(group->enabledProcesses, pids);
@@ -0,0 +1,292 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/ApplicationPool/Pool.h>
+
+/*************************************************************************
+ *
+ * Fair sharing of pool capacity between Groups
+ *
+ * When the pool is at full capacity, Groups compete for processes. Every
+ * Group is entitled to a share of the pool capacity that is proportional
+ * to its `fairShareWeight`, but never less than `minProcesses` (its
+ * guaranteed reservation) and never more than `maxProcesses` (its burst
+ * maximum, if set). The ratio between the capacity that a Group uses and
+ * the share that it's entitled to is its "fair share usage".
+ *
+ * - Groups with a lower fair share usage get to spawn first.
+ * - When capacity must be freed, idle processes are evicted from the Group
+ *   with the highest fair share usage first. Groups that don't use more
+ *   than their `minProcesses` are only evicted from as a last resort.
+ * - A Group that is below its fair share may evict idle processes from
+ *   Groups that are above their fair share, even if it already has
+ *   processes of its own.
+ * - Requests waiting for pool capacity are served in order of ascending
+ *   fair share usage of the Group they're for.
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+using namespace boost;
+
+
+/****************************
+ *
+ * Private methods
+ *
+ ****************************/
+
+
+unsigned int
+Pool::totalFairShareWeightUnlocked() const {
+	unsigned int result = 0;
+	GroupMap::ConstIterator g_it(groups);
+	while (*g_it != NULL) {
+		result += g_it.getValue()->getFairShareWeight();
+		g_it.next();
+	}
+	return result;
+}
+
+/**
+ * Returns the number of processes that the given Group is entitled to.
+ * `totalWeight` must be the result of `totalFairShareWeightUnlocked()`.
+ */
+double
+Pool::fairShareUnlocked(const Group *group, unsigned int totalWeight) const {
+	double share;
+	if (totalWeight == 0) {
+		share = max;
+	} else {
+		share = (double) max * group->getFairShareWeight() / totalWeight;
+	}
+	if (share < group->options.minProcesses) {
+		share = group->options.minProcesses;
+	}
+	if (group->options.maxProcesses != 0 && share > group->options.maxProcesses) {
+		share = group->options.maxProcesses;
+	}
+	return share;
+}
+
+double
+Pool::fairShareUsageUnlocked(const Group *group, unsigned int totalWeight) const {
+	double share = fairShareUnlocked(group, totalWeight);
+	if (share <= 0) {
+		return group->capacityUsed() > 0 ? 1e9 : 0;
+	} else {
+		return group->capacityUsed() / share;
+	}
+}
+
+bool
+Pool::belowFairShareUnlocked(const Group *group) const {
+	return group->capacityUsed() < fairShareUnlocked(group,
+		totalFairShareWeightUnlocked());
+}
+
+/**
+ * Finds an idle process that may be evicted in order to free capacity.
+ * Processes in the Group with the highest fair share usage are preferred;
+ * within a Group, the process that has been idle for the longest time
+ * is chosen. Groups that use no more than their `minProcesses` are skipped,
+ * unless no other Group has an idle process, in which case the process
+ * that has been idle for the longest time overall is chosen.
+ *
+ * If `onlyAboveFairShare` is true, then only processes in Groups that
+ * would still be at or above their fair share after the eviction are
+ * considered. This prevents two Groups from stealing capacity back and
+ * forth from each other.
+ */
+ProcessPtr
+Pool::findIdleProcessToEvict(const Group *exclude, bool onlyAboveFairShare) const {
+	unsigned int totalWeight = totalFairShareWeightUnlocked();
+	ProcessPtr result, lastResort;
+	double resultUsage = 0;
+
+	GroupMap::ConstIterator g_it(groups);
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		if (group.get() == exclude) {
+			g_it.next();
+			continue;
+		}
+		if (onlyAboveFairShare
+		 && group->capacityUsed() < fairShareUnlocked(group.get(), totalWeight) + 1)
+		{
+			g_it.next();
+			continue;
+		}
+
+		ProcessPtr oldestIdleProcess;
+		const ProcessList &processes = group->enabledProcesses;
+		ProcessList::const_iterator p_it, p_end = processes.end();
+		for (p_it = processes.begin(); p_it != p_end; p_it++) {
+			const ProcessPtr &process = *p_it;
+			if (process->busyness() == 0
+			     && (oldestIdleProcess == NULL
+			         || process->lastUsed < oldestIdleProcess->lastUsed)
+			) {
+				oldestIdleProcess = process;
+			}
+		}
+
+		if (oldestIdleProcess != NULL
+		 && group->capacityUsed() <= group->options.minProcesses)
+		{
+			if (lastResort == NULL || oldestIdleProcess->lastUsed < lastResort->lastUsed) {
+				lastResort = oldestIdleProcess;
+			}
+		} else if (oldestIdleProcess != NULL) {
+			double usage = fairShareUsageUnlocked(group.get(), totalWeight);
+			if (result == NULL
+			 || usage > resultUsage
+			 || (usage == resultUsage && oldestIdleProcess->lastUsed < result->lastUsed))
+			{
+				result = oldestIdleProcess;
+				resultUsage = usage;
+			}
+		}
+
+		g_it.next();
+	}
+
+	if (result == NULL) {
+		return lastResort;
+	} else {
+		return result;
+	}
+}
+
+/**
+ * If the given Group is below its fair share, evicts an idle process from
+ * a Group that is above its fair share so that the given Group can spawn.
+ * Returns the evicted process, or NULL if nothing was evicted.
+ *
+ * Calls Group::detach() so be sure to fix up the invariants afterwards.
+ */
+ProcessPtr
+Pool::reclaimCapacityForFairShare(const Group *group,
+	boost::container::vector<Callback> &postLockActions)
+{
+	if (!belowFairShareUnlocked(group)) {
+		return ProcessPtr();
+	}
+
+	ProcessPtr process = findIdleProcessToEvict(group, true);
+	if (process != NULL) {
+		P_DEBUG("Detaching process " << process->inspect() << " because group " <<
+			group->getName() << " is below its fair share of the pool capacity");
+
+		Group *otherGroup = process->getGroup();
+		assert(otherGroup != NULL);
+		assert(otherGroup->getWaitlist.empty());
+
+		otherGroup->detach(process, postLockActions);
+	}
+	return process;
+}
+
+/**
+ * Collects all Groups for which `predicate` holds, ordered by ascending
+ * fair share usage. Groups with equal usage keep their relative order.
+ */
+void
+Pool::findGroupsInFairShareOrder(vector<Group *> &result,
+	bool (Group::*predicate)() const) const
+{
+	unsigned int totalWeight = totalFairShareWeightUnlocked();
+	vector< pair<double, Group *> > candidates;
+
+	GroupMap::ConstIterator g_it(groups);
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		if ((group.get()->*predicate)()) {
+			candidates.push_back(make_pair(
+				fairShareUsageUnlocked(group.get(), totalWeight),
+				group.get()));
+		}
+		g_it.next();
+	}
+
+	std::stable_sort(candidates.begin(), candidates.end(), compareFairShareUsage);
+
+	result.reserve(candidates.size());
+	vector< pair<double, Group *> >::const_iterator it, end = candidates.end();
+	for (it = candidates.begin(); it != end; it++) {
+		result.push_back(it->second);
+	}
+}
+
+bool
+Pool::compareFairShareUsage(const pair<double, Group *> &a, const pair<double, Group *> &b) {
+	return a.first < b.first;
+}
+
+/**
+ * Orders `getWaitlist` by ascending fair share usage of the Group that each
+ * waiter is for. Groups that don't exist yet use no capacity, so their
+ * waiters come first. Waiters with equal usage keep their arrival order.
+ */
+void
+Pool::sortGetWaitlistInFairShareOrder() {
+	if (getWaitlist.size() < 2) {
+		return;
+	}
+
+	unsigned int totalWeight = totalFairShareWeightUnlocked();
+	vector< pair<double, unsigned int> > order;
+	order.reserve(getWaitlist.size());
+	for (unsigned int i = 0; i < getWaitlist.size(); i++) {
+		const Group *group = findMatchingGroup(getWaitlist[i].options);
+		order.push_back(make_pair(
+			(group == NULL) ? 0 : fairShareUsageUnlocked(group, totalWeight),
+			i));
+	}
+
+	std::stable_sort(order.begin(), order.end(), compareGetWaiterFairShareUsage);
+
+	vector<GetWaiter> sortedWaitlist;
+	sortedWaitlist.reserve(getWaitlist.size());
+	vector< pair<double, unsigned int> >::const_iterator it, end = order.end();
+	for (it = order.begin(); it != end; it++) {
+		sortedWaitlist.push_back(getWaitlist[it->second]);
+	}
+	getWaitlist.swap(sortedWaitlist);
+}
+
+bool
+Pool::compareGetWaiterFairShareUsage(const pair<double, unsigned int> &a,
+	const pair<double, unsigned int> &b)
+{
+	return a.first < b.first;
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
@@ -110,10 +110,14 @@ Pool::garbageCollectProcessesInGroup(GarbageCollectorState &state,
 			processesToGc);
 	}
 
+	// Keep the processes that the demand forecast predicts will be needed.
+	unsigned long minProcessesToKeep = std::max<unsigned long>(
+		group->options.minProcesses, group->getPredictedProcessesNeeded());
+
 	p_it  = processesToGc.begin();
 	p_end = processesToGc.end();
 	while (p_it != p_end
-	 && (unsigned long) group->getProcessCount() > group->options.minProcesses)
+	 && (unsigned long) group->getProcessCount() > minProcessesToKeep)
 	{
 		ProcessPtr process = *p_it;
 		P_DEBUG("Garbage collect idle process: " << process->inspect() <<
@@ -154,6 +158,9 @@ Pool::realGarbageCollect() {
 	while (*g_it != NULL) {
 		const GroupPtr group = g_it.getValue();
 
+		// ...let the demand forecast decay if no requests have arrived lately.
+		group->updateDemandForecast(state.now);
+
 		if (maxIdleTime > 0) {
 			// ...detach processes that have been idle for more than maxIdleTime.
 			garbageCollectProcessesInGroup(state, group);
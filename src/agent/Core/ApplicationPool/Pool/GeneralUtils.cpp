@@ -148,9 +148,12 @@ Pool::fullVerifyInvariants() const {
  * Process all waiters on the getWaitlist. Call when capacity has become free.
  * This function assigns sessions to them by calling get() on the corresponding
  * Groups, or by creating more Groups, in so far the new capacity allows.
+ * Waiters are served in fair share order, see Pool/FairSharing.cpp.
  */
 void
 Pool::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions) {
+	sortGetWaitlistInFairShareOrder();
+
 	bool done = false;
 	vector<GetWaiter>::iterator it, end = getWaitlist.end();
 	vector<GetWaiter> newWaitlist;
@@ -45,34 +45,6 @@ using namespace boost;
  ****************************/
 
 
-ProcessPtr
-Pool::findOldestIdleProcess(const Group *exclude) const {
-	ProcessPtr oldestIdleProcess;
-
-	GroupMap::ConstIterator g_it(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (group.get() == exclude) {
-			g_it.next();
-			continue;
-		}
-		const ProcessList &processes = group->enabledProcesses;
-		ProcessList::const_iterator p_it, p_end = processes.end();
-		for (p_it = processes.begin(); p_it != p_end; p_it++) {
-			const ProcessPtr process = *p_it;
-			if (process->busyness() == 0
-			     && (oldestIdleProcess == NULL
-			         || process->lastUsed < oldestIdleProcess->lastUsed)
-			) {
-				oldestIdleProcess = process;
-			}
-		}
-		g_it.next();
-	}
-
-	return oldestIdleProcess;
-}
-
 ProcessPtr
 Pool::findBestProcessToTrash() const {
 	ProcessPtr oldestProcess;
@@ -98,12 +70,14 @@ Pool::findBestProcessToTrash() const {
 /**
  * Calls Group::detach() so be sure to fix up the invariants afterwards.
  * See the comments for Group::detach() and the code for detachProcessUnlocked().
+ * The process to detach is chosen according to the fair sharing rules,
+ * see Pool/FairSharing.cpp.
  */
 ProcessPtr
 Pool::forceFreeCapacity(const Group *exclude,
 	boost::container::vector<Callback> &postLockActions)
 {
-	ProcessPtr process = findOldestIdleProcess(exclude);
+	ProcessPtr process = findIdleProcessToEvict(exclude, false);
 	if (process != NULL) {
 		P_DEBUG("Forcefully detaching process " << process->inspect() <<
 			" in order to free capacity in the pool");
@@ -153,34 +127,33 @@ Pool::syncDisableProcessCallback(const ProcessPtr &process, DisableResult result
 void
 Pool::possiblySpawnMoreProcessesForExistingGroups() {
 	/* Looks for Groups that are waiting for capacity to become available,
-	 * and spawn processes in those groups.
+	 * and spawn processes in those groups. Groups that use the least of
+	 * their fair share go first.
 	 */
-	GroupMap::ConstIterator g_it(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (group->isWaitingForCapacity()) {
-			P_DEBUG("Group " << group->getName() << " is waiting for capacity");
-			group->spawn();
-			if (atFullCapacityUnlocked()) {
-				return;
-			}
+	vector<Group *> candidates;
+	vector<Group *>::const_iterator it;
+
+	findGroupsInFairShareOrder(candidates, &Group::isWaitingForCapacity);
+	for (it = candidates.begin(); it != candidates.end(); it++) {
+		Group *group = *it;
+		P_DEBUG("Group " << group->getName() << " is waiting for capacity");
+		group->spawn();
+		if (atFullCapacityUnlocked()) {
+			return;
 		}
-		g_it.next();
 	}
 	/* Now look for Groups that haven't maximized their allowed capacity
 	 * yet, and spawn processes in those groups.
 	 */
-	g_it = GroupMap::ConstIterator(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (group->shouldSpawn()) {
-			P_DEBUG("Group " << group->getName() << " requests more processes to be spawned");
-			group->spawn();
-			if (atFullCapacityUnlocked()) {
-				return;
-			}
+	candidates.clear();
+	findGroupsInFairShareOrder(candidates, &Group::shouldSpawn);
+	for (it = candidates.begin(); it != candidates.end(); it++) {
+		Group *group = *it;
+		P_DEBUG("Group " << group->getName() << " requests more processes to be spawned");
+		group->spawn();
+		if (atFullCapacityUnlocked()) {
+			return;
 		}
-		g_it.next();
 	}
 }
 
@@ -0,0 +1,524 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/ApplicationPool/Pool.h>
+#include <FileTools/PathManip.h>
+#include <modp_b64.h>
+
+/*************************************************************************
+ *
+ * Capturing and formatting state snapshots for ApplicationPool2::Pool
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+using namespace boost;
+
+
+/****************************
+ *
+ * Capturing
+ *
+ ****************************/
+
+
+SocketSnapshot::SocketSnapshot(const Socket &socket)
+	: address(socket.address.data(), socket.address.size()),
+	  protocol(socket.protocol.data(), socket.protocol.size()),
+	  description(socket.description.data(), socket.description.size()),
+	  concurrency(socket.concurrency),
+	  acceptHttpRequests(socket.acceptHttpRequests),
+	  sessions(socket.sessions)
+	{ }
+
+ProcessSnapshot::ProcessSnapshot(const Process &process)
+	: pid(process.getPid()),
+	  stickySessionId(process.getStickySessionId()),
+	  gupid(process.getGupid().data(), process.getGupid().size()),
+	  concurrency(process.getConcurrency()),
+	  sessions(process.sessions),
+	  busyness(process.busyness()),
+	  processed(process.processed),
+	  spawnerCreationTime(process.getSpawnerCreationTime()),
+	  spawnStartTime(process.getSpawnStartTime()),
+	  spawnEndTime(process.getSpawnEndTime()),
+	  lastUsed(process.lastUsed),
+	  codeRevision(process.getCodeRevision().data(), process.getCodeRevision().size()),
+	  lifeStatus(process.getLifeStatus()),
+	  enabled(process.enabled),
+	  metrics(process.metrics)
+{
+	const SocketList &processSockets = process.getSockets();
+	SocketList::const_iterator it, end = processSockets.end();
+
+	sockets.reserve(processSockets.size());
+	for (it = processSockets.begin(); it != end; it++) {
+		sockets.push_back(SocketSnapshot(*it));
+	}
+}
+
+static void
+captureProcessList(vector<ProcessSnapshot> &result, const ProcessList &processes) {
+	ProcessList::const_iterator it, end = processes.end();
+
+	result.reserve(processes.size());
+	for (it = processes.begin(); it != end; it++) {
+		result.push_back(ProcessSnapshot(**it));
+	}
+}
+
+GroupSnapshot::GroupSnapshot(const Group &group, unsigned int totalFairShareWeight)
+	: resourceLocator(&group.getResourceLocator()),
+	  wrapperRegistry(&group.getWrapperRegistry()),
+	  name(group.getName().data(), group.getName().size()),
+	  uuid(group.uuid),
+	  apiKey(group.getApiKey()),
+	  options(group.options.copyAndPersist()),
+	  lifeStatus((Group::LifeStatus) group.lifeStatus.load(boost::memory_order_relaxed)),
+	  spawning(group.spawning()),
+	  restarting(group.restarting()),
+	  enabledCount(group.enabledCount),
+	  disablingCount(group.disablingCount),
+	  disabledCount(group.disabledCount),
+	  capacityUsed(group.capacityUsed()),
+	  getWaitlistSize(group.getWaitlist.size()),
+	  disableWaitlistSize(group.disableWaitlist.size()),
+	  processesBeingSpawned(group.processesBeingSpawned),
+	  replacementsBeingSpawned(group.replacementsBeingSpawned),
+	  fairShareWeight(group.getFairShareWeight()),
+	  fairShare(group.getPool()->fairShareUnlocked(&group, totalFairShareWeight)),
+	  predictedProcessesNeeded(group.predictedProcessesNeeded),
+	  avgServiceTime(group.avgServiceTime)
+{
+	captureProcessList(enabledProcesses, group.enabledProcesses);
+	captureProcessList(disablingProcesses, group.disablingProcesses);
+	captureProcessList(disabledProcesses, group.disabledProcesses);
+	captureProcessList(detachedProcesses, group.detachedProcesses);
+}
+
+PoolSnapshotPtr
+Pool::captureSnapshotUnlocked() const {
+	boost::shared_ptr<PoolSnapshot> snapshot = boost::make_shared<PoolSnapshot>();
+	vector<GetWaiter>::const_iterator w_it, w_end = getWaitlist.end();
+	GroupMap::ConstIterator g_it(groups);
+	unsigned int totalWeight = totalFairShareWeightUnlocked();
+
+	snapshot->capturedAt = SystemTime::getMonotonicUsec();
+	snapshot->max = max;
+	snapshot->processCount = getProcessCount(false);
+	snapshot->capacityUsed = capacityUsedUnlocked();
+
+	snapshot->getWaitlist.reserve(getWaitlist.size());
+	for (w_it = getWaitlist.begin(); w_it != w_end; w_it++) {
+		snapshot->getWaitlist.push_back(w_it->options.getAppGroupName());
+	}
+
+	snapshot->groups.reserve(groups.size());
+	while (*g_it != NULL) {
+		snapshot->groups.push_back(GroupSnapshot(*g_it.getValue(), totalWeight));
+		g_it.next();
+	}
+
+	return snapshot;
+}
+
+/**
+ * Returns a snapshot of the Pool's state, for formatting without holding
+ * the Pool lock.
+ *
+ * The most recently captured snapshot is reused if it was captured no more
+ * than `maxAge` microseconds ago, in which case the Pool lock is not taken at
+ * all. This allows frequently polling consumers to bound the rate at which
+ * they contend for the Pool lock. A `maxAge` of 0 always captures a new
+ * snapshot.
+ *
+ * If `lock` is false then the caller must already hold the Pool lock.
+ */
+PoolSnapshotPtr
+Pool::getSnapshot(unsigned long long maxAge, bool lock) const {
+	PoolSnapshotPtr snapshot;
+
+	if (maxAge > 0) {
+		boost::lock_guard<boost::mutex> l(snapshotSyncher);
+		snapshot = latestSnapshot;
+	}
+	if (snapshot != NULL
+	 && SystemTime::getMonotonicUsec() - snapshot->capturedAt <= maxAge)
+	{
+		return snapshot;
+	}
+
+	{
+		DynamicScopedLock l(syncher, lock);
+		snapshot = captureSnapshotUnlocked();
+	}
+	{
+		boost::lock_guard<boost::mutex> l(snapshotSyncher);
+		// The old snapshot (if any) is destroyed outside this lock, when
+		// its last user is done with it.
+		latestSnapshot.swap(snapshot);
+		snapshot = latestSnapshot;
+	}
+	return snapshot;
+}
+
+
+/****************************
+ *
+ * Formatting
+ *
+ ****************************/
+
+
+string
+ProcessSnapshot::uptime() const {
+	return distanceOfTimeInWords(spawnEndTime / 1000000);
+}
+
+const SocketSnapshot *
+ProcessSnapshot::findFirstSocketWithProtocol(const StaticString &protocol) const {
+	vector<SocketSnapshot>::const_iterator it, end = sockets.end();
+	for (it = sockets.begin(); it != end; it++) {
+		if (it->protocol == protocol) {
+			return &(*it);
+		}
+	}
+	return NULL;
+}
+
+void
+ProcessSnapshot::inspectXml(std::ostream &stream, bool includeSockets) const {
+	stream << "<pid>" << pid << "</pid>";
+	stream << "<sticky_session_id>" << stickySessionId << "</sticky_session_id>";
+	stream << "<gupid>" << gupid << "</gupid>";
+	stream << "<concurrency>" << concurrency << "</concurrency>";
+	stream << "<sessions>" << sessions << "</sessions>";
+	stream << "<busyness>" << busyness << "</busyness>";
+	stream << "<processed>" << processed << "</processed>";
+	stream << "<spawner_creation_time>" << spawnerCreationTime << "</spawner_creation_time>";
+	stream << "<spawn_start_time>" << spawnStartTime << "</spawn_start_time>";
+	stream << "<spawn_end_time>" << spawnEndTime << "</spawn_end_time>";
+	stream << "<last_used>" << lastUsed << "</last_used>";
+	stream << "<last_used_desc>" << distanceOfTimeInWords(lastUsed / 1000000).c_str() << " ago</last_used_desc>";
+	stream << "<uptime>" << uptime() << "</uptime>";
+	if (!codeRevision.empty()) {
+		stream << "<code_revision>" << escapeForXml(codeRevision) << "</code_revision>";
+	}
+	switch (lifeStatus) {
+	case Process::ALIVE:
+		stream << "<life_status>ALIVE</life_status>";
+		break;
+	case Process::SHUTDOWN_TRIGGERED:
+		stream << "<life_status>SHUTDOWN_TRIGGERED</life_status>";
+		break;
+	case Process::DEAD:
+		stream << "<life_status>DEAD</life_status>";
+		break;
+	default:
+		P_BUG("Unknown 'lifeStatus' state " << (int) lifeStatus);
+	}
+	switch (enabled) {
+	case Process::ENABLED:
+		stream << "<enabled>ENABLED</enabled>";
+		break;
+	case Process::DISABLING:
+		stream << "<enabled>DISABLING</enabled>";
+		break;
+	case Process::DISABLED:
+		stream << "<enabled>DISABLED</enabled>";
+		break;
+	case Process::DETACHED:
+		stream << "<enabled>DETACHED</enabled>";
+		break;
+	default:
+		P_BUG("Unknown 'enabled' state " << (int) enabled);
+	}
+	if (metrics.isValid()) {
+		stream << "<has_metrics>true</has_metrics>";
+		stream << "<cpu>" << (int) metrics.cpu << "</cpu>";
+		stream << "<rss>" << metrics.rss << "</rss>";
+		stream << "<pss>" << metrics.pss << "</pss>";
+		stream << "<private_dirty>" << metrics.privateDirty << "</private_dirty>";
+		stream << "<swap>" << metrics.swap << "</swap>";
+		stream << "<real_memory>" << metrics.realMemory() << "</real_memory>";
+		stream << "<vmsize>" << metrics.vmsize << "</vmsize>";
+		stream << "<process_group_id>" << metrics.processGroupId << "</process_group_id>";
+		stream << "<command>" << escapeForXml(metrics.command) << "</command>";
+	}
+	if (includeSockets) {
+		vector<SocketSnapshot>::const_iterator it;
+
+		stream << "<sockets>";
+		for (it = sockets.begin(); it != sockets.end(); it++) {
+			const SocketSnapshot &socket = *it;
+			stream << "<socket>";
+			stream << "<address>" << escapeForXml(socket.address) << "</address>";
+			stream << "<protocol>" << escapeForXml(socket.protocol) << "</protocol>";
+			if (!socket.description.empty()) {
+				stream << "<description>" << escapeForXml(socket.description) << "</description>";
+			}
+			stream << "<concurrency>" << socket.concurrency << "</concurrency>";
+			stream << "<accept_http_requests>" << socket.acceptHttpRequests << "</accept_http_requests>";
+			stream << "<sessions>" << socket.sessions << "</sessions>";
+			stream << "</socket>";
+		}
+		stream << "</sockets>";
+	}
+}
+
+SpawningKit::UserSwitchingInfo
+GroupSnapshot::prepareUserSwitching() const {
+	return SpawningKit::prepareUserSwitching(options, *wrapperRegistry);
+}
+
+bool
+GroupSnapshot::authorizeByUid(uid_t uid) const {
+	return uid == 0 || prepareUserSwitching().uid == uid;
+}
+
+bool
+GroupSnapshot::authorizeByApiKey(const ApiKey &key) const {
+	return key.isSuper() || key == apiKey;
+}
+
+static void
+inspectProcessListXml(std::ostream &stream, const vector<ProcessSnapshot> &processes,
+	bool includeSecrets)
+{
+	vector<ProcessSnapshot>::const_iterator it, end = processes.end();
+	for (it = processes.begin(); it != end; it++) {
+		stream << "<process>";
+		it->inspectXml(stream, includeSecrets);
+		stream << "</process>";
+	}
+}
+
+void
+GroupSnapshot::inspectXml(std::ostream &stream, bool includeSecrets) const {
+	stream << "<name>" << escapeForXml(name) << "</name>";
+	stream << "<component_name>" << escapeForXml(name) << "</component_name>";
+	stream << "<app_root>" << escapeForXml(options.appRoot) << "</app_root>";
+	stream << "<app_type>" << escapeForXml(options.appType) << "</app_type>";
+	stream << "<environment>" << escapeForXml(options.environment) << "</environment>";
+	stream << "<uuid>" << uuid << "</uuid>";
+	stream << "<enabled_process_count>" << enabledCount << "</enabled_process_count>";
+	stream << "<disabling_process_count>" << disablingCount << "</disabling_process_count>";
+	stream << "<disabled_process_count>" << disabledCount << "</disabled_process_count>";
+	stream << "<capacity_used>" << capacityUsed << "</capacity_used>";
+	stream << "<get_wait_list_size>" << getWaitlistSize << "</get_wait_list_size>";
+	stream << "<disable_wait_list_size>" << disableWaitlistSize << "</disable_wait_list_size>";
+	stream << "<processes_being_spawned>" << processesBeingSpawned << "</processes_being_spawned>";
+	stream << "<replacements_being_spawned>" << replacementsBeingSpawned << "</replacements_being_spawned>";
+	stream << "<fair_share_weight>" << fairShareWeight << "</fair_share_weight>";
+	stream << "<fair_share>" << fairShare << "</fair_share>";
+	stream << "<predicted_processes_needed>" << predictedProcessesNeeded << "</predicted_processes_needed>";
+	if (spawning) {
+		stream << "<spawning/>";
+	}
+	if (restarting) {
+		stream << "<restarting/>";
+	}
+	if (includeSecrets) {
+		stream << "<secret>" << escapeForXml(apiKey.toStaticString()) << "</secret>";
+		stream << "<api_key>" << escapeForXml(apiKey.toStaticString()) << "</api_key>";
+	}
+	switch (lifeStatus) {
+	case Group::ALIVE:
+		stream << "<life_status>ALIVE</life_status>";
+		break;
+	case Group::SHUTTING_DOWN:
+		stream << "<life_status>SHUTTING_DOWN</life_status>";
+		break;
+	case Group::SHUT_DOWN:
+		stream << "<life_status>SHUT_DOWN</life_status>";
+		break;
+	default:
+		P_BUG("Unknown 'lifeStatus' state " << lifeStatus);
+	}
+
+	SpawningKit::UserSwitchingInfo usInfo(prepareUserSwitching());
+	stream << "<user>" << escapeForXml(usInfo.username) << "</user>";
+	stream << "<uid>" << usInfo.uid << "</uid>";
+	stream << "<group>" << escapeForXml(usInfo.groupname) << "</group>";
+	stream << "<gid>" << usInfo.gid << "</gid>";
+
+	stream << "<options>";
+	options.toXml(stream, *resourceLocator, *wrapperRegistry);
+	stream << "</options>";
+
+	stream << "<processes>";
+	inspectProcessListXml(stream, enabledProcesses, includeSecrets);
+	inspectProcessListXml(stream, disablingProcesses, includeSecrets);
+	inspectProcessListXml(stream, disabledProcesses, includeSecrets);
+	inspectProcessListXml(stream, detachedProcesses, includeSecrets);
+	stream << "</processes>";
+}
+
+void
+GroupSnapshot::inspectPropertiesInAdminPanelFormat(Json::Value &result) const {
+	result["path"] = absolutizePath(options.appRoot);
+	result["startup_file"] = absolutizePath(options.getStartupFile(*wrapperRegistry),
+		absolutizePath(options.appRoot));
+	result["start_command"] = options.getStartCommand(*resourceLocator,
+		*wrapperRegistry);
+	result["type"] = wrapperRegistry->lookup(options.appType).language.toString();
+
+	SpawningKit::UserSwitchingInfo usInfo(prepareUserSwitching());
+	result["user"]["username"] = usInfo.username;
+	result["user"]["uid"] = (Json::Int) usInfo.uid;
+	result["group"]["groupname"] = usInfo.groupname;
+	result["group"]["gid"] = (Json::Int) usInfo.gid;
+
+	result["fair_share"]["weight"] = fairShareWeight;
+	result["fair_share"]["share"] = fairShare;
+	result["fair_share"]["capacity_used"] = capacityUsed;
+
+	result["demand_forecast"]["predicted_processes_needed"] = predictedProcessesNeeded;
+	if (avgServiceTime >= 0) {
+		result["demand_forecast"]["avg_service_time"] = avgServiceTime / 1000000.0;
+	}
+
+	/******************/
+}
+
+void
+GroupSnapshot::inspectConfigInAdminPanelFormat(Json::Value &result) const {
+	#define VAL Pool::makeSingleValueJsonConfigFormat
+	#define SVAL Pool::makeSingleStrValueJsonConfigFormat
+	#define NON_EMPTY_SVAL Pool::makeSingleNonEmptyStrValueJsonConfigFormat
+
+	result["app_root"] = NON_EMPTY_SVAL(absolutizePath(options.appRoot));
+	result["app_group_name"] = NON_EMPTY_SVAL(name);
+	result["default_user"] = NON_EMPTY_SVAL(options.defaultUser);
+	result["default_group"] = NON_EMPTY_SVAL(options.defaultGroup);
+	result["enabled"] = VAL(true, false);
+	result["lve_min_uid"] = VAL(options.lveMinUid, DEFAULT_LVE_MIN_UID);
+
+	result["type"] = NON_EMPTY_SVAL(options.appType);
+	result["startup_file"] = NON_EMPTY_SVAL(options.startupFile);
+	result["start_command"] = NON_EMPTY_SVAL(replaceAll(options.appStartCommand,
+		P_STATIC_STRING("\t"), P_STATIC_STRING(" ")));
+	result["ruby"] = SVAL(options.ruby, DEFAULT_RUBY);
+	result["python"] = SVAL(options.python, DEFAULT_PYTHON);
+	result["nodejs"] = SVAL(options.nodejs, DEFAULT_NODEJS);
+	result["meteor_app_settings"] = NON_EMPTY_SVAL(options.meteorAppSettings);
+	result["min_processes"] = VAL(options.minProcesses, 1u);
+	result["max_processes"] = VAL(options.maxProcesses, 0u);
+	result["fair_share_weight"] = VAL(options.fairShareWeight, 1u);
+	result["environment"] = SVAL(options.environment); // TODO: default value depends on integration mode
+	result["spawn_method"] = SVAL(options.spawnMethod, DEFAULT_SPAWN_METHOD);
+	result["bind_address"] = SVAL(options.bindAddress, DEFAULT_BIND_ADDRESS);
+	result["start_timeout"] = VAL(options.startTimeout / 1000.0, DEFAULT_START_TIMEOUT / 1000.0);
+	result["max_preloader_idle_time"] = VAL((Json::UInt) options.maxPreloaderIdleTime,
+		(Json::UInt) DEFAULT_MAX_PRELOADER_IDLE_TIME);
+	result["max_out_of_band_work_instances"] = VAL(options.maxOutOfBandWorkInstances,
+		(Json::UInt) 1);
+	result["base_uri"] = SVAL(options.baseURI, P_STATIC_STRING("/"));
+	result["user"] = SVAL(options.user, options.defaultUser);
+	result["group"] = SVAL(options.group, options.defaultGroup);
+	result["user_switching"] = VAL(options.userSwitching); // TODO: default value depends on integration mode and euid
+	result["file_descriptor_ulimit"] = VAL(options.fileDescriptorUlimit, 0u);
+	result["load_shell_envvars"] = VAL(options.loadShellEnvvars); // TODO: default value depends on integration mode
+	result["max_request_queue_size"] = VAL(options.maxRequestQueueSize,
+		(Json::UInt) DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+	result["max_requests"] = VAL((Json::UInt) options.maxRequests, 0u);
+	result["abort_websockets_on_process_shutdown"] = VAL(options.abortWebsocketsOnProcessShutdown);
+	result["force_max_concurrent_requests_per_process"] = VAL(options.forceMaxConcurrentRequestsPerProcess, -1);
+	result["restart_dir"] = NON_EMPTY_SVAL(options.restartDir);
+	result["sticky_sessions_cookie_attributes"] = SVAL(options.stickySessionsCookieAttributes, DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES);
+
+	if (!options.environmentVariables.empty()) {
+		DynamicBuffer envvarsData(options.environmentVariables.size() * 3 / 4);
+		size_t envvarsDataSize = modp_b64_decode(envvarsData.data,
+			options.environmentVariables.data(), options.environmentVariables.size());
+		if (envvarsDataSize == (size_t) -1) {
+			P_WARN("Unable to decode environment variable data");
+		} else {
+			Json::Value envvars(Json::objectValue);
+			vector<string> envvarsAry;
+			unsigned int i;
+
+			split(StaticString(envvarsData.data, envvarsDataSize), '\0', envvarsAry);
+			if (!envvarsAry.empty() && envvarsAry.back().empty()) {
+				envvarsAry.pop_back();
+			}
+			assert(envvars.size() % 2 == 0);
+
+			for (i = 0; i < envvarsAry.size(); i += 2) {
+				envvars[envvarsAry[i]] = envvarsAry[i + 1];
+			}
+
+			result["environment_variables"] = VAL(envvars, Json::objectValue);
+		}
+	} else {
+		result["environment_variables"] = VAL(Json::objectValue, Json::objectValue);
+	}
+
+	// Missing: sticky_sessions, sticky_session_cookie_name, friendly_error_pages
+
+	/******************/
+
+	#undef VAL
+	#undef SVAL
+	#undef NON_EMPTY_SVAL
+}
+
+
+bool
+PoolSnapshot::authorizeByUid(uid_t uid) const {
+	if (uid == 0 || uid == geteuid()) {
+		return true;
+	}
+
+	vector<GroupSnapshot>::const_iterator it, end = groups.end();
+	for (it = groups.begin(); it != end; it++) {
+		if (it->authorizeByUid(uid)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+PoolSnapshot::authorizeByApiKey(const ApiKey &key) const {
+	if (key.isSuper()) {
+		return true;
+	}
+
+	vector<GroupSnapshot>::const_iterator it, end = groups.end();
+	for (it = groups.begin(); it != end; it++) {
+		if (it->apiKey == key) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
@@ -70,19 +70,19 @@ Pool::atFullCapacityUnlocked() const {
 
 void
 Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
-	const Group *group, const ProcessList &processes) const
+	const GroupSnapshot &group, const vector<ProcessSnapshot> &processes)
 {
-	ProcessList::const_iterator p_it;
+	vector<ProcessSnapshot>::const_iterator p_it;
 	for (p_it = processes.begin(); p_it != processes.end(); p_it++) {
-		const ProcessPtr &process = *p_it;
+		const ProcessSnapshot &process = *p_it;
 		char buf[128];
 		char cpubuf[10];
 		char membuf[10];
 
-		 if (process->metrics.isValid()) {
-			snprintf(cpubuf, sizeof(cpubuf), "%d%%", (int) process->metrics.cpu);
+		 if (process.metrics.isValid()) {
+			snprintf(cpubuf, sizeof(cpubuf), "%d%%", (int) process.metrics.cpu);
 			snprintf(membuf, sizeof(membuf), "%ldM",
-				(unsigned long) (process->metrics.realMemory() / 1024));
+				(unsigned long) (process.metrics.realMemory() / 1024));
 		} else {
 			snprintf(cpubuf, sizeof(cpubuf), "0%%");
 			snprintf(membuf, sizeof(membuf), "0M");
@@ -90,32 +90,33 @@ Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
 		snprintf(buf, sizeof(buf),
 			"  * PID: %-5lu   Sessions: %-2u      Processed: %-5u   Uptime: %s\n"
 			"    CPU: %-5s   Memory  : %-5s   Last used: %s ago",
-			(unsigned long) process->getPid(),
-			process->sessions,
-			process->processed,
-			process->uptime().c_str(),
+			(unsigned long) process.pid,
+			process.sessions,
+			process.processed,
+			process.uptime().c_str(),
 			cpubuf,
 			membuf,
-			distanceOfTimeInWords(process->lastUsed / 1000000).c_str());
+			distanceOfTimeInWords(process.lastUsed / 1000000).c_str());
 		result << buf << endl;
 
-		if (process->enabled == Process::DISABLING) {
+		if (process.enabled == Process::DISABLING) {
 			result << "    Disabling..." << endl;
-		} else if (process->enabled == Process::DISABLED) {
+		} else if (process.enabled == Process::DISABLED) {
 			result << "    DISABLED" << endl;
-		} else if (process->enabled == Process::DETACHED) {
+		} else if (process.enabled == Process::DETACHED) {
 			result << "    Shutting down..." << endl;
 		}
 
-		const Socket *socket;
-		if (options.verbose && (socket = process->getSockets().findFirstSocketWithProtocol("http")) != NULL) {
+		const SocketSnapshot *socket;
+		if (options.verbose && (socket = process.findFirstSocketWithProtocol("http")) != NULL) {
 			result << "    URL     : http://" << replaceString(socket->address, "tcp://", "") << endl;
-			result << "    Password: " << group->getApiKey().toStaticString() << endl;
+			result << "    Password: " << group.apiKey.toStaticString() << endl;
 		}
 	}
 }
 
 
+
 /****************************
  *
  * Public methods
@@ -123,81 +124,82 @@ Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
  ****************************/
 
 
+/**
+ * The state inspection methods format a snapshot of the Pool's state (see
+ * getSnapshot()), so that they only hold the Pool lock for as long as it
+ * takes to copy the state. Polling consumers set `options.maxSnapshotAge`
+ * so that they can share a recent snapshot instead of capturing their own.
+ */
 string
 Pool::inspect(const InspectOptions &options, bool lock) const {
-	DynamicScopedLock l(syncher, lock);
+	PoolSnapshotPtr snapshot = getSnapshot(options.maxSnapshotAge, lock);
 	stringstream result;
 	const char *headerColor = maybeColorize(options, ANSI_COLOR_YELLOW ANSI_COLOR_BLUE_BG ANSI_COLOR_BOLD);
 	const char *resetColor  = maybeColorize(options, ANSI_COLOR_RESET);
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
+	if (!snapshot->authorizeByUid(options.uid)
+	 && !snapshot->authorizeByApiKey(options.apiKey))
 	{
 		throw SecurityException("Operation unauthorized");
 	}
 
 	result << headerColor << "----------- General information -----------" << resetColor << endl;
-	result << "Max pool size : " << max << endl;
-	result << "App groups    : " << groups.size() << endl;
-	result << "Processes     : " << getProcessCount(false) << endl;
-	result << "Requests in top-level queue : " << getWaitlist.size() << endl;
+	result << "Max pool size : " << snapshot->max << endl;
+	result << "App groups    : " << snapshot->groups.size() << endl;
+	result << "Processes     : " << snapshot->processCount << endl;
+	result << "Requests in top-level queue : " << snapshot->getWaitlist.size() << endl;
 	if (options.verbose) {
 		unsigned int i = 0;
-		foreach (const GetWaiter &waiter, getWaitlist) {
-			result << "  " << i << ": " << waiter.options.getAppGroupName() << endl;
+		foreach (const string &appGroupName, snapshot->getWaitlist) {
+			result << "  " << i << ": " << appGroupName << endl;
 			i++;
 		}
 	}
 	result << endl;
 
 	result << headerColor << "----------- Application groups -----------" << resetColor << endl;
-	GroupMap::ConstIterator g_it(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+	foreach (const GroupSnapshot &group, snapshot->groups) {
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
-		ProcessList::const_iterator p_it;
-
-		result << group->getName() << ":" << endl;
-		result << "  App root: " << group->options.appRoot << endl;
-		if (group->restarting()) {
+		result << group.name << ":" << endl;
+		result << "  App root: " << group.options.appRoot << endl;
+		if (group.restarting) {
 			result << "  (restarting...)" << endl;
 		}
-		if (group->spawning()) {
-			if (group->processesBeingSpawned == 0) {
+		if (group.spawning) {
+			if (group.processesBeingSpawned == 0) {
 				result << "  (spawning...)" << endl;
 			} else {
-				result << "  (spawning " << group->processesBeingSpawned << " new " <<
-					maybePluralize(group->processesBeingSpawned, "process", "processes") <<
+				result << "  (spawning " << group.processesBeingSpawned << " new " <<
+					maybePluralize(group.processesBeingSpawned, "process", "processes") <<
 					"...)" << endl;
 			}
 		}
-		result << "  Requests in queue: " << group->getWaitlist.size() << endl;
-		inspectProcessList(options, result, group.get(), group->enabledProcesses);
-		inspectProcessList(options, result, group.get(), group->disablingProcesses);
-		inspectProcessList(options, result, group.get(), group->disabledProcesses);
-		inspectProcessList(options, result, group.get(), group->detachedProcesses);
+		result << "  Requests in queue: " << group.getWaitlistSize << endl;
+		if (options.verbose) {
+			result << "  Fair share: " << group.fairShare <<
+				" (weight " << group.fairShareWeight << ")" << endl;
+		}
+		inspectProcessList(options, result, group, group.enabledProcesses);
+		inspectProcessList(options, result, group, group.disablingProcesses);
+		inspectProcessList(options, result, group, group.disabledProcesses);
+		inspectProcessList(options, result, group, group.detachedProcesses);
 		result << endl;
-
-		g_it.next();
 	}
 	return result.str();
 }
 
 string
 Pool::toXml(const ToXmlOptions &options, bool lock) const {
-	DynamicScopedLock l(syncher, lock);
+	PoolSnapshotPtr snapshot = getSnapshot(options.maxSnapshotAge, lock);
 	stringstream result;
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
+	if (!snapshot->authorizeByUid(options.uid)
+	 && !snapshot->authorizeByApiKey(options.apiKey))
 	{
 		throw SecurityException("Operation unauthorized");
 	}
@@ -206,51 +208,44 @@ Pool::toXml(const ToXmlOptions &options, bool lock) const {
 	result << "<info version=\"3\">";
 
 	result << "<passenger_version>" << PASSENGER_VERSION << "</passenger_version>";
-	result << "<group_count>" << groups.size() << "</group_count>";
-	result << "<process_count>" << getProcessCount(false) << "</process_count>";
-	result << "<max>" << max << "</max>";
-	result << "<capacity_used>" << capacityUsedUnlocked() << "</capacity_used>";
-	result << "<get_wait_list_size>" << getWaitlist.size() << "</get_wait_list_size>";
+	result << "<group_count>" << snapshot->groups.size() << "</group_count>";
+	result << "<process_count>" << snapshot->processCount << "</process_count>";
+	result << "<max>" << snapshot->max << "</max>";
+	result << "<capacity_used>" << snapshot->capacityUsed << "</capacity_used>";
+	result << "<get_wait_list_size>" << snapshot->getWaitlist.size() << "</get_wait_list_size>";
 
 	if (options.secrets) {
-		vector<GetWaiter>::const_iterator w_it, w_end = getWaitlist.end();
-
 		result << "<get_wait_list>";
-		for (w_it = getWaitlist.begin(); w_it != w_end; w_it++) {
-			const GetWaiter &waiter = *w_it;
+		foreach (const string &appGroupName, snapshot->getWaitlist) {
 			result << "<item>";
-			result << "<app_group_name>" << escapeForXml(waiter.options.getAppGroupName()) << "</app_group_name>";
+			result << "<app_group_name>" << escapeForXml(appGroupName) << "</app_group_name>";
 			result << "</item>";
 		}
 		result << "</get_wait_list>";
 	}
 
 	result << "<supergroups>";
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+	foreach (const GroupSnapshot &group, snapshot->groups) {
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
 		result << "<supergroup>";
-		result << "<name>" << escapeForXml(group->getName()) << "</name>";
+		result << "<name>" << escapeForXml(group.name) << "</name>";
 		result << "<state>READY</state>";
 		result << "<get_wait_list_size>0</get_wait_list_size>";
-		result << "<capacity_used>" << group->capacityUsed() << "</capacity_used>";
+		result << "<capacity_used>" << group.capacityUsed << "</capacity_used>";
 		if (options.secrets) {
-			result << "<secret>" << escapeForXml(group->getApiKey().toStaticString()) << "</secret>";
+			result << "<secret>" << escapeForXml(group.apiKey.toStaticString()) << "</secret>";
 		}
 
 		result << "<group default=\"true\">";
-		group->inspectXml(result, options.secrets);
+		group.inspectXml(result, options.secrets);
 		result << "</group>";
 
 		result << "</supergroup>";
-
-		g_it.next();
 	}
 	result << "</supergroups>";
 
@@ -258,83 +253,111 @@ Pool::toXml(const ToXmlOptions &options, bool lock) const {
 	return result.str();
 }
 
-Json::Value
-Pool::inspectPropertiesInAdminPanelFormat(const ToJsonOptions &options) const {
-	ScopedLock l(syncher);
-	Json::Value result(Json::objectValue);
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
+/**
+ * Writes the properties of the groups in the admin panel format with
+ * `writer`, one group at a time, instead of building the whole result
+ * in memory.
+ */
+void
+Pool::writePropertiesInAdminPanelFormat(JsonWriter &writer,
+	const ToJsonOptions &options) const
+{
+	PoolSnapshotPtr snapshot = getSnapshot(options.maxSnapshotAge);
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
+	if (!snapshot->authorizeByUid(options.uid)
+	 && !snapshot->authorizeByApiKey(options.apiKey))
 	{
 		throw SecurityException("Operation unauthorized");
 	}
 
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-
+	writer.beginObject();
+	foreach (const GroupSnapshot &group, snapshot->groups) {
 		if (options.hasApplicationIdsFilter) {
 			const bool *tmp;
-			if (!options.applicationIdsFilter.lookup(group->info.name, &tmp)) {
-				g_it.next();
+			if (!options.applicationIdsFilter.lookup(group.name, &tmp)) {
 				continue;
 			}
 		}
 
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
 		Json::Value groupDoc(Json::objectValue);
-		group->inspectPropertiesInAdminPanelFormat(groupDoc);
-		result[group->info.name] = groupDoc;
-
-		g_it.next();
+		group.inspectPropertiesInAdminPanelFormat(groupDoc);
+		writer.key(group.name);
+		writer.value(groupDoc);
 	}
-
-	return result;
+	writer.endObject();
 }
 
 Json::Value
 Pool::inspectConfigInAdminPanelFormat(const ToJsonOptions &options) const {
-	ScopedLock l(syncher);
+	PoolSnapshotPtr snapshot = getSnapshot(options.maxSnapshotAge);
 	Json::Value result(Json::objectValue);
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
+	if (!snapshot->authorizeByUid(options.uid)
+	 && !snapshot->authorizeByApiKey(options.apiKey))
 	{
 		throw SecurityException("Operation unauthorized");
 	}
 
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-
+	foreach (const GroupSnapshot &group, snapshot->groups) {
 		if (options.hasApplicationIdsFilter) {
 			const bool *tmp;
-			if (!options.applicationIdsFilter.lookup(group->info.name, &tmp)) {
-				g_it.next();
+			if (!options.applicationIdsFilter.lookup(group.name, &tmp)) {
 				continue;
 			}
 		}
 
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
 		Json::Value groupDoc(Json::objectValue);
-		group->inspectConfigInAdminPanelFormat(groupDoc);
-		result[group->info.name] = groupDoc;
+		group.inspectConfigInAdminPanelFormat(groupDoc);
+		result[group.name] = groupDoc;
+	}
 
-		g_it.next();
+	return result;
+}
+
+
+/**
+ * Returns the spawn timing histograms (see SpawningKit::JourneyStats) of
+ * all groups that the given credentials are authorized for. The histograms
+ * are copied while holding the Pool lock and formatted afterwards.
+ */
+Json::Value
+Pool::inspectSpawnStatsAsJson(const AuthenticationOptions &options) const {
+	vector< pair<string, SpawningKit::JourneyStats> > stats;
+	Json::Value result(Json::objectValue);
+
+	{
+		boost::lock_guard<boost::mutex> l(syncher);
+		GroupMap::ConstIterator g_it(groups);
+
+		stats.reserve(groups.size());
+		while (*g_it != NULL) {
+			const GroupPtr &group = g_it.getValue();
+			if (group->authorizeByUid(options.uid)
+			 || group->authorizeByApiKey(options.apiKey))
+			{
+				stats.push_back(make_pair(group->getName().toString(),
+					group->spawnJourneyStats));
+			}
+			g_it.next();
+		}
+	}
+
+	vector< pair<string, SpawningKit::JourneyStats> >::const_iterator it,
+		end = stats.end();
+	for (it = stats.begin(); it != end; it++) {
+		result[it->first] = it->second.inspectAsJson();
 	}
 
 	return result;
@@ -673,6 +673,22 @@ public:
 		return spawnerCreationTime;
 	}
 
+	unsigned long long getSpawnStartTime() const {
+		return spawnStartTime;
+	}
+
+	unsigned long long getSpawnEndTime() const {
+		return spawnEndTime;
+	}
+
+	StaticString getCodeRevision() const {
+		return codeRevision;
+	}
+
+	int getConcurrency() const {
+		return concurrency;
+	}
+
 	bool isDummy() const {
 		return type == SpawningKit::Result::DUMMY;
 	}
@@ -804,11 +820,11 @@ public:
 			} else {
 				lastUsed = SystemTime::getUsec();
 			}
-			return createSessionObject(socket);
+			return createSessionObject(socket, lastUsed);
 		}
 	}
 
-	SessionPtr createSessionObject(Socket *socket) {
+	SessionPtr createSessionObject(Socket *socket, unsigned long long startTime = 0) {
 		struct Guard {
 			Context *context;
 			Session *session;
@@ -833,7 +849,7 @@ public:
 		LockGuard l(context->memoryManagementSyncher);
 		Session *session = context->sessionObjectPool.malloc();
 		Guard guard(context, session);
-		session = new (session) Session(context, &info, socket);
+		session = new (session) Session(context, &info, socket, startTime);
 		guard.clear();
 		return SessionPtr(session, false);
 	}
@@ -863,86 +879,6 @@ public:
 		result << "(pid=" << getPid() << ", group=" << getGroupName() << ")";
 		return result.str();
 	}
-
-	template<typename Stream>
-	void inspectXml(Stream &stream, bool includeSockets = true) const {
-		stream << "<pid>" << getPid() << "</pid>";
-		stream << "<sticky_session_id>" << getStickySessionId() << "</sticky_session_id>";
-		stream << "<gupid>" << getGupid() << "</gupid>";
-		stream << "<concurrency>" << concurrency << "</concurrency>";
-		stream << "<sessions>" << sessions << "</sessions>";
-		stream << "<busyness>" << busyness() << "</busyness>";
-		stream << "<processed>" << processed << "</processed>";
-		stream << "<spawner_creation_time>" << spawnerCreationTime << "</spawner_creation_time>";
-		stream << "<spawn_start_time>" << spawnStartTime << "</spawn_start_time>";
-		stream << "<spawn_end_time>" << spawnEndTime << "</spawn_end_time>";
-		stream << "<last_used>" << lastUsed << "</last_used>";
-		stream << "<last_used_desc>" << distanceOfTimeInWords(lastUsed / 1000000).c_str() << " ago</last_used_desc>";
-		stream << "<uptime>" << uptime() << "</uptime>";
-		if (!codeRevision.empty()) {
-			stream << "<code_revision>" << escapeForXml(codeRevision) << "</code_revision>";
-		}
-		switch (lifeStatus) {
-		case ALIVE:
-			stream << "<life_status>ALIVE</life_status>";
-			break;
-		case SHUTDOWN_TRIGGERED:
-			stream << "<life_status>SHUTDOWN_TRIGGERED</life_status>";
-			break;
-		case DEAD:
-			stream << "<life_status>DEAD</life_status>";
-			break;
-		default:
-			P_BUG("Unknown 'lifeStatus' state " << (int) lifeStatus);
-		}
-		switch (enabled) {
-		case ENABLED:
-			stream << "<enabled>ENABLED</enabled>";
-			break;
-		case DISABLING:
-			stream << "<enabled>DISABLING</enabled>";
-			break;
-		case DISABLED:
-			stream << "<enabled>DISABLED</enabled>";
-			break;
-		case DETACHED:
-			stream << "<enabled>DETACHED</enabled>";
-			break;
-		default:
-			P_BUG("Unknown 'enabled' state " << (int) enabled);
-		}
-		if (metrics.isValid()) {
-			stream << "<has_metrics>true</has_metrics>";
-			stream << "<cpu>" << (int) metrics.cpu << "</cpu>";
-			stream << "<rss>" << metrics.rss << "</rss>";
-			stream << "<pss>" << metrics.pss << "</pss>";
-			stream << "<private_dirty>" << metrics.privateDirty << "</private_dirty>";
-			stream << "<swap>" << metrics.swap << "</swap>";
-			stream << "<real_memory>" << metrics.realMemory() << "</real_memory>";
-			stream << "<vmsize>" << metrics.vmsize << "</vmsize>";
-			stream << "<process_group_id>" << metrics.processGroupId << "</process_group_id>";
-			stream << "<command>" << escapeForXml(metrics.command) << "</command>";
-		}
-		if (includeSockets) {
-			SocketList::const_iterator it;
-
-			stream << "<sockets>";
-			for (it = sockets.begin(); it != sockets.end(); it++) {
-				const Socket &socket = *it;
-				stream << "<socket>";
-				stream << "<address>" << escapeForXml(socket.address) << "</address>";
-				stream << "<protocol>" << escapeForXml(socket.protocol) << "</protocol>";
-				if (!socket.description.empty()) {
-					stream << "<description>" << escapeForXml(socket.description) << "</description>";
-				}
-				stream << "<concurrency>" << socket.concurrency << "</concurrency>";
-				stream << "<accept_http_requests>" << socket.acceptHttpRequests << "</accept_http_requests>";
-				stream << "<sessions>" << socket.sessions << "</sessions>";
-				stream << "</socket>";
-			}
-			stream << "</sockets>";
-		}
-	}
 };
 
 
@@ -85,6 +85,8 @@ private:
 	Socket *socket;
 
 	Connection connection;
+	/** The time at which this Session was checked out, in microseconds. */
+	unsigned long long startTime;
 	mutable boost::atomic<int> refcount;
 	bool closed;
 
@@ -118,10 +120,12 @@ public:
 	Callback onInitiateFailure;
 	Callback onClose;
 
-	Session(Context *_context, const BasicProcessInfo *_processInfo, Socket *_socket)
+	Session(Context *_context, const BasicProcessInfo *_processInfo, Socket *_socket,
+		unsigned long long _startTime = 0)
 		: context(_context),
 		  processInfo(_processInfo),
 		  socket(_socket),
+		  startTime(_startTime),
 		  refcount(1),
 		  closed(false),
 		  onInitiateFailure(NULL),
@@ -176,6 +180,10 @@ public:
 		return socket;
 	}
 
+	unsigned long long getStartTime() const {
+		return startTime;
+	}
+
 	virtual StaticString getProtocol() const {
 		return getSocket()->protocol;
 	}
@@ -0,0 +1,158 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_SNAPSHOT_H_
+#define _PASSENGER_APPLICATION_POOL2_SNAPSHOT_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <boost/shared_ptr.hpp>
+#include <sys/types.h>
+#include <jsoncpp/json.h>
+#include <ResourceLocator.h>
+#include <WrapperRegistry/Registry.h>
+#include <SystemTools/ProcessMetricsCollector.h>
+#include <Core/ApplicationPool/Process.h>
+#include <Core/ApplicationPool/Group.h>
+#include <Core/ApplicationPool/Options.h>
+#include <Core/SpawningKit/UserSwitchingRules.h>
+#include <Shared/ApplicationPoolApiKey.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+/*
+ * Immutable copies of the Pool's state, as needed by the state inspection
+ * functions (Pool::inspect(), Pool::toXml() and the admin panel formats).
+ *
+ * Capturing a snapshot only copies plain values, and must happen while
+ * holding the Pool lock. Everything that is expensive (formatting, escaping,
+ * looking up user accounts) happens on the snapshot, after the lock has been
+ * released. Snapshots do not reference any Pool, Group or Process objects,
+ * so they may outlive them and may be shared between threads.
+ */
+
+
+struct SocketSnapshot {
+	string address;
+	string protocol;
+	string description;
+	int concurrency;
+	bool acceptHttpRequests;
+	int sessions;
+
+	SocketSnapshot(const Socket &socket);
+};
+
+struct ProcessSnapshot {
+	pid_t pid;
+	unsigned int stickySessionId;
+	string gupid;
+	int concurrency;
+	int sessions;
+	int busyness;
+	unsigned int processed;
+	unsigned long long spawnerCreationTime;
+	unsigned long long spawnStartTime;
+	unsigned long long spawnEndTime;
+	unsigned long long lastUsed;
+	string codeRevision;
+	Process::LifeStatus lifeStatus;
+	Process::EnabledStatus enabled;
+	ProcessMetrics metrics;
+	vector<SocketSnapshot> sockets;
+
+	ProcessSnapshot(const Process &process);
+
+	string uptime() const;
+	const SocketSnapshot *findFirstSocketWithProtocol(const StaticString &protocol) const;
+	void inspectXml(std::ostream &stream, bool includeSockets = true) const;
+};
+
+struct GroupSnapshot {
+	const ResourceLocator *resourceLocator;
+	const WrapperRegistry::Registry *wrapperRegistry;
+
+	string name;
+	string uuid;
+	ApiKey apiKey;
+	Options options;
+	Group::LifeStatus lifeStatus;
+	bool spawning;
+	bool restarting;
+	int enabledCount;
+	int disablingCount;
+	int disabledCount;
+	unsigned int capacityUsed;
+	unsigned int getWaitlistSize;
+	unsigned int disableWaitlistSize;
+	short processesBeingSpawned;
+	short replacementsBeingSpawned;
+	unsigned int fairShareWeight;
+	double fairShare;
+	unsigned int predictedProcessesNeeded;
+	double avgServiceTime;
+
+	vector<ProcessSnapshot> enabledProcesses;
+	vector<ProcessSnapshot> disablingProcesses;
+	vector<ProcessSnapshot> disabledProcesses;
+	vector<ProcessSnapshot> detachedProcesses;
+
+	GroupSnapshot(const Group &group, unsigned int totalFairShareWeight);
+
+	SpawningKit::UserSwitchingInfo prepareUserSwitching() const;
+	bool authorizeByUid(uid_t uid) const;
+	bool authorizeByApiKey(const ApiKey &key) const;
+
+	void inspectXml(std::ostream &stream, bool includeSecrets = true) const;
+	void inspectPropertiesInAdminPanelFormat(Json::Value &result) const;
+	void inspectConfigInAdminPanelFormat(Json::Value &result) const;
+};
+
+struct PoolSnapshot {
+	/** Monotonic time at which this snapshot was captured. */
+	MonotonicTimeUsec capturedAt;
+	unsigned int max;
+	unsigned int processCount;
+	unsigned int capacityUsed;
+	/** The app group names of the requests in the Pool's top-level wait list. */
+	vector<string> getWaitlist;
+	vector<GroupSnapshot> groups;
+
+	bool authorizeByUid(uid_t uid) const;
+	bool authorizeByApiKey(const ApiKey &key) const;
+};
+
+typedef boost::shared_ptr<const PoolSnapshot> PoolSnapshotPtr;
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_SNAPSHOT_H_ */
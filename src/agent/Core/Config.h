@@ -86,11 +86,15 @@ using namespace std;
  *   api_server_client_freelist_limit                                unsigned integer   -          default(0)
  *   api_server_file_buffered_channel_auto_start_mover               boolean            -          default(true)
  *   api_server_file_buffered_channel_auto_truncate_file             boolean            -          default(true)
+ *   api_server_file_buffered_channel_backend                        string             -          default("file")
  *   api_server_file_buffered_channel_buffer_dir                     string             -          default
  *   api_server_file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -          default(0)
+ *   api_server_file_buffered_channel_io_uring                       boolean            -          default(false),read_only
  *   api_server_file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -          default(0)
+ *   api_server_file_buffered_channel_max_file_size                  unsigned integer   -          default(0)
  *   api_server_file_buffered_channel_threshold                      unsigned integer   -          default(131072)
  *   api_server_mbuf_block_chunk_size                                unsigned integer   -          default(4096),read_only
+ *   api_server_mbuf_huge_pages                                      boolean            -          default(false),read_only
  *   api_server_min_spare_clients                                    unsigned integer   -          default(0)
  *   api_server_request_freelist_limit                               unsigned integer   -          default(1024)
  *   api_server_start_reading_after_accept                           boolean            -          default(true)
@@ -103,11 +107,15 @@ using namespace std;
  *   controller_cpu_affine                                           boolean            -          default(false),read_only
  *   controller_file_buffered_channel_auto_start_mover               boolean            -          default(true)
  *   controller_file_buffered_channel_auto_truncate_file             boolean            -          default(true)
+ *   controller_file_buffered_channel_backend                        string             -          default("file")
  *   controller_file_buffered_channel_buffer_dir                     string             -          default
  *   controller_file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_io_uring                       boolean            -          default(false),read_only
  *   controller_file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_max_file_size                  unsigned integer   -          default(0)
  *   controller_file_buffered_channel_threshold                      unsigned integer   -          default(131072)
  *   controller_mbuf_block_chunk_size                                unsigned integer   -          default(4096),read_only
+ *   controller_mbuf_huge_pages                                      boolean            -          default(false),read_only
  *   controller_min_spare_clients                                    unsigned integer   -          default(0)
  *   controller_request_freelist_limit                               unsigned integer   -          default(1024)
  *   controller_secure_headers_password                              any                -          secret
@@ -138,6 +146,8 @@ using namespace std;
  *   default_sticky_sessions_cookie_name                             string             -          default("_passenger_route")
  *   default_user                                                    string             -          default("nobody")
  *   disable_log_prefix                                              boolean            -          default(false)
+ *   event_loop_stall_log_interval                                   unsigned integer   -          default(60),read_only
+ *   event_loop_stall_threshold                                      unsigned integer   -          default(1000),read_only
  *   file_descriptor_log_target                                      any                -          -
  *   file_descriptor_ulimit                                          unsigned integer   -          default(0),read_only
  *   graceful_exit                                                   boolean            -          default(true)
@@ -158,6 +168,7 @@ using namespace std;
  *   pool_idle_time                                                  unsigned integer   -          default(300)
  *   pool_selfchecks                                                 boolean            -          default(false)
  *   prestart_urls                                                   array of strings   -          default([]),read_only
+ *   request_trace_buffer_size                                       unsigned integer   -          default(4096)
  *   response_buffer_high_watermark                                  unsigned integer   -          default(134217728)
  *   security_update_checker_certificate_path                        string             -          -
  *   security_update_checker_disabled                                boolean            -          default(false)
@@ -188,6 +199,7 @@ using namespace std;
  *   user_switching                                                  boolean            -          default(true)
  *   vary_turbocache_by_cookie                                       string             -          -
  *   watchdog_fd_passing_password                                    string             -          secret
+ *   watchdog_listener_handoff                                       boolean            -          default(false),read_only
  *   web_server_module_version                                       string             -          read_only
  *   web_server_version                                              string             -          read_only
  *
@@ -497,8 +509,11 @@ public:
 		add("controller_socket_backlog", UINT_TYPE, OPTIONAL | READ_ONLY, DEFAULT_SOCKET_BACKLOG);
 		add("controller_addresses", STRING_ARRAY_TYPE, OPTIONAL | READ_ONLY, getDefaultControllerAddresses());
 		add("api_server_addresses", STRING_ARRAY_TYPE, OPTIONAL | READ_ONLY, Json::arrayValue);
+		add("watchdog_listener_handoff", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
 		add("controller_cpu_affine", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
 		add("file_descriptor_ulimit", UINT_TYPE, OPTIONAL | READ_ONLY, 0);
+		add("event_loop_stall_threshold", UINT_TYPE, OPTIONAL | READ_ONLY, DEFAULT_EVENT_LOOP_STALL_THRESHOLD);
+		add("event_loop_stall_log_interval", UINT_TYPE, OPTIONAL | READ_ONLY, DEFAULT_EVENT_LOOP_STALL_LOG_INTERVAL);
 
 		add("hook_attached_process", STRING_TYPE, OPTIONAL | READ_ONLY);
 		add("hook_detached_process", STRING_TYPE, OPTIONAL | READ_ONLY);
@@ -83,6 +83,10 @@
 #include <Core/Controller/Client.h>
 #include <Core/Controller/AppResponse.h>
 #include <Core/Controller/TurboCaching.h>
+#include <Core/Controller/LatencyStats.h>
+#include <Core/Controller/RequestTracing.h>
+#include <Core/Controller/ConfigSnapshot.h>
+#include <Core/Controller/Metrics.h>
 
 namespace Passenger {
 
@@ -118,6 +122,8 @@ private:
 	StringKeyTable< boost::shared_ptr<Options> > poolOptionsCache;
 
 	HashedStaticString PASSENGER_APP_GROUP_NAME;
+	HashedStaticString PASSENGER_CONFIG;
+	HashedStaticString PASSENGER_REGISTER_CONFIG;
 	HashedStaticString PASSENGER_ENV_VARS;
 	HashedStaticString PASSENGER_MAX_REQUESTS;
 	HashedStaticString PASSENGER_SHOW_VERSION_IN_HEADER;
@@ -144,6 +150,11 @@ private:
 	struct ev_check checkWatcher;
 	TurboCaching<Request> turboCaching;
 	ConfigKit::Store *singleAppModeConfig;
+	RequestLatencyStats latencyStats;
+	StringKeyTable<RequestLatencyStatsPtr> appGroupLatencyStats;
+	RequestTraceRecorder traceRecorder;
+	/** Set by shutdownAndDrain(). Overrides 'graceful_exit'. */
+	bool drainOnShutdown;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		struct ev_prepare prepareWatcher;
@@ -160,6 +171,7 @@ private:
 
 	struct RequestAnalysis;
 
+	bool resolveConfigSnapshot(Client *client, Request *req);
 	void initializeFlags(Client *client, Request *req, RequestAnalysis &analysis);
 	bool respondFromTurboCache(Client *client, Request *req);
 	void initializePoolOptions(Client *client, Request *req, RequestAnalysis &analysis);
@@ -327,6 +339,11 @@ private:
 	static LString *resolveSymlink(const StaticString &path, psg_pool_t *pool);
 	void parseCookieHeader(psg_pool_t *pool, const LString *headerValue,
 		vector< pair<StaticString, StaticString> > &cookies) const;
+	void recordRequestLatencies(Request *req);
+	void beginRequestTrace(Request *req, MonotonicTimeUsec now);
+	void recordRequestTraceEvent(Request *req, RequestTraceEventType type,
+		MonotonicTimeUsec now, boost::uint32_t data = 0);
+	void updateMetricsGauges();
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		void reportLargeTimeDiff(Client *client, const char *name,
 			ev_tstamp fromTime, ev_tstamp toTime);
@@ -342,6 +359,8 @@ protected:
 	/****** Hooks ******/
 
 	virtual void onClientAccepted(Client *client);
+	virtual Channel::Result onClientDataReceived(Client *client,
+		const MemoryKit::mbuf &buffer, int errcode);
 	virtual void onRequestObjectCreated(Client *client, Request *req);
 	virtual void deinitializeClient(Client *client);
 	virtual void reinitializeRequest(Client *client, Request *req);
@@ -354,6 +373,7 @@ protected:
 	virtual bool shouldDisconnectClientOnShutdown(Client *client);
 	virtual bool shouldAutoDechunkBody(Client *client, Request *req);
 	virtual bool supportsUpgrade(Client *client, Request *req);
+	virtual void onUpdateStatistics();
 
 
 	/****** Marked virtual so that unit tests can mock these ******/
@@ -370,6 +390,9 @@ public:
 	WrapperRegistry::Registry *wrapperRegistry;
 	PoolPtr appPool;
 
+	// Thread-safe to read.
+	ControllerMetrics metrics;
+
 
 	/****** Initialization and shutdown ******/
 
@@ -389,6 +412,9 @@ public:
 
 		  turboCaching(),
 		  singleAppModeConfig(NULL),
+		  appGroupLatencyStats(4),
+		  traceRecorder(mainConfig.requestTraceBufferSize),
+		  drainOnShutdown(false),
 		  resourceLocator(NULL)
 		  /**************************/
 	{
@@ -402,6 +428,7 @@ public:
 
 	virtual ~Controller();
 	virtual void initialize();
+	void shutdownAndDrain();
 
 
 	/****** Hooks ******/
@@ -421,9 +448,12 @@ public:
 	/****** State and configuration ******/
 
 	unsigned int getThreadNumber() const; // Thread-safe
-	virtual Json::Value inspectStateAsJson() const;
+	virtual Json::Value inspectServerStateAsJson() const;
+	virtual Json::Value inspectMemoryUsageAsJson() const;
 	virtual Json::Value inspectClientStateAsJson(const Client *client) const;
 	virtual Json::Value inspectRequestStateAsJson(const Request *req) const;
+	void snapshotLatencyStats(LatencyStatsSnapshot &snapshot) const;
+	void copyRequestTraceEvents(vector<RequestTraceEvent> &events) const;
 
 
 	/****** Miscellaneous *******/
@@ -66,6 +66,9 @@ Controller::checkoutSession(Client *client, Request *req) {
 	callback.userData = req;
 
 	options.currentTime = SystemTime::getUsec();
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+	req->phaseTimer.begin(RP_CHECKOUT_WAIT, now);
+	recordRequestTraceEvent(req, RTE_CHECKOUT_QUEUED, now);
 
 	refRequest(req, __FILE__, __LINE__);
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
@@ -135,6 +138,10 @@ Controller::sessionCheckedOutFromEventLoopThread(Client *client, Request *req,
 	#endif
 
 	if (e == NULL) {
+		MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+		req->phaseTimer.end(RP_CHECKOUT_WAIT, now);
+		recordRequestTraceEvent(req, RTE_CHECKOUT_GRANTED, now,
+			session->getPid());
 		SKC_DEBUG(client, "Session checked out: pid=" << session->getPid() <<
 			", gupid=" << session->getGupid());
 		req->session = session;
@@ -176,6 +183,7 @@ void
 Controller::initiateSession(Client *client, Request *req) {
 	TRACE_POINT();
 	req->sessionCheckoutTry++;
+	req->phaseTimer.begin(RP_APP_CONNECT, SystemTime::getMonotonicUsec());
 	try {
 		req->session->initiate(false);
 	} catch (const SystemException &e2) {
@@ -194,6 +202,10 @@ Controller::initiateSession(Client *client, Request *req) {
 	}
 
 	UPDATE_TRACE_POINT();
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+	req->phaseTimer.end(RP_APP_CONNECT, now);
+	req->phaseTimer.begin(RP_TIME_TO_FIRST_BYTE, now);
+	recordRequestTraceEvent(req, RTE_APP_CONNECTED, now);
 
 	UPDATE_TRACE_POINT();
 	SKC_DEBUG(client, "Session initiated: fd=" << req->session->fd());
@@ -223,6 +235,7 @@ Controller::reportSessionCheckoutError(Client *client, Request *req,
 	const ExceptionPtr &e)
 {
 	TRACE_POINT();
+	metrics.sessionCheckoutErrors.add();
 	{
 		boost::shared_ptr<RequestQueueFullException> e2 =
 			dynamic_pointer_cast<RequestQueueFullException>(e);
@@ -42,6 +42,8 @@ using namespace ApplicationPool2;
 class Client: public ServerKit::BaseHttpClient<Request> {
 public:
 	ev_tstamp connectedAt;
+	// Registered with `!~PASSENGER_REGISTER_CONFIG`.
+	ConfigSnapshotPtr configSnapshots[ConfigSnapshot::MAX_SLOTS];
 
 	Client(void *server)
 		: ServerKit::BaseHttpClient<Request>(server)
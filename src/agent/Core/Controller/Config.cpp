@@ -59,6 +59,7 @@ Controller::commitConfigChange(ControllerConfigChangeRequest &req)
 	ParentClass::commitConfigChange(req.forParent);
 	mainConfig.swap(*req.mainConfig);
 	requestConfig.swap(req.requestConfig);
+	traceRecorder.setCapacity(mainConfig.requestTraceBufferSize);
 }
 
 
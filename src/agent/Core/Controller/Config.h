@@ -114,6 +114,7 @@ parseControllerBenchmarkMode(const StaticString &mode) {
  *   min_spare_clients                                   unsigned integer   -          default(0)
  *   multi_app                                           boolean            -          default(true),read_only
  *   request_freelist_limit                              unsigned integer   -          default(1024)
+ *   request_trace_buffer_size                           unsigned integer   -          default(4096)
  *   response_buffer_high_watermark                      unsigned integer   -          default(134217728)
  *   server_software                                     string             -          default("Phusion_Passenger/6.0.8")
  *   show_version_in_header                              boolean            -          default(true)
@@ -142,6 +143,7 @@ private:
 		add("stat_throttle_rate", UINT_TYPE, OPTIONAL, DEFAULT_STAT_THROTTLE_RATE);
 		add("show_version_in_header", BOOL_TYPE, OPTIONAL, true);
 		add("response_buffer_high_watermark", UINT_TYPE, OPTIONAL, DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK);
+		add("request_trace_buffer_size", UINT_TYPE, OPTIONAL, DEFAULT_REQUEST_TRACE_BUFFER_SIZE);
 		add("graceful_exit", BOOL_TYPE, OPTIONAL, true);
 		add("benchmark_mode", STRING_TYPE, OPTIONAL);
 
@@ -337,6 +339,7 @@ public:
 	unsigned int threadNumber;
 	unsigned int statThrottleRate;
 	unsigned int responseBufferHighWatermark;
+	unsigned int requestTraceBufferSize;
 	StaticString integrationMode;
 	StaticString serverLogName;
 	unsigned int maxInstancesPerApp;
@@ -355,6 +358,7 @@ public:
 		  threadNumber(config["thread_number"].asUInt()),
 		  statThrottleRate(config["stat_throttle_rate"].asUInt()),
 		  responseBufferHighWatermark(config["response_buffer_high_watermark"].asUInt()),
+		  requestTraceBufferSize(config["request_trace_buffer_size"].asUInt()),
 		  integrationMode(psg_pstrdup(pool, config["integration_mode"].asString())),
 		  serverLogName(createServerLogName()),
 		  maxInstancesPerApp(config["max_instances_per_app"].asUInt()),
@@ -385,6 +389,7 @@ public:
 		std::swap(threadNumber, other.threadNumber);
 		std::swap(statThrottleRate, other.statThrottleRate);
 		std::swap(responseBufferHighWatermark, other.responseBufferHighWatermark);
+		std::swap(requestTraceBufferSize, other.requestTraceBufferSize);
 		std::swap(integrationMode, other.integrationMode);
 		std::swap(serverLogName, other.serverLogName);
 		SWAP_BITFIELD(ControllerBenchmarkMode, benchmarkMode);
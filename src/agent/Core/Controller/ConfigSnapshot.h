@@ -0,0 +1,220 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_CONFIG_SNAPSHOT_H_
+#define _PASSENGER_CORE_CONTROLLER_CONFIG_SNAPSHOT_H_
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+#include <string>
+#include <cstddef>
+
+#include <MemoryKit/palloc.h>
+#include <DataStructures/LString.h>
+#include <DataStructures/HashedStaticString.h>
+#include <ServerKit/HeaderTable.h>
+#include <StaticString.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * The web server modules send the `passenger_*` settings of a location as
+ * `!~` secure headers. These are the same for every request to that location,
+ * so instead of sending them every time, a web server module may register
+ * them once per connection:
+ *
+ *     !~PASSENGER_REGISTER_CONFIG: <slot> <config ID>
+ *
+ * The Controller then copies the request's location-wide secure headers into
+ * a ConfigSnapshot, and stores it in the given slot of the client. Subsequent
+ * requests on the same connection only have to send the per-request secure
+ * headers and a reference to the snapshot:
+ *
+ *     !~PASSENGER_CONFIG: <slot> <config ID>
+ *
+ * The Controller adds the snapshot's headers to those requests' secure
+ * headers, so the rest of the request handling code doesn't need to know
+ * about snapshots. The web server decides which slot to (re)use, so
+ * snapshots are never evicted behind its back.
+ */
+class ConfigSnapshot: public boost::noncopyable {
+public:
+	/** The maximum number of snapshots per client. */
+	static const unsigned int MAX_SLOTS = 16;
+
+private:
+	psg_pool_t *pool;
+	string id;
+	vector<ServerKit::Header *> headers;
+
+	/**
+	 * Whether the header with the given name may differ per request to
+	 * the same location, or is part of the snapshot protocol itself.
+	 * Those are never stored in a snapshot.
+	 */
+	static bool isPerRequestHeader(const LString *name) {
+		static const StaticString names[] = {
+			P_STATIC_STRING("!~"),
+			P_STATIC_STRING("!~FLAGS"),
+			P_STATIC_STRING("!~DOCUMENT_ROOT"),
+			P_STATIC_STRING("!~SCRIPT_NAME"),
+			P_STATIC_STRING("!~REMOTE_ADDR"),
+			P_STATIC_STRING("!~REMOTE_PORT"),
+			P_STATIC_STRING("!~REMOTE_USER"),
+			P_STATIC_STRING("!~PASSENGER_APP_TYPE"),
+			P_STATIC_STRING("!~PASSENGER_APP_START_COMMAND"),
+			P_STATIC_STRING("!~PASSENGER_CONFIG"),
+			P_STATIC_STRING("!~PASSENGER_REGISTER_CONFIG")
+		};
+
+		for (size_t i = 0; i < sizeof(names) / sizeof(StaticString); i++) {
+			if (psg_lstr_cmp(name, names[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void copyString(LString *target, const LString *source) {
+		const LString *contiguous = psg_lstr_make_contiguous(source, pool);
+		psg_lstr_init(target);
+		if (contiguous->size > 0) {
+			psg_lstr_append(target, pool,
+				psg_pstrdup(pool, StaticString(contiguous->start->data,
+					contiguous->size)).data(),
+				contiguous->size);
+		}
+	}
+
+public:
+	/**
+	 * Copies the location-wide headers in `secureHeaders`. The copies are
+	 * allocated from a pool owned by the snapshot, so the snapshot
+	 * outlives the request that registered it.
+	 */
+	ConfigSnapshot(const StaticString &_id, ServerKit::HeaderTable &secureHeaders)
+		: pool(psg_create_pool(PSG_DEFAULT_POOL_SIZE)),
+		  id(_id.data(), _id.size())
+	{
+		ServerKit::HeaderTable::Iterator it(secureHeaders);
+		while (*it != NULL) {
+			const ServerKit::Header *source = it->header;
+			if (!isPerRequestHeader(&source->key)) {
+				ServerKit::Header *header = (ServerKit::Header *)
+					psg_palloc(pool, sizeof(ServerKit::Header));
+				copyString(&header->key, &source->key);
+				copyString(&header->origKey, &source->origKey);
+				copyString(&header->val, &source->val);
+				header->hash = source->hash;
+				headers.push_back(header);
+			}
+			it.next();
+		}
+	}
+
+	~ConfigSnapshot() {
+		psg_destroy_pool(pool);
+	}
+
+	const string &getId() const {
+		return id;
+	}
+
+	unsigned int size() const {
+		return headers.size();
+	}
+
+	/**
+	 * Adds the snapshot's headers to a request's secure headers. Headers
+	 * that the request sent itself take precedence.
+	 *
+	 * The added headers share their data with the snapshot, so the
+	 * caller must keep a reference to the snapshot until `secureHeaders`
+	 * is cleared. Only the Header structs themselves are allocated from
+	 * `requestPool`, because HeaderTable takes ownership of them.
+	 */
+	void apply(ServerKit::HeaderTable &secureHeaders, psg_pool_t *requestPool) const {
+		vector<ServerKit::Header *>::const_iterator it, end = headers.end();
+
+		for (it = headers.begin(); it != end; it++) {
+			const ServerKit::Header *source = *it;
+			HashedStaticString key(source->key.start->data, source->key.size,
+				source->hash);
+			if (secureHeaders.lookupCell(key) == NULL) {
+				ServerKit::Header *header = (ServerKit::Header *)
+					psg_palloc(requestPool, sizeof(ServerKit::Header));
+				*header = *source;
+				secureHeaders.insert(&header, requestPool);
+			}
+		}
+	}
+
+	/**
+	 * Parses the value of a `!~PASSENGER_CONFIG` or
+	 * `!~PASSENGER_REGISTER_CONFIG` header, which has the format
+	 * "<slot> <config ID>". Returns whether the value is valid.
+	 */
+	static bool parseReference(const LString *value, psg_pool_t *pool,
+		unsigned int &slot, StaticString &id)
+	{
+		value = psg_lstr_make_contiguous(value, pool);
+		if (value->size == 0) {
+			return false;
+		}
+
+		StaticString str(value->start->data, value->size);
+		string::size_type pos = str.find(' ');
+		if (pos == 0 || pos == string::npos || pos > 2 || pos == str.size() - 1) {
+			return false;
+		}
+
+		slot = 0;
+		for (string::size_type i = 0; i < pos; i++) {
+			if (str[i] < '0' || str[i] > '9') {
+				return false;
+			}
+			slot = slot * 10 + (str[i] - '0');
+		}
+		if (slot >= MAX_SLOTS) {
+			return false;
+		}
+
+		id = str.substr(pos + 1);
+		return true;
+	}
+};
+
+typedef boost::shared_ptr<ConfigSnapshot> ConfigSnapshotPtr;
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_CONFIG_SNAPSHOT_H_ */
@@ -70,6 +70,9 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 			// Data
 			UPDATE_TRACE_POINT();
 			size_t ret;
+			MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+			req->phaseTimer.end(RP_TIME_TO_FIRST_BYTE, now);
+			recordRequestTraceEvent(req, RTE_FIRST_APP_BYTE, now);
 			SKC_TRACE(client, 3, "Processing " << buffer.size() <<
 				" bytes of application data: \"" << cEscapeString(StaticString(
 					buffer.start, buffer.size())) << "\"");
@@ -883,12 +886,12 @@ Controller::sendResponseHeaderWithBuffering(Client *client, Request *req,
 	markHeaderBuffersForTurboCaching(client, req, buffers, nCacheableBuffers);
 
 	MemoryKit::mbuf_pool &mbuf_pool = getContext()->mbuf_pool;
-	const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
+	const unsigned int MBUF_MAX_SIZE = mbuf_pool_max_data_size(&mbuf_pool);
 	if (dataSize <= MBUF_MAX_SIZE) {
 		UPDATE_TRACE_POINT();
 		SKC_TRACE(client, 2, "Sending response headers using an mbuf");
-		MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
-		gatherBuffers(buffer.start, MBUF_MAX_SIZE, buffers, nbuffers);
+		MemoryKit::mbuf buffer(MemoryKit::mbuf_get_with_size(&mbuf_pool, dataSize));
+		gatherBuffers(buffer.start, dataSize, buffers, nbuffers);
 		buffer = MemoryKit::mbuf(buffer, offset, dataSize - offset);
 		writeResponse(client, buffer);
 	} else {
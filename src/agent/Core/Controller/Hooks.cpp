@@ -93,6 +93,26 @@ Controller::onClientAccepted(Client *client) {
 	client->connectedAt = ev_now(getLoop());
 }
 
+ServerKit::Channel::Result
+Controller::onClientDataReceived(Client *client, const MemoryKit::mbuf &buffer,
+	int errcode)
+{
+	Request *req = client->currentRequest;
+	if (req->httpState == Request::PARSING_HEADERS && buffer.size() > 0) {
+		MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+		req->phaseTimer.begin(RP_HEADER_PARSE, now);
+		req->phaseTimer.begin(RP_TOTAL, now);
+		beginRequestTrace(req, now);
+	}
+	return ParentClass::onClientDataReceived(client, buffer, errcode);
+}
+
+void
+Controller::onUpdateStatistics() {
+	ParentClass::onUpdateStatistics();
+	updateMetricsGauges();
+}
+
 void
 Controller::onRequestObjectCreated(Client *client, Request *req) {
 	ParentClass::onRequestObjectCreated(client, req);
@@ -112,6 +132,9 @@ Controller::onRequestObjectCreated(Client *client, Request *req) {
 void
 Controller::deinitializeClient(Client *client) {
 	ParentClass::deinitializeClient(client);
+	for (unsigned int i = 0; i < ConfigSnapshot::MAX_SLOTS; i++) {
+		client->configSnapshots[i].reset();
+	}
 	client->output.clearBuffersFlushedCallback();
 	client->output.setDataFlushedCallback(getClientOutputDataFlushedCallback());
 }
@@ -134,6 +157,7 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 	req->appResponseInitialized = false;
 	req->strip100ContinueHeader = false;
 	req->hasPragmaHeader = false;
+	req->countedInMetrics = false;
 	req->host = NULL;
 	req->config = requestConfig;
 	req->bodyBytesBuffered = 0;
@@ -141,6 +165,9 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 	req->cacheControl = NULL;
 	req->varyCookie = NULL;
 	req->envvars = NULL;
+	req->phaseTimer.reset();
+	req->traceNumber = 0;
+	req->traceEventsRecorded = 0;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		req->timedAppPoolGet = false;
@@ -154,6 +181,14 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 
 void
 Controller::deinitializeRequest(Client *client, Request *req) {
+	if (req->countedInMetrics) {
+		metrics.requestsFinished.add();
+	}
+	if (req->traceNumber != 0) {
+		recordRequestTraceEvent(req, RTE_END, SystemTime::getMonotonicUsec(),
+			req->appResponseInitialized ? req->appResponse.statusCode : 0);
+	}
+	recordRequestLatencies(req);
 	req->session.reset();
 	req->config.reset();
 
@@ -171,6 +206,7 @@ Controller::deinitializeRequest(Client *client, Request *req) {
 	}
 
 	ParentClass::deinitializeRequest(client, req);
+	req->configSnapshot.reset();
 }
 
 void
@@ -270,7 +306,7 @@ Controller::onNextRequestEarlyReadError(Client *client, Request *req, int errcod
 bool
 Controller::shouldDisconnectClientOnShutdown(Client *client) {
 	return ParentClass::shouldDisconnectClientOnShutdown(client)
-		|| !mainConfig.gracefulExit;
+		|| (!mainConfig.gracefulExit && !drainOnShutdown);
 }
 
 bool
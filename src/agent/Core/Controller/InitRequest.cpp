@@ -53,6 +53,54 @@ struct Controller::RequestAnalysis {
 };
 
 
+/**
+ * Handles `!~PASSENGER_REGISTER_CONFIG` and `!~PASSENGER_CONFIG`.
+ * See ConfigSnapshot for the protocol. Returns false if the request
+ * was ended because of an invalid reference.
+ */
+bool
+Controller::resolveConfigSnapshot(Client *client, Request *req) {
+	const LString *value;
+	unsigned int slot;
+	StaticString id;
+
+	value = req->secureHeaders.lookup(PASSENGER_CONFIG);
+	if (value != NULL) {
+		if (!ConfigSnapshot::parseReference(value, req->pool, slot, id)) {
+			endAsBadRequest(&client, &req, "Invalid !~PASSENGER_CONFIG header");
+			return false;
+		}
+
+		const ConfigSnapshotPtr &snapshot = client->configSnapshots[slot];
+		if (OXT_UNLIKELY(snapshot == NULL || snapshot->getId() != id)) {
+			endAsBadRequest(&client, &req, "Unknown !~PASSENGER_CONFIG value");
+			return false;
+		}
+
+		SKC_TRACE(client, 2, "Using configuration snapshot " << id
+			<< " in slot " << slot);
+		req->configSnapshot = snapshot;
+		snapshot->apply(req->secureHeaders, req->pool);
+		return true;
+	}
+
+	value = req->secureHeaders.lookup(PASSENGER_REGISTER_CONFIG);
+	if (value != NULL) {
+		if (!ConfigSnapshot::parseReference(value, req->pool, slot, id)) {
+			endAsBadRequest(&client, &req, "Invalid !~PASSENGER_REGISTER_CONFIG header");
+			return false;
+		}
+
+		client->configSnapshots[slot] = boost::make_shared<ConfigSnapshot>(
+			id, boost::ref(req->secureHeaders));
+		SKC_TRACE(client, 2, "Registered configuration snapshot " << id
+			<< " in slot " << slot << " (" << client->configSnapshots[slot]->size()
+			<< " headers)");
+	}
+
+	return true;
+}
+
 void
 Controller::initializeFlags(Client *client, Request *req, RequestAnalysis &analysis) {
 	if (analysis.flags != NULL) {
@@ -115,6 +163,7 @@ Controller::respondFromTurboCache(Client *client, Request *req) {
 		if (entry.valid()) {
 			SKC_TRACE(client, 2, "Turbocaching: cache hit (key \"" <<
 				cEscapeString(req->cacheKey) << "\")");
+			metrics.turboCacheHits.add();
 			turboCaching.writeResponse(this, client, req, entry);
 			if (!req->ended()) {
 				endRequest(&client, &req);
@@ -367,6 +416,7 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	fillPoolOption(req, options.user, "!~PASSENGER_USER");
 	fillPoolOption(req, options.group, "!~PASSENGER_GROUP");
 	fillPoolOption(req, options.minProcesses, "!~PASSENGER_MIN_PROCESSES");
+	fillPoolOption(req, options.fairShareWeight, "!~PASSENGER_FAIR_SHARE_WEIGHT");
 	fillPoolOption(req, options.spawnMethod, "!~PASSENGER_SPAWN_METHOD");
 	fillPoolOption(req, options.bindAddress, "!~PASSENGER_DIRECT_INSTANCE_REQUEST_ADDRESS");
 	fillPoolOption(req, options.appStartCommand, "!~PASSENGER_APP_START_COMMAND");
@@ -378,10 +428,13 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	fillPoolOption(req, options.restartDir, "!~PASSENGER_RESTART_DIR");
 	fillPoolOption(req, options.startupFile, "!~PASSENGER_STARTUP_FILE");
 	fillPoolOption(req, options.loadShellEnvvars, "!~PASSENGER_LOAD_SHELL_ENVVARS");
+	fillPoolOption(req, options.shellEnvvarsCacheTtl, "!~PASSENGER_SHELL_ENVVARS_CACHE_TTL");
 	fillPoolOption(req, options.fileDescriptorUlimit, "!~PASSENGER_APP_FILE_DESCRIPTOR_ULIMIT");
 	fillPoolOption(req, options.raiseInternalError, "!~PASSENGER_RAISE_INTERNAL_ERROR");
 	fillPoolOption(req, options.lveMinUid, "!~PASSENGER_LVE_MIN_UID");
 	fillPoolOption(req, options.stickySessionsCookieAttributes, "!~PASSENGER_STICKY_SESSIONS_COOKIE_ATTRIBUTES");
+	fillPoolOption(req, options.rollingRestart, "!~PASSENGER_ROLLING_RESTARTS");
+	fillPoolOption(req, options.warmupURIs, "!~PASSENGER_WARMUP_URIS");
 
 	// maxProcesses is configured per-application by the (Enterprise) maxInstances option (and thus passed
 	// via request headers). In OSS the max processes can also be configured, but on a global level
@@ -442,9 +495,19 @@ Controller::getStickySessionCookieName(Request *req) {
 void
 Controller::onRequestBegin(Client *client, Request *req) {
 	ParentClass::onRequestBegin(client, req);
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+	req->phaseTimer.end(RP_HEADER_PARSE, now);
+	recordRequestTraceEvent(req, RTE_HEADERS_PARSED, now);
+	metrics.requestsBegun.add();
+	req->countedInMetrics = true;
+	updateMetricsGauges();
 
 	CC_BENCHMARK_POINT(client, req, BM_AFTER_ACCEPT);
 
+	if (!resolveConfigSnapshot(client, req)) {
+		return;
+	}
+
 	{
 		// Perform hash table operations as close to header parsing as possible,
 		// and localize them as much as possible, for better CPU caching.
@@ -65,6 +65,8 @@ Controller::preinitialize() {
 	#endif
 
 	PASSENGER_APP_GROUP_NAME = "!~PASSENGER_APP_GROUP_NAME";
+	PASSENGER_CONFIG = "!~PASSENGER_CONFIG";
+	PASSENGER_REGISTER_CONFIG = "!~PASSENGER_REGISTER_CONFIG";
 	PASSENGER_ENV_VARS = "!~PASSENGER_ENV_VARS";
 	PASSENGER_MAX_REQUESTS = "!~PASSENGER_MAX_REQUESTS";
 	PASSENGER_SHOW_VERSION_IN_HEADER = "!~PASSENGER_SHOW_VERSION_IN_HEADER";
@@ -125,6 +127,17 @@ Controller::initialize() {
 	}
 }
 
+/**
+ * Like `shutdown()`, but lets requests that are in progress finish even
+ * if 'graceful_exit' is disabled. Used when another Core process has
+ * taken over our listener sockets.
+ */
+void
+Controller::shutdownAndDrain() {
+	drainOnShutdown = true;
+	shutdown();
+}
+
 
 } // namespace Core
 } // namespace Passenger
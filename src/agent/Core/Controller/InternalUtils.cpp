@@ -296,6 +296,90 @@ Controller::parseCookieHeader(psg_pool_t *pool, const LString *headerValue,
 	}
 }
 
+/**
+ * Records the durations of the request's phases in the latency histograms,
+ * both Controller-wide and for the request's app group. Resets the request's
+ * phase timer, so that calling this more than once has no effect.
+ */
+void
+Controller::recordRequestLatencies(Request *req) {
+	typedef StringKeyTable<RequestLatencyStatsPtr> Table;
+	RequestPhaseTimer &timer = req->phaseTimer;
+
+	if (req->startedAt != 0) {
+		timer.end(RP_TOTAL, SystemTime::getMonotonicUsec());
+	}
+	if (timer.measured == 0) {
+		timer.reset();
+		return;
+	}
+
+	latencyStats.record(timer);
+
+	// The pool options (and thus the app group name) are only
+	// valid for this request if it got as far as checking out a session.
+	const HashedStaticString &appGroupName = req->options.getAppGroupName();
+	if (timer.began(RP_CHECKOUT_WAIT)
+	 && !appGroupName.empty()
+	 && appGroupName.size() <= Table::MAX_KEY_LENGTH)
+	{
+		RequestLatencyStatsPtr *stats;
+		if (!appGroupLatencyStats.lookup(appGroupName, &stats)) {
+			if (appGroupLatencyStats.size() >= Table::MAX_ITEMS - 1) {
+				timer.reset();
+				return;
+			}
+			stats = &appGroupLatencyStats.insert(appGroupName,
+				boost::make_shared<RequestLatencyStats>())->value;
+		}
+		(*stats)->record(timer);
+	}
+
+	timer.reset();
+}
+
+/**
+ * Assigns the request a number in the request trace flight recorder and
+ * records its first event, unless tracing is disabled or the request is
+ * already being traced.
+ */
+void
+Controller::beginRequestTrace(Request *req, MonotonicTimeUsec now) {
+	if (traceRecorder.isEnabled() && req->traceNumber == 0) {
+		req->traceNumber = traceRecorder.newRequestNumber();
+		recordRequestTraceEvent(req, RTE_ACCEPTED, now);
+	}
+}
+
+/**
+ * Records an event of the request in the request trace flight recorder.
+ * Only the first occurrence of each event type is recorded, so that retries
+ * (e.g. of session checkouts) don't push other requests' events out of the
+ * ring buffer.
+ */
+void
+Controller::recordRequestTraceEvent(Request *req, RequestTraceEventType type,
+	MonotonicTimeUsec now, boost::uint32_t data)
+{
+	if (req->traceNumber != 0 && !(req->traceEventsRecorded & (1 << type))) {
+		req->traceEventsRecorded |= 1 << type;
+		traceRecorder.record(req->traceNumber, type, now, data);
+	}
+}
+
+/**
+ * Publishes the current values of the gauges in `metrics`. Counters are
+ * updated as the events happen, but gauges are only refreshed here because
+ * their inputs change far too often to publish every change.
+ */
+void
+Controller::updateMetricsGauges() {
+	const struct MemoryKit::mbuf_pool &mbufPool = getContext()->mbuf_pool;
+	metrics.activeClients.set(activeClientCount);
+	metrics.mbufActiveBytes.set((boost::int64_t) mbuf_pool_active_bytes(&mbufPool));
+	metrics.mbufSpareBytes.set((boost::int64_t) mbuf_pool_spare_bytes(&mbufPool));
+}
+
 #ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 	void
 	Controller::reportLargeTimeDiff(Client *client, const char *name,
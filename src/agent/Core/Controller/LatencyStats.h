@@ -0,0 +1,209 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_LATENCY_STATS_H_
+#define _PASSENGER_CORE_CONTROLLER_LATENCY_STATS_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <map>
+
+#include <jsoncpp/json.h>
+#include <Algorithms/LatencyHistogram.h>
+#include <SystemTools/SystemTime.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * The phases of a request for which the Controller keeps latency
+ * histograms.
+ */
+enum RequestPhase {
+	// From receiving the first byte of the request header until the
+	// header is fully parsed.
+	RP_HEADER_PARSE,
+	// From asking the ApplicationPool for a session until it is checked
+	// out (see BM_BEFORE_CHECKOUT and BM_AFTER_CHECKOUT).
+	RP_CHECKOUT_WAIT,
+	// Connecting to the application process's socket.
+	RP_APP_CONNECT,
+	// From starting to send the request to the application process until
+	// it sends the first byte of its response.
+	RP_TIME_TO_FIRST_BYTE,
+	// From receiving the first byte of the request header until the
+	// response has been fully written to the client.
+	RP_TOTAL,
+
+	RP_COUNT
+};
+
+inline const char *
+requestPhaseToString(RequestPhase phase) {
+	switch (phase) {
+	case RP_HEADER_PARSE:
+		return "header_parse";
+	case RP_CHECKOUT_WAIT:
+		return "checkout_wait";
+	case RP_APP_CONNECT:
+		return "app_connect";
+	case RP_TIME_TO_FIRST_BYTE:
+		return "time_to_first_byte";
+	case RP_TOTAL:
+		return "total";
+	default:
+		return "unknown";
+	}
+}
+
+
+/**
+ * Per-request bookkeeping of when each phase began and how long it took.
+ * Phases that never began or never finished are not recorded.
+ */
+struct RequestPhaseTimer {
+	MonotonicTimeUsec beganAt[RP_COUNT];
+	MonotonicTimeUsec durations[RP_COUNT];
+	boost::uint8_t measured;
+
+	void reset() {
+		for (unsigned int i = 0; i < RP_COUNT; i++) {
+			beganAt[i] = 0;
+		}
+		measured = 0;
+	}
+
+	bool began(RequestPhase phase) const {
+		return beganAt[phase] != 0;
+	}
+
+	bool isMeasured(RequestPhase phase) const {
+		return measured & (1 << phase);
+	}
+
+	/**
+	 * Marks the beginning of the given phase. Does nothing if the phase
+	 * already began, so that retries are included in the measurement.
+	 */
+	void begin(RequestPhase phase, MonotonicTimeUsec now) {
+		if (beganAt[phase] == 0) {
+			beganAt[phase] = now;
+		}
+	}
+
+	void end(RequestPhase phase, MonotonicTimeUsec now) {
+		if (beganAt[phase] != 0 && !isMeasured(phase)) {
+			durations[phase] = (now > beganAt[phase]) ? now - beganAt[phase] : 0;
+			measured |= 1 << phase;
+		}
+	}
+};
+
+
+/**
+ * A latency histogram, in microseconds, for each request phase.
+ */
+struct RequestLatencyStats {
+	LatencyHistogram histograms[RP_COUNT];
+
+	void record(const RequestPhaseTimer &timer) {
+		for (unsigned int i = 0; i < RP_COUNT; i++) {
+			if (timer.isMeasured((RequestPhase) i)) {
+				histograms[i].record(timer.durations[i]);
+			}
+		}
+	}
+
+	void merge(const RequestLatencyStats &other) {
+		for (unsigned int i = 0; i < RP_COUNT; i++) {
+			histograms[i].merge(other.histograms[i]);
+		}
+	}
+
+	Json::Value inspectAsJson() const {
+		Json::Value doc(Json::objectValue);
+		for (unsigned int i = 0; i < RP_COUNT; i++) {
+			const LatencyHistogram &h = histograms[i];
+			Json::Value phase;
+			phase["count"] = (Json::UInt64) h.getCount();
+			phase["min"] = (Json::UInt64) h.getMin();
+			phase["mean"] = h.getMean();
+			phase["max"] = (Json::UInt64) h.getMax();
+			phase["p50"] = (Json::UInt64) h.getValueAtPercentile(50);
+			phase["p90"] = (Json::UInt64) h.getValueAtPercentile(90);
+			phase["p99"] = (Json::UInt64) h.getValueAtPercentile(99);
+			phase["p999"] = (Json::UInt64) h.getValueAtPercentile(99.9);
+			doc[requestPhaseToString((RequestPhase) i)] = phase;
+		}
+		return doc;
+	}
+};
+
+typedef boost::shared_ptr<RequestLatencyStats> RequestLatencyStatsPtr;
+
+
+/**
+ * A copy of the latency histograms of one or more Controllers, used to
+ * merge the histograms of all Controller threads outside their event loops.
+ */
+struct LatencyStatsSnapshot {
+	RequestLatencyStats total;
+	map<string, RequestLatencyStats> appGroups;
+
+	void merge(const LatencyStatsSnapshot &other) {
+		map<string, RequestLatencyStats>::const_iterator it, end = other.appGroups.end();
+
+		total.merge(other.total);
+		for (it = other.appGroups.begin(); it != end; it++) {
+			appGroups[it->first].merge(it->second);
+		}
+	}
+
+	Json::Value inspectAsJson() const {
+		Json::Value doc;
+		Json::Value appGroupsDoc(Json::objectValue);
+		map<string, RequestLatencyStats>::const_iterator it, end = appGroups.end();
+
+		doc["unit"] = "microseconds";
+		doc["phases"] = total.inspectAsJson();
+		for (it = appGroups.begin(); it != end; it++) {
+			appGroupsDoc[it->first] = it->second.inspectAsJson();
+		}
+		doc["app_groups"] = appGroupsDoc;
+		return doc;
+	}
+};
+
+typedef boost::shared_ptr<LatencyStatsSnapshot> LatencyStatsSnapshotPtr;
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_LATENCY_STATS_H_ */
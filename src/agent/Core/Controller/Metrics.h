@@ -0,0 +1,63 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_METRICS_H_
+#define _PASSENGER_CORE_CONTROLLER_METRICS_H_
+
+#include <Utils/OpenMetrics.h>
+
+namespace Passenger {
+namespace Core {
+
+
+/**
+ * Counters and gauges of a single Controller. They are only written by the
+ * Controller's event loop thread, and can be read by any thread (e.g. by the
+ * ApiServer's /metrics endpoint) without going through the event loop.
+ *
+ * Gauges are refreshed when a request begins and on every statistics update,
+ * so they may lag behind by at most the statistics update interval on an
+ * idle Controller.
+ */
+struct ControllerMetrics {
+	MetricsCacheLinePadding paddingBefore;
+
+	MetricCounter requestsBegun;
+	MetricCounter requestsFinished;
+	MetricCounter turboCacheHits;
+	MetricCounter sessionCheckoutErrors;
+
+	MetricGauge activeClients;
+	MetricGauge mbufActiveBytes;
+	MetricGauge mbufSpareBytes;
+
+	MetricsCacheLinePadding paddingAfter;
+};
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_METRICS_H_ */
@@ -37,6 +37,9 @@
 #include <Core/ApplicationPool/Pool.h>
 #include <Core/Controller/Config.h>
 #include <Core/Controller/AppResponse.h>
+#include <Core/Controller/LatencyStats.h>
+#include <Core/Controller/RequestTracing.h>
+#include <Core/Controller/ConfigSnapshot.h>
 
 namespace Passenger {
 namespace Core {
@@ -78,6 +81,8 @@ public:
 	bool appResponseInitialized: 1;
 	bool strip100ContinueHeader: 1;
 	bool hasPragmaHeader: 1;
+	// Whether this request was counted in `metrics.requestsBegun`.
+	bool countedInMetrics: 1;
 
 	Options options;
 	AbstractSessionPtr session;
@@ -101,6 +106,16 @@ public:
 	//
 	// This value is guaranteed to be contiguous.
 	LString *envvars;
+	// The snapshot referenced by `!~PASSENGER_CONFIG`, if any. Some of
+	// `secureHeaders` point into it, so it's kept alive until they are
+	// cleared.
+	ConfigSnapshotPtr configSnapshot;
+
+	RequestPhaseTimer phaseTimer;
+	// 0 if this request is not being traced.
+	boost::uint32_t traceNumber;
+	// A bit mask of the RequestTraceEventTypes recorded so far.
+	boost::uint8_t traceEventsRecorded;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		bool timedAppPoolGet;
@@ -0,0 +1,439 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_REQUEST_TRACING_H_
+#define _PASSENGER_CORE_CONTROLLER_REQUEST_TRACING_H_
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/cstdint.hpp>
+#include <oxt/macros.hpp>
+#include <new>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <map>
+#include <cstdlib>
+
+#include <jsoncpp/json.h>
+#include <SystemTools/SystemTime.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * The points in a request's life that the Controller records in its
+ * request trace flight recorder.
+ */
+enum RequestTraceEventType {
+	// The first byte of the request header was received.
+	RTE_ACCEPTED,
+	RTE_HEADERS_PARSED,
+	// The Controller asked the ApplicationPool for a session.
+	RTE_CHECKOUT_QUEUED,
+	// A session was checked out. The data is the PID of the process.
+	RTE_CHECKOUT_GRANTED,
+	RTE_APP_CONNECTED,
+	RTE_FIRST_APP_BYTE,
+	// The request was deinitialized. The data is the status code of the
+	// application's response, or 0 if there was none.
+	RTE_END,
+
+	RTE_COUNT
+};
+
+inline const char *
+requestTraceEventTypeToString(RequestTraceEventType type) {
+	switch (type) {
+	case RTE_ACCEPTED:
+		return "accepted";
+	case RTE_HEADERS_PARSED:
+		return "headers_parsed";
+	case RTE_CHECKOUT_QUEUED:
+		return "checkout_queued";
+	case RTE_CHECKOUT_GRANTED:
+		return "checkout_granted";
+	case RTE_APP_CONNECTED:
+		return "app_connected";
+	case RTE_FIRST_APP_BYTE:
+		return "first_app_byte";
+	case RTE_END:
+		return "end";
+	default:
+		return "unknown";
+	}
+}
+
+
+struct RequestTraceEvent {
+	MonotonicTimeUsec time;
+	boost::uint32_t requestNumber;
+	boost::uint32_t type: 8;
+	// Large enough for a PID on Linux (at most 2^22).
+	boost::uint32_t data: 24;
+};
+
+
+/**
+ * A fixed-size ring buffer with the most recent request trace events of a
+ * single Controller. It is only accessed from the Controller's event loop
+ * thread, so recording an event is just a few stores: there are no locks,
+ * atomics or allocations involved.
+ */
+class RequestTraceRecorder: public boost::noncopyable {
+private:
+	RequestTraceEvent *events;
+	unsigned int capacity;
+	boost::uint64_t mask;
+	boost::uint64_t eventsRecorded;
+	boost::uint32_t lastRequestNumber;
+
+	static unsigned int roundUpToPowerOfTwo(unsigned int n) {
+		unsigned int result = 1;
+		while (result < n) {
+			result <<= 1;
+		}
+		return result;
+	}
+
+public:
+	RequestTraceRecorder(unsigned int capacity = 0)
+		: events(NULL),
+		  capacity(0),
+		  mask(0),
+		  eventsRecorded(0),
+		  lastRequestNumber(0)
+	{
+		setCapacity(capacity);
+	}
+
+	~RequestTraceRecorder() {
+		free(events);
+	}
+
+	/**
+	 * Changes the number of events that the ring buffer holds, rounded up
+	 * to a power of two. 0 disables recording. Discards all events recorded
+	 * so far if the capacity changes.
+	 */
+	void setCapacity(unsigned int newCapacity) {
+		if (newCapacity > 0) {
+			newCapacity = roundUpToPowerOfTwo(newCapacity);
+		}
+		if (newCapacity == capacity) {
+			return;
+		}
+
+		free(events);
+		events = NULL;
+		capacity = 0;
+		mask = 0;
+		eventsRecorded = 0;
+		if (newCapacity > 0) {
+			events = (RequestTraceEvent *) malloc(newCapacity * sizeof(RequestTraceEvent));
+			if (events == NULL) {
+				throw std::bad_alloc();
+			}
+			capacity = newCapacity;
+			mask = newCapacity - 1;
+		}
+	}
+
+	unsigned int getCapacity() const {
+		return capacity;
+	}
+
+	bool isEnabled() const {
+		return capacity != 0;
+	}
+
+	/**
+	 * Returns a request number for a new request. It is never 0, so
+	 * that 0 can be used to mean "not traced".
+	 */
+	boost::uint32_t newRequestNumber() {
+		lastRequestNumber++;
+		if (OXT_UNLIKELY(lastRequestNumber == 0)) {
+			lastRequestNumber = 1;
+		}
+		return lastRequestNumber;
+	}
+
+	void record(boost::uint32_t requestNumber, RequestTraceEventType type,
+		MonotonicTimeUsec time, boost::uint32_t data = 0)
+	{
+		if (OXT_LIKELY(capacity != 0)) {
+			RequestTraceEvent &event = events[eventsRecorded & mask];
+			event.time = time;
+			event.requestNumber = requestNumber;
+			event.type = type;
+			event.data = data;
+			eventsRecorded++;
+		}
+	}
+
+	/**
+	 * Appends the events in the ring buffer to `result`, oldest first.
+	 */
+	void copyEvents(vector<RequestTraceEvent> &result) const {
+		boost::uint64_t count = std::min<boost::uint64_t>(eventsRecorded, capacity);
+
+		result.reserve(result.size() + count);
+		for (boost::uint64_t i = eventsRecorded - count; i < eventsRecorded; i++) {
+			result.push_back(events[i & mask]);
+		}
+	}
+};
+
+
+/**
+ * The events of a single request, as reassembled from a
+ * RequestTraceRecorder's ring buffer.
+ */
+struct RequestTrace {
+	unsigned int threadNumber;
+	boost::uint32_t requestNumber;
+	// A bit mask of the RequestTraceEventTypes that were recorded.
+	boost::uint8_t recorded;
+	MonotonicTimeUsec times[RTE_COUNT];
+	boost::uint32_t data[RTE_COUNT];
+
+	RequestTrace()
+		: threadNumber(0),
+		  requestNumber(0),
+		  recorded(0)
+		{ }
+
+	bool has(RequestTraceEventType type) const {
+		return recorded & (1 << type);
+	}
+
+	/**
+	 * Whether both the beginning and the end of the request are known.
+	 * A request is incomplete if it is still in progress, or if its first
+	 * events have already been overwritten in the ring buffer.
+	 */
+	bool isComplete() const {
+		return has(RTE_ACCEPTED) && has(RTE_END);
+	}
+
+	MonotonicTimeUsec getDuration() const {
+		if (times[RTE_END] > times[RTE_ACCEPTED]) {
+			return times[RTE_END] - times[RTE_ACCEPTED];
+		} else {
+			return 0;
+		}
+	}
+
+	string getId() const {
+		return toString(threadNumber) + "-" + toString(requestNumber);
+	}
+};
+
+
+/**
+ * Complete request traces, gathered from the flight recorders of one or more
+ * Controllers and filtered by duration. Used by the ApiServer to reassemble
+ * requests outside the Controllers' event loops.
+ */
+struct RequestTraceSnapshot {
+	MonotonicTimeUsec minDuration;
+	vector<RequestTrace> traces;
+
+	RequestTraceSnapshot(MonotonicTimeUsec _minDuration = 0)
+		: minDuration(_minDuration)
+		{ }
+
+	/**
+	 * Reassembles the requests in `events`, as obtained with
+	 * `RequestTraceRecorder::copyEvents()`. Only keeps complete requests
+	 * that took at least `minDuration`.
+	 */
+	void add(unsigned int threadNumber, const vector<RequestTraceEvent> &events) {
+		map<boost::uint32_t, RequestTrace> requests;
+		map<boost::uint32_t, RequestTrace>::const_iterator it, end;
+		vector<RequestTraceEvent>::const_iterator eit, eend = events.end();
+
+		for (eit = events.begin(); eit != eend; eit++) {
+			RequestTrace &trace = requests[eit->requestNumber];
+			trace.threadNumber = threadNumber;
+			trace.requestNumber = eit->requestNumber;
+			trace.recorded |= 1 << eit->type;
+			trace.times[eit->type] = eit->time;
+			trace.data[eit->type] = eit->data;
+		}
+
+		end = requests.end();
+		for (it = requests.begin(); it != end; it++) {
+			const RequestTrace &trace = it->second;
+			if (trace.isComplete() && trace.getDuration() >= minDuration) {
+				traces.push_back(trace);
+			}
+		}
+	}
+
+	/**
+	 * Only keeps the `limit` requests that ended most recently, sorted by
+	 * the time they ended.
+	 */
+	void keepMostRecent(unsigned int limit) {
+		std::sort(traces.begin(), traces.end(), endedBefore);
+		if (traces.size() > limit) {
+			traces.erase(traces.begin(), traces.end() - limit);
+		}
+	}
+
+	Json::Value inspectAsJson() const {
+		Json::Value doc;
+		Json::Value tracesDoc(Json::arrayValue);
+		vector<RequestTrace>::const_iterator it, end = traces.end();
+
+		for (it = traces.begin(); it != end; it++) {
+			const RequestTrace &trace = *it;
+			Json::Value traceDoc;
+			Json::Value eventsDoc(Json::arrayValue);
+
+			traceDoc["id"] = trace.getId();
+			traceDoc["thread"] = trace.threadNumber;
+			traceDoc["duration"] = (Json::UInt64) trace.getDuration();
+			if (trace.data[RTE_END] != 0) {
+				traceDoc["status"] = trace.data[RTE_END];
+			}
+			if (trace.has(RTE_CHECKOUT_GRANTED)) {
+				traceDoc["pid"] = trace.data[RTE_CHECKOUT_GRANTED];
+			}
+			for (unsigned int i = 0; i < RTE_COUNT; i++) {
+				if (trace.has((RequestTraceEventType) i)) {
+					Json::Value eventDoc;
+					eventDoc["name"] = requestTraceEventTypeToString(
+						(RequestTraceEventType) i);
+					eventDoc["offset"] = (Json::UInt64) (trace.times[i]
+						- trace.times[RTE_ACCEPTED]);
+					eventsDoc.append(eventDoc);
+				}
+			}
+			traceDoc["events"] = eventsDoc;
+			tracesDoc.append(traceDoc);
+		}
+
+		doc["unit"] = "microseconds";
+		doc["traces"] = tracesDoc;
+		return doc;
+	}
+
+	/**
+	 * Formats the traces in the Chrome trace event format, which can be
+	 * loaded into chrome://tracing or Perfetto. Each Controller thread is
+	 * shown as a process, and each request as a thread within it, because
+	 * requests on the same Controller overlap.
+	 */
+	Json::Value inspectAsChromeTrace() const {
+		static const struct {
+			const char *name;
+			RequestTraceEventType begin;
+			RequestTraceEventType end;
+		} spans[] = {
+			{ "header_parse", RTE_ACCEPTED, RTE_HEADERS_PARSED },
+			{ "checkout_wait", RTE_CHECKOUT_QUEUED, RTE_CHECKOUT_GRANTED },
+			{ "app_connect", RTE_CHECKOUT_GRANTED, RTE_APP_CONNECTED },
+			{ "time_to_first_byte", RTE_APP_CONNECTED, RTE_FIRST_APP_BYTE },
+			{ "response", RTE_FIRST_APP_BYTE, RTE_END }
+		};
+		Json::Value doc;
+		Json::Value eventsDoc(Json::arrayValue);
+		map<unsigned int, bool> threadsNamed;
+		vector<RequestTrace>::const_iterator it, end = traces.end();
+
+		for (it = traces.begin(); it != end; it++) {
+			const RequestTrace &trace = *it;
+			Json::Value eventDoc;
+
+			if (!threadsNamed[trace.threadNumber]) {
+				threadsNamed[trace.threadNumber] = true;
+				eventDoc["name"] = "process_name";
+				eventDoc["ph"] = "M";
+				eventDoc["pid"] = trace.threadNumber;
+				eventDoc["args"]["name"] = "Controller thread "
+					+ toString(trace.threadNumber);
+				eventsDoc.append(eventDoc);
+				eventDoc = Json::Value();
+			}
+
+			eventDoc["name"] = "request " + trace.getId();
+			eventDoc["cat"] = "request";
+			eventDoc["ph"] = "X";
+			eventDoc["ts"] = (Json::UInt64) trace.times[RTE_ACCEPTED];
+			eventDoc["dur"] = (Json::UInt64) trace.getDuration();
+			eventDoc["pid"] = trace.threadNumber;
+			eventDoc["tid"] = trace.requestNumber;
+			if (trace.data[RTE_END] != 0) {
+				eventDoc["args"]["status"] = trace.data[RTE_END];
+			}
+			if (trace.has(RTE_CHECKOUT_GRANTED)) {
+				eventDoc["args"]["pid"] = trace.data[RTE_CHECKOUT_GRANTED];
+			}
+			eventsDoc.append(eventDoc);
+
+			for (unsigned int i = 0; i < sizeof(spans) / sizeof(spans[0]); i++) {
+				if (!trace.has(spans[i].begin) || !trace.has(spans[i].end)
+				 || trace.times[spans[i].end] < trace.times[spans[i].begin])
+				{
+					continue;
+				}
+				Json::Value spanDoc;
+				spanDoc["name"] = spans[i].name;
+				spanDoc["cat"] = "phase";
+				spanDoc["ph"] = "X";
+				spanDoc["ts"] = (Json::UInt64) trace.times[spans[i].begin];
+				spanDoc["dur"] = (Json::UInt64) (trace.times[spans[i].end]
+					- trace.times[spans[i].begin]);
+				spanDoc["pid"] = trace.threadNumber;
+				spanDoc["tid"] = trace.requestNumber;
+				eventsDoc.append(spanDoc);
+			}
+		}
+
+		doc["traceEvents"] = eventsDoc;
+		doc["displayTimeUnit"] = "ms";
+		return doc;
+	}
+
+private:
+	static bool endedBefore(const RequestTrace &a, const RequestTrace &b) {
+		return a.times[RTE_END] < b.times[RTE_END];
+	}
+};
+
+typedef boost::shared_ptr<RequestTraceSnapshot> RequestTraceSnapshotPtr;
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_REQUEST_TRACING_H_ */
@@ -170,12 +170,11 @@ Controller::sendHeaderToAppWithSessionProtocol(Client *client, Request *req) {
 	unsigned int bufferSize = determineMaxHeaderSizeForSessionProtocol(req,
 		state, deltaMonotonic);
 	MemoryKit::mbuf_pool &mbuf_pool = getContext()->mbuf_pool;
-	const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
+	const unsigned int MBUF_MAX_SIZE = mbuf_pool_max_data_size(&mbuf_pool);
 	bool ok;
 
 	if (bufferSize <= MBUF_MAX_SIZE) {
-		MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
-		bufferSize = MBUF_MAX_SIZE;
+		MemoryKit::mbuf buffer(MemoryKit::mbuf_get_with_size(&mbuf_pool, bufferSize));
 
 		ok = constructHeaderForSessionProtocol(req, buffer.start,
 			bufferSize, state, deltaMonotonic);
@@ -900,10 +899,10 @@ Controller::sendHeaderToAppWithHttpProtocolWithBuffering(Request *req,
 	(void) ok; // Shut up compiler warning
 
 	MemoryKit::mbuf_pool &mbuf_pool = getContext()->mbuf_pool;
-	const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
+	const unsigned int MBUF_MAX_SIZE = mbuf_pool_max_data_size(&mbuf_pool);
 	if (dataSize <= MBUF_MAX_SIZE) {
-		MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
-		gatherBuffers(buffer.start, MBUF_MAX_SIZE, buffers, nbuffers);
+		MemoryKit::mbuf buffer(MemoryKit::mbuf_get_with_size(&mbuf_pool, dataSize));
+		gatherBuffers(buffer.start, dataSize, buffers, nbuffers);
 		buffer = MemoryKit::mbuf(buffer, offset, dataSize - offset);
 		req->appSink.feedWithoutRefGuard(boost::move(buffer));
 	} else {
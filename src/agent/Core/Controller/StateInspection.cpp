@@ -52,8 +52,8 @@ Controller::getThreadNumber() const {
 }
 
 Json::Value
-Controller::inspectStateAsJson() const {
-	Json::Value doc = ParentClass::inspectStateAsJson();
+Controller::inspectServerStateAsJson() const {
+	Json::Value doc = ParentClass::inspectServerStateAsJson();
 	if (turboCaching.isEnabled()) {
 		Json::Value subdoc;
 		subdoc["fetches"] = turboCaching.responseCache.getFetches();
@@ -67,6 +67,62 @@ Controller::inspectStateAsJson() const {
 	return doc;
 }
 
+Json::Value
+Controller::inspectMemoryUsageAsJson() const {
+	Json::Value doc = ParentClass::inspectMemoryUsageAsJson();
+	const Client *client;
+	boost::uint64_t inMemory = 0, onDisk = 0;
+
+	TAILQ_FOREACH (client, &activeClients, nextClient.activeOrDisconnectedClient) {
+		if (client->currentRequest != NULL) {
+			const Request *req = client->currentRequest;
+			inMemory += req->bodyBuffer.getBytesBuffered();
+			onDisk += req->bodyBuffer.getBytesBufferedOnDisk();
+		}
+	}
+	doc["request_body_buffers"]["in_memory"] = byteSizeToJson(inMemory);
+	doc["request_body_buffers"]["on_disk"] = byteSizeToJson(onDisk);
+
+	if (turboCaching.isEnabled()) {
+		const ResponseCache<Request> &responseCache = turboCaching.responseCache;
+		doc["turbocaching"]["entries"] = responseCache.getEntryCount();
+		doc["turbocaching"]["data_size"] = byteSizeToJson(responseCache.getDataSize());
+		doc["turbocaching"]["memory"] = byteSizeToJson(sizeof(responseCache));
+	}
+
+	doc["request_trace_buffer"] = byteSizeToJson(traceRecorder.getCapacity()
+		* sizeof(RequestTraceEvent));
+
+	return doc;
+}
+
+/**
+ * Copies the latency histograms of this Controller into `snapshot`. Must be
+ * called from the event loop thread; the snapshot may then be merged with
+ * those of other Controllers from any thread.
+ */
+void
+Controller::snapshotLatencyStats(LatencyStatsSnapshot &snapshot) const {
+	StringKeyTable<RequestLatencyStatsPtr>::ConstIterator it(appGroupLatencyStats);
+
+	snapshot.total = latencyStats;
+	while (*it != NULL) {
+		snapshot.appGroups[it.getKey().toString()] = *it.getValue();
+		it.next();
+	}
+}
+
+/**
+ * Copies the events in this Controller's request trace flight recorder into
+ * `events`, oldest first. Must be called from the event loop thread.
+ * Reassembling them into requests is left to the caller, so that it happens
+ * outside the event loop.
+ */
+void
+Controller::copyRequestTraceEvents(vector<RequestTraceEvent> &events) const {
+	traceRecorder.copyEvents(events);
+}
+
 Json::Value
 Controller::inspectClientStateAsJson(const Client *client) const {
 	Json::Value doc = ParentClass::inspectClientStateAsJson(client);
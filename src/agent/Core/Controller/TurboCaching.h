@@ -265,7 +265,7 @@ public:
 	template<typename Server, typename Client>
 	void writeResponse(Server *server, Client *client, Request *req, ResponseCacheEntryType &entry) {
 		MemoryKit::mbuf_pool &mbuf_pool = server->getContext()->mbuf_pool;
-		const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
+		const unsigned int MBUF_MAX_SIZE = mbuf_pool_max_data_size(&mbuf_pool);
 		ResponsePreparation prep;
 		unsigned int headerSize;
 
@@ -274,8 +274,8 @@ public:
 
 		if (headerSize + entry.body->httpBodySize <= MBUF_MAX_SIZE) {
 			// Header and body fit inside a single mbuf
-			MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
-			buffer = MemoryKit::mbuf(buffer, 0, headerSize + entry.body->httpBodySize);
+			MemoryKit::mbuf buffer(MemoryKit::mbuf_get_with_size(&mbuf_pool,
+				headerSize + entry.body->httpBodySize));
 
 			buildResponseHeader(prep, server, buffer.start, buffer.size());
 			memcpy(buffer.start + headerSize, entry.body->httpBodyData, entry.body->httpBodySize);
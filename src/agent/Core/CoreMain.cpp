@@ -76,11 +76,13 @@
 
 #include <Shared/Fundamentals/Initialization.h>
 #include <Shared/ApiServerUtils.h>
+#include <Shared/ListenerHandoff.h>
 #include <Constants.h>
 #include <LoggingKit/Context.h>
 #include <ConfigKit/SubComponentUtils.h>
 #include <ServerKit/Server.h>
 #include <ServerKit/AcceptLoadBalancer.h>
+#include <JsonTools/JsonWriter.h>
 #include <AppTypeDetector/Detector.h>
 #include <IOTools/MessageSerialization.h>
 #include <FileDescriptor.h>
@@ -98,6 +100,8 @@
 #include <Core/Config.h>
 #include <Core/ConfigChange.h>
 #include <Core/ApplicationPool/Pool.h>
+#include <Core/CpuProfiler.cpp>
+#include <Core/EventLoopStallDetector.cpp>
 #include <Core/SecurityUpdateChecker.h>
 #include <Core/TelemetryCollector.h>
 #include <Core/AdminPanelConnector.h>
@@ -159,6 +163,7 @@ namespace Core {
 		struct ev_signal sigquitWatcher;
 
 		ApiWorkingObjects apiWorkingObjects;
+		EventLoopStallDetector *eventLoopStallDetector;
 
 		EventFd exitEvent;
 		EventFd allClientsDisconnectedEvent;
@@ -172,7 +177,8 @@ namespace Core {
 		oxt::thread *adminPanelConnectorThread;
 
 		WorkingObjects()
-			: exitEvent(__FILE__, __LINE__, "WorkingObjects: exitEvent"),
+			: eventLoopStallDetector(NULL),
+			  exitEvent(__FILE__, __LINE__, "WorkingObjects: exitEvent"),
 			  allClientsDisconnectedEvent(__FILE__, __LINE__, "WorkingObjects: allClientsDisconnectedEvent"),
 			  terminationCount(0),
 			  shutdownCounter(0),
@@ -190,6 +196,7 @@ namespace Core {
 		}
 
 		~WorkingObjects() {
+			delete eventLoopStallDetector;
 			delete prestarterThread;
 			delete adminPanelConnectorThread;
 			delete adminPanelConnector;
@@ -446,7 +453,7 @@ makeFileWorldReadableAndWritable(const string &path) {
 #endif
 
 static void
-startListening() {
+createListeners() {
 	TRACE_POINT();
 	WorkingObjects *wo = workingObjects;
 	const Json::Value addresses = coreConfig->get("controller_addresses");
@@ -491,6 +498,76 @@ startListening() {
 	}
 }
 
+/**
+ * Asks the Watchdog for the listener sockets that a previous Core process
+ * handed over to it, so that the sockets, and the connections queued in
+ * their backlogs, survive Core restarts. Returns false if the Watchdog has
+ * no suitable sockets, in which case the caller must create them.
+ */
+static bool
+adoptListenersFromWatchdog() {
+	TRACE_POINT();
+	WorkingObjects *wo = workingObjects;
+	const Json::Value addresses = coreConfig->get("controller_addresses");
+	const Json::Value apiAddresses = coreConfig->get("api_server_addresses");
+	vector<FileDescriptor> fds;
+	unsigned int i;
+
+	if (!ListenerHandoff::requestListeners(FEEDBACK_FD,
+		addresses.size() + apiAddresses.size(), fds))
+	{
+		return false;
+	}
+
+	for (i = 0; i < addresses.size(); i++) {
+		wo->serverFds[i] = fds[i].detach();
+		P_LOG_FILE_DESCRIPTOR_PURPOSE(wo->serverFds[i],
+			"Server address: " << addresses[i].asString());
+	}
+	for (i = 0; i < apiAddresses.size(); i++) {
+		wo->apiServerFds[i] = fds[addresses.size() + i].detach();
+		P_LOG_FILE_DESCRIPTOR_PURPOSE(wo->apiServerFds[i],
+			"ApiServer address: " << apiAddresses[i].asString());
+	}
+	P_NOTICE("Adopted " << fds.size() << " listener socket(s) from the Watchdog");
+	return true;
+}
+
+/**
+ * Passes our listener sockets to the Watchdog, which keeps them open
+ * so that it can hand them to the next Core process.
+ */
+static void
+handListenersToWatchdog() {
+	TRACE_POINT();
+	WorkingObjects *wo = workingObjects;
+	vector<int> fds;
+	unsigned int i;
+
+	for (i = 0; i < SERVER_KIT_MAX_SERVER_ENDPOINTS && wo->serverFds[i] != -1; i++) {
+		fds.push_back(wo->serverFds[i]);
+	}
+	for (i = 0; i < SERVER_KIT_MAX_SERVER_ENDPOINTS && wo->apiServerFds[i] != -1; i++) {
+		fds.push_back(wo->apiServerFds[i]);
+	}
+
+	ListenerHandoff::sendListeners(FEEDBACK_FD, fds);
+}
+
+static void
+startListening() {
+	TRACE_POINT();
+	bool handoff = feedbackFdAvailable()
+		&& coreConfig->get("watchdog_listener_handoff").asBool();
+
+	if (!handoff || !adoptListenersFromWatchdog()) {
+		createListeners();
+	}
+	if (handoff) {
+		handListenersToWatchdog();
+	}
+}
+
 static void
 createPidFile() {
 	TRACE_POINT();
@@ -526,7 +603,8 @@ printInfo(EV_P_ struct ev_signal *watcher, int revents) {
 
 static void
 inspectControllerStateAsJson(Controller *controller, string *result) {
-	*result = controller->inspectStateAsJson().toStyledString();
+	JsonWriter writer(*result, true);
+	controller->writeStateAsJson(writer);
 }
 
 static void
@@ -604,8 +682,11 @@ dumpControllerStatesOnCrash(void *userData) {
 
 	for (i = 0; i < wo->threadWorkingObjects.size(); i++) {
 		ThreadWorkingObjects *two = &wo->threadWorkingObjects[i];
+		string state;
+		JsonWriter writer(state, true);
+		two->controller->writeStateAsJson(writer);
 		cerr << "####### Controller state (thread " << (i + 1) << ") #######\n";
-		cerr << two->controller->inspectStateAsJson();
+		cerr << state;
 		cerr << "\n\n";
 		cerr.flush();
 	}
@@ -901,6 +982,30 @@ initializeTelemetryCollector() {
 	wo.shutdownCounter.fetch_add(1, boost::memory_order_relaxed);
 }
 
+static void
+initializeEventLoopStallDetector() {
+	TRACE_POINT();
+	WorkingObjects *wo = workingObjects;
+	unsigned int threshold = coreConfig->get("event_loop_stall_threshold").asUInt();
+
+	if (threshold == 0) {
+		P_DEBUG("Event loop stall detector disabled");
+		return;
+	}
+
+	EventLoopStallDetector *detector = new EventLoopStallDetector(threshold,
+		coreConfig->get("event_loop_stall_log_interval").asUInt());
+	wo->eventLoopStallDetector = detector;
+	for (unsigned int i = 0; i < wo->threadWorkingObjects.size(); i++) {
+		detector->add(wo->threadWorkingObjects[i].bgloop,
+			"Main event loop: thread " + toString(i + 1));
+	}
+	if (wo->apiWorkingObjects.apiServer != NULL) {
+		detector->add(wo->apiWorkingObjects.bgloop, "API event loop");
+		wo->apiWorkingObjects.apiServer->eventLoopStallDetector = detector;
+	}
+}
+
 static void
 runAdminPanelConnector(AdminPanelConnector *connector) {
 	connector->run();
@@ -1129,6 +1234,9 @@ mainLoop() {
 	if (wo->threadWorkingObjects.size() > 1) {
 		wo->loadBalancer.start();
 	}
+	if (wo->eventLoopStallDetector != NULL) {
+		wo->eventLoopStallDetector->start();
+	}
 	waitForExitEvent();
 }
 
@@ -1154,8 +1262,12 @@ abortLongRunningConnections(const ApplicationPool2::ProcessPtr &process) {
 }
 
 static void
-shutdownController(ThreadWorkingObjects *two) {
-	two->controller->shutdown();
+shutdownController(ThreadWorkingObjects *two, bool drain) {
+	if (drain) {
+		two->controller->shutdownAndDrain();
+	} else {
+		two->controller->shutdown();
+	}
 }
 
 static void
@@ -1200,7 +1312,9 @@ asyncShutdownTelemetryCollector() {
 }
 
 /* Wait until the watchdog closes the feedback fd (meaning it
- * was killed) or until we receive an exit message.
+ * was killed) or until we receive an exit message. The watchdog
+ * writes 'h' to the feedback fd when a new Core process has taken
+ * over the listener sockets, in which case we drain our clients.
  */
 static void
 waitForExitEvent() {
@@ -1208,6 +1322,8 @@ waitForExitEvent() {
 	WorkingObjects *wo = workingObjects;
 	fd_set fds;
 	int largestFd = -1;
+	char x;
+	bool replaced = false;
 
 	FD_ZERO(&fds);
 	if (feedbackFdAvailable()) {
@@ -1224,7 +1340,11 @@ waitForExitEvent() {
 		throw SystemException("select() failed", e);
 	}
 
-	if (FD_ISSET(FEEDBACK_FD, &fds)) {
+	if (feedbackFdAvailable() && FD_ISSET(FEEDBACK_FD, &fds)) {
+		replaced = syscalls::read(FEEDBACK_FD, &x, 1) == 1 && x == 'h';
+	}
+
+	if (feedbackFdAvailable() && FD_ISSET(FEEDBACK_FD, &fds) && !replaced) {
 		UPDATE_TRACE_POINT();
 		/* If the watchdog has been killed then we'll kill all descendant
 		 * processes and exit. There's no point in keeping the server agent
@@ -1242,13 +1362,18 @@ waitForExitEvent() {
 	} else {
 		UPDATE_TRACE_POINT();
 		/* We received an exit command. */
-		P_NOTICE("Received command to shutdown gracefully. "
-			"Waiting until all clients have disconnected...");
+		if (replaced) {
+			P_NOTICE("A new " SHORT_PROGRAM_NAME " core process has taken over. "
+				"Waiting until all clients have disconnected...");
+		} else {
+			P_NOTICE("Received command to shutdown gracefully. "
+				"Waiting until all clients have disconnected...");
+		}
 		wo->appPool->prepareForShutdown();
 
 		for (unsigned i = 0; i < wo->threadWorkingObjects.size(); i++) {
 			ThreadWorkingObjects *two = &wo->threadWorkingObjects[i];
-			two->bgloop->safe->runLater(boost::bind(shutdownController, two));
+			two->bgloop->safe->runLater(boost::bind(shutdownController, two, replaced));
 		}
 		if (wo->threadWorkingObjects.size() > 1) {
 			wo->loadBalancer.shutdown();
@@ -1288,6 +1413,9 @@ cleanup() {
 
 	uninstallAbortHandlerCustomDiagnostics();
 
+	if (wo->eventLoopStallDetector != NULL) {
+		wo->eventLoopStallDetector->stop();
+	}
 	for (unsigned i = 0; i < wo->threadWorkingObjects.size(); i++) {
 		ThreadWorkingObjects *two = &wo->threadWorkingObjects[i];
 		two->bgloop->stop();
@@ -1330,6 +1458,15 @@ deletePidFile() {
 	TRACE_POINT();
 	Json::Value pidFile = coreConfig->get("pid_file");
 	if (!pidFile.isNull()) {
+		// After a hot restart, the PID file belongs to the Core
+		// process that replaced us.
+		try {
+			if (stringToLL(unsafeReadFile(pidFile.asString())) != (long long) getpid()) {
+				return;
+			}
+		} catch (const SystemException &) {
+			return;
+		}
 		syscalls::unlink(pidFile.asCString());
 	}
 }
@@ -1349,6 +1486,7 @@ runCore() {
 		lowerPrivilege();
 		initializeCurl();
 		initializeNonPrivilegedWorkingObjects();
+		initializeEventLoopStallDetector();
 		initializeSecurityUpdateChecker();
 		initializeTelemetryCollector();
 		initializeAdminPanelConnector();
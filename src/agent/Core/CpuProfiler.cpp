@@ -0,0 +1,290 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+
+#include <boost/core/demangle.hpp>
+#include <oxt/macros.hpp>
+#include <oxt/detail/context.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <cassert>
+#include <signal.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <dlfcn.h>
+
+#ifdef __linux__
+	#include <features.h>
+#endif
+#if defined(__APPLE__) || defined(__GNU_LIBRARY__)
+	#define LIBC_HAS_BACKTRACE_FUNC
+#endif
+#ifdef LIBC_HAS_BACKTRACE_FUNC
+	#include <execinfo.h>
+#endif
+
+#include <Core/CpuProfiler.h>
+#include <FileTools/PathManip.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+namespace Core {
+
+
+/*
+ * The first frames captured by the signal handler are those of the
+ * signal handler itself and of the signal trampoline.
+ */
+#define CPU_PROFILER_SKIPPED_FRAMES 2
+
+static boost::atomic<CpuProfiler *> runningCpuProfiler(NULL);
+static boost::atomic<unsigned int> cpuProfilerSignalHandlersRunning(0);
+static bool cpuProfilerSignalHandlerInstalled = false;
+
+
+CpuProfiler::CpuProfiler(unsigned int _frequency, unsigned int maxSamples)
+	: frequency(std::max(_frequency, 1u)),
+	  capacity(maxSamples),
+	  samples((Sample *) malloc(sizeof(Sample) * std::max(maxSamples, 1u))),
+	  running(false)
+{
+	if (samples == NULL) {
+		throw std::bad_alloc();
+	}
+	nextSample.store(0, boost::memory_order_relaxed);
+	droppedSamples.store(0, boost::memory_order_relaxed);
+}
+
+CpuProfiler::~CpuProfiler() {
+	stop();
+	free(samples);
+}
+
+void
+CpuProfiler::handleSignal(int signo) {
+	#ifdef LIBC_HAS_BACKTRACE_FUNC
+		int e = errno;
+
+		// stop() waits until this counter drops to zero after it has
+		// cleared runningCpuProfiler, so the profiler can't be destroyed
+		// while we use it.
+		cpuProfilerSignalHandlersRunning.fetch_add(1);
+		CpuProfiler *profiler = runningCpuProfiler.load();
+		if (profiler != NULL) {
+			void *frames[MAX_FRAMES + CPU_PROFILER_SKIPPED_FRAMES];
+			int nframes = backtrace(frames, MAX_FRAMES + CPU_PROFILER_SKIPPED_FRAMES);
+			if (nframes > CPU_PROFILER_SKIPPED_FRAMES) {
+				profiler->recordSample(frames + CPU_PROFILER_SKIPPED_FRAMES,
+					nframes - CPU_PROFILER_SKIPPED_FRAMES);
+			}
+		}
+		cpuProfilerSignalHandlersRunning.fetch_sub(1);
+
+		errno = e;
+	#endif
+}
+
+// Called from the signal handler, so must be async-signal-safe.
+void
+CpuProfiler::recordSample(void * const *frames, int nframes) {
+	unsigned int index = nextSample.fetch_add(1, boost::memory_order_relaxed);
+	if (index >= capacity) {
+		droppedSamples.fetch_add(1, boost::memory_order_relaxed);
+		return;
+	}
+
+	Sample &sample = samples[index];
+	sample.nframes = nframes;
+	memcpy(sample.frames, frames, nframes * sizeof(void *));
+
+	const char *threadName = "Unknown thread";
+	size_t threadNameSize = strlen(threadName);
+	#ifdef OXT_THREAD_LOCAL_KEYWORD_SUPPORTED
+		// Only safe to call from a signal handler if it's backed by a
+		// thread local variable.
+		oxt::thread_local_context *ctx = oxt::get_thread_local_context();
+		if (ctx != NULL) {
+			threadName = ctx->thread_name.data();
+			threadNameSize = ctx->thread_name.size();
+		}
+	#endif
+	threadNameSize = std::min<size_t>(threadNameSize, MAX_THREAD_NAME_SIZE - 1);
+	memcpy(sample.threadName, threadName, threadNameSize);
+	sample.threadName[threadNameSize] = '\0';
+}
+
+bool
+CpuProfiler::start() {
+	#ifdef LIBC_HAS_BACKTRACE_FUNC
+		assert(!running);
+		CpuProfiler *expected = NULL;
+		struct itimerval timer;
+
+		if (!runningCpuProfiler.compare_exchange_strong(expected, this)) {
+			return false;
+		}
+
+		if (!cpuProfilerSignalHandlerInstalled) {
+			struct sigaction action;
+			void *frames[1];
+
+			// backtrace() may allocate memory or load libgcc the first time
+			// it's called, neither of which is safe inside a signal handler.
+			backtrace(frames, 1);
+
+			// The handler is never uninstalled: a SIGPROF that is still
+			// pending after stop() would otherwise terminate the process.
+			action.sa_handler = handleSignal;
+			action.sa_flags = SA_RESTART;
+			sigemptyset(&action.sa_mask);
+			sigaction(SIGPROF, &action, NULL);
+			cpuProfilerSignalHandlerInstalled = true;
+		}
+
+		nextSample.store(0, boost::memory_order_relaxed);
+		droppedSamples.store(0, boost::memory_order_relaxed);
+		running = true;
+
+		unsigned int interval = std::max(1000000u / frequency, 1u);
+		timer.it_interval.tv_sec = interval / 1000000;
+		timer.it_interval.tv_usec = interval % 1000000;
+		timer.it_value = timer.it_interval;
+		if (setitimer(ITIMER_PROF, &timer, NULL) == -1) {
+			running = false;
+			runningCpuProfiler.store(NULL);
+			return false;
+		}
+		return true;
+	#else
+		return false;
+	#endif
+}
+
+void
+CpuProfiler::stop() {
+	if (!running) {
+		return;
+	}
+
+	struct itimerval timer;
+	memset(&timer, 0, sizeof(timer));
+	setitimer(ITIMER_PROF, &timer, NULL);
+
+	runningCpuProfiler.store(NULL);
+	while (cpuProfilerSignalHandlersRunning.load() > 0) {
+		usleep(100);
+	}
+	running = false;
+}
+
+unsigned int
+CpuProfiler::getSampleCount() const {
+	return std::min(nextSample.load(boost::memory_order_acquire), capacity);
+}
+
+unsigned int
+CpuProfiler::getDroppedSampleCount() const {
+	return droppedSamples.load(boost::memory_order_relaxed);
+}
+
+static string
+symbolizeFrame(void *address) {
+	Dl_info info;
+
+	if (dladdr(address, &info) != 0) {
+		if (info.dli_sname != NULL) {
+			string result = boost::core::demangle(info.dli_sname);
+			// Semicolons separate frames in the folded stack format.
+			std::replace(result.begin(), result.end(), ';', ':');
+			return result;
+		} else if (info.dli_fname != NULL) {
+			return extractBaseName(info.dli_fname) + "+0x"
+				+ integerToHex((long long) ((const char *) address
+					- (const char *) info.dli_fbase));
+		}
+	}
+	return "0x" + integerToHex((long long) (boost::uintptr_t) address);
+}
+
+void
+CpuProfiler::collectFoldedStacks(FoldedStacks &result) const {
+	assert(!running);
+	map<void *, string> symbols;
+	unsigned int count = getSampleCount();
+	string stack;
+
+	for (unsigned int i = 0; i < count; i++) {
+		const Sample &sample = samples[i];
+
+		stack.assign(sample.threadName);
+		for (int j = (int) sample.nframes - 1; j >= 0; j--) {
+			// Except for the innermost one, frames are return addresses,
+			// which may already belong to the next function.
+			void *address = (j == 0)
+				? sample.frames[j]
+				: (void *) ((char *) sample.frames[j] - 1);
+			map<void *, string>::iterator it = symbols.find(address);
+			if (it == symbols.end()) {
+				it = symbols.insert(make_pair(address, symbolizeFrame(address))).first;
+			}
+			stack.append(1, ';');
+			stack.append(it->second);
+		}
+		result[stack]++;
+	}
+}
+
+string
+CpuProfiler::formatFoldedStacks() const {
+	FoldedStacks stacks;
+	FoldedStacks::const_iterator it, end;
+	string result;
+
+	collectFoldedStacks(stacks);
+	for (it = stacks.begin(), end = stacks.end(); it != end; it++) {
+		result.append(it->first);
+		result.append(1, ' ');
+		result.append(toString(it->second));
+		result.append(1, '\n');
+	}
+	return result;
+}
+
+Json::Value
+CpuProfiler::inspectAsJson() const {
+	Json::Value doc;
+	doc["frequency"] = frequency;
+	doc["samples"] = getSampleCount();
+	doc["dropped_samples"] = getDroppedSampleCount();
+	doc["folded_stacks"] = formatFoldedStacks();
+	return doc;
+}
+
+
+} // namespace Core
+} // namespace Passenger
@@ -0,0 +1,138 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CPU_PROFILER_H_
+#define _PASSENGER_CORE_CPU_PROFILER_H_
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <map>
+
+#include <jsoncpp/json.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * A sampling CPU profiler for the whole process. While it's running, the
+ * kernel sends SIGPROF whenever the process has consumed another
+ * 1/frequency seconds of CPU time, to the thread that was running at that
+ * moment. The signal handler captures that thread's native stack with
+ * backtrace(), like the EventLoopStallDetector does. Idle threads are
+ * therefore never sampled, and the overhead is bounded by the frequency.
+ *
+ * Samples are stored in a buffer that's allocated up front. When it's
+ * full, further samples are counted as dropped. After stopping, the
+ * samples can be aggregated into "folded stacks": one line per unique
+ * stack, with the frames separated by semicolons (outermost first,
+ * prefixed by the thread name) and followed by a space and the number of
+ * samples. This is the input format of flamegraph.pl and speedscope.
+ *
+ * Frames are symbolized with dladdr(). Symbols that are not exported,
+ * such as those in the Passenger agent executable itself, are shown as
+ * `module+0xoffset`, which can be resolved with addr2line.
+ *
+ * Only one CpuProfiler can be running at a time. This class is not
+ * thread-safe: start(), stop() and the inspection methods must be called
+ * from the same thread.
+ */
+class CpuProfiler: public boost::noncopyable {
+public:
+	static const unsigned int MAX_FRAMES = 48;
+	static const unsigned int MAX_THREAD_NAME_SIZE = 48;
+
+	struct Sample {
+		unsigned int nframes;
+		void *frames[MAX_FRAMES];
+		char threadName[MAX_THREAD_NAME_SIZE];
+	};
+
+	typedef map<string, unsigned int> FoldedStacks;
+
+private:
+	unsigned int frequency;
+	unsigned int capacity;
+	Sample *samples;
+	boost::atomic<unsigned int> nextSample;
+	boost::atomic<unsigned int> droppedSamples;
+	bool running;
+
+	static void handleSignal(int signo);
+	void recordSample(void * const *frames, int nframes);
+
+public:
+	/**
+	 * @param frequency The number of samples per second of CPU time.
+	 * @param maxSamples The maximum number of samples to keep.
+	 */
+	CpuProfiler(unsigned int frequency, unsigned int maxSamples);
+	~CpuProfiler();
+
+	/**
+	 * Starts sampling. Returns false if another CpuProfiler is already
+	 * running, or if profiling is not supported on this platform.
+	 */
+	bool start();
+	/**
+	 * Stops sampling, and waits until all signal handlers that are
+	 * recording a sample have finished. Does nothing if not running.
+	 */
+	void stop();
+
+	bool isRunning() const {
+		return running;
+	}
+
+	unsigned int getFrequency() const {
+		return frequency;
+	}
+
+	unsigned int getSampleCount() const;
+	unsigned int getDroppedSampleCount() const;
+	const Sample &getSample(unsigned int i) const {
+		return samples[i];
+	}
+
+	/** Must not be called while running. */
+	void collectFoldedStacks(FoldedStacks &result) const;
+	/** Must not be called while running. */
+	string formatFoldedStacks() const;
+	/** Must not be called while running. */
+	Json::Value inspectAsJson() const;
+};
+
+typedef boost::shared_ptr<CpuProfiler> CpuProfilerPtr;
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CPU_PROFILER_H_ */
@@ -0,0 +1,318 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+
+#include <boost/thread.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <oxt/backtrace.hpp>
+#include <oxt/system_calls.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <signal.h>
+#include <unistd.h>
+
+#ifdef __linux__
+	#include <features.h>
+#endif
+#if defined(__APPLE__) || defined(__GNU_LIBRARY__)
+	#define LIBC_HAS_BACKTRACE_FUNC
+#endif
+#ifdef LIBC_HAS_BACKTRACE_FUNC
+	#include <execinfo.h>
+#endif
+
+#include <Core/EventLoopStallDetector.h>
+#include <LoggingKit/LoggingKit.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace oxt;
+
+
+#ifdef LIBC_HAS_BACKTRACE_FUNC
+
+/*
+ * A native backtrace of a stalled thread is captured by sending it
+ * NATIVE_BACKTRACE_SIGNAL. The signal handler stores the thread's stack
+ * frames in a static buffer, which the detector thread then symbolizes.
+ * Only one capture can be in progress at a time.
+ */
+#define NATIVE_BACKTRACE_SIGNAL SIGURG
+#define NATIVE_BACKTRACE_MAX_FRAMES 64
+#define NATIVE_BACKTRACE_TIMEOUT 100000
+
+struct NativeBacktraceCapture {
+	// Set by the requester. Cleared by whoever claims the request first:
+	// the signal handler, or the requester when it gives up waiting.
+	boost::atomic<bool> requested;
+	boost::atomic<bool> done;
+	void *frames[NATIVE_BACKTRACE_MAX_FRAMES];
+	int nframes;
+};
+
+static NativeBacktraceCapture nativeBacktraceCapture;
+static boost::mutex nativeBacktraceCaptureSyncher;
+static boost::once_flag nativeBacktraceHandlerInstalled = BOOST_ONCE_INIT;
+
+static void
+captureNativeBacktraceFromSignalHandler(int signo) {
+	NativeBacktraceCapture &capture = nativeBacktraceCapture;
+	int e = errno;
+	if (capture.requested.exchange(false, boost::memory_order_acquire)) {
+		capture.nframes = backtrace(capture.frames, NATIVE_BACKTRACE_MAX_FRAMES);
+		capture.done.store(true, boost::memory_order_release);
+	}
+	errno = e;
+}
+
+static void
+installNativeBacktraceHandler() {
+	struct sigaction action;
+	void *frames[1];
+
+	// backtrace() may allocate memory or load libgcc the first time it's
+	// called, neither of which is safe to do inside a signal handler.
+	backtrace(frames, 1);
+
+	action.sa_handler = captureNativeBacktraceFromSignalHandler;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	sigaction(NATIVE_BACKTRACE_SIGNAL, &action, NULL);
+}
+
+static string
+captureNativeBacktrace(pthread_t thread) {
+	boost::lock_guard<boost::mutex> l(nativeBacktraceCaptureSyncher);
+	NativeBacktraceCapture &capture = nativeBacktraceCapture;
+	MonotonicTimeUsec deadline;
+	int ret;
+
+	boost::call_once(installNativeBacktraceHandler, nativeBacktraceHandlerInstalled);
+
+	capture.nframes = 0;
+	capture.done.store(false, boost::memory_order_relaxed);
+	capture.requested.store(true, boost::memory_order_release);
+	ret = pthread_kill(thread, NATIVE_BACKTRACE_SIGNAL);
+	if (ret != 0) {
+		capture.requested.store(false, boost::memory_order_relaxed);
+		return "     (cannot signal thread: " + string(strerror(ret))
+			+ " (errno=" + toString(ret) + "))\n";
+	}
+
+	deadline = SystemTime::getMonotonicUsec() + NATIVE_BACKTRACE_TIMEOUT;
+	while (!capture.done.load(boost::memory_order_acquire)) {
+		if (SystemTime::getMonotonicUsec() >= deadline
+		 && capture.requested.exchange(false, boost::memory_order_relaxed))
+		{
+			// The signal handler hasn't run, so it will not touch
+			// the buffer anymore.
+			return "     (timed out waiting for the thread to handle the signal)\n";
+		}
+		usleep(1000);
+	}
+
+	string result;
+	char **symbols = backtrace_symbols(capture.frames, capture.nframes);
+	for (int i = 0; i < capture.nframes; i++) {
+		result.append("     ");
+		if (symbols != NULL) {
+			result.append(symbols[i]);
+		} else {
+			result.append(pointerToIntString(capture.frames[i]));
+		}
+		result.append("\n");
+	}
+	free(symbols);
+	return result;
+}
+
+#endif /* LIBC_HAS_BACKTRACE_FUNC */
+
+
+EventLoopStallDetector::EventLoopStallDetector(unsigned int thresholdMsec,
+	unsigned int reportIntervalSec)
+	: threshold(MonotonicTimeUsec(thresholdMsec) * 1000),
+	  reportInterval(MonotonicTimeUsec(reportIntervalSec) * 1000000),
+	  thr(NULL)
+	{ }
+
+EventLoopStallDetector::~EventLoopStallDetector() {
+	stop();
+}
+
+void
+EventLoopStallDetector::threadMain() {
+	TRACE_POINT();
+	// Check often enough that stalls are noticed soon after they
+	// exceed the threshold.
+	unsigned int interval = (unsigned int) std::max<MonotonicTimeUsec>(
+		threshold / 4, 10000);
+
+	while (!boost::this_thread::interruption_requested()) {
+		syscalls::usleep(interval);
+		UPDATE_TRACE_POINT();
+		check();
+	}
+}
+
+void
+EventLoopStallDetector::reportStall(Loop &loop, MonotonicTimeUsec stalledFor) {
+	TRACE_POINT();
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+
+	if (loop.lastReportedAt != 0 && now - loop.lastReportedAt < reportInterval) {
+		loop.suppressedReports++;
+		return;
+	}
+
+	string message = "Event loop '" + loop.name + "' has been blocked for "
+		+ toString(stalledFor / 1000) + " msec (threshold: "
+		+ toString(threshold / 1000) + " msec). This stall is number "
+		+ toString(loop.stalls.load(boost::memory_order_relaxed))
+		+ " of this event loop";
+	if (loop.suppressedReports > 0) {
+		message.append("; " + toString(loop.suppressedReports)
+			+ " stalls were not reported since the last report");
+	}
+	message.append(".\n  Tracepoint backtrace:\n");
+	message.append(loop.bgloop->getBacktrace());
+	if (message[message.size() - 1] != '\n') {
+		message.append("\n");
+	}
+	#ifdef LIBC_HAS_BACKTRACE_FUNC
+		message.append("  Native backtrace:\n");
+		message.append(captureNativeBacktrace(loop.bgloop->getNativeHandle()));
+	#endif
+	P_WARN(message);
+
+	loop.lastReportedAt = now;
+	loop.suppressedReports = 0;
+}
+
+void
+EventLoopStallDetector::add(BackgroundEventLoop *bgloop, const string &name) {
+	assert(thr == NULL);
+	LoopPtr loop = boost::make_shared<Loop>();
+	loop->bgloop = bgloop;
+	loop->name = name;
+	loop->stalls.store(0, boost::memory_order_relaxed);
+	loop->longestStall.store(0, boost::memory_order_relaxed);
+	loop->lastStalledIteration = 0;
+	loop->lastReportedAt = 0;
+	loop->suppressedReports = 0;
+	loops.push_back(loop);
+}
+
+void
+EventLoopStallDetector::start() {
+	assert(thr == NULL);
+	thr = new oxt::thread(
+		boost::bind(&EventLoopStallDetector::threadMain, this),
+		"Event loop stall detector",
+		1024 * 128
+	);
+}
+
+void
+EventLoopStallDetector::stop() {
+	if (thr != NULL) {
+		thr->interrupt_and_join();
+		delete thr;
+		thr = NULL;
+	}
+}
+
+void
+EventLoopStallDetector::check() {
+	vector<LoopPtr>::const_iterator it, end = loops.end();
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsecWithGranularity<
+		SystemTime::GRAN_1MSEC>();
+
+	for (it = loops.begin(); it != end; it++) {
+		Loop &loop = **it;
+		MonotonicTimeUsec iterationStartTime = loop.bgloop->getIterationStartTime();
+
+		if (iterationStartTime == 0 || now <= iterationStartTime
+		 || now - iterationStartTime < threshold)
+		{
+			continue;
+		}
+
+		MonotonicTimeUsec stalledFor = now - iterationStartTime;
+		if (stalledFor > loop.longestStall.load(boost::memory_order_relaxed)) {
+			loop.longestStall.store(stalledFor, boost::memory_order_relaxed);
+		}
+		if (loop.lastStalledIteration != iterationStartTime) {
+			loop.lastStalledIteration = iterationStartTime;
+			loop.stalls.fetch_add(1, boost::memory_order_relaxed);
+			reportStall(loop, stalledFor);
+		}
+	}
+}
+
+unsigned int
+EventLoopStallDetector::getLoopCount() const {
+	return loops.size();
+}
+
+const string &
+EventLoopStallDetector::getLoopName(unsigned int i) const {
+	return loops[i]->name;
+}
+
+boost::uint64_t
+EventLoopStallDetector::getStallCount(unsigned int i) const {
+	return loops[i]->stalls.load(boost::memory_order_relaxed);
+}
+
+MonotonicTimeUsec
+EventLoopStallDetector::getLongestStall(unsigned int i) const {
+	return loops[i]->longestStall.load(boost::memory_order_relaxed);
+}
+
+Json::Value
+EventLoopStallDetector::inspectAsJson() const {
+	Json::Value doc(Json::objectValue);
+	Json::Value loopsDoc(Json::objectValue);
+
+	doc["threshold_msec"] = (Json::UInt64) (threshold / 1000);
+	for (unsigned int i = 0; i < loops.size(); i++) {
+		Json::Value loopDoc;
+		loopDoc["stalls"] = (Json::UInt64) getStallCount(i);
+		loopDoc["longest_stall_msec"] = (Json::UInt64) (getLongestStall(i) / 1000);
+		loopsDoc[loops[i]->name] = loopDoc;
+	}
+	doc["event_loops"] = loopsDoc;
+	return doc;
+}
+
+
+} // namespace Core
+} // namespace Passenger
@@ -0,0 +1,119 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_EVENT_LOOP_STALL_DETECTOR_H_
+#define _PASSENGER_CORE_EVENT_LOOP_STALL_DETECTOR_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <oxt/thread.hpp>
+#include <string>
+#include <vector>
+
+#include <jsoncpp/json.h>
+#include <BackgroundEventLoop.h>
+#include <SystemTools/SystemTime.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * Watches a number of BackgroundEventLoops from a background thread, and
+ * reports event loops that have been processing the same batch of events
+ * for longer than a threshold. Such a stall means that something blocks
+ * the event loop thread, e.g. a blocking system call or a long computation,
+ * which delays all other clients handled by that thread.
+ *
+ * A stall is reported with the oxt backtrace of the stalled thread and,
+ * if the C library supports it, a native backtrace that the thread captures
+ * from a signal handler. Reports are rate limited per event loop; stalls are
+ * always counted.
+ *
+ * Event loops must be added before the detector is started, and the
+ * detector must be stopped before the event loops are stopped.
+ */
+class EventLoopStallDetector {
+private:
+	struct Loop {
+		BackgroundEventLoop *bgloop;
+		string name;
+		boost::atomic<boost::uint64_t> stalls;
+		boost::atomic<MonotonicTimeUsec> longestStall;
+		// The iteration start time of the last stall that was counted,
+		// so that a single stall is only counted once.
+		MonotonicTimeUsec lastStalledIteration;
+		MonotonicTimeUsec lastReportedAt;
+		unsigned int suppressedReports;
+	};
+
+	typedef boost::shared_ptr<Loop> LoopPtr;
+
+	vector<LoopPtr> loops;
+	MonotonicTimeUsec threshold;
+	MonotonicTimeUsec reportInterval;
+	oxt::thread *thr;
+
+	void threadMain();
+	void reportStall(Loop &loop, MonotonicTimeUsec stalledFor);
+
+public:
+	/**
+	 * @param thresholdMsec After how many milliseconds an event loop that
+	 *   hasn't finished processing its events is considered stalled.
+	 * @param reportIntervalSec Stalls of the same event loop are logged
+	 *   at most once per this many seconds.
+	 */
+	EventLoopStallDetector(unsigned int thresholdMsec, unsigned int reportIntervalSec);
+	~EventLoopStallDetector();
+
+	void add(BackgroundEventLoop *bgloop, const string &name);
+	void start();
+	void stop();
+
+	/**
+	 * Checks all event loops once. Called periodically by the background
+	 * thread; only public for the purpose of unit tests.
+	 */
+	void check();
+
+	unsigned int getLoopCount() const;
+	const string &getLoopName(unsigned int i) const;
+	/** Thread-safe. */
+	boost::uint64_t getStallCount(unsigned int i) const;
+	/** Thread-safe. */
+	MonotonicTimeUsec getLongestStall(unsigned int i) const;
+	/** Thread-safe. */
+	Json::Value inspectAsJson() const;
+};
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_EVENT_LOOP_STALL_DETECTOR_H_ */
@@ -191,6 +191,15 @@ coreUsage() {
 	printf("      --stat-throttle-rate SECONDS\n");
 	printf("                            Throttle filesystem restart.txt checks to at most\n");
 	printf("                            once per given seconds. Default: %d\n", DEFAULT_STAT_THROTTLE_RATE);
+	printf("      --event-loop-stall-threshold MSEC\n");
+	printf("                            Log a backtrace when an event loop thread is\n");
+	printf("                            blocked for longer than this. 0 disables the\n");
+	printf("                            check. Default: %d\n", DEFAULT_EVENT_LOOP_STALL_THRESHOLD);
+	printf("      --request-trace-buffer-size NUMBER\n");
+	printf("                            The number of request trace events that each\n");
+	printf("                            server thread keeps for /server/traces.json.\n");
+	printf("                            0 disables request tracing. Default: %d\n",
+		DEFAULT_REQUEST_TRACE_BUFFER_SIZE);
 	printf("      --no-show-version-in-header\n");
 	printf("                            Do not show " PROGRAM_NAME " version number in\n");
 	printf("                            HTTP headers.\n");
@@ -389,6 +398,12 @@ parseCoreOption(int argc, const char *argv[], int &i, Json::Value &updates) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--stat-throttle-rate")) {
 		updates["stat_throttle_rate"] = atoi(argv[i + 1]);
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--event-loop-stall-threshold")) {
+		updates["event_loop_stall_threshold"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--request-trace-buffer-size")) {
+		updates["request_trace_buffer_size"] = atoi(argv[i + 1]);
+		i += 2;
 	} else if (p.isFlag(argv[i], '\0', "--no-show-version-in-header")) {
 		updates["show_version_in_header"] = false;
 		i++;
@@ -459,6 +459,31 @@ public:
 		return storeSuccesses / (double) stores;
 	}
 
+	unsigned int getEntryCount() const {
+		unsigned int result = 0;
+		for (unsigned int i = 0; i < MAX_ENTRIES; i++) {
+			if (headers[i].valid) {
+				result++;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Returns the number of bytes used by the keys and the responses of
+	 * all valid entries. The cache's own memory is of a fixed size.
+	 */
+	size_t getDataSize() const {
+		size_t result = 0;
+		for (unsigned int i = 0; i < MAX_ENTRIES; i++) {
+			if (headers[i].valid) {
+				result += headers[i].keySize + bodies[i].httpHeaderSize
+					+ bodies[i].httpBodySize;
+			}
+		}
+		return result;
+	}
+
 	// For decreasing the store success ratio without calling store().
 	OXT_FORCE_INLINE
 	void incStores() {
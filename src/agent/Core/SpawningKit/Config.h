@@ -353,6 +353,20 @@ public:
 	 */
 	unsigned int fileDescriptorUlimit;
 
+	/**
+	 * If `loadShellEnvvars` is set, then the environment produced by the
+	 * OS shell is cached for this number of seconds, and reused by
+	 * subsequent spawns of the same app by the same user. The cache is
+	 * also invalidated when the shell startup files change.
+	 * 0 means that the environment is not cached.
+	 *
+	 * @hinted_parseable
+	 * @pass_during_handshake
+	 * @non_confidential
+	 * @only_pass_during_handshake_if config.shellEnvvarsCacheTtl > 0
+	 */
+	unsigned int shellEnvvarsCacheTtl;
+
 	/**
 	 * The maximum amount of time, in milliseconds, that may be spent
 	 * on spawning the process or the preloader.
@@ -377,6 +391,7 @@ public:
 		  baseURI(P_STATIC_STRING("/")),
 		  lveMinUid(DEFAULT_LVE_MIN_UID),
 		  fileDescriptorUlimit(0),
+		  shellEnvvarsCacheTtl(0),
 		  startTimeoutMsec(DEFAULT_START_TIMEOUT)
 		  /*********************/
 		{ }
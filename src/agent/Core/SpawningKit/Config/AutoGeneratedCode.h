@@ -267,6 +267,7 @@ Passenger::SpawningKit::Config::validate(vector<StaticString> &errors) const {
 	 * groupUuid
 	 * lveMinUid
 	 * fileDescriptorUlimit
+	 * shellEnvvarsCacheTtl
 	 */
 
 	return ok;
@@ -313,6 +314,9 @@ Passenger::SpawningKit::Config::getConfidentialFieldsToPassToApp() const {
 	if (config.fileDescriptorUlimit > 0) {
 		doc["file_descriptor_ulimit"] = fileDescriptorUlimit;
 	}
+	if (config.shellEnvvarsCacheTtl > 0) {
+		doc["shell_envvars_cache_ttl"] = shellEnvvarsCacheTtl;
+	}
 
 	/*
 	 * Excluded:
@@ -367,6 +371,9 @@ Passenger::SpawningKit::Config::getNonConfidentialFieldsToPassToApp() const {
 	if (config.fileDescriptorUlimit > 0) {
 		doc["file_descriptor_ulimit"] = fileDescriptorUlimit;
 	}
+	if (config.shellEnvvarsCacheTtl > 0) {
+		doc["shell_envvars_cache_ttl"] = shellEnvvarsCacheTtl;
+	}
 
 	/*
 	 * Excluded:
@@ -92,11 +92,16 @@ public:
 		unsigned int dummyConcurrency;
 		unsigned long long dummySpawnDelay;
 		unsigned long long spawnerCreationSleepTime;
+		// The socket address that DummySpawner reports for the processes
+		// it "spawns". Point this to a real server in order to have requests
+		// actually forwarded to dummy processes.
+		string dummySocketAddress;
 
 		DebugSupport()
 			: dummyConcurrency(1),
 			  dummySpawnDelay(0),
-			  spawnerCreationSleepTime(0)
+			  spawnerCreationSleepTime(0),
+			  dummySocketAddress("tcp://127.0.0.1:1234")
 			{ }
 	};
 
@@ -221,6 +221,8 @@ private:
 			detachProcess(session.result.pid);
 			guard.clear();
 			session.journey.setStepPerformed(SPAWNING_KIT_HANDSHAKE_PERFORM);
+			session.result.journeyStepDurations =
+				session.journey.getPerformedStepDurations();
 			P_DEBUG("Process spawning done: appRoot=" << options.appRoot <<
 				", pid=" << session.result.pid);
 			return session.result;
@@ -84,6 +84,7 @@ public:
 		socket.concurrency = 1;
 		socket.acceptHttpRequests = true;
 		if (context->debugSupport != NULL) {
+			socket.address = context->debugSupport->dummySocketAddress;
 			socket.concurrency = context->debugSupport->dummyConcurrency;
 		}
 
@@ -42,6 +42,7 @@
 
 #include <sys/types.h>
 #include <dirent.h>
+#include <poll.h>
 
 #include <jsoncpp/json.h>
 
@@ -104,6 +105,7 @@ private:
 	oxt::thread *processExitWatcher;
 	oxt::thread *finishSignalWatcher;
 	bool processExited;
+	bool finishFifoReadable;
 	FinishState finishState;
 	string finishSignalWatcherErrorMessage;
 	ErrorCategory finishSignalWatcherErrorCategory;
@@ -147,6 +149,11 @@ private:
 	void watchFinishSignal() {
 		TRACE_POINT();
 		try {
+			if (session.compactSpawnProtocol) {
+				watchFinishFifoReadability();
+				return;
+			}
+
 			string path = session.responseDir + "/finish";
 			int fd = syscalls::openat(session.responseDirFd, "finish",
 				O_RDONLY | O_NOFOLLOW);
@@ -185,6 +192,52 @@ private:
 		}
 	}
 
+	/**
+	 * Compact spawn protocol: step state records and the finish signal
+	 * arrive through the same FIFO. They are read by the thread that
+	 * runs `checkCurrentState()`, because that is the thread which updates
+	 * the journey. This thread merely tells it when there is something to read.
+	 */
+	void watchFinishFifoReadability() {
+		TRACE_POINT();
+		struct pollfd pfd;
+		pfd.fd = session.finishFifoFd;
+		pfd.events = POLLIN;
+
+		while (true) {
+			pfd.revents = 0;
+			if (syscalls::poll(&pfd, 1, -1) == -1) {
+				int e = errno;
+				string path = session.responseDir + "/finish";
+				throw FileSystemException("Error polling FIFO " + path,
+					e, path);
+			}
+
+			boost::unique_lock<boost::mutex> l(syncher);
+			finishFifoReadable = true;
+			wakeupEventLoop();
+			while (finishFifoReadable) {
+				cond.wait(l);
+			}
+			if (finishState != NOT_FINISHED) {
+				return;
+			}
+		}
+	}
+
+	void readFinishFifo() {
+		TRACE_POINT();
+		char finishSignal = loadJourneyStateFromFinishFifo(session, pid,
+			stdoutAndErrCapturer);
+		if (finishSignal == '1') {
+			finishState = FINISH_SUCCESS;
+		} else if (finishSignal != '\0') {
+			finishState = FINISH_ERROR;
+		}
+		finishFifoReadable = false;
+		wakeupEventLoop();
+	}
+
 	void startWatchingSocketPingability() {
 		socketPingabilityWatcher = new oxt::thread(
 			boost::bind(&HandshakePerform::watchSocketPingability, this),
@@ -232,6 +285,10 @@ private:
 	bool checkCurrentState() {
 		TRACE_POINT();
 
+		if (finishFifoReadable) {
+			readFinishFifo();
+		}
+
 		if ((stdoutAndErrCapturer != NULL && stdoutAndErrCapturer->isStopped())
 		 || processExited)
 		{
@@ -1187,16 +1244,153 @@ private:
 		}
 	}
 
+	/**
+	 * Compact spawn protocol: reads the step state records that are
+	 * currently available from the finish FIFO, without blocking, and
+	 * applies them to the journey. Returns the finish signal if it was
+	 * read, or '\0' otherwise.
+	 */
+	static char loadJourneyStateFromFinishFifo(HandshakeSession &session, pid_t pid,
+		const BackgroundIOCapturerPtr &stdoutAndErrCapturer)
+	{
+		TRACE_POINT();
+		string &data = session.finishFifoBuffer;
+		string path = session.responseDir + "/finish";
+		char buf[1024 * 4];
+		char finishSignal = '\0';
+
+		while (true) {
+			ssize_t ret = syscalls::read(session.finishFifoFd, buf, sizeof(buf));
+			if (ret == -1) {
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					break;
+				}
+				int e = errno;
+				throw FileSystemException("Error reading from FIFO " + path,
+					e, path);
+			} else if (ret == 0) {
+				// Never happens since we have the FIFO open for writing too.
+				break;
+			}
+			data.append(buf, ret);
+		}
+
+		UPDATE_TRACE_POINT();
+		string::size_type start = 0;
+		while (start < data.size()) {
+			// Step names start with a lowercase letter. Anything else
+			// is the finish signal.
+			if (data[start] < 'a' || data[start] > 'z') {
+				finishSignal = data[start];
+				start++;
+				continue;
+			}
+
+			string::size_type end = data.find('\n', start);
+			if (end == string::npos) {
+				if (data.size() - start > SPAWNINGKIT_MAX_JOURNEY_STEP_RECORD_SIZE) {
+					P_WARN("[App " << pid << " journey] Ignoring oversized step"
+						" state record in " << path);
+					start = data.size();
+				}
+				break;
+			}
+
+			loadJourneyStateFromFinishFifoRecord(session, pid, stdoutAndErrCapturer,
+				StaticString(data.data() + start, end - start), path);
+			start = end + 1;
+		}
+		data.erase(0, start);
+
+		return finishSignal;
+	}
+
+	/**
+	 * Applies a record of the form `<step> <state> [<time field> <seconds>]`,
+	 * where `<step>` is the lowercase step name and `<time field>` is named
+	 * like the corresponding file in a step directory.
+	 */
+	static void loadJourneyStateFromFinishFifoRecord(HandshakeSession &session,
+		pid_t pid, const BackgroundIOCapturerPtr &stdoutAndErrCapturer,
+		const StaticString &record, const string &path)
+	{
+		TRACE_POINT();
+		vector<string> fields;
+		split(record, ' ', fields);
+
+		JourneyStep step = findJourneyStepReportedBySubprocess(fields[0]);
+		if (step == UNKNOWN_JOURNEY_STEP || !session.journey.hasStep(step)) {
+			P_DEBUG("[App " << pid << " journey] Ignoring state record for"
+				" unknown step " << fields[0]);
+			return;
+		}
+		if (fields.size() < 2 || fields[1].empty()) {
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": state record is empty");
+			return;
+		}
+
+		P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+			<< ": setting state to " << fields[1]);
+		setJourneyStepState(session, pid, stdoutAndErrCapturer, step, fields[1], path);
+		if (fields.size() < 4) {
+			return;
+		}
+
+		UPDATE_TRACE_POINT();
+		const string &timeField = fields[2];
+		MonotonicTimeUsec time;
+		if (timeField == "begin_time_monotonic" || timeField == "end_time_monotonic") {
+			time = atof(fields[3].c_str()) * 1000000;
+		} else {
+			time = usecTimestampToMonoTime(atof(fields[3].c_str()) * 1000000);
+		}
+		P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+			<< ": " << timeField << " is \"" << cEscapeString(fields[3])
+			<< "\", monotonic conversion is " << doubleToString(time / 1000000.0));
+
+		if (timeField == "begin_time_monotonic" || timeField == "begin_time") {
+			session.journey.setStepBeginTime(step, time);
+		} else if (timeField == "end_time_monotonic" || timeField == "end_time") {
+			// A step may be reported as ended without having been reported
+			// as begun, in which case it began just now.
+			if (session.journey.getStepInfo(step).beginTime == 0) {
+				session.journey.setStepBeginTime(step, time);
+			}
+			session.journey.setStepEndTime(step, time);
+		}
+	}
+
+	static JourneyStep findJourneyStepReportedBySubprocess(const string &name) {
+		JourneyStep step;
+
+		for (step = getFirstSubprocessJourneyStep();
+			step < getLastSubprocessJourneyStep();
+			step = JourneyStep((int) step + 1))
+		{
+			if (journeyStepToStringLowerCase(step) == name) {
+				return step;
+			}
+		}
+		for (step = getFirstPreloaderJourneyStep();
+			step <= getLastPreloaderJourneyStep();
+			step = JourneyStep((int) step + 1))
+		{
+			if (journeyStepToStringLowerCase(step) == name) {
+				return step;
+			}
+		}
+
+		return UNKNOWN_JOURNEY_STEP;
+	}
+
 	static void loadJourneyStateFromResponseDirForSpecificStep(HandshakeSession &session,
 		pid_t pid, const BackgroundIOCapturerPtr &stdoutAndErrCapturer,
 		JourneyStep step, const string &stepDir, int stepDirFd)
 	{
 		TRACE_POINT_WITH_DATA(journeyStepToString(step).data());
-		string summary;
 		string value = strip(safeReadFile(stepDirFd, "state",
 			SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first);
-		JourneyStepState state = stringToJourneyStepState(value);
-		const Config *config = session.config;
 
 		if (value.empty()) {
 			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
@@ -1206,6 +1400,61 @@ private:
 
 		P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
 			<< ": setting state to " << value);
+		setJourneyStepState(session, pid, stdoutAndErrCapturer, step, value,
+			stepDir + "/state");
+
+		UPDATE_TRACE_POINT();
+		if (fileExists(stepDir + "/begin_time_monotonic")) {
+			value = safeReadFile(stepDirFd, "begin_time_monotonic",
+				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
+			MonotonicTimeUsec beginTimeMonotonic = atof(value.c_str()) * 1000000;
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": monotonic begin time is \"" << cEscapeString(value) << "\"");
+			session.journey.setStepBeginTime(step, beginTimeMonotonic);
+		} else if (fileExists(stepDir + "/begin_time")) {
+			value = safeReadFile(stepDirFd, "begin_time",
+				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
+			unsigned long long beginTime = atof(value.c_str()) * 1000000;
+			MonotonicTimeUsec beginTimeMonotonic = usecTimestampToMonoTime(beginTime);
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": begin time is \"" << cEscapeString(value) << "\", monotonic conversion is "
+				<< doubleToString(beginTimeMonotonic / 1000000.0));
+			session.journey.setStepBeginTime(step, beginTimeMonotonic);
+		} else {
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": no begin time known");
+		}
+
+		UPDATE_TRACE_POINT();
+		if (fileExists(stepDir + "/end_time_monotonic")) {
+			value = safeReadFile(stepDirFd, "end_time_monotonic",
+				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
+			MonotonicTimeUsec endTimeMonotonic = atof(value.c_str()) * 1000000;
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": monotonic end time is \"" << cEscapeString(value) << "\"");
+			session.journey.setStepEndTime(step, endTimeMonotonic);
+		} else if (fileExists(stepDir + "/end_time")) {
+			value = safeReadFile(stepDirFd, "end_time",
+				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
+			unsigned long long endTime = atof(value.c_str()) * 1000000;
+			MonotonicTimeUsec endTimeMonotonic = usecTimestampToMonoTime(endTime);
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": end time is \"" << cEscapeString(value) << "\", monotonic conversion is "
+				<< doubleToString(endTimeMonotonic / 1000000.0));
+			session.journey.setStepEndTime(step, endTimeMonotonic);
+		} else {
+			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
+				<< ": no end time known");
+		}
+	}
+
+	static void setJourneyStepState(HandshakeSession &session, pid_t pid,
+		const BackgroundIOCapturerPtr &stdoutAndErrCapturer, JourneyStep step,
+		const string &value, const string &statePath)
+	{
+		TRACE_POINT();
+		JourneyStepState state = stringToJourneyStepState(value);
+		const Config *config = session.config;
 
 		try {
 			UPDATE_TRACE_POINT();
@@ -1266,7 +1515,7 @@ private:
 							" report about its startup progress, but the tool"
 							" communicated back an invalid answer:</p>"
 							"<ul>"
-							"<li>In file: " + escapeHTML(stepDir) + "/state</li>"
+							"<li>In file: " + escapeHTML(statePath) + "</li>"
 							"<li>Content: <code>" + escapeHTML(value) + "</code></li>"
 							"</ul>");
 						e.setSolutionDescriptionHTML(
@@ -1287,7 +1536,7 @@ private:
 							" the helper tool to report about its startup progress,"
 							" but the tool communicated back an invalid answer:</p>"
 							"<ul>"
-							"<li>In file: " + escapeHTML(stepDir) + "/state</li>"
+							"<li>In file: " + escapeHTML(statePath) + "</li>"
 							"<li>Content: <code>" + escapeHTML(value) + "</code></li>"
 							"</ul>");
 						e.setSolutionDescriptionHTML(
@@ -1303,7 +1552,7 @@ private:
 						" to report about its startup progress. But the application"
 						" communicated back an invalid answer:</p>"
 						"<ul>"
-						"<li>In file: " + escapeHTML(stepDir) + "/state</li>"
+						"<li>In file: " + escapeHTML(statePath) + "</li>"
 						"<li>Content: <code>" + escapeHTML(value) + "</code></li>"
 						"</ul>");
 					e.setSolutionDescriptionHTML(
@@ -1359,7 +1608,7 @@ private:
 						" report about its startup progress, but the tool"
 						" communicated back an invalid answer:</p>"
 						"<ul>"
-						"<li>In file: " + escapeHTML(stepDir) + "/state</li>"
+						"<li>In file: " + escapeHTML(statePath) + "</li>"
 						"<li>Error: " + escapeHTML(originalException.what()) + "</li>"
 						"</ul>");
 					e.setSolutionDescriptionHTML(
@@ -1380,7 +1629,7 @@ private:
 						" the helper tool to report about its startup progress,"
 						" but the tool communicated back an invalid answer:</p>"
 						"<ul>"
-						"<li>In file: " + escapeHTML(stepDir) + "/state</li>"
+						"<li>In file: " + escapeHTML(statePath) + "</li>"
 						"<li>Error: " + escapeHTML(originalException.what()) + "</li>"
 						"</ul>");
 					e.setSolutionDescriptionHTML(
@@ -1396,7 +1645,7 @@ private:
 					" to report about its startup progress. But the application"
 					" communicated back an invalid answer:</p>"
 					"<ul>"
-					"<li>In file: " + escapeHTML(stepDir) + "/state</li>"
+					"<li>In file: " + escapeHTML(statePath) + "</li>"
 					"<li>Error: " + escapeHTML(originalException.what()) + "</li>"
 					"</ul>");
 				e.setSolutionDescriptionHTML(
@@ -1409,50 +1658,6 @@ private:
 
 			throw e.finalize();
 		}
-
-		UPDATE_TRACE_POINT();
-		if (fileExists(stepDir + "/begin_time_monotonic")) {
-			value = safeReadFile(stepDirFd, "begin_time_monotonic",
-				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
-			MonotonicTimeUsec beginTimeMonotonic = atof(value.c_str()) * 1000000;
-			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
-				<< ": monotonic begin time is \"" << cEscapeString(value) << "\"");
-			session.journey.setStepBeginTime(step, beginTimeMonotonic);
-		} else if (fileExists(stepDir + "/begin_time")) {
-			value = safeReadFile(stepDirFd, "begin_time",
-				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
-			unsigned long long beginTime = atof(value.c_str()) * 1000000;
-			MonotonicTimeUsec beginTimeMonotonic = usecTimestampToMonoTime(beginTime);
-			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
-				<< ": begin time is \"" << cEscapeString(value) << "\", monotonic conversion is "
-				<< doubleToString(beginTimeMonotonic / 1000000.0));
-			session.journey.setStepBeginTime(step, beginTimeMonotonic);
-		} else {
-			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
-				<< ": no begin time known");
-		}
-
-		UPDATE_TRACE_POINT();
-		if (fileExists(stepDir + "/end_time_monotonic")) {
-			value = safeReadFile(stepDirFd, "end_time_monotonic",
-				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
-			MonotonicTimeUsec endTimeMonotonic = atof(value.c_str()) * 1000000;
-			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
-				<< ": monotonic end time is \"" << cEscapeString(value) << "\"");
-			session.journey.setStepEndTime(step, endTimeMonotonic);
-		} else if (fileExists(stepDir + "/end_time")) {
-			value = safeReadFile(stepDirFd, "end_time",
-				SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE).first;
-			unsigned long long endTime = atof(value.c_str()) * 1000000;
-			MonotonicTimeUsec endTimeMonotonic = usecTimestampToMonoTime(endTime);
-			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
-				<< ": end time is \"" << cEscapeString(value) << "\", monotonic conversion is "
-				<< doubleToString(endTimeMonotonic / 1000000.0));
-			session.journey.setStepEndTime(step, endTimeMonotonic);
-		} else {
-			P_DEBUG("[App " << pid << " journey] Step " << journeyStepToString(step)
-				<< ": no end time known");
-		}
 	}
 
 	static MonotonicTimeUsec usecTimestampToMonoTime(unsigned long long timestamp) {
@@ -1708,6 +1913,7 @@ public:
 		  processExitWatcher(NULL),
 		  finishSignalWatcher(NULL),
 		  processExited(false),
+		  finishFifoReadable(false),
 		  finishState(NOT_FINISHED),
 		  socketPingabilityWatcher(NULL),
 		  socketIsNowPingable(false),
@@ -1779,6 +1985,13 @@ public:
 	{
 		TRACE_POINT();
 
+		if (session.compactSpawnProtocol) {
+			// Callers either already know how spawning ended, or are
+			// aborting it, so they don't care about the finish signal.
+			loadJourneyStateFromFinishFifo(session, pid, stdoutAndErrCapturer);
+			return;
+		}
+
 		P_DEBUG("[App " << pid << " journey] Loading state from " << session.responseDir);
 
 		loadJourneyStateFromResponseDir(session, pid, stdoutAndErrCapturer,
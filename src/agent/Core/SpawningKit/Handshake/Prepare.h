@@ -27,6 +27,7 @@
 #define _PASSENGER_SPAWNING_KIT_HANDSHAKE_PREPARE_H_
 
 #include <oxt/backtrace.hpp>
+#include <oxt/system_calls.hpp>
 #include <boost/thread.hpp>
 #include <boost/scoped_array.hpp>
 #include <string>
@@ -44,6 +45,7 @@
 #include <sys/socket.h>
 #include <pwd.h>
 #include <grp.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <limits.h>
 
@@ -145,6 +147,11 @@ private:
 			"u=rwx,g=,o=",
 			session.uid,
 			session.gid);
+		if (session.compactSpawnProtocol) {
+			// Step states are reported through the finish FIFO,
+			// so don't create any step directories.
+			return;
+		}
 		makeDirTree(session.responseDir + "/steps",
 			"u=rwx,g=,o=",
 			session.uid,
@@ -204,10 +211,14 @@ private:
 		session.responseErrorDirFd = openDirFd(session.responseDir + "/error");
 		session.envDumpDirFd = openDirFd(session.envDumpDir);
 		session.envDumpAnnotationsDirFd = openDirFd(session.envDumpDir + "/annotations");
-		openJourneyStepDirFds(getFirstSubprocessJourneyStep(),
-			getLastSubprocessJourneyStep());
-		openJourneyStepDirFds(getFirstPreloaderJourneyStep(),
-			JourneyStep((int) getLastPreloaderJourneyStep() + 1));
+		if (session.compactSpawnProtocol) {
+			openFinishFifo();
+		} else {
+			openJourneyStepDirFds(getFirstSubprocessJourneyStep(),
+				getLastSubprocessJourneyStep());
+			openJourneyStepDirFds(getFirstPreloaderJourneyStep(),
+				JourneyStep((int) getLastPreloaderJourneyStep() + 1));
+		}
 	}
 
 	void openJourneyStepDirFds(JourneyStep firstStep, JourneyStep lastStep) {
@@ -224,6 +235,25 @@ private:
 		}
 	}
 
+	/**
+	 * With the compact spawn protocol, the subprocess (and the preloader)
+	 * write step state records to the finish FIFO at any point during
+	 * the spawn, so we keep a read end open from now on. Opening it
+	 * for reading and writing means that opening it never blocks, and
+	 * that reads never hit EOF when a writer closes it. Reads must
+	 * never block either: see `HandshakePerform::loadJourneyStateFromFinishFifo()`.
+	 */
+	void openFinishFifo() {
+		string path = session.responseDir + "/finish";
+		int fd = syscalls::openat(session.responseDirFd, "finish",
+			O_RDWR | O_NONBLOCK | O_NOFOLLOW);
+		if (fd == -1) {
+			int e = errno;
+			throw FileSystemException("Cannot open FIFO " + path, e, path);
+		}
+		session.finishFifoFd = fd;
+	}
+
 	int openDirFd(const string &path) {
 		int fd = open(path.c_str(), O_RDONLY);
 		if (fd == -1) {
@@ -292,6 +322,11 @@ private:
 			session.uid, session.gid,
 			false, __FILE__, __LINE__);
 
+		if (session.compactSpawnProtocol) {
+			// Passenger's own wrappers only read args.json.
+			return;
+		}
+
 		const string dir = session.workDir->getPath() + "/args";
 		makeDirTree(dir, "u=rwx,g=,o=",
 			session.uid,
@@ -323,6 +358,18 @@ private:
 		}
 	}
 
+	/**
+	 * The compact spawn protocol saves dozens of file and directory
+	 * creations per spawn, but only Passenger's own wrappers speak it.
+	 * Generic apps and third-party wrappers may rely on the full work
+	 * directory layout, so they keep it.
+	 */
+	bool usesCompactSpawnProtocol() const {
+		return !config->genericApp
+			&& config->startsUsingWrapper
+			&& !config->wrapperSuppliedByThirdParty;
+	}
+
 	string jsonValueToString(const Json::Value &value) const {
 		switch (value.type()) {
 		case Json::nullValue:
@@ -565,6 +612,7 @@ public:
 			timer.start();
 
 			resolveUserAndGroup();
+			session.compactSpawnProtocol = usesCompactSpawnProtocol();
 			createWorkDir();
 			openWorkDirSubdirFds();
 			initializeResult();
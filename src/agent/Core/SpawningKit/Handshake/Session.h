@@ -60,6 +60,19 @@ struct HandshakeSession {
 	Journey journey;
 	Result result;
 
+	/**
+	 * Whether the subprocess is spoken to with the compact spawn protocol.
+	 * See README.md, section "The compact spawn protocol".
+	 */
+	bool compactSpawnProtocol;
+	/**
+	 * Compact spawn protocol only: a read end of `response/finish`, opened
+	 * before the subprocess is spawned so that writers never block, plus
+	 * any record that has only been partially read from it so far.
+	 */
+	int finishFifoFd;
+	string finishFifoBuffer;
+
 	uid_t uid;
 	gid_t gid;
 	string homedir;
@@ -82,6 +95,8 @@ struct HandshakeSession {
 		  envDumpDirFd(-1),
 		  envDumpAnnotationsDirFd(-1),
 		  journey(journeyType, !_config.genericApp && _config.startsUsingWrapper),
+		  compactSpawnProtocol(false),
+		  finishFifoFd(-1),
 		  uid(USER_NOT_GIVEN),
 		  gid(GROUP_NOT_GIVEN),
 		  timeoutUsec(_config.startTimeoutMsec * 1000),
@@ -104,6 +119,9 @@ struct HandshakeSession {
 		if (envDumpAnnotationsDirFd != -1) {
 			safelyClose(envDumpAnnotationsDirFd, true);
 		}
+		if (finishFifoFd != -1) {
+			safelyClose(finishFifoFd, true);
+		}
 
 		map<JourneyStep, int>::iterator it, end = stepDirFds.end();
 		for (it = stepDirFds.begin(); it != end; it++) {
@@ -182,6 +182,8 @@ public:
 };
 
 
+typedef map<JourneyStep, unsigned long long> JourneyStepDurations;
+
 /**
  * For an introduction see README.md, sections:
  *
@@ -439,6 +441,27 @@ public:
 
 		return doc;
 	}
+
+	/**
+	 * Returns the durations of all steps that were performed, in microseconds.
+	 * Used for aggregating spawn timing statistics, see JourneyStats.
+	 */
+	JourneyStepDurations getPerformedStepDurations() const {
+		JourneyStepDurations result;
+		Map::const_iterator it, end = steps.end();
+		for (it = steps.begin(); it != end; it++) {
+			const JourneyStepInfo &info = it->second;
+			if (info.state != STEP_PERFORMED) {
+				continue;
+			}
+			const JourneyStepInfo *nextStepInfo = NULL;
+			if (info.nextStep != UNKNOWN_JOURNEY_STEP) {
+				nextStepInfo = &steps.find(info.nextStep)->second;
+			}
+			result.insert(make_pair(it->first, info.usecDuration(nextStepInfo)));
+		}
+		return result;
+	}
 };
 
 
@@ -0,0 +1,130 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SPAWNING_KIT_JOURNEY_STATS_H_
+#define _PASSENGER_SPAWNING_KIT_JOURNEY_STATS_H_
+
+#include <boost/cstdint.hpp>
+#include <map>
+
+#include <jsoncpp/json.h>
+#include <Algorithms/LatencyHistogram.h>
+#include <Core/SpawningKit/Journey.h>
+
+namespace Passenger {
+namespace SpawningKit {
+
+using namespace std;
+
+
+/**
+ * Aggregates the journey step durations of successful spawns into
+ * latency histograms (in microseconds), one per step plus one for the
+ * total spawn time. This shows where spawn time goes: shell startup,
+ * the preloader fork, loading the application, etc.
+ *
+ * Not thread-safe. ApplicationPool::Group protects it with the pool lock.
+ */
+class JourneyStats {
+public:
+	typedef map<JourneyStep, LatencyHistogram> StepHistograms;
+
+private:
+	LatencyHistogram total;
+	StepHistograms steps;
+
+	static Json::Value inspectHistogramAsJson(const LatencyHistogram &h) {
+		Json::Value doc;
+		doc["count"] = (Json::UInt64) h.getCount();
+		doc["min"] = (Json::UInt64) h.getMin();
+		doc["mean"] = h.getMean();
+		doc["max"] = (Json::UInt64) h.getMax();
+		doc["p50"] = (Json::UInt64) h.getValueAtPercentile(50);
+		doc["p90"] = (Json::UInt64) h.getValueAtPercentile(90);
+		doc["p99"] = (Json::UInt64) h.getValueAtPercentile(99);
+		doc["p999"] = (Json::UInt64) h.getValueAtPercentile(99.9);
+		return doc;
+	}
+
+public:
+	void record(const JourneyStepDurations &durations, boost::uint64_t totalUsec) {
+		JourneyStepDurations::const_iterator it, end = durations.end();
+
+		total.record(totalUsec);
+		for (it = durations.begin(); it != end; it++) {
+			steps[it->first].record(it->second);
+		}
+	}
+
+	void merge(const JourneyStats &other) {
+		StepHistograms::const_iterator it, end = other.steps.end();
+
+		total.merge(other.total);
+		for (it = other.steps.begin(); it != end; it++) {
+			steps[it->first].merge(it->second);
+		}
+	}
+
+	void reset() {
+		total.reset();
+		steps.clear();
+	}
+
+	boost::uint64_t getCount() const {
+		return total.getCount();
+	}
+
+	const LatencyHistogram &getTotal() const {
+		return total;
+	}
+
+	const StepHistograms &getSteps() const {
+		return steps;
+	}
+
+	Json::Value inspectAsJson() const {
+		Json::Value doc;
+		Json::Value stepsDoc(Json::arrayValue);
+		StepHistograms::const_iterator it, end = steps.end();
+
+		doc["unit"] = "microseconds";
+		doc["total"] = inspectHistogramAsJson(total);
+		// An array rather than an object, so that the steps stay in
+		// journey order.
+		for (it = steps.begin(); it != end; it++) {
+			Json::Value stepDoc = inspectHistogramAsJson(it->second);
+			stepDoc["step"] = journeyStepToStringLowerCase(it->first);
+			stepsDoc.append(stepDoc);
+		}
+		doc["steps"] = stepsDoc;
+		return doc;
+	}
+};
+
+
+} // namespace SpawningKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SPAWNING_KIT_JOURNEY_STATS_H_ */
@@ -37,6 +37,7 @@
 #include <ConfigKit/ConfigKit.h>
 #include <Core/SpawningKit/Context.h>
 #include <Core/SpawningKit/Config.h>
+#include <Core/SpawningKit/Journey.h>
 
 namespace Passenger {
 namespace SpawningKit {
@@ -195,6 +196,15 @@ public:
 	vector<Socket> sockets;
 
 
+	/****** Fields supplied by the Spawner ******/
+
+	/**
+	 * Durations of the journey steps that this spawn went through.
+	 * Only set for successful spawns.
+	 */
+	JourneyStepDurations journeyStepDurations;
+
+
 	Result()
 		: pid(-1),
 		  type(UNKNOWN),
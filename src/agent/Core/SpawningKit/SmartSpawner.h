@@ -1325,6 +1325,8 @@ public:
 				execute();
 			guard.clear();
 			session.journey.setStepPerformed(SPAWNING_KIT_HANDSHAKE_PERFORM);
+			session.result.journeyStepDurations =
+				session.journey.getPerformedStepDurations();
 			P_DEBUG("Process spawning done: appRoot=" << options.appRoot <<
 				", pid=" << forkResult.pid);
 			return session.result;
@@ -115,6 +115,7 @@ protected:
 		config->wrapperSuppliedByThirdParty = false;
 		config->findFreePort = false;
 		config->loadShellEnvvars = options.loadShellEnvvars;
+		config->shellEnvvarsCacheTtl = options.shellEnvvarsCacheTtl;
 		config->startupFile = options.getStartupFile(*context->wrapperRegistry);
 		config->appType = options.appType;
 		config->processTitle = options.getProcessTitle(*context->wrapperRegistry);
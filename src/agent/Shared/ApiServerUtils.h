@@ -537,6 +537,18 @@ apiServerRespondWith405(Server *server, Client *client, Request *req) {
 	}
 }
 
+template<typename Server, typename Client, typename Request>
+inline void
+apiServerRespondWith409(Server *server, Client *client, Request *req, const StaticString &body) {
+	ServerKit::HeaderTable headers;
+	headers.insert(req->pool, "Cache-Control", "no-cache, no-store, must-revalidate");
+	headers.insert(req->pool, "Content-Type", "text/plain; charset=utf-8");
+	server->writeSimpleResponse(client, 409, &headers, body);
+	if (!req->ended()) {
+		server->endRequest(&client, &req);
+	}
+}
+
 template<typename Server, typename Client, typename Request>
 inline void
 apiServerRespondWith413(Server *server, Client *client, Request *req) {
@@ -0,0 +1,162 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_LISTENER_HANDOFF_H_
+#define _PASSENGER_LISTENER_HANDOFF_H_
+
+#include <vector>
+#include <string>
+
+#include <FileDescriptor.h>
+#include <Exceptions.h>
+#include <LoggingKit/LoggingKit.h>
+#include <IOTools/MessageIO.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+namespace ListenerHandoff {
+
+using namespace std;
+
+
+/*
+ * This file implements the exchange of listener sockets between the Core
+ * and the Watchdog, which allows the sockets, and the connections queued
+ * in their backlogs, to survive Core restarts. It happens over the Core's
+ * feedback fd, during the Core's startup:
+ *
+ *  1. The Core sends a "listener handoff" message.
+ *  2. The Watchdog replies with a "listeners" message that contains the
+ *     number of listener sockets that it kept from the previous Core
+ *     process, followed by the sockets themselves.
+ *  3. The Core adopts these sockets if their number matches the number of
+ *     addresses that it is configured with. Otherwise it creates new ones.
+ *  4. The Core sends the sockets that it listens on in a "listeners"
+ *     message, and the Watchdog keeps them for the next Core process.
+ *
+ * Sockets are passed with `writeFileDescriptorWithNegotiation()`.
+ */
+
+
+inline void
+sendListeners(int fd, const vector<int> &listenerFds) {
+	vector<int>::const_iterator it;
+
+	writeArrayMessage(fd, "listeners", toString(listenerFds.size()).c_str(), NULL);
+	for (it = listenerFds.begin(); it != listenerFds.end(); it++) {
+		writeFileDescriptorWithNegotiation(fd, *it);
+	}
+}
+
+/**
+ * Receives a "listeners" message and the sockets in it.
+ *
+ * @return False if end-of-file was reached before the message was read.
+ * @throws IOException The message is not a "listeners" message.
+ * @throws SystemException
+ */
+inline bool
+receiveListeners(int fd, vector<FileDescriptor> &listenerFds) {
+	vector<string> args;
+	unsigned int i, count;
+
+	if (!readArrayMessage(fd, args)) {
+		return false;
+	} else if (args.size() != 2 || args[0] != "listeners") {
+		throw IOException("Invalid listener handoff message");
+	}
+
+	listenerFds.clear();
+	count = stringToUint(args[1]);
+	for (i = 0; i < count; i++) {
+		listenerFds.push_back(FileDescriptor(
+			readFileDescriptorWithNegotiation(fd), __FILE__, __LINE__));
+	}
+	return true;
+}
+
+/**
+ * Performs steps 1-3 on the Core side. Returns true and sets `result` if
+ * the Watchdog handed over exactly `expectedCount` sockets. Returns false
+ * if it handed over none, or a different number, in which case the caller
+ * must create the sockets.
+ *
+ * @throws EOFException The Watchdog closed the connection.
+ * @throws IOException
+ * @throws SystemException
+ */
+inline bool
+requestListeners(int fd, unsigned int expectedCount, vector<FileDescriptor> &result) {
+	vector<FileDescriptor> fds;
+
+	writeArrayMessage(fd, "listener handoff", NULL);
+	if (!receiveListeners(fd, fds)) {
+		throw EOFException("The Watchdog closed the connection during the listener handoff");
+	}
+
+	if (fds.empty()) {
+		return false;
+	} else if (fds.size() != expectedCount) {
+		P_WARN("The Watchdog handed over " << fds.size() << " listener socket(s), but "
+			<< expectedCount << " addresses are configured. Creating new listener "
+			"sockets instead");
+		return false;
+	} else {
+		result.swap(fds);
+		return true;
+	}
+}
+
+/**
+ * Performs steps 2 and 4 on the Watchdog side, after it has received the
+ * "listener handoff" message. Sends `listenerFds`, and replaces them with
+ * the sockets that the Core sends back.
+ *
+ * @return False if the Core closed the connection before sending its sockets.
+ * @throws IOException
+ * @throws SystemException
+ */
+inline bool
+handOffListeners(int fd, vector<FileDescriptor> &listenerFds) {
+	vector<FileDescriptor>::const_iterator it;
+	vector<FileDescriptor> newListenerFds;
+	vector<int> fds;
+
+	for (it = listenerFds.begin(); it != listenerFds.end(); it++) {
+		fds.push_back(*it);
+	}
+	sendListeners(fd, fds);
+	if (!receiveListeners(fd, newListenerFds)) {
+		return false;
+	}
+	listenerFds.swap(newListenerFds);
+	return true;
+}
+
+
+} // namespace ListenerHandoff
+} // namespace Passenger
+
+#endif /* _PASSENGER_LISTENER_HANDOFF_H_ */
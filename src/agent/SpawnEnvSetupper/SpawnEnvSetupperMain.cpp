@@ -38,8 +38,10 @@
 #include <cerrno>
 #include <cassert>
 #include <stdexcept>
+#include <algorithm>
 #include <string>
 #include <vector>
+#include <utility>
 
 #include <sys/types.h>
 #include <sys/param.h>
@@ -48,7 +50,9 @@
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <limits.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <dirent.h>
 #include <pwd.h>
 #include <grp.h>
 #include <stdlib.h>
@@ -63,6 +67,9 @@
 #include <FileTools/FileManip.h>
 #include <FileTools/PathManip.h>
 #include <SystemTools/UserDatabase.h>
+#include <SystemTools/SystemTime.h>
+#include <Algorithms/Hasher.h>
+#include <Exceptions.h>
 #include <Utils.h>
 #include <StrIntTools/StrIntUtils.h>
 #include <Core/SpawningKit/Handshake/WorkDir.h>
@@ -86,6 +93,7 @@ namespace SpawnEnvSetupper {
 
 	struct Context {
 		string workDir;
+		bool compactSpawnProtocol;
 		Mode mode;
 		Json::Value args;
 		SpawningKit::JourneyStep step;
@@ -131,10 +139,42 @@ tryWriteFile(const StaticString &path, const StaticString &value) {
 	}
 }
 
+/**
+ * With the compact spawn protocol there are no step directories: step
+ * states are reported as records written to the finish FIFO instead.
+ * See SpawningKit's README.md, section "The compact spawn protocol".
+ */
+static void
+reportJourneyStep(const Context &context, SpawningKit::JourneyStep step,
+	SpawningKit::JourneyStepState state, const char *timeField)
+{
+	string path = context.workDir + "/response/finish";
+	string record = journeyStepToStringLowerCase(step)
+		+ " " + SpawningKit::journeyStepStateToString(state)
+		+ " " + timeField
+		+ " " + doubleToString(SystemTime::getMonotonicUsecWithGranularity
+			<SystemTime::GRAN_10MSEC>() / 1000000.0)
+		+ "\n";
+	int fd = open(path.c_str(), O_WRONLY | O_NONBLOCK);
+	if (fd == -1 || write(fd, record.data(), record.size()) == -1) {
+		int e = errno;
+		fprintf(stderr, "Warning: unable to write to %s: %s (errno=%d)\n",
+			path.c_str(), strerror(e), e);
+	}
+	if (fd != -1) {
+		close(fd);
+	}
+}
+
 static void
 recordJourneyStepBegin(const Context &context,
 	SpawningKit::JourneyStep step, SpawningKit::JourneyStepState state)
 {
+	if (context.compactSpawnProtocol) {
+		reportJourneyStep(context, step, state, "begin_time_monotonic");
+		return;
+	}
+
 	string stepString = journeyStepToStringLowerCase(step);
 	string stepDir = context.workDir + "/response/steps/" + stepString;
 	tryWriteFile(stepDir + "/state", SpawningKit::journeyStepStateToString(state));
@@ -146,6 +186,11 @@ static void
 recordJourneyStepEnd(const Context &context,
 	SpawningKit::JourneyStep step, SpawningKit::JourneyStepState state)
 {
+	if (context.compactSpawnProtocol) {
+		reportJourneyStep(context, step, state, "end_time_monotonic");
+		return;
+	}
+
 	string stepString = journeyStepToStringLowerCase(step);
 	string stepDir = context.workDir + "/response/steps/" + stepString;
 	tryWriteFile(stepDir + "/state", SpawningKit::journeyStepStateToString(state));
@@ -747,6 +792,244 @@ shouldLoadShellEnvvars(const Json::Value &args, const string &shell) {
 	}
 }
 
+static bool
+shouldCacheShellEnvvars(const Json::Value &args) {
+	return args["load_shell_envvars"].asBool()
+		&& args.isMember("shell_envvars_cache_ttl")
+		&& args["shell_envvars_cache_ttl"].asUInt() > 0
+		&& args.isMember("instance_dir");
+}
+
+static string
+getShellEnvvarsCacheDir(const Json::Value &args, uid_t uid) {
+	return args["instance_dir"].asString() + "/shell_envvars_cache/" + toString(uid);
+}
+
+/**
+ * Creates the directory in which the environment produced by the OS shell
+ * is cached. Called before switching user, so that the directory can be
+ * made private to the user that the app runs as.
+ */
+static void
+prepareShellEnvvarsCacheDir(const Context &context, uid_t uid, gid_t gid) {
+	if (!shouldCacheShellEnvvars(context.args)) {
+		return;
+	}
+
+	string dir = getShellEnvvarsCacheDir(context.args, uid);
+	try {
+		makeDirTree(extractDirName(dir), "u=rwx,g=x,o=x");
+		makeDirTree(dir, "u=rwx,g=,o=", uid, gid);
+	} catch (const std::exception &e) {
+		P_WARN("Cannot create shell environment variables cache directory "
+			<< dir << ": " << e.what());
+	}
+}
+
+// These differ between spawns, so they are neither part of the cache key
+// nor restored from the cache.
+static bool
+isVolatileEnvvar(const StaticString &name) {
+	return name == P_STATIC_STRING("PASSENGER_SPAWN_WORK_DIR")
+		|| name == P_STATIC_STRING("PORT");
+}
+
+static Json::Value
+captureEnvvars() {
+	Json::Value result(Json::objectValue);
+	for (char **env = environ; *env != NULL; env++) {
+		const char *sep = strchr(*env, '=');
+		if (sep != NULL) {
+			string name(*env, sep - *env);
+			if (!isVolatileEnvvar(name)) {
+				result[name] = sep + 1;
+			}
+		}
+	}
+	return result;
+}
+
+static void
+replaceEnvvars(const Json::Value &envvars) {
+	vector< pair<string, string> > volatileEnvvars;
+	for (char **env = environ; *env != NULL; env++) {
+		const char *sep = strchr(*env, '=');
+		if (sep != NULL && isVolatileEnvvar(StaticString(*env, sep - *env))) {
+			volatileEnvvars.push_back(make_pair(string(*env, sep - *env), string(sep + 1)));
+		}
+	}
+
+	clearenv();
+	Json::Value::const_iterator it, end = envvars.end();
+	for (it = envvars.begin(); it != end; it++) {
+		if (it->isString()) {
+			setenv(it.name().c_str(), it->asCString(), 1);
+		}
+	}
+
+	vector< pair<string, string> >::const_iterator v_it;
+	for (v_it = volatileEnvvars.begin(); v_it != volatileEnvvars.end(); v_it++) {
+		setenv(v_it->first.c_str(), v_it->second.c_str(), 1);
+	}
+}
+
+static void
+inspectShellStartupFile(const string &path, string &result) {
+	struct stat buf;
+	if (stat(path.c_str(), &buf) == 0) {
+		result.append(path);
+		result.append(1, ':');
+		result.append(toString((long long) buf.st_mtime));
+		result.append(1, '\n');
+	}
+}
+
+/**
+ * Returns a description of the modification times of the shell startup
+ * files. The cached environment is only used if this description is unchanged.
+ */
+static string
+inspectShellStartupFiles() {
+	static const char *homeFiles[] = {
+		".profile", ".bash_profile", ".bash_login", ".bashrc",
+		".zshenv", ".zprofile", ".zshrc", ".zlogin", ".kshrc",
+		NULL
+	};
+	static const char *systemFiles[] = {
+		"/etc/environment", "/etc/profile", "/etc/bash.bashrc", "/etc/bashrc",
+		"/etc/zshenv", "/etc/zprofile", "/etc/zshrc", "/etc/zlogin",
+		"/etc/zsh/zshenv", "/etc/zsh/zprofile", "/etc/zsh/zshrc", "/etc/zsh/zlogin",
+		"/etc/profile.d",
+		NULL
+	};
+	const char *home = getenv("HOME");
+	string result;
+
+	if (home != NULL && *home != '\0') {
+		for (const char **file = homeFiles; *file != NULL; file++) {
+			inspectShellStartupFile(string(home) + "/" + *file, result);
+		}
+	}
+	for (const char **file = systemFiles; *file != NULL; file++) {
+		inspectShellStartupFile(*file, result);
+	}
+
+	DIR *dir = opendir("/etc/profile.d");
+	if (dir != NULL) {
+		vector<string> names;
+		struct dirent *entry;
+		while ((entry = readdir(dir)) != NULL) {
+			if (entry->d_name[0] != '.') {
+				names.push_back(entry->d_name);
+			}
+		}
+		closedir(dir);
+		sort(names.begin(), names.end());
+		vector<string>::const_iterator it;
+		for (it = names.begin(); it != names.end(); it++) {
+			inspectShellStartupFile("/etc/profile.d/" + *it, result);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Looks up the environment that the OS shell produced during an earlier
+ * spawn of this app by this user. If the cache entry is valid, then the
+ * current environment is replaced with it and true is returned, so that
+ * running the OS shell can be skipped.
+ *
+ * Otherwise, the cache key is written to the work directory, so that
+ * 'spawn-env-setupper --after' can store the environment that the OS
+ * shell is about to produce.
+ */
+static bool
+tryLoadShellEnvvarsFromCache(const Context &context, const string &shell) {
+	if (!shouldCacheShellEnvvars(context.args)) {
+		return false;
+	}
+
+	string appRoot = context.args["app_root"].asString();
+	JenkinsHash hash;
+	hash.update(shell.data(), shell.size());
+	hash.update("", 1);
+	hash.update(appRoot.data(), appRoot.size());
+	string path = getShellEnvvarsCacheDir(context.args, geteuid())
+		+ "/" + integerToHex(hash.finalize()) + ".json";
+
+	Json::Value key;
+	key["shell"] = shell;
+	key["app_root"] = appRoot;
+	key["startup_files"] = inspectShellStartupFiles();
+	key["input_envvars"] = captureEnvvars();
+
+	struct stat buf;
+	if (lstat(path.c_str(), &buf) == 0) {
+		Json::Value doc;
+		Json::Reader reader;
+		if (!S_ISREG(buf.st_mode) || buf.st_uid != geteuid() || (buf.st_mode & 022)) {
+			P_WARN("Ignoring shell environment variables cache file " << path
+				<< " because it has unsafe ownership or permissions");
+		} else if (buf.st_mtime + (time_t) context.args["shell_envvars_cache_ttl"].asUInt()
+			<= SystemTime::get())
+		{
+			P_DEBUG("Shell environment variables cache file " << path << " has expired");
+		} else if (!reader.parse(unsafeReadFile(path), doc, false) || !doc.isObject()) {
+			P_WARN("Ignoring corrupt shell environment variables cache file " << path);
+		} else if (doc["shell"] != key["shell"]
+			|| doc["app_root"] != key["app_root"]
+			|| doc["startup_files"] != key["startup_files"]
+			|| doc["input_envvars"] != key["input_envvars"])
+		{
+			P_DEBUG("Shell environment variables cache file " << path << " is outdated");
+		} else {
+			P_DEBUG("Loading shell environment variables from cache file " << path);
+			replaceEnvvars(doc["envvars"]);
+			return true;
+		}
+	}
+
+	key["path"] = path;
+	tryWriteFile(context.workDir + "/shell_envvars_cache.json", key.toStyledString());
+	return false;
+}
+
+/**
+ * Called by 'spawn-env-setupper --after' right after the OS shell has been
+ * executed, in order to cache the environment that it produced.
+ */
+static void
+saveShellEnvvarsToCache(const Context &context) {
+	string keyPath = context.workDir + "/shell_envvars_cache.json";
+	if (!fileExists(keyPath)) {
+		return;
+	}
+
+	try {
+		Json::Value doc;
+		Json::Reader reader;
+		if (!reader.parse(unsafeReadFile(keyPath), doc, false) || !doc.isObject()) {
+			throw RuntimeException("cannot parse " + keyPath);
+		}
+
+		string path = doc["path"].asString();
+		string tmpPath = path + ".tmp." + toString(getpid());
+		doc.removeMember("path");
+		doc["envvars"] = captureEnvvars();
+		createFile(tmpPath, doc.toStyledString(), 0600);
+		if (rename(tmpPath.c_str(), path.c_str()) == -1) {
+			int e = errno;
+			unlink(tmpPath.c_str());
+			throw FileSystemException("Cannot rename " + tmpPath + " to " + path,
+				e, path);
+		}
+		P_DEBUG("Saved shell environment variables to cache file " << path);
+	} catch (const std::exception &e) {
+		P_WARN("Cannot save shell environment variables cache: " << e.what());
+	}
+}
+
 static string
 commandArgsToString(const vector<const char *> &commandArgs) {
 	vector<const char *>::const_iterator it;
@@ -780,7 +1063,9 @@ execNextCommand(const Context &context, const string &shell)
 	if (context.mode == BEFORE_MODE) {
 		// Note: `shell` could be empty:
 		// https://github.com/phusion/passenger/issues/2078
-		if (shouldLoadShellEnvvars(context.args, shell)) {
+		if (shouldLoadShellEnvvars(context.args, shell)
+		 && !tryLoadShellEnvvarsFromCache(context, shell))
+		{
 			nextJourneyStep = SpawningKit::SUBPROCESS_OS_SHELL;
 			commandArgs.push_back(shell.c_str());
 			if (LoggingKit::getLevel() >= LoggingKit::DEBUG3) {
@@ -855,6 +1140,8 @@ spawnEnvSetupperMain(int argc, char *argv[]) {
 
 	Context context;
 	context.workDir = argv[2];
+	context.compactSpawnProtocol =
+		getFileType(context.workDir + "/response/steps") != FT_DIRECTORY;
 	context.mode =
 		(strcmp(argv[3], "--before") == 0)
 		? BEFORE_MODE
@@ -900,6 +1187,7 @@ spawnEnvSetupperMain(int argc, char *argv[]) {
 			if (setUlimits(context.args)) {
 				dumpUlimits(context.workDir);
 			}
+			prepareShellEnvvarsCacheDir(context, uid, gid);
 			if (shouldTrySwitchUser) {
 				chownNewWorkDirFiles(context, uid, gid);
 				finalizeWorkDir(context, uid, gid);
@@ -917,6 +1205,7 @@ spawnEnvSetupperMain(int argc, char *argv[]) {
 		} else if (executedThroughShell(context)) {
 			recordJourneyStepEnd(context, SpawningKit::SUBPROCESS_OS_SHELL,
 				SpawningKit::STEP_PERFORMED);
+			saveShellEnvvarsToCache(context);
 		} else {
 			recordJourneyStepEnd(context, SpawningKit::SUBPROCESS_OS_SHELL,
 				SpawningKit::STEP_NOT_STARTED);
@@ -38,17 +38,41 @@ private:
 			int status, e;
 
 			while (!boost::this_thread::interruption_requested()) {
+				pid_t retired;
+				bool replaced = false;
+
 				{
-					boost::lock_guard<boost::mutex> l(lock);
-					pid = this->pid;
-				}
+					// Wait for any in-progress hotRestart() to finish.
+					boost::lock_guard<boost::mutex> sl(startLock);
+					{
+						boost::lock_guard<boost::mutex> l(lock);
+						pid = this->pid;
+						retired = retiredPid;
+					}
 
-				// Process can be started before the watcher thread is launched.
-				if (pid == 0) {
-					pid = start();
+					// Process can be started before the watcher thread is launched.
+					if (pid == 0) {
+						pid = start();
+					}
 				}
-				ret = syscalls::waitpid(pid, &status, 0);
-				if (ret == -1 && errno == ECHILD) {
+
+				if (retired != 0) {
+					/* A process that hotRestart() replaced is still shutting
+					 * down. We weren't necessarily waiting for it when
+					 * hotRestart() ran, so poll both processes until one of
+					 * them exits.
+					 */
+					if (syscalls::waitpid(retired, NULL, WNOHANG) != 0) {
+						retiredProcessExited(retired);
+						continue;
+					}
+					ret = syscalls::waitpid(pid, &status, WNOHANG);
+					e = errno;
+					if (ret == 0) {
+						syscalls::usleep(10000);
+						continue;
+					}
+				} else if ((ret = syscalls::waitpid(pid, &status, 0)) == -1 && errno == ECHILD) {
 					/* If the agent is attached to gdb then waitpid()
 					 * here can return -1 with errno == ECHILD.
 					 * Fallback to kill() polling for checking
@@ -67,7 +91,14 @@ private:
 
 				{
 					boost::lock_guard<boost::mutex> l(lock);
-					this->pid = 0;
+					replaced = pid == retiredPid;
+					if (!replaced) {
+						this->pid = 0;
+					}
+				}
+				if (replaced) {
+					retiredProcessExited(pid);
+					continue;
 				}
 
 				boost::this_thread::disable_interruption di;
@@ -119,6 +150,18 @@ private:
 		}
 	}
 
+	void retiredProcessExited(pid_t pid) {
+		{
+			boost::lock_guard<boost::mutex> l(lock);
+			if (retiredPid == pid) {
+				retiredPid = 0;
+				retiredFeedbackFd = FileDescriptor();
+			}
+		}
+		P_NOTICE(name() << " (pid=" << pid << ") exited after being "
+			"replaced by a hot restart");
+	}
+
 protected:
 	/** PID of the process we're watching. 0 if no process is started at this time. */
 	pid_t pid;
@@ -133,12 +176,27 @@ protected:
 	/** The agent process's feedback fd. */
 	FileDescriptor feedbackFd;
 
+	/**
+	 * PID and feedback fd of the agent process that hotRestart() replaced,
+	 * while it is still shutting down. The feedback fd is kept open until
+	 * then, because the agent treats its closure as the Watchdog dying.
+	 * `retiredPid` is 0 if there is no such process.
+	 */
+	pid_t retiredPid;
+	FileDescriptor retiredFeedbackFd;
+
 	/**
 	 * Lock for protecting the exchange of data between the main thread and
 	 * the watcher thread.
 	 */
 	mutable boost::mutex lock;
 
+	/**
+	 * Serializes starting agent processes, which can happen both in the
+	 * watcher thread and in hotRestart(). Always acquired before `lock`.
+	 */
+	boost::mutex startLock;
+
 	WorkingObjectsPtr wo;
 
 	/**
@@ -167,12 +225,30 @@ protected:
 	 */
 	virtual void sendStartupArguments(pid_t pid, FileDescriptor &fd) = 0;
 
+	/**
+	 * This method is to process a message that the agent process sends
+	 * during startup, before its startup info. Returns true if the message
+	 * was handled, in which case the next message is read. Returns false if
+	 * the message is the startup info. May throw arbitrary exceptions.
+	 */
+	virtual bool processStartupExchange(pid_t pid, FileDescriptor &fd, const vector<string> &args) {
+		return false;
+	}
+
 	/**
 	 * This method is to process the startup info that the agent process has
 	 * sent back. May throw arbitrary exceptions.
 	 */
 	virtual bool processStartupInfo(pid_t pid, FileDescriptor &fd, const vector<string> &args) = 0;
 
+	/**
+	 * Tell an agent process that hotRestart() has replaced to gracefully
+	 * shut down. `fd` is its feedback fd.
+	 */
+	virtual void signalReplaced(pid_t pid, FileDescriptor &fd) {
+		killAndDontWait(pid);
+	}
+
 	/**
 	 * Kill a process (but not its children) with SIGTERM.
 	 * Does not wait until it has quit.
@@ -233,6 +309,7 @@ public:
 	AgentWatcher(const WorkingObjectsPtr &wo) {
 		thr = NULL;
 		pid = 0;
+		retiredPid = 0;
 		this->wo = wo;
 	}
 
@@ -356,17 +433,19 @@ public:
 			}
 
 			// Now read its feedback.
-			try {
-				ret = readArrayMessage(feedbackFd, args);
-			} catch (const SystemException &e) {
-				if (e.code() == ECONNRESET) {
-					ret = false;
-				} else {
-					throw SystemException(string("Unable to start the ") + name() +
-						": unable to read its startup information",
-						e.code());
+			do {
+				try {
+					ret = readArrayMessage(feedbackFd, args);
+				} catch (const SystemException &e) {
+					if (e.code() == ECONNRESET) {
+						ret = false;
+					} else {
+						throw SystemException(string("Unable to start the ") + name() +
+							": unable to read its startup information",
+							e.code());
+					}
 				}
-			}
+			} while (ret && processStartupExchange(pid, feedbackFd, args));
 			if (!ret) {
 				boost::this_thread::disable_interruption di2;
 				boost::this_thread::disable_syscall_interruption dsi2;
@@ -459,6 +538,62 @@ public:
 			name(), 256 * 1024);
 	}
 
+	/**
+	 * Starts a new agent process while the current one keeps running, and
+	 * then tells the current one to gracefully shut down. Returns false if
+	 * no agent process was running, in which case the watcher thread starts
+	 * one anyway. If starting the new process fails, then an exception is
+	 * thrown and the current process keeps running.
+	 *
+	 * @pre beginWatching() has been called.
+	 * @throws RuntimeException The process replaced by the previous hot restart
+	 *                          is still shutting down.
+	 */
+	virtual bool hotRestart() {
+		boost::lock_guard<boost::mutex> sl(startLock);
+		pid_t oldPid;
+
+		{
+			boost::lock_guard<boost::mutex> l(lock);
+			if (retiredPid != 0) {
+				throw RuntimeException(string("The ") + name() + " (pid="
+					+ toString(retiredPid) + ") replaced by the previous hot restart "
+					"is still shutting down");
+			}
+			oldPid = pid;
+			if (oldPid == 0) {
+				return false;
+			}
+			// Mark it as retired before starting the new process: if it
+			// exits in the mean time, then the watcher thread must not
+			// start another one.
+			retiredPid = oldPid;
+			retiredFeedbackFd = feedbackFd;
+		}
+
+		P_NOTICE("Hot restarting " << name() << " (pid=" << oldPid << ")");
+		try {
+			start();
+		} catch (...) {
+			boost::lock_guard<boost::mutex> l(lock);
+			if (retiredPid == oldPid) {
+				retiredPid = 0;
+				retiredFeedbackFd = FileDescriptor();
+			} else {
+				// The old process exited while we were starting the new one,
+				// so let the watcher thread start one.
+				pid = 0;
+			}
+			throw;
+		}
+
+		boost::lock_guard<boost::mutex> l(lock);
+		if (retiredPid == oldPid) {
+			signalReplaced(oldPid, retiredFeedbackFd);
+		}
+		return true;
+	}
+
 	static void stopWatching(vector< boost::shared_ptr<AgentWatcher> > &watchers) {
 		vector< boost::shared_ptr<AgentWatcher> >::const_iterator it;
 		vector<oxt::thread *> threads;
@@ -496,6 +631,11 @@ public:
 	 */
 	virtual bool forceShutdown() {
 		boost::lock_guard<boost::mutex> l(lock);
+		if (retiredPid != 0) {
+			killProcessGroupAndWait(retiredPid);
+			retiredPid = 0;
+			retiredFeedbackFd = FileDescriptor();
+		}
 		if (pid == 0) {
 			return false;
 		} else {
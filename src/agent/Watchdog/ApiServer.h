@@ -136,6 +136,8 @@ private:
 			processConfigLogFileFd(client, req);
 		} else if (path == P_STATIC_STRING("/reopen_logs.json")) {
 			apiServerProcessReopenLogs(this, client, req);
+		} else if (path == P_STATIC_STRING("/hot_restart_core.json")) {
+			processHotRestartCore(client, req);
 		} else {
 			apiServerRespondWith404(this, client, req);
 		}
@@ -226,6 +228,25 @@ private:
 		}
 	}
 
+	void processHotRestartCore(Client *client, Request *req) {
+		if (req->method != HTTP_POST) {
+			apiServerRespondWith405(this, client, req);
+		} else if (authorizeAdminOperation(this, client, req)) {
+			// The main thread starts a new Core, which adopts the listener
+			// sockets, and then tells the current Core to drain its clients
+			// and shut down. We don't wait for that to finish.
+			HeaderTable headers;
+			headers.insert(req->pool, "Content-Type", "application/json");
+			hotRestartEvent->notify();
+			writeSimpleResponse(client, 200, &headers, "{ \"status\": \"ok\" }");
+			if (!req->ended()) {
+				endRequest(&client, &req);
+			}
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
 	bool authorizeFdPassingOperation(Client *client, Request *req) {
 		const LString *password = req->headers.lookup("fd-passing-password");
 		if (password == NULL) {
@@ -331,12 +352,14 @@ public:
 
 	// Dependencies
 	EventFd *exitEvent;
+	EventFd *hotRestartEvent;
 
 	ApiServer(ServerKit::Context *context, const Schema &schema,
 		const Json::Value &initialConfig,
 		const ConfigKit::Translator &translator = ConfigKit::DummyTranslator())
 		: ParentClass(context, schema, initialConfig, translator),
-		  exitEvent(NULL)
+		  exitEvent(NULL),
+		  hotRestartEvent(NULL)
 	{
 		apiAccountDatabase = ApiAccountUtils::ApiAccountDatabase(
 			config["authorizations"]);
@@ -346,6 +369,9 @@ public:
 		if (exitEvent == NULL) {
 			throw RuntimeException("exitEvent must be non-NULL");
 		}
+		if (hotRestartEvent == NULL) {
+			throw RuntimeException("hotRestartEvent must be non-NULL");
+		}
 		ParentClass::initialize();
 	}
 
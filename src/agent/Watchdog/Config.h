@@ -72,11 +72,15 @@ using namespace std;
  *   controller_cpu_affine                                                    boolean            -          default(false),read_only
  *   controller_file_buffered_channel_auto_start_mover                        boolean            -          default(true)
  *   controller_file_buffered_channel_auto_truncate_file                      boolean            -          default(true)
+ *   controller_file_buffered_channel_backend                                 string             -          default("file")
  *   controller_file_buffered_channel_buffer_dir                              string             -          default
  *   controller_file_buffered_channel_delay_in_file_mode_switching            unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_io_uring                                boolean            -          default(false),read_only
  *   controller_file_buffered_channel_max_disk_chunk_read_size                unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_max_file_size                           unsigned integer   -          default(0)
  *   controller_file_buffered_channel_threshold                               unsigned integer   -          default(131072)
  *   controller_mbuf_block_chunk_size                                         unsigned integer   -          default(4096),read_only
+ *   controller_mbuf_huge_pages                                               boolean            -          default(false),read_only
  *   controller_min_spare_clients                                             unsigned integer   -          default(0)
  *   controller_pid_file                                                      string             -          default,read_only
  *   controller_request_freelist_limit                                        unsigned integer   -          default(1024)
@@ -90,11 +94,15 @@ using namespace std;
  *   core_api_server_client_freelist_limit                                    unsigned integer   -          default(0)
  *   core_api_server_file_buffered_channel_auto_start_mover                   boolean            -          default(true)
  *   core_api_server_file_buffered_channel_auto_truncate_file                 boolean            -          default(true)
+ *   core_api_server_file_buffered_channel_backend                            string             -          default("file")
  *   core_api_server_file_buffered_channel_buffer_dir                         string             -          default
  *   core_api_server_file_buffered_channel_delay_in_file_mode_switching       unsigned integer   -          default(0)
+ *   core_api_server_file_buffered_channel_io_uring                           boolean            -          default(false),read_only
  *   core_api_server_file_buffered_channel_max_disk_chunk_read_size           unsigned integer   -          default(0)
+ *   core_api_server_file_buffered_channel_max_file_size                      unsigned integer   -          default(0)
  *   core_api_server_file_buffered_channel_threshold                          unsigned integer   -          default(131072)
  *   core_api_server_mbuf_block_chunk_size                                    unsigned integer   -          default(4096),read_only
+ *   core_api_server_mbuf_huge_pages                                          boolean            -          default(false),read_only
  *   core_api_server_min_spare_clients                                        unsigned integer   -          default(0)
  *   core_api_server_request_freelist_limit                                   unsigned integer   -          default(1024)
  *   core_api_server_start_reading_after_accept                               boolean            -          default(true)
@@ -185,11 +193,15 @@ using namespace std;
  *   watchdog_api_server_client_freelist_limit                                unsigned integer   -          default(0)
  *   watchdog_api_server_file_buffered_channel_auto_start_mover               boolean            -          default(true)
  *   watchdog_api_server_file_buffered_channel_auto_truncate_file             boolean            -          default(true)
+ *   watchdog_api_server_file_buffered_channel_backend                        string             -          default("file")
  *   watchdog_api_server_file_buffered_channel_buffer_dir                     string             -          default
  *   watchdog_api_server_file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -          default(0)
+ *   watchdog_api_server_file_buffered_channel_io_uring                       boolean            -          default(false),read_only
  *   watchdog_api_server_file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -          default(0)
+ *   watchdog_api_server_file_buffered_channel_max_file_size                  unsigned integer   -          default(0)
  *   watchdog_api_server_file_buffered_channel_threshold                      unsigned integer   -          default(131072)
  *   watchdog_api_server_mbuf_block_chunk_size                                unsigned integer   -          default(4096),read_only
+ *   watchdog_api_server_mbuf_huge_pages                                      boolean            -          default(false),read_only
  *   watchdog_api_server_min_spare_clients                                    unsigned integer   -          default(0)
  *   watchdog_api_server_request_freelist_limit                               unsigned integer   -          default(1024)
  *   watchdog_api_server_start_reading_after_accept                           boolean            -          default(true)
@@ -312,6 +324,7 @@ public:
 		erase("instance_dir");
 		erase("oom_score");
 		erase("watchdog_fd_passing_password");
+		erase("watchdog_listener_handoff");
 		/***********/
 		/***********/
 
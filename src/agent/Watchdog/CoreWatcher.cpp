@@ -25,12 +25,42 @@
  */
 
 #include <Shared/Fundamentals/Utils.h>
+#include <Shared/ListenerHandoff.h>
 #include <IOTools/MessageIO.h>
 
 class CoreWatcher: public AgentWatcher {
 protected:
 	string agentFilename;
 
+	/**
+	 * The Core's listener sockets. We keep them open so that the next Core
+	 * process, after a crash or a hot restart, can adopt them instead of
+	 * recreating them. Only accessed while starting the Core and after the
+	 * watcher thread has stopped.
+	 */
+	vector<FileDescriptor> listenerFds;
+
+	void handOffListeners(FileDescriptor &fd) {
+		bool handedOff;
+
+		try {
+			handedOff = ListenerHandoff::handOffListeners(fd, listenerFds);
+		} catch (const IOException &) {
+			throw RuntimeException(string("The ") + name() +
+				" sent an invalid listener handoff message");
+		}
+		if (!handedOff) {
+			throw RuntimeException(string("Unable to start the ") + name() +
+				": it exited during the listener socket handoff");
+		}
+
+		vector<FileDescriptor>::const_iterator it;
+		for (it = listenerFds.begin(); it != listenerFds.end(); it++) {
+			P_LOG_FILE_DESCRIPTOR_PURPOSE(*it,
+				SHORT_PROGRAM_NAME " core listener socket");
+		}
+	}
+
 	virtual const char *name() const {
 		return SHORT_PROGRAM_NAME " core";
 	}
@@ -66,6 +96,7 @@ protected:
 		config["controller_addresses"] = wo->controllerAddresses;
 		config["api_server_addresses"] = wo->coreApiServerAddresses;
 		config["api_server_authorizations"] = wo->coreApiServerAuthorizations;
+		config["watchdog_listener_handoff"] = true;
 
 		// The special value "-" means "don't set a controller secure headers password".
 		if (config["controller_secure_headers_password"].asString() == "-") {
@@ -76,10 +107,27 @@ protected:
 		writeScalarMessage(fd, filteredConfig.inspectEffectiveValues().toStyledString());
 	}
 
+	virtual bool processStartupExchange(pid_t pid, FileDescriptor &fd, const vector<string> &args) {
+		if (args[0] == "listener handoff") {
+			handOffListeners(fd);
+			return true;
+		} else {
+			return false;
+		}
+	}
+
 	virtual bool processStartupInfo(pid_t pid, FileDescriptor &fd, const vector<string> &args) {
 		return args[0] == "initialized";
 	}
 
+	virtual void signalReplaced(pid_t pid, FileDescriptor &fd) {
+		// Unlike SIGTERM, this makes the Core finish the requests that are
+		// in progress even if graceful exit is disabled.
+		if (write(fd, "h", 1) != 1) {
+			AgentWatcher::signalReplaced(pid, fd);
+		}
+	}
+
 public:
 	CoreWatcher(const WorkingObjectsPtr &wo)
 		: AgentWatcher(wo)
@@ -88,6 +136,13 @@ public:
 			resourceLocator->findSupportBinary(AGENT_EXE);
 	}
 
+	virtual bool signalShutdown() {
+		// Stop holding on to the listener sockets, so that clients are
+		// refused once the Core has shut down.
+		listenerFds.clear();
+		return AgentWatcher::signalShutdown();
+	}
+
 	virtual void reportAgentStartupResult(Json::Value &report) {
 		report["core_address"] = wo->controllerAddresses[0].asString();
 		report["core_password"] = watchdogConfig->get("controller_secure_headers_password").asString();
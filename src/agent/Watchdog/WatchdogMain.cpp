@@ -115,6 +115,7 @@ namespace Watchdog {
 		RandomGenerator randomGenerator;
 		EventFd errorEvent;
 		EventFd exitEvent;
+		EventFd hotRestartEvent;
 		uid_t defaultUid;
 		gid_t defaultGid;
 		InstanceDirectoryPtr instanceDir;
@@ -141,6 +142,7 @@ namespace Watchdog {
 		WorkingObjects()
 			: errorEvent(__FILE__, __LINE__, "WorkingObjects: errorEvent"),
 			  exitEvent(__FILE__, __LINE__, "WorkingObjects: exitEvent"),
+			  hotRestartEvent(__FILE__, __LINE__, "WorkingObjects: hotRestartEvent"),
 			  startupReportFile(-1),
 			  pidsCleanedUp(false),
 			  pidFileCleanedUp(false),
@@ -326,10 +328,29 @@ terminationHandler(int signo) {
 	(void) ret; // Don't care about the result.
 }
 
+static void
+hotRestartAgents(const WorkingObjectsPtr &wo, vector<AgentWatcherPtr> &watchers) {
+	TRACE_POINT();
+	char buf[32];
+
+	// Coalesce multiple hot restart commands.
+	ssize_t ret = syscalls::read(wo->hotRestartEvent.fd(), buf, sizeof(buf));
+	(void) ret; // Don't care about the result.
+
+	foreach (AgentWatcherPtr watcher, watchers) {
+		try {
+			watcher->hotRestart();
+		} catch (const std::exception &e) {
+			P_ERROR("Cannot hot restart the " << watcher->name() << ": " << e.what());
+		}
+	}
+}
+
 /**
  * Wait until the starter process has exited or sent us an exit command,
  * or until one of the watcher threads encounter an error. If a thread
  * encountered an error then the error message will be printed.
+ * Hot restarts agents when an API client asks for it in the mean time.
  *
  * Returns whether this watchdog should exit gracefully, which is only the
  * case if the web server sent us an exit command and no thread encountered
@@ -351,22 +372,37 @@ waitForStarterProcessOrWatchers(const WorkingObjectsPtr &wo, vector<AgentWatcher
 	sigaction(SIGINT, &action, NULL);
 	sigaction(SIGTERM, &action, NULL);
 
-	FD_ZERO(&fds);
-	if (feedbackFdAvailable()) {
-		FD_SET(FEEDBACK_FD, &fds);
-		max = std::max(max, FEEDBACK_FD);
-	}
-	FD_SET(wo->errorEvent.fd(), &fds);
-	max = std::max(max, wo->errorEvent.fd());
-	FD_SET(wo->exitEvent.fd(), &fds);
-	max = std::max(max, wo->exitEvent.fd());
+	while (true) {
+		FD_ZERO(&fds);
+		if (feedbackFdAvailable()) {
+			FD_SET(FEEDBACK_FD, &fds);
+			max = std::max(max, FEEDBACK_FD);
+		}
+		FD_SET(wo->errorEvent.fd(), &fds);
+		max = std::max(max, wo->errorEvent.fd());
+		FD_SET(wo->exitEvent.fd(), &fds);
+		max = std::max(max, wo->exitEvent.fd());
+		FD_SET(wo->hotRestartEvent.fd(), &fds);
+		max = std::max(max, wo->hotRestartEvent.fd());
 
-	UPDATE_TRACE_POINT();
-	ret = syscalls::select(max + 1, &fds, NULL, NULL, NULL);
-	if (ret == -1) {
-		int e = errno;
-		P_ERROR("select() failed: " << strerror(e));
-		return false;
+		UPDATE_TRACE_POINT();
+		ret = syscalls::select(max + 1, &fds, NULL, NULL, NULL);
+		if (ret == -1) {
+			int e = errno;
+			P_ERROR("select() failed: " << strerror(e));
+			return false;
+		}
+
+		if (FD_ISSET(wo->hotRestartEvent.fd(), &fds)
+		 && !FD_ISSET(wo->errorEvent.fd(), &fds)
+		 && !FD_ISSET(wo->exitEvent.fd(), &fds)
+		 && !(feedbackFdAvailable() && FD_ISSET(FEEDBACK_FD, &fds)))
+		{
+			UPDATE_TRACE_POINT();
+			hotRestartAgents(wo, watchers);
+		} else {
+			break;
+		}
 	}
 
 	action.sa_handler = SIG_DFL;
@@ -1259,6 +1295,7 @@ initializeApiServer(const WorkingObjectsPtr &wo) {
 		apiServerConfig,
 		watchdogSchema->apiServer.translator);
 	wo->apiServer->exitEvent = &wo->exitEvent;
+	wo->apiServer->hotRestartEvent = &wo->hotRestartEvent;
 	wo->apiServer->initialize();
 	for (unsigned int i = 0; i < wo->watchdogApiServerAddresses.size(); i++) {
 		wo->apiServer->listen(wo->apiServerFds[i]);
@@ -89,19 +89,34 @@ bucket_read(apr_bucket *bucket, const char **str, apr_size_t *len, apr_read_type
 		return APR_EAGAIN;
 	}
 
+	if (data->state->completed) {
+		delete data;
+		bucket->data = NULL;
+
+		bucket = apr_bucket_immortal_make(bucket, "", 0);
+		*str = (const char *) bucket->data;
+		*len = 0;
+		return APR_SUCCESS;
+	}
+
 	buf = (char *) apr_bucket_alloc(APR_BUCKET_BUFF_SIZE, bucket->list);
 	if (buf == NULL) {
 		return APR_ENOMEM;
 	}
 
 	do {
-		ret = read(data->state->connection, buf, APR_BUCKET_BUFF_SIZE);
+		ret = data->state->readBody(buf, APR_BUCKET_BUFF_SIZE);
 	} while (ret == -1 && errno == EINTR);
 
 	if (ret > 0) {
 		apr_bucket_heap *h;
 
 		data->state->bytesRead += ret;
+		if (data->state->bodyEnded()) {
+			// Return the connection to the pool as early as possible.
+			// The next PassengerBucket will report end-of-stream.
+			data->state->finish();
+		}
 
 		*str = buf;
 		*len = ret;
@@ -129,7 +144,7 @@ bucket_read(apr_bucket *bucket, const char **str, apr_size_t *len, apr_read_type
 		return APR_SUCCESS;
 
 	} else if (ret == 0) {
-		data->state->completed = true;
+		data->state->finish();
 		delete data;
 		bucket->data = NULL;
 
@@ -142,8 +157,8 @@ bucket_read(apr_bucket *bucket, const char **str, apr_size_t *len, apr_read_type
 
 	} else /* ret == -1 */ {
 		int e = errno;
-		data->state->completed = true;
 		data->state->errorCode = e;
+		data->state->finish();
 		delete data;
 		bucket->data = NULL;
 		apr_bucket_free(buf);
@@ -26,9 +26,8 @@
 #ifndef _PASSENGER_APACHE2_MODULE_BUCKET_H_
 #define _PASSENGER_APACHE2_MODULE_BUCKET_H_
 
-#include <boost/shared_ptr.hpp>
 #include <apr_buckets.h>
-#include <FileDescriptor.h>
+#include "BucketState.h"
 
 namespace Passenger {
 namespace Apache2Module {
@@ -36,37 +35,6 @@ namespace Apache2Module {
 using namespace boost;
 
 
-struct PassengerBucketState {
-	/** The number of bytes that this PassengerBucket has read so far. */
-	unsigned long bytesRead;
-
-	/** Whether this PassengerBucket is completed, i.e. no more data
-	 * can be read from the underlying file descriptor. When true,
-	 * this can either mean that EOF has been reached, or that an I/O
-	 * error occured. Use errorCode to check whether an error occurred.
-	 */
-	bool completed;
-
-	/** When completed is true, errorCode contains the errno value of
-	 * the last read() call.
-	 *
-	 * A value of 0 means that no error occured.
-	 */
-	int errorCode;
-
-	/** Connection to the Passenger core. */
-	FileDescriptor connection;
-
-	PassengerBucketState(const FileDescriptor &conn) {
-		bytesRead  = 0;
-		completed  = false;
-		errorCode  = 0;
-		connection = conn;
-	}
-};
-
-typedef boost::shared_ptr<PassengerBucketState> PassengerBucketStatePtr;
-
 /**
  * We used to use an apr_bucket_pipe for forwarding the backend process's
  * response to the HTTP client. However, apr_bucket_pipe has a number of
@@ -80,7 +48,11 @@ typedef boost::shared_ptr<PassengerBucketState> PassengerBucketStatePtr;
  * PassengerBucket is like apr_bucket_pipe, but:
  * - It also holds a reference to the connection with the Passenger core.
  *   When a read error has occured or when end-of-stream has been reached
- *   this connection will be closed.
+ *   this connection will be closed, unless it can be reused for another
+ *   request, in which case it is put back in the CoreConnectionPool.
+ * - It reads no further than the end of the response body, as determined
+ *   by the Content-Length header or the chunked encoding, and decodes
+ *   chunked bodies.
  * - It ignores the APR_NONBLOCK_READ flag because that's known to cause
  *   strange I/O problems.
  * - It can store its current state in a PassengerBucketState data structure.
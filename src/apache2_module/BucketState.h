@@ -0,0 +1,287 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APACHE2_MODULE_BUCKET_STATE_H_
+#define _PASSENGER_APACHE2_MODULE_BUCKET_STATE_H_
+
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <string>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include <unistd.h>
+#include <FileDescriptor.h>
+#include <StaticString.h>
+#include <StrIntTools/StrIntUtils.h>
+#include "ChunkedBodyDecoder.h"
+#include "CoreConnectionPool.h"
+
+namespace Passenger {
+namespace Apache2Module {
+
+
+/** How the end of a response body from the Passenger core is determined. */
+enum ResponseBodyType {
+	/** The response has no body, e.g. because it is a response to a HEAD request. */
+	RBT_NO_BODY,
+	RBT_CONTENT_LENGTH,
+	RBT_CHUNKED,
+	/** The body ends when the core closes the connection. */
+	RBT_UNTIL_EOF
+};
+
+struct PassengerBucketState {
+	/** The number of bytes that this PassengerBucket has read so far. */
+	unsigned long bytesRead;
+
+	/** Whether this PassengerBucket is completed, i.e. no more data
+	 * can be read from the underlying file descriptor. When true,
+	 * this can either mean that the end of the body has been reached,
+	 * or that an I/O error occured. Use errorCode to check whether an
+	 * error occurred.
+	 */
+	bool completed;
+
+	/** When completed is true, errorCode contains the errno value of
+	 * the last read() call.
+	 *
+	 * A value of 0 means that no error occured.
+	 */
+	int errorCode;
+
+	/** Connection to the Passenger core. */
+	FileDescriptor connection;
+
+	ResponseBodyType bodyType;
+
+	/** When bodyType is RBT_CONTENT_LENGTH: the number of body bytes
+	 * that haven't been read yet.
+	 */
+	unsigned long long remainingContentLength;
+
+	/** When bodyType is RBT_CHUNKED: decodes the chunked body. */
+	ChunkedBodyDecoder chunkedDecoder;
+
+	/** Response data that has already been read from the connection
+	 * together with the response header, but not yet processed.
+	 */
+	std::string bufferedData;
+
+	/** Whether the connection may be reused after the body has been
+	 * fully read. Cleared when the core ends the connection early or
+	 * sends more data than the body.
+	 */
+	bool keepAlive;
+
+	/** If not NULL, and keepAlive is true, then the connection is put
+	 * back in this pool once the body has been fully read.
+	 */
+	CoreConnectionPool *connectionPool;
+
+	PassengerBucketState(const FileDescriptor &conn) {
+		bytesRead  = 0;
+		completed  = false;
+		errorCode  = 0;
+		connection = conn;
+		bodyType   = RBT_UNTIL_EOF;
+		remainingContentLength = 0;
+		keepAlive  = false;
+		connectionPool = NULL;
+	}
+
+	/** Whether the entire body has been read. */
+	bool bodyEnded() const {
+		switch (bodyType) {
+		case RBT_NO_BODY:
+			return true;
+		case RBT_CONTENT_LENGTH:
+			return remainingContentLength == 0;
+		case RBT_CHUNKED:
+			return chunkedDecoder.done();
+		default:
+			return false;
+		}
+	}
+
+	/** Marks this bucket as completed and puts the connection back in the
+	 * pool if it can be reused.
+	 */
+	void finish() {
+		completed = true;
+		if (connectionPool != NULL && keepAlive && errorCode == 0
+		 && bodyEnded() && bufferedData.empty())
+		{
+			connectionPool->checkin(connection);
+		}
+		connection = FileDescriptor();
+	}
+
+	/**
+	 * Determines from the response header how the end of the response body
+	 * can be found, and whether the connection can be reused afterwards.
+	 * `headerOnly` is whether the response is to a HEAD request.
+	 */
+	void analyzeResponseHeader(const std::string &header, bool headerOnly) {
+		const char *pos = header.data();
+		const char *end = header.data() + header.size();
+		bool http11, hasContentLength = false, chunked = false, connectionClose = false;
+		unsigned long long contentLength = 0;
+		int status;
+
+		if (header.size() < 4 || header.compare(header.size() - 4, 4, "\r\n\r\n") != 0
+		 || header.size() < sizeof("HTTP/1.1 200") - 1
+		 || header.compare(0, sizeof("HTTP/1.") - 1, "HTTP/1.") != 0)
+		{
+			// Incomplete or unexpected header.
+			return;
+		}
+		http11 = header[7] == '1';
+		status = atoi(header.data() + sizeof("HTTP/1.1 ") - 1);
+
+		// Skip the status line.
+		pos = (const char *) memchr(pos, '\n', end - pos) + 1;
+		while (pos < end) {
+			const char *lineEnd = (const char *) memchr(pos, '\n', end - pos);
+			const char *colon = (const char *) memchr(pos, ':', lineEnd - pos);
+			if (colon != NULL) {
+				const char *valueBegin = colon + 1;
+				const char *valueEnd = lineEnd;
+				while (valueBegin < valueEnd && (*valueBegin == ' ' || *valueBegin == '\t')) {
+					valueBegin++;
+				}
+				if (valueEnd > valueBegin && valueEnd[-1] == '\r') {
+					valueEnd--;
+				}
+
+				if (headerNameEquals(pos, colon, P_STATIC_STRING("Content-Length"))) {
+					hasContentLength = true;
+					contentLength = stringToULL(StaticString(valueBegin, valueEnd - valueBegin));
+				} else if (headerNameEquals(pos, colon, P_STATIC_STRING("Transfer-Encoding"))) {
+					chunked = headerValueContains(valueBegin, valueEnd, "chunked");
+				} else if (headerNameEquals(pos, colon, P_STATIC_STRING("Connection"))) {
+					connectionClose = headerValueContains(valueBegin, valueEnd, "close")
+						|| headerValueContains(valueBegin, valueEnd, "upgrade");
+				}
+			}
+			pos = lineEnd + 1;
+		}
+
+		if (status == 101) {
+			// After switching protocols, the connection carries the new
+			// protocol's data until either side closes it.
+			bodyType = RBT_UNTIL_EOF;
+		} else if (headerOnly || (status >= 100 && status < 200) || status == 204 || status == 304) {
+			bodyType = RBT_NO_BODY;
+		} else if (chunked) {
+			bodyType = RBT_CHUNKED;
+		} else if (hasContentLength) {
+			bodyType = RBT_CONTENT_LENGTH;
+			remainingContentLength = contentLength;
+		} else {
+			bodyType = RBT_UNTIL_EOF;
+		}
+		keepAlive = http11 && !connectionClose && bodyType != RBT_UNTIL_EOF;
+	}
+
+	/**
+	 * Reads the next piece of the response body into `buf`, reading no further
+	 * than the end of the body. Returns the number of body bytes, 0 at the end
+	 * of the body, or -1 on error (with errno set).
+	 */
+	ssize_t readBody(char *buf, size_t bufsize) {
+		while (true) {
+			size_t maxSize = bufsize;
+			ssize_t ret;
+
+			if (bodyEnded()) {
+				return 0;
+			} else if (bodyType == RBT_CONTENT_LENGTH
+			        && maxSize > remainingContentLength)
+			{
+				maxSize = (size_t) remainingContentLength;
+			}
+
+			if (!bufferedData.empty()) {
+				ret = std::min(maxSize, bufferedData.size());
+				memcpy(buf, bufferedData.data(), ret);
+				bufferedData.erase(0, ret);
+			} else {
+				ret = read(connection, buf, maxSize);
+				if (ret <= 0) {
+					// The core closed the connection before the end of the
+					// body, or an error occurred.
+					keepAlive = false;
+					return ret;
+				}
+			}
+
+			if (bodyType == RBT_CONTENT_LENGTH) {
+				remainingContentLength -= ret;
+				return ret;
+			} else if (bodyType == RBT_CHUNKED) {
+				size_t consumed;
+				size_t size = chunkedDecoder.feed(buf, ret, consumed);
+				if (chunkedDecoder.hasError()) {
+					keepAlive = false;
+					errno = EIO;
+					return -1;
+				} else if (consumed < (size_t) ret) {
+					// Data after the end of the body. Don't reuse a connection
+					// that is in an unknown state.
+					keepAlive = false;
+				}
+				if (size > 0 || chunkedDecoder.done()) {
+					return size;
+				}
+				// Only chunk framing was read so far, so read more.
+			} else {
+				return ret;
+			}
+		}
+	}
+
+private:
+	static bool headerNameEquals(const char *begin, const char *end, const StaticString &name) {
+		return (size_t) (end - begin) == name.size()
+			&& strncasecmp(begin, name.data(), name.size()) == 0;
+	}
+
+	static bool headerValueContains(const char *begin, const char *end, const char *token) {
+		std::string value(begin, end - begin);
+		convertLowerCase((const unsigned char *) value.data(),
+			(unsigned char *) &value[0], value.size());
+		return value.find(token) != std::string::npos;
+	}
+};
+
+typedef boost::shared_ptr<PassengerBucketState> PassengerBucketStatePtr;
+
+
+} // namespace Apache2Module
+} // namespace Passenger
+
+#endif /* _PASSENGER_APACHE2_MODULE_BUCKET_STATE_H_ */
@@ -0,0 +1,202 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APACHE2_MODULE_CHUNKED_BODY_DECODER_H_
+#define _PASSENGER_APACHE2_MODULE_CHUNKED_BODY_DECODER_H_
+
+#include <cstddef>
+#include <cstring>
+
+namespace Passenger {
+namespace Apache2Module {
+
+
+/**
+ * Decodes a chunked response body from the Passenger core, so that
+ * PassengerBucket can forward the plain body to Apache and knows where
+ * the body ends. The latter allows the connection to the core to be
+ * reused for the next request.
+ *
+ * Chunk extensions and trailers are skipped.
+ */
+class ChunkedBodyDecoder {
+public:
+	enum State {
+		CHUNK_SIZE,
+		CHUNK_EXTENSION,
+		CHUNK_SIZE_LF,
+		CHUNK_DATA,
+		CHUNK_DATA_CR,
+		CHUNK_DATA_LF,
+		TRAILER_START,
+		TRAILER,
+		TRAILER_LF,
+		FINAL_LF,
+		DONE,
+		ERROR
+	};
+
+private:
+	static const unsigned int MAX_CHUNK_SIZE_DIGITS = 15;
+
+	State state;
+	unsigned int chunkSizeDigits;
+	unsigned long long remaining;
+
+	static int parseHexDigit(char ch) {
+		if (ch >= '0' && ch <= '9') {
+			return ch - '0';
+		} else if (ch >= 'a' && ch <= 'f') {
+			return ch - 'a' + 10;
+		} else if (ch >= 'A' && ch <= 'F') {
+			return ch - 'A' + 10;
+		} else {
+			return -1;
+		}
+	}
+
+	void expect(char ch, char expected, State nextState) {
+		if (ch == expected) {
+			state = nextState;
+		} else {
+			state = ERROR;
+		}
+	}
+
+public:
+	ChunkedBodyDecoder()
+		: state(CHUNK_SIZE),
+		  chunkSizeDigits(0),
+		  remaining(0)
+		{ }
+
+	/**
+	 * Decodes the given data in place: the body data contained in it is
+	 * moved to the beginning of `data`. Returns the number of body bytes.
+	 *
+	 * `consumed` is set to the number of input bytes that were processed.
+	 * This is less than `size` only if the end of the body was reached,
+	 * or if a parse error occurred.
+	 */
+	size_t feed(char *data, size_t size, size_t &consumed) {
+		char *out = data;
+		const char *pos = data;
+		const char *end = data + size;
+
+		while (pos < end && state != DONE && state != ERROR) {
+			char ch = *pos;
+
+			switch (state) {
+			case CHUNK_SIZE: {
+				int digit = parseHexDigit(ch);
+				if (digit >= 0) {
+					if (chunkSizeDigits == MAX_CHUNK_SIZE_DIGITS) {
+						state = ERROR;
+						break;
+					}
+					remaining = remaining * 16 + digit;
+					chunkSizeDigits++;
+				} else if (chunkSizeDigits == 0) {
+					state = ERROR;
+					break;
+				} else if (ch == '\r') {
+					state = CHUNK_SIZE_LF;
+				} else if (ch == ';' || ch == ' ' || ch == '\t') {
+					state = CHUNK_EXTENSION;
+				} else {
+					state = ERROR;
+					break;
+				}
+				pos++;
+				break;
+			}
+			case CHUNK_EXTENSION:
+				if (ch == '\r') {
+					state = CHUNK_SIZE_LF;
+				}
+				pos++;
+				break;
+			case CHUNK_SIZE_LF:
+				expect(*pos++, '\n', (remaining == 0) ? TRAILER_START : CHUNK_DATA);
+				break;
+			case CHUNK_DATA: {
+				size_t n = end - pos;
+				if (n > remaining) {
+					n = (size_t) remaining;
+				}
+				// `out` never runs ahead of `pos`.
+				memmove(out, pos, n);
+				out += n;
+				pos += n;
+				remaining -= n;
+				if (remaining == 0) {
+					state = CHUNK_DATA_CR;
+				}
+				break;
+			}
+			case CHUNK_DATA_CR:
+				expect(*pos++, '\r', CHUNK_DATA_LF);
+				break;
+			case CHUNK_DATA_LF:
+				expect(*pos++, '\n', CHUNK_SIZE);
+				chunkSizeDigits = 0;
+				break;
+			case TRAILER_START:
+				state = (*pos++ == '\r') ? FINAL_LF : TRAILER;
+				break;
+			case TRAILER:
+				if (*pos++ == '\r') {
+					state = TRAILER_LF;
+				}
+				break;
+			case TRAILER_LF:
+				expect(*pos++, '\n', TRAILER_START);
+				break;
+			case FINAL_LF:
+				expect(*pos++, '\n', DONE);
+				break;
+			default:
+				break;
+			}
+		}
+
+		consumed = pos - data;
+		return out - data;
+	}
+
+	bool done() const {
+		return state == DONE;
+	}
+
+	bool hasError() const {
+		return state == ERROR;
+	}
+};
+
+
+} // namespace Apache2Module
+} // namespace Passenger
+
+#endif /* _PASSENGER_APACHE2_MODULE_CHUNKED_BODY_DECODER_H_ */
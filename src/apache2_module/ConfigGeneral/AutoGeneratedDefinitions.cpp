@@ -207,6 +207,11 @@ extern "C" const command_rec passenger_commands[] = {
 		NULL,
 		RSRC_CONF | ACCESS_CONF | OR_ALL,
 		"Allow Apache to handle error response."),
+	AP_INIT_TAKE1("PassengerFairShareWeight",
+		(Take1Func) cmd_passenger_fair_share_weight,
+		NULL,
+		RSRC_CONF | ACCESS_CONF,
+		"The weight of this application when dividing the pool capacity between applications."),
 	AP_INIT_TAKE1("PassengerFileDescriptorLogFile",
 		(Take1Func) cmd_passenger_file_descriptor_log_file,
 		NULL,
@@ -358,7 +363,7 @@ extern "C" const command_rec passenger_commands[] = {
 		RSRC_CONF | ACCESS_CONF,
 		"The directory in which Phusion Passenger should look for restart.txt."),
 	AP_INIT_FLAG("PassengerRollingRestarts",
-		(FlagFunc) cmd_passenger_enterprise_only,
+		(FlagFunc) cmd_passenger_rolling_restarts,
 		NULL,
 		RSRC_CONF | ACCESS_CONF,
 		"Whether to turn on rolling restarts."),
@@ -377,6 +382,11 @@ extern "C" const command_rec passenger_commands[] = {
 		NULL,
 		RSRC_CONF,
 		"Use specified HTTP/SOCKS proxy for the Phusion Passenger security update check."),
+	AP_INIT_TAKE1("PassengerShellEnvvarsCacheTTL",
+		(Take1Func) cmd_passenger_shell_envvars_cache_t_t_l,
+		NULL,
+		RSRC_CONF | ACCESS_CONF,
+		"The number of seconds for which the environment variables loaded from the shell may be cached and reused by later application instances. 0 disables caching."),
 	AP_INIT_FLAG("PassengerShowVersionInHeader",
 		(FlagFunc) cmd_passenger_show_version_in_header,
 		NULL,
@@ -452,6 +462,11 @@ extern "C" const command_rec passenger_commands[] = {
 		NULL,
 		RSRC_CONF,
 		"Whether to enable user switching support in Phusion Passenger."),
+	AP_INIT_TAKE1("PassengerWarmupURIs",
+		(Take1Func) cmd_passenger_warmup_u_r_is,
+		NULL,
+		RSRC_CONF | ACCESS_CONF,
+		"A space-separated list of URIs to request on new application instances, during rolling restarts, before they start receiving traffic."),
 	AP_INIT_TAKE1("RackBaseURI",
 		(Take1Func) cmd_passenger_base_uri,
 		NULL,
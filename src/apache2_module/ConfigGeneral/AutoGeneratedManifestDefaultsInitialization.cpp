@@ -184,6 +184,11 @@ ConfigManifestGenerator::autoGenerated_setAppConfigDefaults() {
 		"PassengerDirectInstanceRequestAddress",
 		P_STATIC_STRING("127.0.0.1"));
 
+	addOptionsContainerStaticDefaultInt(
+		defaultAppConfigContainer,
+		"PassengerFairShareWeight",
+		1);
+
 	addOptionsContainerStaticDefaultInt(
 		defaultAppConfigContainer,
 		"PassengerForceMaxConcurrentRequestsPerProcess",
@@ -244,11 +249,21 @@ ConfigManifestGenerator::autoGenerated_setAppConfigDefaults() {
 		"PassengerRestartDir",
 		P_STATIC_STRING("tmp"));
 
+	addOptionsContainerStaticDefaultBool(
+		defaultAppConfigContainer,
+		"PassengerRollingRestarts",
+		false);
+
 	addOptionsContainerStaticDefaultStr(
 		defaultAppConfigContainer,
 		"PassengerRuby",
 		StaticString());
 
+	addOptionsContainerStaticDefaultInt(
+		defaultAppConfigContainer,
+		"PassengerShellEnvvarsCacheTTL",
+		0);
+
 	addOptionsContainerDynamicDefault(
 		defaultAppConfigContainer,
 		"PassengerSpawnMethod",
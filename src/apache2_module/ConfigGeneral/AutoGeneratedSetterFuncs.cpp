@@ -420,6 +420,20 @@ cmd_passenger_error_override(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return NULL;
 }
 
+static const char *
+cmd_passenger_fair_share_weight(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mFairShareWeightSourceFile = cmd->directive->filename;
+	config->mFairShareWeightSourceLine = cmd->directive->line_num;
+	config->mFairShareWeightExplicitlySet = true;
+	return setIntConfig(cmd, arg, config->mFairShareWeight, 1);
+}
+
 static const char *
 cmd_passenger_file_descriptor_log_file(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
@@ -773,6 +787,24 @@ cmd_passenger_restart_dir(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return NULL;
 }
 
+static const char *
+cmd_passenger_rolling_restarts(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mRollingRestartsSourceFile = cmd->directive->filename;
+	config->mRollingRestartsSourceLine = cmd->directive->line_num;
+	config->mRollingRestartsExplicitlySet = true;
+	config->mRollingRestarts =
+		(arg != NULL) ?
+		ENABLED :
+		DISABLED;
+	return NULL;
+}
+
 static const char *
 cmd_passenger_root(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
@@ -818,6 +850,20 @@ cmd_passenger_security_update_check_proxy(cmd_parms *cmd, void *pcfg, const char
 	return NULL;
 }
 
+static const char *
+cmd_passenger_shell_envvars_cache_t_t_l(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mShellEnvvarsCacheTTLSourceFile = cmd->directive->filename;
+	config->mShellEnvvarsCacheTTLSourceLine = cmd->directive->line_num;
+	config->mShellEnvvarsCacheTTLExplicitlySet = true;
+	return setIntConfig(cmd, arg, config->mShellEnvvarsCacheTTL, 0);
+}
+
 static const char *
 cmd_passenger_show_version_in_header(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
@@ -990,6 +1036,21 @@ cmd_passenger_user_switching(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return NULL;
 }
 
+static const char *
+cmd_passenger_warmup_u_r_is(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mWarmupURIsSourceFile = cmd->directive->filename;
+	config->mWarmupURIsSourceLine = cmd->directive->line_num;
+	config->mWarmupURIsExplicitlySet = true;
+	config->mWarmupURIs = arg;
+	return NULL;
+}
+
 static const char *
 cmd_rails_allow_mod_rewrite(cmd_parms *cmd, void *pcfg, const char *arg) {
 	fprintf(stderr, "WARNING: The 'RailsAllowModRewrite' option is obsolete: Phusion Passenger now fully supports mod_rewrite. Please remove this option from your configuration file.\n");
@@ -0,0 +1,129 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APACHE2_MODULE_CORE_CONNECTION_POOL_H_
+#define _PASSENGER_APACHE2_MODULE_CORE_CONNECTION_POOL_H_
+
+#include <boost/thread.hpp>
+#include <vector>
+#include <cerrno>
+#include <poll.h>
+
+#include <FileDescriptor.h>
+
+namespace Passenger {
+namespace Apache2Module {
+
+using namespace std;
+
+
+/**
+ * Keeps idle keep-alive connections to the Passenger core, so that
+ * requests do not have to connect to the core, and the core does not
+ * have to accept a new client, every time.
+ *
+ * Hooks creates one pool in the Apache control process, before the
+ * children are forked. No connections are made until requests are
+ * handled, so each Apache child ends up with its own pool.
+ *
+ * Thread-safe, because worker and event MPM children handle requests
+ * in multiple threads.
+ */
+class CoreConnectionPool {
+private:
+	boost::mutex syncher;
+	vector<FileDescriptor> idleConnections;
+	unsigned int maxIdleConnections;
+
+	/**
+	 * Checks whether an idle connection can still be used. An idle
+	 * connection must not be readable: if it is then the core closed it
+	 * (e.g. because it was restarted) or sent unexpected data.
+	 */
+	static bool isUsable(const FileDescriptor &fd) {
+		struct pollfd pfd;
+		int ret;
+
+		pfd.fd = fd;
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+		do {
+			ret = poll(&pfd, 1, 0);
+		} while (ret == -1 && errno == EINTR);
+		return ret == 0;
+	}
+
+public:
+	CoreConnectionPool(unsigned int maxIdleConnections = 1)
+		: maxIdleConnections(maxIdleConnections)
+		{ }
+
+	void setMaxIdleConnections(unsigned int value) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		maxIdleConnections = value;
+		if (idleConnections.size() > value) {
+			idleConnections.resize(value);
+		}
+	}
+
+	/**
+	 * Returns an idle connection that passed the health check, or an empty
+	 * FileDescriptor if there is none. Connections that failed the health
+	 * check are closed.
+	 */
+	FileDescriptor checkout() {
+		boost::lock_guard<boost::mutex> l(syncher);
+		while (!idleConnections.empty()) {
+			FileDescriptor fd = idleConnections.back();
+			idleConnections.pop_back();
+			if (isUsable(fd)) {
+				return fd;
+			}
+		}
+		return FileDescriptor();
+	}
+
+	/**
+	 * Puts a connection, whose last response has been fully read, back in
+	 * the pool. The connection is closed if the pool is full.
+	 */
+	void checkin(const FileDescriptor &fd) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (idleConnections.size() < maxIdleConnections) {
+			idleConnections.push_back(fd);
+		}
+	}
+
+	void clear() {
+		boost::lock_guard<boost::mutex> l(syncher);
+		idleConnections.clear();
+	}
+};
+
+
+} // namespace Apache2Module
+} // namespace Passenger
+
+#endif /* _PASSENGER_APACHE2_MODULE_CORE_CONNECTION_POOL_H_ */
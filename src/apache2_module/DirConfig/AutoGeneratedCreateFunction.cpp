@@ -80,6 +80,7 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	 */
 	config->mEnabled = Apache2Module::UNSET;
 	config->mErrorOverride = Apache2Module::UNSET;
+	config->mFairShareWeight = UNSET_INT_VALUE;
 	config->mForceMaxConcurrentRequestsPerProcess = UNSET_INT_VALUE;
 	config->mFriendlyErrorPages = Apache2Module::UNSET;
 	/*
@@ -107,9 +108,11 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	/*
 	 * config->mRestartDir: default initialized
 	 */
+	config->mRollingRestarts = Apache2Module::UNSET;
 	/*
 	 * config->mRuby: default initialized
 	 */
+	config->mShellEnvvarsCacheTTL = UNSET_INT_VALUE;
 	/*
 	 * config->mSpawnMethod: default initialized
 	 */
@@ -127,6 +130,9 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	/*
 	 * config->mUser: default initialized
 	 */
+	/*
+	 * config->mWarmupURIs: default initialized
+	 */
 
 	config->mAllowEncodedSlashesSourceLine = 0;
 	config->mAppEnvSourceLine = 0;
@@ -141,6 +147,7 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mDirectInstanceRequestAddressSourceLine = 0;
 	config->mEnabledSourceLine = 0;
 	config->mErrorOverrideSourceLine = 0;
+	config->mFairShareWeightSourceLine = 0;
 	config->mForceMaxConcurrentRequestsPerProcessSourceLine = 0;
 	config->mFriendlyErrorPagesSourceLine = 0;
 	config->mGroupSourceLine = 0;
@@ -156,7 +163,9 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mNodejsSourceLine = 0;
 	config->mPythonSourceLine = 0;
 	config->mRestartDirSourceLine = 0;
+	config->mRollingRestartsSourceLine = 0;
 	config->mRubySourceLine = 0;
+	config->mShellEnvvarsCacheTTLSourceLine = 0;
 	config->mSpawnMethodSourceLine = 0;
 	config->mStartTimeoutSourceLine = 0;
 	config->mStartupFileSourceLine = 0;
@@ -164,6 +173,7 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mStickySessionsCookieAttributesSourceLine = 0;
 	config->mStickySessionsCookieNameSourceLine = 0;
 	config->mUserSourceLine = 0;
+	config->mWarmupURIsSourceLine = 0;
 
 	config->mAllowEncodedSlashesExplicitlySet = false;
 	config->mAppEnvExplicitlySet = false;
@@ -178,6 +188,7 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mDirectInstanceRequestAddressExplicitlySet = false;
 	config->mEnabledExplicitlySet = false;
 	config->mErrorOverrideExplicitlySet = false;
+	config->mFairShareWeightExplicitlySet = false;
 	config->mForceMaxConcurrentRequestsPerProcessExplicitlySet = false;
 	config->mFriendlyErrorPagesExplicitlySet = false;
 	config->mGroupExplicitlySet = false;
@@ -193,7 +204,9 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mNodejsExplicitlySet = false;
 	config->mPythonExplicitlySet = false;
 	config->mRestartDirExplicitlySet = false;
+	config->mRollingRestartsExplicitlySet = false;
 	config->mRubyExplicitlySet = false;
+	config->mShellEnvvarsCacheTTLExplicitlySet = false;
 	config->mSpawnMethodExplicitlySet = false;
 	config->mStartTimeoutExplicitlySet = false;
 	config->mStartupFileExplicitlySet = false;
@@ -201,6 +214,7 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mStickySessionsCookieAttributesExplicitlySet = false;
 	config->mStickySessionsCookieNameExplicitlySet = false;
 	config->mUserExplicitlySet = false;
+	config->mWarmupURIsExplicitlySet = false;
 }
 
 
@@ -64,6 +64,9 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(result, StaticString("!~PASSENGER_DIRECT_INSTANCE_REQUEST_ADDRESS",
 			sizeof("!~PASSENGER_DIRECT_INSTANCE_REQUEST_ADDRESS") - 1),
 		config->mDirectInstanceRequestAddress);
+	addHeader(r, result, StaticString("!~PASSENGER_FAIR_SHARE_WEIGHT",
+			sizeof("!~PASSENGER_FAIR_SHARE_WEIGHT") - 1),
+		config->mFairShareWeight);
 	addHeader(r, result, StaticString("!~PASSENGER_FORCE_MAX_CONCURRENT_REQUESTS_PER_PROCESS",
 			sizeof("!~PASSENGER_FORCE_MAX_CONCURRENT_REQUESTS_PER_PROCESS") - 1),
 		config->mForceMaxConcurrentRequestsPerProcess);
@@ -103,9 +106,15 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(result, StaticString("!~PASSENGER_RESTART_DIR",
 			sizeof("!~PASSENGER_RESTART_DIR") - 1),
 		config->mRestartDir);
+	addHeader(result, StaticString("!~PASSENGER_ROLLING_RESTARTS",
+			sizeof("!~PASSENGER_ROLLING_RESTARTS") - 1),
+		config->mRollingRestarts);
 	addHeader(result, StaticString("!~PASSENGER_RUBY",
 			sizeof("!~PASSENGER_RUBY") - 1),
 		config->mRuby.empty() ? serverConfig.defaultRuby : config->mRuby);
+	addHeader(r, result, StaticString("!~PASSENGER_SHELL_ENVVARS_CACHE_TTL",
+			sizeof("!~PASSENGER_SHELL_ENVVARS_CACHE_TTL") - 1),
+		config->mShellEnvvarsCacheTTL);
 	addHeader(result, StaticString("!~PASSENGER_SPAWN_METHOD",
 			sizeof("!~PASSENGER_SPAWN_METHOD") - 1),
 		config->mSpawnMethod);
@@ -127,6 +136,9 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(result, StaticString("!~PASSENGER_USER",
 			sizeof("!~PASSENGER_USER") - 1),
 		config->mUser);
+	addHeader(result, StaticString("!~PASSENGER_WARMUP_URIS",
+			sizeof("!~PASSENGER_WARMUP_URIS") - 1),
+		config->mWarmupURIs);
 }
 
 
@@ -211,6 +211,17 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mErrorOverrideSourceLine);
 		hierarchyMember["value"] = pdconf->mErrorOverride == Apache2Module::ENABLED;
 	}
+	if (pdconf->mFairShareWeightExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerFairShareWeight",
+			sizeof("PassengerFairShareWeight") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mFairShareWeightSourceFile,
+			pdconf->mFairShareWeightSourceLine);
+		hierarchyMember["value"] = pdconf->mFairShareWeight;
+	}
 	if (pdconf->mForceMaxConcurrentRequestsPerProcessExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -387,6 +398,17 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mRestartDir.data(),
 			pdconf->mRestartDir.data() + pdconf->mRestartDir.size());
 	}
+	if (pdconf->mRollingRestartsExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerRollingRestarts",
+			sizeof("PassengerRollingRestarts") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mRollingRestartsSourceFile,
+			pdconf->mRollingRestartsSourceLine);
+		hierarchyMember["value"] = pdconf->mRollingRestarts == Apache2Module::ENABLED;
+	}
 	if (pdconf->mRubyExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -400,6 +422,17 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mRuby.data(),
 			pdconf->mRuby.data() + pdconf->mRuby.size());
 	}
+	if (pdconf->mShellEnvvarsCacheTTLExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerShellEnvvarsCacheTTL",
+			sizeof("PassengerShellEnvvarsCacheTTL") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mShellEnvvarsCacheTTLSourceFile,
+			pdconf->mShellEnvvarsCacheTTLSourceLine);
+		hierarchyMember["value"] = pdconf->mShellEnvvarsCacheTTL;
+	}
 	if (pdconf->mSpawnMethodExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -487,6 +520,19 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mUser.data(),
 			pdconf->mUser.data() + pdconf->mUser.size());
 	}
+	if (pdconf->mWarmupURIsExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerWarmupURIs",
+			sizeof("PassengerWarmupURIs") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mWarmupURIsSourceFile,
+			pdconf->mWarmupURIsSourceLine);
+		hierarchyMember["value"] = Json::Value(
+			pdconf->mWarmupURIs.data(),
+			pdconf->mWarmupURIs.data() + pdconf->mWarmupURIs.size());
+	}
 }
 
 
@@ -100,6 +100,10 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(add->mErrorOverride != Apache2Module::UNSET)
 		? add->mErrorOverride
 		: base->mErrorOverride;
+	config->mFairShareWeight =
+		(add->mFairShareWeight != UNSET_INT_VALUE)
+		? add->mFairShareWeight
+		: base->mFairShareWeight;
 	config->mForceMaxConcurrentRequestsPerProcess =
 		(add->mForceMaxConcurrentRequestsPerProcess != UNSET_INT_VALUE)
 		? add->mForceMaxConcurrentRequestsPerProcess
@@ -160,10 +164,18 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(!add->mRestartDir.empty())
 		? add->mRestartDir
 		: base->mRestartDir;
+	config->mRollingRestarts =
+		(add->mRollingRestarts != Apache2Module::UNSET)
+		? add->mRollingRestarts
+		: base->mRollingRestarts;
 	config->mRuby =
 		(!add->mRuby.empty())
 		? add->mRuby
 		: base->mRuby;
+	config->mShellEnvvarsCacheTTL =
+		(add->mShellEnvvarsCacheTTL != UNSET_INT_VALUE)
+		? add->mShellEnvvarsCacheTTL
+		: base->mShellEnvvarsCacheTTL;
 	config->mSpawnMethod =
 		(!add->mSpawnMethod.empty())
 		? add->mSpawnMethod
@@ -192,6 +204,10 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(!add->mUser.empty())
 		? add->mUser
 		: base->mUser;
+	config->mWarmupURIs =
+		(!add->mWarmupURIs.empty())
+		? add->mWarmupURIs
+		: base->mWarmupURIs;
 
 	config->mAllowEncodedSlashesSourceFile = add->mAllowEncodedSlashesSourceFile;
 	config->mAppEnvSourceFile = add->mAppEnvSourceFile;
@@ -206,6 +222,7 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mDirectInstanceRequestAddressSourceFile = add->mDirectInstanceRequestAddressSourceFile;
 	config->mEnabledSourceFile = add->mEnabledSourceFile;
 	config->mErrorOverrideSourceFile = add->mErrorOverrideSourceFile;
+	config->mFairShareWeightSourceFile = add->mFairShareWeightSourceFile;
 	config->mForceMaxConcurrentRequestsPerProcessSourceFile = add->mForceMaxConcurrentRequestsPerProcessSourceFile;
 	config->mFriendlyErrorPagesSourceFile = add->mFriendlyErrorPagesSourceFile;
 	config->mGroupSourceFile = add->mGroupSourceFile;
@@ -221,7 +238,9 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mNodejsSourceFile = add->mNodejsSourceFile;
 	config->mPythonSourceFile = add->mPythonSourceFile;
 	config->mRestartDirSourceFile = add->mRestartDirSourceFile;
+	config->mRollingRestartsSourceFile = add->mRollingRestartsSourceFile;
 	config->mRubySourceFile = add->mRubySourceFile;
+	config->mShellEnvvarsCacheTTLSourceFile = add->mShellEnvvarsCacheTTLSourceFile;
 	config->mSpawnMethodSourceFile = add->mSpawnMethodSourceFile;
 	config->mStartTimeoutSourceFile = add->mStartTimeoutSourceFile;
 	config->mStartupFileSourceFile = add->mStartupFileSourceFile;
@@ -229,6 +248,7 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mStickySessionsCookieAttributesSourceFile = add->mStickySessionsCookieAttributesSourceFile;
 	config->mStickySessionsCookieNameSourceFile = add->mStickySessionsCookieNameSourceFile;
 	config->mUserSourceFile = add->mUserSourceFile;
+	config->mWarmupURIsSourceFile = add->mWarmupURIsSourceFile;
 
 	config->mAllowEncodedSlashesSourceLine = add->mAllowEncodedSlashesSourceLine;
 	config->mAppEnvSourceLine = add->mAppEnvSourceLine;
@@ -243,6 +263,7 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mDirectInstanceRequestAddressSourceLine = add->mDirectInstanceRequestAddressSourceLine;
 	config->mEnabledSourceLine = add->mEnabledSourceLine;
 	config->mErrorOverrideSourceLine = add->mErrorOverrideSourceLine;
+	config->mFairShareWeightSourceLine = add->mFairShareWeightSourceLine;
 	config->mForceMaxConcurrentRequestsPerProcessSourceLine = add->mForceMaxConcurrentRequestsPerProcessSourceLine;
 	config->mFriendlyErrorPagesSourceLine = add->mFriendlyErrorPagesSourceLine;
 	config->mGroupSourceLine = add->mGroupSourceLine;
@@ -258,7 +279,9 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mNodejsSourceLine = add->mNodejsSourceLine;
 	config->mPythonSourceLine = add->mPythonSourceLine;
 	config->mRestartDirSourceLine = add->mRestartDirSourceLine;
+	config->mRollingRestartsSourceLine = add->mRollingRestartsSourceLine;
 	config->mRubySourceLine = add->mRubySourceLine;
+	config->mShellEnvvarsCacheTTLSourceLine = add->mShellEnvvarsCacheTTLSourceLine;
 	config->mSpawnMethodSourceLine = add->mSpawnMethodSourceLine;
 	config->mStartTimeoutSourceLine = add->mStartTimeoutSourceLine;
 	config->mStartupFileSourceLine = add->mStartupFileSourceLine;
@@ -266,6 +289,7 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mStickySessionsCookieAttributesSourceLine = add->mStickySessionsCookieAttributesSourceLine;
 	config->mStickySessionsCookieNameSourceLine = add->mStickySessionsCookieNameSourceLine;
 	config->mUserSourceLine = add->mUserSourceLine;
+	config->mWarmupURIsSourceLine = add->mWarmupURIsSourceLine;
 
 	config->mAllowEncodedSlashesExplicitlySet = add->mAllowEncodedSlashesExplicitlySet;
 	config->mAppEnvExplicitlySet = add->mAppEnvExplicitlySet;
@@ -280,6 +304,7 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mDirectInstanceRequestAddressExplicitlySet = add->mDirectInstanceRequestAddressExplicitlySet;
 	config->mEnabledExplicitlySet = add->mEnabledExplicitlySet;
 	config->mErrorOverrideExplicitlySet = add->mErrorOverrideExplicitlySet;
+	config->mFairShareWeightExplicitlySet = add->mFairShareWeightExplicitlySet;
 	config->mForceMaxConcurrentRequestsPerProcessExplicitlySet = add->mForceMaxConcurrentRequestsPerProcessExplicitlySet;
 	config->mFriendlyErrorPagesExplicitlySet = add->mFriendlyErrorPagesExplicitlySet;
 	config->mGroupExplicitlySet = add->mGroupExplicitlySet;
@@ -295,7 +320,9 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mNodejsExplicitlySet = add->mNodejsExplicitlySet;
 	config->mPythonExplicitlySet = add->mPythonExplicitlySet;
 	config->mRestartDirExplicitlySet = add->mRestartDirExplicitlySet;
+	config->mRollingRestartsExplicitlySet = add->mRollingRestartsExplicitlySet;
 	config->mRubyExplicitlySet = add->mRubyExplicitlySet;
+	config->mShellEnvvarsCacheTTLExplicitlySet = add->mShellEnvvarsCacheTTLExplicitlySet;
 	config->mSpawnMethodExplicitlySet = add->mSpawnMethodExplicitlySet;
 	config->mStartTimeoutExplicitlySet = add->mStartTimeoutExplicitlySet;
 	config->mStartupFileExplicitlySet = add->mStartupFileExplicitlySet;
@@ -303,6 +330,7 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mStickySessionsCookieAttributesExplicitlySet = add->mStickySessionsCookieAttributesExplicitlySet;
 	config->mStickySessionsCookieNameExplicitlySet = add->mStickySessionsCookieNameExplicitlySet;
 	config->mUserExplicitlySet = add->mUserExplicitlySet;
+	config->mWarmupURIsExplicitlySet = add->mWarmupURIsExplicitlySet;
 }
 
 
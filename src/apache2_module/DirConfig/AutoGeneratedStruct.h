@@ -96,11 +96,21 @@ struct AutoGeneratedDirConfig {
 	 */
 	Threeway mLoadShellEnvvars;
 
+	/*
+	 * Whether to turn on rolling restarts.
+	 */
+	Threeway mRollingRestarts;
+
 	/*
 	 * Whether to enable sticky sessions.
 	 */
 	Threeway mStickySessions;
 
+	/*
+	 * The weight of this application when dividing the pool capacity between applications.
+	 */
+	int mFairShareWeight;
+
 	/*
 	 * Force Passenger to believe that an application process can handle the given number of concurrent requests per process
 	 */
@@ -131,6 +141,11 @@ struct AutoGeneratedDirConfig {
 	 */
 	int mMinInstances;
 
+	/*
+	 * The number of seconds for which the environment variables loaded from the shell may be cached and reused by later application instances. 0 disables caching.
+	 */
+	int mShellEnvvarsCacheTTL;
+
 	/*
 	 * A timeout for application startup.
 	 */
@@ -226,6 +241,11 @@ struct AutoGeneratedDirConfig {
 	 */
 	StaticString mUser;
 
+	/*
+	 * A space-separated list of URIs to request on new application instances, during rolling restarts, before they start receiving traffic.
+	 */
+	StaticString mWarmupURIs;
+
 	/*
 	 * Declare the given base URI as belonging to a web application.
 	 */
@@ -245,13 +265,16 @@ struct AutoGeneratedDirConfig {
 	StaticString mFriendlyErrorPagesSourceFile;
 	StaticString mHighPerformanceSourceFile;
 	StaticString mLoadShellEnvvarsSourceFile;
+	StaticString mRollingRestartsSourceFile;
 	StaticString mStickySessionsSourceFile;
+	StaticString mFairShareWeightSourceFile;
 	StaticString mForceMaxConcurrentRequestsPerProcessSourceFile;
 	StaticString mLveMinUidSourceFile;
 	StaticString mMaxPreloaderIdleTimeSourceFile;
 	StaticString mMaxRequestQueueSizeSourceFile;
 	StaticString mMaxRequestsSourceFile;
 	StaticString mMinInstancesSourceFile;
+	StaticString mShellEnvvarsCacheTTLSourceFile;
 	StaticString mStartTimeoutSourceFile;
 	StaticString mAppEnvSourceFile;
 	StaticString mAppGroupNameSourceFile;
@@ -271,6 +294,7 @@ struct AutoGeneratedDirConfig {
 	StaticString mStickySessionsCookieAttributesSourceFile;
 	StaticString mStickySessionsCookieNameSourceFile;
 	StaticString mUserSourceFile;
+	StaticString mWarmupURIsSourceFile;
 	StaticString mBaseURIsSourceFile;
 	StaticString mMonitorLogFileSourceFile;
 
@@ -282,13 +306,16 @@ struct AutoGeneratedDirConfig {
 	unsigned int mFriendlyErrorPagesSourceLine;
 	unsigned int mHighPerformanceSourceLine;
 	unsigned int mLoadShellEnvvarsSourceLine;
+	unsigned int mRollingRestartsSourceLine;
 	unsigned int mStickySessionsSourceLine;
+	unsigned int mFairShareWeightSourceLine;
 	unsigned int mForceMaxConcurrentRequestsPerProcessSourceLine;
 	unsigned int mLveMinUidSourceLine;
 	unsigned int mMaxPreloaderIdleTimeSourceLine;
 	unsigned int mMaxRequestQueueSizeSourceLine;
 	unsigned int mMaxRequestsSourceLine;
 	unsigned int mMinInstancesSourceLine;
+	unsigned int mShellEnvvarsCacheTTLSourceLine;
 	unsigned int mStartTimeoutSourceLine;
 	unsigned int mAppEnvSourceLine;
 	unsigned int mAppGroupNameSourceLine;
@@ -308,6 +335,7 @@ struct AutoGeneratedDirConfig {
 	unsigned int mStickySessionsCookieAttributesSourceLine;
 	unsigned int mStickySessionsCookieNameSourceLine;
 	unsigned int mUserSourceLine;
+	unsigned int mWarmupURIsSourceLine;
 	unsigned int mBaseURIsSourceLine;
 	unsigned int mMonitorLogFileSourceLine;
 
@@ -319,13 +347,16 @@ struct AutoGeneratedDirConfig {
 	bool mFriendlyErrorPagesExplicitlySet: 1;
 	bool mHighPerformanceExplicitlySet: 1;
 	bool mLoadShellEnvvarsExplicitlySet: 1;
+	bool mRollingRestartsExplicitlySet: 1;
 	bool mStickySessionsExplicitlySet: 1;
+	bool mFairShareWeightExplicitlySet: 1;
 	bool mForceMaxConcurrentRequestsPerProcessExplicitlySet: 1;
 	bool mLveMinUidExplicitlySet: 1;
 	bool mMaxPreloaderIdleTimeExplicitlySet: 1;
 	bool mMaxRequestQueueSizeExplicitlySet: 1;
 	bool mMaxRequestsExplicitlySet: 1;
 	bool mMinInstancesExplicitlySet: 1;
+	bool mShellEnvvarsCacheTTLExplicitlySet: 1;
 	bool mStartTimeoutExplicitlySet: 1;
 	bool mAppEnvExplicitlySet: 1;
 	bool mAppGroupNameExplicitlySet: 1;
@@ -345,6 +376,7 @@ struct AutoGeneratedDirConfig {
 	bool mStickySessionsCookieAttributesExplicitlySet: 1;
 	bool mStickySessionsCookieNameExplicitlySet: 1;
 	bool mUserExplicitlySet: 1;
+	bool mWarmupURIsExplicitlySet: 1;
 	bool mBaseURIsExplicitlySet: 1;
 	bool mMonitorLogFileExplicitlySet: 1;
 
@@ -417,6 +449,15 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	bool
+	getRollingRestarts() const {
+		if (mRollingRestarts == Apache2Module::UNSET) {
+			return false;
+		} else {
+			return mRollingRestarts == Apache2Module::ENABLED;
+		}
+	}
+
 	bool
 	getStickySessions() const {
 		if (mStickySessions == Apache2Module::UNSET) {
@@ -426,6 +467,15 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	int
+	getFairShareWeight() const {
+		if (mFairShareWeight == UNSET_INT_VALUE) {
+			return 1;
+		} else {
+			return mFairShareWeight;
+		}
+	}
+
 	int
 	getForceMaxConcurrentRequestsPerProcess() const {
 		if (mForceMaxConcurrentRequestsPerProcess == UNSET_INT_VALUE) {
@@ -480,6 +530,15 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	int
+	getShellEnvvarsCacheTTL() const {
+		if (mShellEnvvarsCacheTTL == UNSET_INT_VALUE) {
+			return 0;
+		} else {
+			return mShellEnvvarsCacheTTL;
+		}
+	}
+
 	int
 	getStartTimeout() const {
 		if (mStartTimeout == UNSET_INT_VALUE) {
@@ -611,6 +670,11 @@ struct AutoGeneratedDirConfig {
 		return mUser;
 	}
 
+	StaticString
+	getWarmupURIs() const {
+		return mWarmupURIs;
+	}
+
 	const std::set<std::string> &
 	getBaseURIs() const {
 		return mBaseURIs;
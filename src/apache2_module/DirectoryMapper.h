@@ -34,8 +34,9 @@
 #include <boost/thread.hpp>
 
 #include <AppTypeDetector/Detector.h>
+#include <AppTypeDetector/ResultCache.h>
 #include <Utils.h>
-#include <Utils/CachedFileStat.hpp>
+#include <Utils/ShardedCachedFileStat.hpp>
 
 // The APR headers must come after the Passenger headers.
 // See Hooks.cpp to learn why.
@@ -75,8 +76,8 @@ private:
 	const WrapperRegistry::Registry &registry;
 	DirConfig *config;
 	request_rec *r;
-	CachedFileStat *cstat;
-	boost::mutex *cstatMutex;
+	ShardedCachedFileStat *cstat;
+	AppTypeDetector::ResultCache *detectorResultCache;
 	boost::mutex *configMutex;
 	const char *baseURI;
 	string publicDir;
@@ -149,7 +150,7 @@ private:
 
 		UPDATE_TRACE_POINT();
 		AppTypeDetector::Detector detector(registry, cstat,
-			cstatMutex, throttleRate, configMutex);
+			throttleRate, configMutex);
 		AppTypeDetector::Detector::Result detectorResult;
 		string appRoot;
 		// If `AppStartCommand` is set, then it means the config specified that it is
@@ -160,12 +161,13 @@ private:
 			// If neither `AppStartCommand` nor `AppType` are set, then
 			// autodetect what kind of app this is.
 			if (config->getAppRoot().empty()) {
-				detectorResult = detector.checkDocumentRoot(publicDir,
-					baseURI != NULL,
-					&appRoot);
+				detectorResult = detectorResultCache->checkDocumentRoot(
+					detector, throttleRate, publicDir,
+					baseURI != NULL, &appRoot);
 			} else {
 				appRoot = config->getAppRoot();
-				detectorResult = detector.checkAppRoot(appRoot);
+				detectorResult = detectorResultCache->checkAppRoot(
+					detector, throttleRate, appRoot);
 			}
 		} else if (!config->getAppRoot().empty()) {
 			// If `AppStartCommand` is not set but `AppType` is (as well as
@@ -186,23 +188,23 @@ public:
 	/**
 	 * Create a new DirectoryMapper object.
 	 *
-	 * @param cstat A CachedFileStat object used for statting files.
-	 * @param cstatMutex A mutex for locking CachedFileStat, making its
-	 *                   usage thread-safe.
-	 * @param throttleRate A throttling rate for cstat.
+	 * @param cstat A ShardedCachedFileStat object used for statting files.
+	 * @param detectorResultCache Caches the application type per directory.
+	 * @param throttleRate A throttling rate for cstat and detectorResultCache.
 	 * @warning Do not use this object after the destruction of <tt>r</tt>,
-	 *          <tt>config</tt> or <tt>cstat</tt>.
+	 *          <tt>config</tt>, <tt>cstat</tt> or <tt>detectorResultCache</tt>.
 	 */
 	DirectoryMapper(request_rec *r, DirConfig *config,
 		const WrapperRegistry::Registry &_registry,
-		CachedFileStat *cstat, boost::mutex *cstatMutex,
+		ShardedCachedFileStat *cstat,
+		AppTypeDetector::ResultCache *detectorResultCache,
 		unsigned int throttleRate, boost::mutex *configMutex)
 		: registry(_registry)
 	{
 		this->r = r;
 		this->config = config;
 		this->cstat = cstat;
-		this->cstatMutex = cstatMutex;
+		this->detectorResultCache = detectorResultCache;
 		this->configMutex = configMutex;
 		this->throttleRate = throttleRate;
 		baseURI = NULL;
@@ -86,6 +86,7 @@
 #include <http_protocol.h>
 #include <http_log.h>
 #include <util_script.h>
+#include <ap_mpm.h>
 #include <apr_pools.h>
 #include <apr_strings.h>
 #include <apr_lib.h>
@@ -232,11 +233,14 @@ private:
 
 	enum Threeway { YES, NO, UNKNOWN };
 
+	static const size_t MAX_RESPONSE_HEADER_SIZE = 1024 * 128;
+
 	Threeway m_hasModRewrite, m_hasModDir, m_hasModAutoIndex, m_hasModXsendfile;
 	WrapperRegistry::Registry wrapperRegistry;
-	CachedFileStat cstat;
+	ShardedCachedFileStat cstat;
+	AppTypeDetector::ResultCache detectorResultCache;
 	WatchdogLauncher watchdogLauncher;
-	boost::mutex cstatMutex;
+	CoreConnectionPool coreConnectionPool;
 	boost::mutex configMutex;
 
 	static Json::Value strsetToJson(const set<string> &input) {
@@ -351,6 +355,91 @@ private:
 		return conn;
 	}
 
+	/**
+	 * Sends the request header to the core, over a pooled keep-alive
+	 * connection if there is one. If the pooled connection turns out to
+	 * have been closed by the core, e.g. because the core was restarted,
+	 * then a new connection is made instead.
+	 *
+	 * @param reused Set to whether a pooled connection was used.
+	 */
+	FileDescriptor sendRequestHeaderToCore(const string &headers, bool &reused) {
+		TRACE_POINT();
+		FileDescriptor conn = coreConnectionPool.checkout();
+
+		reused = conn != -1;
+		if (reused) {
+			try {
+				writeExact(conn, headers);
+				return conn;
+			} catch (const SystemException &e) {
+				if (e.code() != EPIPE && e.code() != ECONNRESET) {
+					throw;
+				}
+				P_DEBUG("Pooled connection to the Passenger core was closed, reconnecting");
+			}
+		}
+
+		UPDATE_TRACE_POINT();
+		reused = false;
+		conn = connectToCore();
+		writeExact(conn, headers);
+		return conn;
+	}
+
+	/**
+	 * Reads the response header from the core into `header`, up to and
+	 * including the empty line that ends it. Response data that was read
+	 * beyond the header is stored in `rest`.
+	 *
+	 * If the header is larger than MAX_RESPONSE_HEADER_SIZE or if the core
+	 * closes the connection before the end of the header, then `header`
+	 * contains whatever was read, and the caller should treat the rest of
+	 * the stream like it did before keep-alive: as unframed data.
+	 *
+	 * @return Whether any data was read at all.
+	 */
+	bool readResponseHeader(const FileDescriptor &conn, string &header, string &rest) {
+		TRACE_POINT();
+		char buf[1024 * 8];
+		size_t searchStart = 0;
+
+		while (header.size() < MAX_RESPONSE_HEADER_SIZE) {
+			ssize_t ret;
+			do {
+				ret = read(conn, buf, sizeof(buf));
+			} while (ret == -1 && errno == EINTR);
+
+			if (ret == -1) {
+				if (errno == ECONNRESET && header.empty()) {
+					return false;
+				}
+				int e = errno;
+				throw SystemException("Cannot read response from the Passenger core", e);
+			} else if (ret == 0) {
+				return !header.empty();
+			}
+
+			header.append(buf, ret);
+			string::size_type pos = header.find("\r\n\r\n", searchStart);
+			if (pos != string::npos) {
+				rest.assign(header, pos + 4, string::npos);
+				header.resize(pos + 4);
+				return true;
+			}
+			searchStart = (header.size() > 3) ? header.size() - 3 : 0;
+		}
+		return true;
+	}
+
+	/**
+	 * Whether the request can be sent to the core a second time without
+	 * side effects. HEAD requests have M_GET as method number.
+	 */
+	static bool isIdempotentMethod(const request_rec *r) {
+		return r->method_number == M_GET || r->method_number == M_OPTIONS;
+	}
+
 	bool hasModRewrite() {
 		if (m_hasModRewrite == UNKNOWN) {
 			if (ap_find_linked_module("mod_rewrite.c")) {
@@ -447,7 +536,7 @@ private:
 		TRACE_POINT();
 
 		DirectoryMapper mapper(r, config, wrapperRegistry, &cstat,
-		    &cstatMutex, serverConfig.statThrottleRate, &configMutex);
+		    &detectorResultCache, serverConfig.statThrottleRate, &configMutex);
 		try {
 			if (config->getAppStartCommand().empty()
 			 && mapper.getDetectorResult().isNull())
@@ -642,9 +731,8 @@ private:
 			bool bodyIsChunked = false;
 
 			string headers = constructRequestHeaders(r, mapper, bodyIsChunked);
-			FileDescriptor conn = connectToCore();
-			writeExact(conn, headers);
-			headers.clear();
+			bool reused;
+			FileDescriptor conn = sendRequestHeaderToCore(headers, reused);
 			if (expectingBody) {
 				sendRequestBody(conn, r, bodyIsChunked);
 			}
@@ -657,11 +745,49 @@ private:
 			apr_bucket_brigade *bb;
 			apr_bucket *b;
 			PassengerBucketStatePtr bucketState;
+			string responseHeader, responseData;
+
+			if (!readResponseHeader(conn, responseHeader, responseData)) {
+				// The connection was closed before the core responded.
+				// If it was a pooled connection then the core may have
+				// closed it before it saw the request, but we can't be
+				// sure, so only requests that are safe to run twice
+				// (like nginx's proxy_next_upstream) are sent again.
+				if (!reused || expectingBody || !isIdempotentMethod(r)) {
+					P_ERROR("The Passenger core closed the connection "
+						"before sending a response");
+					return HTTP_BAD_GATEWAY;
+				}
+				P_DEBUG("Pooled connection to the Passenger core was closed, "
+					"resending request");
+				conn = connectToCore();
+				writeExact(conn, headers);
+				if (!readResponseHeader(conn, responseHeader, responseData)) {
+					P_ERROR("The Passenger core closed the connection "
+						"before sending a response");
+					return HTTP_BAD_GATEWAY;
+				}
+			}
+			headers.clear();
 
-			/* Setup the bucket brigade. */
+			/* Setup the bucket brigade. The response header is parsed from
+			 * a copy of the data that we already read, followed by the body.
+			 */
 			bb = apr_brigade_create(r->connection->pool, r->connection->bucket_alloc);
 
+			b = apr_bucket_heap_create(responseHeader.data(), responseHeader.size(),
+				NULL, r->connection->bucket_alloc);
+			APR_BRIGADE_INSERT_TAIL(bb, b);
+
 			bucketState = boost::make_shared<PassengerBucketState>(conn);
+			bucketState->analyzeResponseHeader(responseHeader, r->header_only);
+			bucketState->bufferedData.swap(responseData);
+			bucketState->connectionPool = &coreConnectionPool;
+			responseHeader.clear();
+			conn = FileDescriptor();
+			if (bucketState->bodyEnded()) {
+				bucketState->finish();
+			}
 			b = passenger_bucket_create(bucketState, r->connection->bucket_alloc,
 				config->getBufferResponse());
 			APR_BRIGADE_INSERT_TAIL(bb, b);
@@ -685,13 +811,19 @@ private:
 			// into error_headers_out (mostly) as well as headers_out.
 			ret = ap_scan_script_header_err_brigade(r, bb, backendData);
 
-			// The PassengerAgent sets the Connection: close header because it wants
-			// the bb connection closed, but because we fed everything to the
+			// The PassengerAgent may set the Connection: close header because it
+			// wants the bb connection closed, but because we fed everything to the
 			// ap_scan_script it will also be set in the response to the client and
 			// that breaks HTTP 1.1 keep-alive, so unset it.
 			apr_table_unset(r->err_headers_out, "Connection");
 			// It's undefined in which of the tables it ends up in, so unset on both.
 			apr_table_unset(r->headers_out, "Connection");
+			if (bucketState->bodyType == RBT_CHUNKED) {
+				// PassengerBucket dechunks the body. Apache applies its own
+				// transfer encoding.
+				apr_table_unset(r->err_headers_out, "Transfer-Encoding");
+				apr_table_unset(r->headers_out, "Transfer-Encoding");
+			}
 
 			if (ret == OK) {
 				// The API documentation for ap_scan_script_err_brigade() says it
@@ -934,10 +1066,10 @@ private:
 			}
 		}
 
+		// Without a Connection header, the core keeps the connection alive
+		// so that it can be reused through the CoreConnectionPool.
 		if (connectionHeader != NULL && connectionUpgradeFlagSet(connectionHeader->val)) {
 			result.append("Connection: upgrade\r\n", sizeof("Connection: upgrade\r\n") - 1);
-		} else {
-			result.append("Connection: close\r\n", sizeof("Connection: close\r\n") - 1);
 		}
 
 		if (transferEncodingHeader != NULL) {
@@ -1053,11 +1185,14 @@ private:
 
 		// Add flags.
 		// C = Strip 100 Continue header
-		// D = Dechunk
 		// B = Buffer request body
 		// S = SSL
+		//
+		// The D (dechunk) flag is not passed: chunked responses are
+		// dechunked by PassengerBucket, so that the connection can be
+		// kept alive.
 
-		result.append("!~FLAGS: CD", sizeof("!~FLAGS: CD") - 1);
+		result.append("!~FLAGS: C", sizeof("!~FLAGS: C") - 1);
 		if (config->getBufferUpload()) {
 			result.append("B", 1);
 		}
@@ -1270,6 +1405,15 @@ public:
 		wrapperRegistry.finalize();
 		postprocessConfig(s, pconf, ptemp);
 
+		// Each thread in an Apache child can keep one idle connection.
+		int threadsPerChild;
+		if (ap_mpm_query(AP_MPMQ_MAX_THREADS, &threadsPerChild) != APR_SUCCESS
+		 || threadsPerChild < 1)
+		{
+			threadsPerChild = 1;
+		}
+		coreConnectionPool.setMaxIdleConnections(threadsPerChild);
+
 		Json::Value loggingConfig;
 		loggingConfig["level"] = LoggingKit::Level(serverConfig.logLevel);
 		loggingConfig["redirect_stderr"] = false;
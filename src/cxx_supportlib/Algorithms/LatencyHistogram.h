@@ -0,0 +1,189 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_ALGORITHMS_LATENCY_HISTOGRAM_H_
+#define _PASSENGER_ALGORITHMS_LATENCY_HISTOGRAM_H_
+
+#include <boost/cstdint.hpp>
+#include <oxt/macros.hpp>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * A fixed-memory histogram for latency values (typically in microseconds),
+ * in the spirit of HdrHistogram. Values are put in log-linear buckets:
+ * values smaller than `SUB_BUCKET_COUNT` get a bucket of their own, and
+ * every power of two above that is divided in `SUB_BUCKET_COUNT / 2` equally
+ * sized buckets. This bounds the relative error of reported percentiles
+ * to about 1 / (SUB_BUCKET_COUNT / 2) = 6.25%, while recording is a
+ * handful of integer operations and memory usage is constant.
+ *
+ * Values larger than or equal to 2^MAX_VALUE_BITS are clamped into the
+ * last bucket. With microseconds, that is about 71 minutes.
+ *
+ * Histograms can be merged, so that each thread can record into its own
+ * histogram without locking, and the results can be combined on demand.
+ */
+class LatencyHistogram {
+public:
+	static const unsigned int SUB_BUCKET_BITS = 5;
+	static const unsigned int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static const unsigned int SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+	static const unsigned int MAX_VALUE_BITS = 32;
+	static const unsigned int BUCKET_COUNT = SUB_BUCKET_COUNT
+		+ (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_HALF_COUNT;
+
+private:
+	boost::uint64_t counts[BUCKET_COUNT];
+	boost::uint64_t totalCount;
+	boost::uint64_t sum;
+	boost::uint64_t minValue;
+	boost::uint64_t maxValue;
+
+	static unsigned int getBucketIndex(boost::uint64_t value) {
+		if (value < SUB_BUCKET_COUNT) {
+			return (unsigned int) value;
+		} else if (OXT_UNLIKELY(value >= (boost::uint64_t(1) << MAX_VALUE_BITS))) {
+			return BUCKET_COUNT - 1;
+		}
+
+		unsigned int msb = 63 - __builtin_clzll(value);
+		unsigned int shift = msb - SUB_BUCKET_BITS + 1;
+		unsigned int mantissa = (unsigned int) (value >> shift);
+		return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF_COUNT
+			+ (mantissa - SUB_BUCKET_HALF_COUNT);
+	}
+
+	static boost::uint64_t getBucketUpperBound(unsigned int index) {
+		if (index < SUB_BUCKET_COUNT) {
+			return index;
+		}
+
+		unsigned int shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF_COUNT + 1;
+		boost::uint64_t mantissa = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF_COUNT
+			+ SUB_BUCKET_HALF_COUNT;
+		return ((mantissa + 1) << shift) - 1;
+	}
+
+public:
+	LatencyHistogram() {
+		reset();
+	}
+
+	void reset() {
+		memset(counts, 0, sizeof(counts));
+		totalCount = 0;
+		sum = 0;
+		minValue = 0;
+		maxValue = 0;
+	}
+
+	void record(boost::uint64_t value) {
+		counts[getBucketIndex(value)]++;
+		if (totalCount == 0 || value < minValue) {
+			minValue = value;
+		}
+		if (value > maxValue) {
+			maxValue = value;
+		}
+		totalCount++;
+		sum += value;
+	}
+
+	void merge(const LatencyHistogram &other) {
+		if (other.totalCount == 0) {
+			return;
+		}
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			counts[i] += other.counts[i];
+		}
+		if (totalCount == 0 || other.minValue < minValue) {
+			minValue = other.minValue;
+		}
+		maxValue = std::max(maxValue, other.maxValue);
+		totalCount += other.totalCount;
+		sum += other.sum;
+	}
+
+	boost::uint64_t getCount() const {
+		return totalCount;
+	}
+
+	boost::uint64_t getMin() const {
+		return minValue;
+	}
+
+	boost::uint64_t getMax() const {
+		return maxValue;
+	}
+
+	double getMean() const {
+		if (totalCount == 0) {
+			return 0;
+		} else {
+			return sum / (double) totalCount;
+		}
+	}
+
+	/**
+	 * Returns the value below which `percentile` percent (0..100) of the
+	 * recorded values fall. The result is the upper bound of the bucket in
+	 * which that value was recorded, capped by the largest recorded value.
+	 * Returns 0 if nothing has been recorded.
+	 */
+	boost::uint64_t getValueAtPercentile(double percentile) const {
+		if (totalCount == 0) {
+			return 0;
+		}
+
+		boost::uint64_t rank = (boost::uint64_t) ceil(
+			std::min(std::max(percentile, 0.0), 100.0) / 100.0 * totalCount);
+		rank = std::max<boost::uint64_t>(rank, 1);
+
+		boost::uint64_t cumulative = 0;
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			cumulative += counts[i];
+			if (cumulative >= rank) {
+				if (i == BUCKET_COUNT - 1) {
+					// Clamped values may be larger than the bucket's bound.
+					return maxValue;
+				}
+				return std::min(getBucketUpperBound(i), maxValue);
+			}
+		}
+		return maxValue;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_ALGORITHMS_LATENCY_HISTOGRAM_H_ */
@@ -46,6 +46,7 @@
 #include <DataStructures/StringKeyTable.h>
 #include <Utils.h>
 #include <Utils/CachedFileStat.hpp>
+#include <Utils/ShardedCachedFileStat.hpp>
 
 namespace Passenger {
 namespace AppTypeDetector {
@@ -74,6 +75,7 @@ private:
 	const WrapperRegistry::Registry &registry;
 	CachedFileStat *cstat;
 	boost::mutex *cstatMutex;
+	ShardedCachedFileStat *shardedCstat;
 	unsigned int throttleRate;
 	bool ownsCstat;
 	AppLocalConfigMap appLocalConfigCache;
@@ -92,8 +94,17 @@ private:
 			TRACE_POINT();
 			throw RuntimeException("Not enough buffer space");
 		}
-		return getFileType(StaticString(buf, pos - buf - 1),
-			cstat, cstatMutex, throttleRate) != FT_NONEXISTANT;
+
+		StaticString filename(buf, pos - buf - 1);
+		if (shardedCstat != NULL) {
+			boost::mutex *shardMutex;
+			CachedFileStat *shard = shardedCstat->getShard(filename, &shardMutex);
+			return getFileType(filename, shard, shardMutex, throttleRate)
+				!= FT_NONEXISTANT;
+		} else {
+			return getFileType(filename, cstat, cstatMutex, throttleRate)
+				!= FT_NONEXISTANT;
+		}
 	}
 
 	AppLocalConfigPtr getAppLocalConfigFromCache(const StaticString &appRoot) {
@@ -120,6 +131,7 @@ public:
 		: registry(_registry),
 		  cstat(_cstat),
 		  cstatMutex(_cstatMutex),
+		  shardedCstat(NULL),
 		  throttleRate(_throttleRate),
 		  ownsCstat(false),
 		  configMutex(_configMutex)
@@ -131,6 +143,26 @@ public:
 		}
 	}
 
+	/**
+	 * Creates a Detector that stats files through a ShardedCachedFileStat,
+	 * so that Detectors in many threads can share it without contending
+	 * on a single lock.
+	 */
+	Detector(const WrapperRegistry::Registry &_registry,
+		ShardedCachedFileStat *_shardedCstat, unsigned int _throttleRate = 1,
+		boost::mutex *_configMutex = NULL)
+		: registry(_registry),
+		  cstat(NULL),
+		  cstatMutex(NULL),
+		  shardedCstat(_shardedCstat),
+		  throttleRate(_throttleRate),
+		  ownsCstat(false),
+		  configMutex(_configMutex)
+	{
+		assert(_registry.isFinalized());
+		assert(_shardedCstat != NULL);
+	}
+
 	~Detector() {
 		if (ownsCstat) {
 			delete cstat;
@@ -0,0 +1,207 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APP_TYPE_DETECTOR_RESULT_CACHE_H_
+#define _PASSENGER_APP_TYPE_DETECTOR_RESULT_CACHE_H_
+
+#include <time.h>
+
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <string>
+
+#include <StaticString.h>
+#include <DataStructures/HashedStaticString.h>
+#include <DataStructures/StringKeyTable.h>
+#include <SystemTools/SystemTime.h>
+#include <AppTypeDetector/Detector.h>
+
+namespace Passenger {
+namespace AppTypeDetector {
+
+using namespace std;
+
+
+/**
+ * Caches Detector results per document root or application root, so that
+ * threads that map many requests to the same application (such as the
+ * threads of an Apache worker process) don't have to probe the filesystem
+ * for startup files on every request.
+ *
+ * A result is reused for `throttleRate` seconds after it was determined,
+ * just like CachedFileStat reuses stat() results. So a change in the
+ * application type is noticed at most `throttleRate` seconds later.
+ * Errors are not cached.
+ *
+ * The cache is partitioned over a number of shards by the hash of the
+ * directory, each with its own lock, to avoid contention between threads.
+ */
+class ResultCache: public boost::noncopyable {
+public:
+	static const unsigned int SHARD_COUNT = 16;
+	/** When a shard reaches this size, it is cleared. */
+	static const unsigned int MAX_ENTRIES_PER_SHARD = 64;
+
+private:
+	struct Entry {
+		Detector::Result result;
+		string appRoot;
+		time_t checkedAt;
+
+		Entry()
+			: checkedAt(0)
+			{ }
+	};
+
+	struct Shard {
+		boost::mutex syncher;
+		StringKeyTable<Entry> entries;
+	};
+
+	Shard shards[SHARD_COUNT];
+
+	Shard &getShard(const HashedStaticString &key) {
+		return shards[key.hash() % SHARD_COUNT];
+	}
+
+	bool lookup(const HashedStaticString &key, unsigned int throttleRate,
+		Detector::Result &result, string *appRoot)
+	{
+		Shard &shard = getShard(key);
+		time_t now = SystemTime::get();
+		boost::lock_guard<boost::mutex> l(shard.syncher);
+		const Entry *entry;
+
+		if (shard.entries.lookup(key, &entry)
+		 && (unsigned int) (now - entry->checkedAt) < throttleRate)
+		{
+			result = entry->result;
+			if (appRoot != NULL) {
+				*appRoot = entry->appRoot;
+			}
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	void insert(const HashedStaticString &key, time_t checkedAt,
+		const Detector::Result &result, const string *appRoot)
+	{
+		Shard &shard = getShard(key);
+		Entry entry;
+
+		entry.result = result;
+		if (appRoot != NULL) {
+			entry.appRoot = *appRoot;
+		}
+		entry.checkedAt = checkedAt;
+
+		boost::lock_guard<boost::mutex> l(shard.syncher);
+		if (shard.entries.size() >= MAX_ENTRIES_PER_SHARD
+		 && !shard.entries.contains(key))
+		{
+			shard.entries.clear();
+		}
+		shard.entries.insert(key, entry);
+	}
+
+	static string makeKey(char type, const StaticString &dir) {
+		string key;
+		key.reserve(dir.size() + 1);
+		key.append(1, type);
+		key.append(dir.data(), dir.size());
+		return key;
+	}
+
+public:
+	/**
+	 * Cached version of `detector.checkDocumentRoot()`.
+	 *
+	 * @throws FileSystemException
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	Detector::Result checkDocumentRoot(Detector &detector,
+		unsigned int throttleRate, const StaticString &documentRoot,
+		bool resolveFirstSymlink = false, string *appRoot = NULL)
+	{
+		string keyString(makeKey(resolveFirstSymlink ? 'S' : 'D', documentRoot));
+		HashedStaticString key(keyString);
+		Detector::Result result;
+
+		if (!lookup(key, throttleRate, result, appRoot)) {
+			time_t checkedAt = SystemTime::get();
+			string detectedAppRoot;
+			result = detector.checkDocumentRoot(documentRoot,
+				resolveFirstSymlink, &detectedAppRoot);
+			if (throttleRate > 0) {
+				insert(key, checkedAt, result, &detectedAppRoot);
+			}
+			if (appRoot != NULL) {
+				*appRoot = detectedAppRoot;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Cached version of `detector.checkAppRoot()`.
+	 *
+	 * @throws FileSystemException
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	Detector::Result checkAppRoot(Detector &detector,
+		unsigned int throttleRate, const StaticString &appRoot)
+	{
+		string keyString(makeKey('R', appRoot));
+		HashedStaticString key(keyString);
+		Detector::Result result;
+
+		if (!lookup(key, throttleRate, result, NULL)) {
+			time_t checkedAt = SystemTime::get();
+			result = detector.checkAppRoot(appRoot);
+			if (throttleRate > 0) {
+				insert(key, checkedAt, result, NULL);
+			}
+		}
+		return result;
+	}
+
+	void clear() {
+		for (unsigned int i = 0; i < SHARD_COUNT; i++) {
+			boost::lock_guard<boost::mutex> l(shards[i].syncher);
+			shards[i].entries.clear();
+		}
+	}
+};
+
+
+} // namespace AppTypeDetector
+} // namespace Passenger
+
+#endif /* _PASSENGER_APP_TYPE_DETECTOR_RESULT_CACHE_H_ */
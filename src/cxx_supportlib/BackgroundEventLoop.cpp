@@ -29,6 +29,7 @@
 #include <boost/bind/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/atomic.hpp>
 #include <oxt/thread.hpp>
 #include <oxt/backtrace.hpp>
 #include <oxt/system_calls.hpp>
@@ -39,6 +40,7 @@
 #include <LoggingKit/LoggingKit.h>
 #include <Exceptions.h>
 #include <SafeLibev.h>
+#include <SystemTools/SystemTime.h>
 
 #ifndef HAVE_KQUEUE
 	#if defined(__APPLE__) || \
@@ -94,6 +96,8 @@ using namespace oxt;
 struct BackgroundEventLoopPrivate {
 	struct ev_async exitSignaller;
 	struct ev_async libuvActivitySignaller;
+	struct ev_prepare heartbeatPrepareWatcher;
+	struct ev_check heartbeatCheckWatcher;
 	uv_loop_t libuv_loop;
 	/**
 	 * Coordinates communication between the libuv poller thread and the
@@ -110,6 +114,11 @@ struct BackgroundEventLoopPrivate {
 	oxt::thread *thr;
 	oxt::thread *libuvPollerThr;
 	uv_barrier_t startBarrier;
+	/**
+	 * The monotonic time at which the event loop started processing
+	 * the current batch of events, or 0 if it is waiting for events.
+	 */
+	boost::atomic<MonotonicTimeUsec> iterationStartedAt;
 
 	bool usesLibuv;
 	bool started;
@@ -137,6 +146,20 @@ onLibuvActivity(struct ev_loop *loop, ev_async *async, int revents) {
 	uv_sem_post(&bg->priv->libuv_sem);
 }
 
+static void
+onHeartbeatPrepare(struct ev_loop *loop, ev_prepare *watcher, int revents) {
+	BackgroundEventLoop *bg = (BackgroundEventLoop *) watcher->data;
+	bg->priv->iterationStartedAt.store(0, boost::memory_order_relaxed);
+}
+
+static void
+onHeartbeatCheck(struct ev_loop *loop, ev_check *watcher, int revents) {
+	BackgroundEventLoop *bg = (BackgroundEventLoop *) watcher->data;
+	bg->priv->iterationStartedAt.store(
+		SystemTime::getMonotonicUsecWithGranularity<SystemTime::GRAN_1MSEC>(),
+		boost::memory_order_relaxed);
+}
+
 static void
 doNothing(uv_timer_t *timer) {
 	// Do nothing
@@ -151,6 +174,7 @@ runBackgroundLoop(BackgroundEventLoop *bg) {
 	}
 	uv_barrier_wait(&bg->priv->startBarrier);
 	ev_run(bg->libev_loop, 0);
+	bg->priv->iterationStartedAt.store(0, boost::memory_order_relaxed);
 }
 
 static void
@@ -275,6 +299,13 @@ BackgroundEventLoop::BackgroundEventLoop(bool scalable, bool usesLibuv)
 	P_LOG_FILE_DESCRIPTOR_OPEN2(ev_loop_get_pipe(libev_loop, 0), "libev event loop: async pipe 0");
 	P_LOG_FILE_DESCRIPTOR_OPEN2(ev_loop_get_pipe(libev_loop, 1), "libev event loop: async pipe 1");
 	priv->exitSignaller.data = this;
+	ev_prepare_init(&priv->heartbeatPrepareWatcher, onHeartbeatPrepare);
+	priv->heartbeatPrepareWatcher.data = this;
+	ev_check_init(&priv->heartbeatCheckWatcher, onHeartbeatCheck);
+	// Make sure that the check watcher is invoked before any other
+	// watchers in the same iteration, including those of ev_async.
+	ev_set_priority(&priv->heartbeatCheckWatcher, EV_MAXPRI);
+	priv->heartbeatCheckWatcher.data = this;
 	safe = boost::make_shared<SafeLibev>(libev_loop);
 
 	uv_barrier_init(&priv->startBarrier, usesLibuv ? 3 : 2);
@@ -294,6 +325,7 @@ BackgroundEventLoop::BackgroundEventLoop(bool scalable, bool usesLibuv)
 
 	priv->thr = NULL;
 	priv->libuvPollerThr = NULL;
+	priv->iterationStartedAt.store(0, boost::memory_order_relaxed);
 	priv->usesLibuv = usesLibuv;
 	priv->started = false;
 	guard.clear();
@@ -319,6 +351,12 @@ BackgroundEventLoop::~BackgroundEventLoop() {
 	if (ev_is_active(&priv->exitSignaller)) {
 		ev_async_stop(libev_loop, &priv->exitSignaller);
 	}
+	if (ev_is_active(&priv->heartbeatPrepareWatcher)) {
+		ev_prepare_stop(libev_loop, &priv->heartbeatPrepareWatcher);
+	}
+	if (ev_is_active(&priv->heartbeatCheckWatcher)) {
+		ev_check_stop(libev_loop, &priv->heartbeatCheckWatcher);
+	}
 	uv_barrier_destroy(&priv->startBarrier);
 	delete priv;
 }
@@ -327,6 +365,8 @@ void
 BackgroundEventLoop::start(const string &threadName, unsigned int stackSize) {
 	assert(priv->thr == NULL);
 	ev_async_start(libev_loop, &priv->exitSignaller);
+	ev_prepare_start(libev_loop, &priv->heartbeatPrepareWatcher);
+	ev_check_start(libev_loop, &priv->heartbeatCheckWatcher);
 	if (priv->usesLibuv) {
 		ev_async_start(libev_loop, &priv->libuvActivitySignaller);
 	}
@@ -370,5 +410,15 @@ BackgroundEventLoop::getNativeHandle() const {
 	return priv->thr->native_handle();
 }
 
+MonotonicTimeUsec
+BackgroundEventLoop::getIterationStartTime() const {
+	return priv->iterationStartedAt.load(boost::memory_order_relaxed);
+}
+
+string
+BackgroundEventLoop::getBacktrace() const {
+	return priv->thr->backtrace();
+}
+
 
 } // namespace Passenger
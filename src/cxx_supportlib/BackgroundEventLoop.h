@@ -29,6 +29,7 @@
 #include <boost/shared_ptr.hpp>
 #include <string>
 #include <pthread.h>
+#include <SystemTools/SystemTime.h>
 
 extern "C" {
 	struct ev_loop;
@@ -58,6 +59,20 @@ namespace Passenger {
 		void stop();
 		bool isStarted() const;
 		pthread_t getNativeHandle() const;
+
+		/**
+		 * Returns the monotonic time at which the event loop thread started
+		 * processing its current batch of events, or 0 if it is waiting for
+		 * events (or not running). A value that lies far in the past means
+		 * that the event loop is blocked. Thread-safe.
+		 */
+		MonotonicTimeUsec getIterationStartTime() const;
+
+		/**
+		 * Returns the oxt tracepoint backtrace of the event loop thread.
+		 * Thread-safe, but the loop must be started.
+		 */
+		string getBacktrace() const;
 	};
 
 }
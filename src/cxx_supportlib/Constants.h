@@ -50,6 +50,8 @@
 #define DEFAULT_APP_THREAD_COUNT 1
 #define DEFAULT_BIND_ADDRESS "127.0.0.1"
 #define DEFAULT_CONCURRENCY_MODEL "process"
+#define DEFAULT_EVENT_LOOP_STALL_LOG_INTERVAL 60
+#define DEFAULT_EVENT_LOOP_STALL_THRESHOLD 1000
 #define DEFAULT_FILE_BUFFERED_CHANNEL_THRESHOLD 131072
 #define DEFAULT_HTTP_SERVER_LISTEN_ADDRESS "tcp://127.0.0.1:3000"
 #define DEFAULT_INTEGRATION_MODE "standalone"
@@ -63,6 +65,7 @@
 #define DEFAULT_NODEJS "node"
 #define DEFAULT_POOL_IDLE_TIME 300
 #define DEFAULT_PYTHON "python"
+#define DEFAULT_REQUEST_TRACE_BUFFER_SIZE 4096
 #define DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK 134217728
 #define DEFAULT_RUBY "ruby"
 #define DEFAULT_SOCKET_BACKLOG 2048
@@ -102,6 +105,7 @@
 #define SHORT_PROGRAM_NAME "Passenger"
 #define SPAWNINGKIT_MAX_ERROR_CATEGORY_SIZE 32
 #define SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE 32
+#define SPAWNINGKIT_MAX_JOURNEY_STEP_RECORD_SIZE 256
 #define SPAWNINGKIT_MAX_PROPERTIES_JSON_SIZE 32768
 #define SPAWNINGKIT_MAX_SUBPROCESS_ENVDUMP_SIZE 131072
 #define SPAWNINGKIT_MAX_SUBPROCESS_ERROR_MESSAGE_SIZE 131072
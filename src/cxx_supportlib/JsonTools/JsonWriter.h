@@ -0,0 +1,402 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_JSON_TOOLS_JSON_WRITER_H_
+#define _PASSENGER_JSON_TOOLS_JSON_WRITER_H_
+
+#include <string>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <jsoncpp/json.h>
+#include <StaticString.h>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * Writes JSON text incrementally into `Output`, which can be any type with an
+ * `append(const char *data, size_t size)` method, such as `std::string`.
+ *
+ * Building a Json::Value tree and serializing it allocates a node for every
+ * value and then copies everything once more. When inspecting large data
+ * structures, such as all clients of a server, writing the text directly
+ * takes linear time and no memory besides the output itself.
+ *
+ *     string str;
+ *     JsonWriter writer(str);
+ *     writer.beginObject();
+ *     writer.key("pid");
+ *     writer.value(getpid());
+ *     writer.key("memory");
+ *     writer.value(inspectMemoryUsageAsJson()); // Json::Value
+ *     writer.endObject();
+ *
+ * Commas are inserted automatically. Nesting is only verified with assertions.
+ *
+ * By default the output is compact: it contains no whitespace. Output meant
+ * for humans, such as `passenger-status --show=server` and state dumps, can
+ * be indented by passing `true` as `pretty`.
+ */
+template<typename Output>
+class BasicJsonWriter {
+private:
+	Output &output;
+	unsigned int depth;
+	bool needComma;
+	bool afterKey;
+	bool pretty;
+
+	void write(const char *data, size_t size) {
+		output.append(data, size);
+	}
+
+	void write(char ch) {
+		output.append(&ch, 1);
+	}
+
+	void writeNewline(unsigned int level) {
+		write('\n');
+		for (unsigned int i = 0; i < level; i++) {
+			write("   ", 3);
+		}
+	}
+
+	void prepareValue() {
+		if (needComma) {
+			write(',');
+		}
+		if (afterKey) {
+			afterKey = false;
+		} else if (pretty && depth > 0) {
+			writeNewline(depth);
+		}
+	}
+
+	void endContainer(char ch) {
+		assert(depth > 0);
+		depth--;
+		if (pretty && needComma) {
+			// Non-empty containers end on their own line.
+			writeNewline(depth);
+		}
+		write(ch);
+		valueWritten();
+	}
+
+	void valueWritten() {
+		needComma = true;
+	}
+
+	template<typename IntegerType>
+	void writeUnsigned(IntegerType value) {
+		char buf[24];
+		char *end = buf + sizeof(buf);
+		char *pos = end;
+
+		do {
+			*--pos = '0' + (char) (value % 10);
+			value /= 10;
+		} while (value != 0);
+		write(pos, end - pos);
+	}
+
+	template<typename UnsignedType, typename IntegerType>
+	void writeSigned(IntegerType value) {
+		if (value < 0) {
+			write('-');
+			// Correct for the most negative value, too.
+			writeUnsigned<UnsignedType>(UnsignedType(0) - (UnsignedType) value);
+		} else {
+			writeUnsigned<UnsignedType>((UnsignedType) value);
+		}
+	}
+
+	void writeString(const char *data, size_t size) {
+		static const char hex[] = "0123456789abcdef";
+		const char *end = data + size;
+		const char *unescaped = data;
+
+		write('"');
+		for (const char *pos = data; pos < end; pos++) {
+			unsigned char ch = (unsigned char) *pos;
+			const char *escape;
+
+			if (ch >= 0x20 && ch != '"' && ch != '\\') {
+				continue;
+			}
+
+			write(unescaped, pos - unescaped);
+			unescaped = pos + 1;
+			switch (ch) {
+			case '"':
+				escape = "\\\"";
+				break;
+			case '\\':
+				escape = "\\\\";
+				break;
+			case '\b':
+				escape = "\\b";
+				break;
+			case '\f':
+				escape = "\\f";
+				break;
+			case '\n':
+				escape = "\\n";
+				break;
+			case '\r':
+				escape = "\\r";
+				break;
+			case '\t':
+				escape = "\\t";
+				break;
+			default:
+				escape = NULL;
+				break;
+			}
+			if (escape != NULL) {
+				write(escape, 2);
+			} else {
+				char buf[6] = { '\\', 'u', '0', '0', hex[ch >> 4], hex[ch & 0xf] };
+				write(buf, sizeof(buf));
+			}
+		}
+		write(unescaped, end - unescaped);
+		write('"');
+	}
+
+public:
+	BasicJsonWriter(Output &_output, bool _pretty = false)
+		: output(_output),
+		  depth(0),
+		  needComma(false),
+		  afterKey(false),
+		  pretty(_pretty)
+		{ }
+
+	void beginObject() {
+		prepareValue();
+		write('{');
+		depth++;
+		needComma = false;
+	}
+
+	void endObject() {
+		endContainer('}');
+	}
+
+	void beginArray() {
+		prepareValue();
+		write('[');
+		depth++;
+		needComma = false;
+	}
+
+	void endArray() {
+		endContainer(']');
+	}
+
+	void key(const StaticString &name) {
+		assert(depth > 0);
+		prepareValue();
+		writeString(name.data(), name.size());
+		if (pretty) {
+			write(" : ", 3);
+		} else {
+			write(':');
+		}
+		needComma = false;
+		afterKey = true;
+	}
+
+	void value(const StaticString &str) {
+		prepareValue();
+		writeString(str.data(), str.size());
+		valueWritten();
+	}
+
+	void value(const char *str) {
+		value(StaticString(str));
+	}
+
+	void value(const string &str) {
+		value(StaticString(str));
+	}
+
+	void value(bool b) {
+		prepareValue();
+		if (b) {
+			write("true", 4);
+		} else {
+			write("false", 5);
+		}
+		valueWritten();
+	}
+
+	void value(int i) {
+		prepareValue();
+		writeSigned<unsigned int>(i);
+		valueWritten();
+	}
+
+	void value(unsigned int i) {
+		prepareValue();
+		writeUnsigned(i);
+		valueWritten();
+	}
+
+	void value(long i) {
+		prepareValue();
+		writeSigned<unsigned long>(i);
+		valueWritten();
+	}
+
+	void value(unsigned long i) {
+		prepareValue();
+		writeUnsigned(i);
+		valueWritten();
+	}
+
+	void value(long long i) {
+		prepareValue();
+		writeSigned<unsigned long long>(i);
+		valueWritten();
+	}
+
+	void value(unsigned long long i) {
+		prepareValue();
+		writeUnsigned(i);
+		valueWritten();
+	}
+
+	void value(double d) {
+		// Formatted like Json::Value, so that output doesn't change
+		// when porting code to this writer.
+		rawValue(Json::valueToString(d));
+	}
+
+	void nullValue() {
+		prepareValue();
+		write("null", 4);
+		valueWritten();
+	}
+
+	/**
+	 * Writes a Json::Value tree. This allows porting code incrementally: the
+	 * bulk of a document can be streamed while small parts are still built
+	 * as trees.
+	 */
+	void value(const Json::Value &doc) {
+		switch (doc.type()) {
+		case Json::nullValue:
+			nullValue();
+			break;
+		case Json::intValue:
+			value((long long) doc.asLargestInt());
+			break;
+		case Json::uintValue:
+			value((unsigned long long) doc.asLargestUInt());
+			break;
+		case Json::realValue:
+			value(doc.asDouble());
+			break;
+		case Json::stringValue: {
+			const char *begin, *end;
+			if (doc.getString(&begin, &end)) {
+				value(StaticString(begin, end - begin));
+			} else {
+				value(StaticString());
+			}
+			break;
+		}
+		case Json::booleanValue:
+			value(doc.asBool());
+			break;
+		case Json::arrayValue:
+			beginArray();
+			for (Json::ArrayIndex i = 0; i < doc.size(); i++) {
+				value(doc[i]);
+			}
+			endArray();
+			break;
+		case Json::objectValue:
+			beginObject();
+			members(doc);
+			endObject();
+			break;
+		}
+	}
+
+	/**
+	 * Writes the members of the given Json::Value object into the object
+	 * that is currently being written.
+	 */
+	void members(const Json::Value &object) {
+		Json::Value::const_iterator it, end = object.end();
+		for (it = object.begin(); it != end; it++) {
+			const char *nameEnd;
+			const char *name = it.memberName(&nameEnd);
+			key(StaticString(name, nameEnd - name));
+			value(*it);
+		}
+	}
+
+	/**
+	 * Writes a value that is already formatted as JSON. In pretty mode,
+	 * multi-line values (such as the output of another pretty writer) are
+	 * indented to the current nesting level.
+	 */
+	void rawValue(const StaticString &json) {
+		prepareValue();
+		if (pretty && depth > 0) {
+			const char *pos = json.data();
+			const char *end = json.data() + json.size();
+			const char *newline;
+
+			while ((newline = (const char *) memchr(pos, '\n', end - pos)) != NULL) {
+				write(pos, newline - pos);
+				writeNewline(depth);
+				pos = newline + 1;
+			}
+			write(pos, end - pos);
+		} else {
+			write(json.data(), json.size());
+		}
+		valueWritten();
+	}
+
+	unsigned int getDepth() const {
+		return depth;
+	}
+};
+
+typedef BasicJsonWriter<string> JsonWriter;
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_JSON_TOOLS_JSON_WRITER_H_ */
@@ -23,6 +23,8 @@
 #include <oxt/backtrace.hpp>
 #include <algorithm>
 #include <ostream>
+#include <cstdlib>
+#include <sys/mman.h>
 #include <MemoryKit/mbuf.h>
 #include <LoggingKit/LoggingKit.h>
 #include <StaticString.h>
@@ -73,14 +75,15 @@ _mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset)
 	 * mbuf_block header is at the tail end of the mbuf_block. The data
 	 * precedes the header. This enables us to catch buffer overrun early
 	 * by asserting on the magic value during get or put operations.
-	 * All normal mbuf_blocks in a pool have the same mbuf_block_offset,
-	 * allowing them to be reused through a freelist.
+	 * All normal mbuf_blocks in a size class have the same mbuf_block_offset,
+	 * allowing them to be reused through the size class's freelist. They are
+	 * carved out of a slab, back to back.
 	 *
-	 *   <------------ pool->mbuf_block_chunk_size -------------->
+	 *   <------------ class->mbuf_block_chunk_size ------------->
 	 *   +-------------------------------------------------------+
 	 *   |       mbuf_block data          |  mbuf_block header   |
 	 *   |                                |                      |
-	 *   |  (pool->mbuf_block_offset)     | (struct mbuf_block)  |
+	 *   |  (class->mbuf_block_offset)    | (struct mbuf_block)  |
 	 *   +-------------------------------------------------------+
 	 *   ^                                ^
 	 *   |                                |
@@ -113,56 +116,177 @@ _mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset)
 	mbuf_block = (struct mbuf_block *)(buf + block_offset);
 	mbuf_block->magic = MBUF_BLOCK_MAGIC;
 	mbuf_block->pool  = pool;
+	mbuf_block->slab  = NULL;
 	mbuf_block->offset = 0;
 
 	_mbuf_block_mark_as_active(pool, mbuf_block);
 	return mbuf_block;
 }
 
+/*
+ * Map memory for a slab. When huge pages are requested, we first try
+ * explicit huge pages, and fall back to normal pages that the kernel may
+ * transparently back with huge pages.
+ */
+static char *
+_mbuf_slab_map(size_t size, bool huge_pages)
+{
+	void *mem;
+
+	#ifdef MAP_HUGETLB
+		if (huge_pages) {
+			mem = mmap(NULL, size, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+			if (mem != MAP_FAILED) {
+				return (char *) mem;
+			}
+		}
+	#endif
+
+	mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+	if (OXT_UNLIKELY(mem == MAP_FAILED)) {
+		return NULL;
+	}
+	#ifdef MADV_HUGEPAGE
+		if (huge_pages) {
+			madvise(mem, size, MADV_HUGEPAGE);
+		}
+	#endif
+	return (char *) mem;
+}
+
+static struct mbuf_slab *
+_mbuf_slab_new(struct mbuf_pool *pool, unsigned int size_class)
+{
+	struct mbuf_size_class *cls = &pool->classes[size_class];
+	struct mbuf_slab *slab;
+	size_t unit, size;
+	char *start;
+
+	unit = pool->mbuf_huge_pages ? MBUF_HUGE_SLAB_SIZE : MBUF_SLAB_SIZE;
+	size = (cls->mbuf_block_chunk_size + unit - 1) / unit * unit;
+
+	slab = (struct mbuf_slab *) malloc(sizeof(struct mbuf_slab));
+	if (OXT_UNLIKELY(slab == NULL)) {
+		return NULL;
+	}
+	start = _mbuf_slab_map(size, pool->mbuf_huge_pages);
+	if (OXT_UNLIKELY(start == NULL)) {
+		free(slab);
+		return NULL;
+	}
+
+	slab->start = start;
+	slab->size = size;
+	slab->capacity = size / cls->mbuf_block_chunk_size;
+	slab->ncarved = 0;
+	slab->nactive = 0;
+	slab->size_class = size_class;
+	TAILQ_INSERT_HEAD(&cls->slabq, slab, next);
+	cls->nslabs++;
+	pool->slab_bytes += size;
+	return slab;
+}
+
+static void
+_mbuf_slab_free(struct mbuf_pool *pool, struct mbuf_slab *slab)
+{
+	struct mbuf_size_class *cls = &pool->classes[slab->size_class];
+
+	assert(slab->nactive == 0);
+	TAILQ_REMOVE(&cls->slabq, slab, next);
+	cls->nslabs--;
+	pool->slab_bytes -= slab->size;
+	munmap(slab->start, slab->size);
+	free(slab);
+}
+
+/*
+ * Carve a new chunk out of the size class's current slab, allocating
+ * a new slab if the current one is exhausted.
+ */
+static char *
+_mbuf_slab_carve(struct mbuf_pool *pool, unsigned int size_class,
+	struct mbuf_slab **result)
+{
+	struct mbuf_size_class *cls = &pool->classes[size_class];
+	struct mbuf_slab *slab = TAILQ_FIRST(&cls->slabq);
+	char *buf;
+
+	if (slab == NULL || slab->ncarved == slab->capacity) {
+		slab = _mbuf_slab_new(pool, size_class);
+		if (OXT_UNLIKELY(slab == NULL)) {
+			return NULL;
+		}
+	}
+
+	buf = slab->start + (size_t) slab->ncarved * cls->mbuf_block_chunk_size;
+	slab->ncarved++;
+	*result = slab;
+	return buf;
+}
+
 static struct mbuf_block *
-_mbuf_block_get(struct mbuf_pool *pool)
+_mbuf_block_get(struct mbuf_pool *pool, unsigned int size_class)
 {
+	struct mbuf_size_class *cls = &pool->classes[size_class];
 	struct mbuf_block *mbuf_block;
+	struct mbuf_slab *slab;
 	char *buf;
 
-	if (!STAILQ_EMPTY(&pool->free_mbuf_blockq)) {
+	if (!STAILQ_EMPTY(&cls->free_mbuf_blockq)) {
+		assert(cls->nfree_mbuf_blockq > 0);
 		assert(pool->nfree_mbuf_blockq > 0);
 
-		mbuf_block = STAILQ_FIRST(&pool->free_mbuf_blockq);
+		mbuf_block = STAILQ_FIRST(&cls->free_mbuf_blockq);
 		ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->magic == MBUF_BLOCK_MAGIC);
 		ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->refcount == 0);
 
+		cls->nfree_mbuf_blockq--;
 		pool->nfree_mbuf_blockq--;
-		STAILQ_REMOVE_HEAD(&pool->free_mbuf_blockq, next);
+		STAILQ_REMOVE_HEAD(&cls->free_mbuf_blockq, next);
 		_mbuf_block_mark_as_active(pool, mbuf_block);
-		return mbuf_block;
-	}
+	} else {
+		buf = _mbuf_slab_carve(pool, size_class, &slab);
+		if (OXT_UNLIKELY(buf == NULL)) {
+			return NULL;
+		}
 
-	buf = (char *) malloc(pool->mbuf_block_chunk_size);
-	if (OXT_UNLIKELY(buf == NULL)) {
-		return NULL;
+		mbuf_block = _mbuf_block_init(pool, buf, cls->mbuf_block_offset);
+		mbuf_block->slab = slab;
 	}
 
-	return _mbuf_block_init(pool, buf, pool->mbuf_block_offset);
+	mbuf_block->slab->nactive++;
+	cls->nactive_mbuf_blockq++;
+	return mbuf_block;
 }
 
 struct mbuf_block *
 mbuf_block_get(struct mbuf_pool *pool)
+{
+	return mbuf_block_get_with_class(pool, 0);
+}
+
+struct mbuf_block *
+mbuf_block_get_with_class(struct mbuf_pool *pool, unsigned int size_class)
 {
 	struct mbuf_block *mbuf_block;
+	size_t block_offset;
 	char *buf;
 
-	mbuf_block = _mbuf_block_get(pool);
+	assert(size_class < MBUF_POOL_NCLASSES);
+	mbuf_block = _mbuf_block_get(pool, size_class);
 	if (OXT_UNLIKELY(mbuf_block == NULL)) {
 		return NULL;
 	}
 
-	buf = (char *)mbuf_block - pool->mbuf_block_offset;
+	block_offset = pool->classes[size_class].mbuf_block_offset;
+	buf = (char *)mbuf_block - block_offset;
 	mbuf_block->start = buf;
-	mbuf_block->end = buf + pool->mbuf_block_offset;
+	mbuf_block->end = buf + block_offset;
 
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block,
-		mbuf_block->end - mbuf_block->start == (int) pool->mbuf_block_offset);
+		mbuf_block->end - mbuf_block->start == (int) block_offset);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->start < mbuf_block->end);
 
 	#ifdef MBUF_DEBUG_REFCOUNTS
@@ -189,6 +313,8 @@ mbuf_block_new_standalone(struct mbuf_pool *pool, size_t size)
 	mbuf_block->start = buf;
 	mbuf_block->end = buf + size;
 	mbuf_block->offset = block_offset;
+	pool->nactive_standalone_mbuf_blockq++;
+	pool->active_standalone_bytes += MBUF_BLOCK_HSIZE + block_offset;
 
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block,
 		mbuf_block->end - mbuf_block->start == (int) size);
@@ -221,11 +347,9 @@ mbuf_block_free(struct mbuf_block *mbuf_block)
 		free(mbuf_block->backtrace);
 	#endif
 
-	if (mbuf_block->offset > 0) {
-		buf = (char *) mbuf_block - mbuf_block->offset;
-	} else {
-		buf = (char *) mbuf_block - mbuf_block->pool->mbuf_block_offset;
-	}
+	/* Normal mbuf_blocks are only freed together with their slab. */
+	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->offset > 0);
+	buf = (char *) mbuf_block - mbuf_block->offset;
 	free(buf);
 }
 
@@ -241,28 +365,23 @@ mbuf_block_put(struct mbuf_block *mbuf_block)
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->refcount == 0);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->pool->nactive_mbuf_blockq > 0);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->offset == 0);
+	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->slab->nactive > 0);
+
+	struct mbuf_pool *pool = mbuf_block->pool;
+	struct mbuf_size_class *cls = &pool->classes[mbuf_block->slab->size_class];
 
-	mbuf_block->pool->nfree_mbuf_blockq++;
-	mbuf_block->pool->nactive_mbuf_blockq--;
-	STAILQ_INSERT_HEAD(&mbuf_block->pool->free_mbuf_blockq, mbuf_block, next);
+	mbuf_block->slab->nactive--;
+	cls->nfree_mbuf_blockq++;
+	cls->nactive_mbuf_blockq--;
+	pool->nfree_mbuf_blockq++;
+	pool->nactive_mbuf_blockq--;
+	STAILQ_INSERT_HEAD(&cls->free_mbuf_blockq, mbuf_block, next);
 
 	#ifdef MBUF_ENABLE_DEBUGGING
 		TAILQ_REMOVE(&mbuf_block->pool->active_mbuf_blockq, mbuf_block, active_q);
 	#endif
 }
 
-/*
- * Remove mbuf_block from the mhdr Q
- */
-static void
-mbuf_block_remove(struct mhdr *mhdr, struct mbuf_block *mbuf_block)
-{
-	//log_debug(LOG_VVERB, "remove mbuf_block %p", mbuf_block);
-
-	STAILQ_REMOVE(mhdr, mbuf_block, struct mbuf_block, next);
-	STAILQ_NEXT(mbuf_block, next) = NULL;
-}
-
 void
 _mbuf_block_assert_refcount_at_least_two(struct mbuf_block *mbuf_block) {
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->refcount >= 2);
@@ -271,9 +390,28 @@ _mbuf_block_assert_refcount_at_least_two(struct mbuf_block *mbuf_block) {
 void
 mbuf_pool_init(struct mbuf_pool *pool)
 {
+	size_t chunk_size = pool->mbuf_block_chunk_size;
+
 	pool->nfree_mbuf_blockq = 0;
 	pool->nactive_mbuf_blockq = 0;
-	STAILQ_INIT(&pool->free_mbuf_blockq);
+	pool->nactive_standalone_mbuf_blockq = 0;
+	pool->active_standalone_bytes = 0;
+	pool->slab_bytes = 0;
+	pool->mbuf_huge_pages = false;
+
+	for (unsigned int i = 0; i < MBUF_POOL_NCLASSES; i++) {
+		struct mbuf_size_class *cls = &pool->classes[i];
+
+		cls->nfree_mbuf_blockq = 0;
+		cls->nactive_mbuf_blockq = 0;
+		cls->nslabs = 0;
+		STAILQ_INIT(&cls->free_mbuf_blockq);
+		TAILQ_INIT(&cls->slabq);
+		cls->mbuf_block_chunk_size = chunk_size;
+		cls->mbuf_block_offset = chunk_size - MBUF_BLOCK_HSIZE;
+		chunk_size = std::min<size_t>(chunk_size * MBUF_CLASS_FACTOR,
+			MBUF_BLOCK_MAX_SIZE);
+	}
 
 	#ifdef MBUF_ENABLE_DEBUGGING
 		TAILQ_INIT(&pool->active_mbuf_blockq);
@@ -289,31 +427,127 @@ mbuf_pool_deinit(struct mbuf_pool *pool)
 }
 
 /*
- * Return the maximum available space size for data in any mbuf_block. Mbuf cannot
- * contain more than 2^32 bytes (4G).
+ * Return the maximum available space size for data in any mbuf_block of the
+ * smallest size class. Mbuf cannot contain more than 2^32 bytes (4G).
  */
 size_t
-mbuf_pool_data_size(struct mbuf_pool *pool)
+mbuf_pool_data_size(const struct mbuf_pool *pool)
 {
 	return pool->mbuf_block_offset;
 }
 
+size_t
+mbuf_pool_class_data_size(struct mbuf_pool *pool, unsigned int size_class)
+{
+	assert(size_class < MBUF_POOL_NCLASSES);
+	return pool->classes[size_class].mbuf_block_offset;
+}
+
+/*
+ * Return the maximum available space size for data in any mbuf_block of the
+ * largest size class. Larger data needs a standalone mbuf_block.
+ */
+size_t
+mbuf_pool_max_data_size(struct mbuf_pool *pool)
+{
+	return pool->classes[MBUF_POOL_NCLASSES - 1].mbuf_block_offset;
+}
+
+/*
+ * Return the smallest size class whose mbuf_blocks can contain `size` bytes,
+ * or MBUF_POOL_NCLASSES if none can.
+ */
+unsigned int
+mbuf_pool_size_class_for(struct mbuf_pool *pool, size_t size)
+{
+	unsigned int i;
+
+	for (i = 0; i < MBUF_POOL_NCLASSES; i++) {
+		if (size <= pool->classes[i].mbuf_block_offset) {
+			break;
+		}
+	}
+	return i;
+}
+
+/*
+ * Release the slabs in which all mbuf_blocks are free. Returns the number of
+ * free mbuf_blocks released that way. Free mbuf_blocks in slabs that still
+ * contain active ones stay in the freelist.
+ */
 unsigned int
 mbuf_pool_compact(struct mbuf_pool *pool)
 {
-	unsigned int count = pool->nfree_mbuf_blockq;
+	unsigned int count = 0;
+
+	for (unsigned int i = 0; i < MBUF_POOL_NCLASSES; i++) {
+		struct mbuf_size_class *cls = &pool->classes[i];
+		struct mbuf_slab *slab, *next_slab;
+		struct mhdr kept;
+
+		STAILQ_INIT(&kept);
+		while (!STAILQ_EMPTY(&cls->free_mbuf_blockq)) {
+			struct mbuf_block *mbuf_block = STAILQ_FIRST(&cls->free_mbuf_blockq);
+			STAILQ_REMOVE_HEAD(&cls->free_mbuf_blockq, next);
+			if (mbuf_block->slab->nactive == 0) {
+				cls->nfree_mbuf_blockq--;
+				pool->nfree_mbuf_blockq--;
+				count++;
+			} else {
+				STAILQ_INSERT_TAIL(&kept, mbuf_block, next);
+			}
+		}
+		STAILQ_CONCAT(&cls->free_mbuf_blockq, &kept);
 
-	while (!STAILQ_EMPTY(&pool->free_mbuf_blockq)) {
-		struct mbuf_block *mbuf_block = STAILQ_FIRST(&pool->free_mbuf_blockq);
-		mbuf_block_remove(&pool->free_mbuf_blockq, mbuf_block);
-		mbuf_block_free(mbuf_block);
-		pool->nfree_mbuf_blockq--;
+		TAILQ_FOREACH_SAFE(slab, &cls->slabq, next, next_slab) {
+			if (slab->nactive == 0) {
+				_mbuf_slab_free(pool, slab);
+			}
+		}
 	}
-	assert(pool->nfree_mbuf_blockq == 0);
 
 	return count;
 }
 
+/*
+ * Return the memory used by active mbuf_blocks, both normal and standalone ones.
+ */
+size_t
+mbuf_pool_active_bytes(const struct mbuf_pool *pool)
+{
+	size_t result = pool->active_standalone_bytes;
+	for (unsigned int i = 0; i < MBUF_POOL_NCLASSES; i++) {
+		result += (size_t) pool->classes[i].nactive_mbuf_blockq
+			* pool->classes[i].mbuf_block_chunk_size;
+	}
+	return result;
+}
+
+/*
+ * Return the memory used by free mbuf_blocks. mbuf_pool_compact() releases
+ * the ones whose slab contains no active mbuf_blocks.
+ */
+size_t
+mbuf_pool_spare_bytes(const struct mbuf_pool *pool)
+{
+	size_t result = 0;
+	for (unsigned int i = 0; i < MBUF_POOL_NCLASSES; i++) {
+		result += (size_t) pool->classes[i].nfree_mbuf_blockq
+			* pool->classes[i].mbuf_block_chunk_size;
+	}
+	return result;
+}
+
+/*
+ * Return the memory reserved by slabs, including the parts that no
+ * mbuf_block has been carved out of yet.
+ */
+size_t
+mbuf_pool_slab_bytes(const struct mbuf_pool *pool)
+{
+	return pool->slab_bytes;
+}
+
 
 void
 mbuf_block_ref(struct mbuf_block *mbuf_block)
@@ -353,7 +587,12 @@ mbuf_block_unref(struct mbuf_block *mbuf_block)
 	if (mbuf_block->refcount == 0) {
 		if (mbuf_block->offset > 0) {
 			ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->pool->nactive_mbuf_blockq > 0);
+			ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block,
+				mbuf_block->pool->nactive_standalone_mbuf_blockq > 0);
 			mbuf_block->pool->nactive_mbuf_blockq--;
+			mbuf_block->pool->nactive_standalone_mbuf_blockq--;
+			mbuf_block->pool->active_standalone_bytes -=
+				MBUF_BLOCK_HSIZE + mbuf_block->offset;
 			mbuf_block_free(mbuf_block);
 		} else {
 			mbuf_block_put(mbuf_block);
@@ -379,12 +618,29 @@ mbuf_get(struct mbuf_pool *pool)
 	return mbuf(block, 0, block->end - block->start, mbuf::just_created_t());
 }
 
+mbuf
+mbuf_get_with_class(struct mbuf_pool *pool, unsigned int size_class)
+{
+	struct mbuf_block *block = mbuf_block_get_with_class(pool, size_class);
+	if (OXT_UNLIKELY(block == NULL)) {
+		return mbuf();
+	}
+
+	ASSERT_MBUF_BLOCK_PROPERTY(block, block->refcount == 1);
+	return mbuf(block, 0, block->end - block->start, mbuf::just_created_t());
+}
+
+/*
+ * Return an mbuf of exactly `size` bytes, backed by an mbuf_block of the
+ * smallest size class that fits, or by a standalone mbuf_block.
+ */
 mbuf
 mbuf_get_with_size(struct mbuf_pool *pool, size_t size)
 {
 	struct mbuf_block *block;
-	if (size <= mbuf_pool_data_size(pool)) {
-		block = mbuf_block_get(pool);
+	unsigned int size_class = mbuf_pool_size_class_for(pool, size);
+	if (size_class < MBUF_POOL_NCLASSES) {
+		block = mbuf_block_get_with_class(pool, size_class);
 	} else {
 		block = mbuf_block_new_standalone(pool, size);
 	}
@@ -408,6 +664,7 @@ mbuf_block_print(struct mbuf_block *mbuf_block, std::ostream &stream)
 			mbuf_block->end - mbuf_block->start)) << "\"\n"
 		"mbuf_block.refcount: " << mbuf_block->refcount << "\n"
 		"mbuf_block.offset: " << mbuf_block->offset << "\n"
+		"mbuf_block.slab: " << (void *) mbuf_block->slab << "\n"
 		"mbuf_block.pool: " << (void *) mbuf_block->pool << "\n"
 		"mbuf_block.pool.nfree_mbuf_blockq: " << mbuf_block->pool->nfree_mbuf_blockq << "\n"
 		"mbuf_block.pool.nactive_mbuf_blockq: " << mbuf_block->pool->nactive_mbuf_blockq << "\n"
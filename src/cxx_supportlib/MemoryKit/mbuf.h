@@ -54,6 +54,13 @@
  * This approach is similar to how Node.js manages buffer slices.
  * We also got rid of the global variables, and put them in an mbuf_pool
  * struct, which acts like a context structure.
+ *
+ * Normal mbuf_blocks are not malloc()ed individually, but carved out of
+ * large slabs. A pool has MBUF_POOL_NCLASSES size classes, each one
+ * MBUF_CLASS_FACTOR times as large as the previous one, starting at
+ * mbuf_block_chunk_size. Every size class has its own freelist and slabs.
+ * Slabs are optionally backed by huge pages to reduce TLB pressure. A slab
+ * is only released by mbuf_pool_compact() once all its mbuf_blocks are free.
  */
 
 //#define MBUF_ENABLE_DEBUGGING
@@ -67,6 +74,7 @@ using namespace boost;
 
 
 struct mbuf_block;
+struct mbuf_slab;
 struct mhdr;
 
 typedef void (*mbuf_block_copy_t)(struct mbuf_block *, void *);
@@ -84,25 +92,56 @@ struct mbuf_block {
 	char              *start;     /* start of buffer (const) */
 	char              *end;       /* end of buffer (const) */
 	struct mbuf_pool  *pool;      /* containing pool (const) */
+	struct mbuf_slab  *slab;      /* containing slab, NULL if standalone (const) */
 	boost::uint32_t    refcount;  /* number of references by mbuf subsets */
 	boost::uint32_t    offset;    /* standalone mbuf_block data size */
 };
 
+/* A contiguous memory region that normal mbuf_blocks of a single size class are carved from. */
+struct mbuf_slab {
+	TAILQ_ENTRY(struct mbuf_slab) next; /* next slab in the same size class */
+	char              *start;      /* start of slab memory (const) */
+	size_t             size;       /* size of slab memory (const) */
+	boost::uint32_t    capacity;   /* # mbuf_blocks that fit in the slab (const) */
+	boost::uint32_t    ncarved;    /* # mbuf_blocks carved out so far */
+	boost::uint32_t    nactive;    /* # carved mbuf_blocks that are not free */
+	boost::uint8_t     size_class; /* size class of the mbuf_blocks (const) */
+};
+
 STAILQ_HEAD(mhdr, struct mbuf_block);
+TAILQ_HEAD(mbuf_slab_list, struct mbuf_slab);
 #ifdef MBUF_ENABLE_DEBUGGING
 	TAILQ_HEAD(active_mbuf_block_list, struct mbuf_block);
 #endif
 
-struct mbuf_pool {
+struct mbuf_size_class {
 	boost::uint32_t nfree_mbuf_blockq;   /* # free mbuf_block */
-	boost::uint32_t nactive_mbuf_blockq; /* # active (non-free) mbuf_block */
-	struct mhdr free_mbuf_blockq; /* free mbuf_block q */
+	boost::uint32_t nactive_mbuf_blockq; /* # active mbuf_block */
+	boost::uint32_t nslabs;              /* # slabs */
+	struct mhdr free_mbuf_blockq;        /* free mbuf_block q */
+	struct mbuf_slab_list slabq;         /* slab q, the one being carved first */
+
+	size_t mbuf_block_chunk_size; /* mbuf_block chunk size - header + data (const) */
+	size_t mbuf_block_offset;     /* mbuf_block offset in chunk (const) */
+};
+
+#define MBUF_POOL_NCLASSES    3
+#define MBUF_CLASS_FACTOR     4
+
+struct mbuf_pool {
+	boost::uint32_t nfree_mbuf_blockq;   /* # free mbuf_block, in all size classes */
+	boost::uint32_t nactive_mbuf_blockq; /* # active (non-free) mbuf_block, including standalone ones */
+	boost::uint32_t nactive_standalone_mbuf_blockq; /* # active standalone mbuf_block */
+	size_t active_standalone_bytes; /* memory used by active standalone mbuf_blocks */
+	size_t slab_bytes;              /* memory reserved by slabs */
+	struct mbuf_size_class classes[MBUF_POOL_NCLASSES];
 	#ifdef MBUF_ENABLE_DEBUGGING
 		struct active_mbuf_block_list active_mbuf_blockq; /* active mbuf_block q */
 	#endif
 
-	size_t mbuf_block_chunk_size; /* mbuf_block chunk size - header + data (const) */
-	size_t mbuf_block_offset;     /* mbuf_block offset in chunk (const) */
+	size_t mbuf_block_chunk_size; /* mbuf_block chunk size of the smallest size class (const) */
+	size_t mbuf_block_offset;     /* mbuf_block offset in chunk of the smallest size class (const) */
+	bool   mbuf_huge_pages;       /* whether new slabs are backed by huge pages */
 };
 
 #define MBUF_BLOCK_MAGIC      0xdeadbeef
@@ -110,16 +149,25 @@ struct mbuf_pool {
 #define MBUF_BLOCK_MAX_SIZE   16777216
 #define MBUF_BLOCK_SIZE       16384
 #define MBUF_BLOCK_HSIZE      sizeof(struct mbuf_block)
+#define MBUF_SLAB_SIZE        262144
+#define MBUF_HUGE_SLAB_SIZE   2097152
 
 #define MBUF_BLOCK_EMPTY(mbuf_block) ((mbuf_block)->pos  == (mbuf_block)->last)
 #define MBUF_BLOCK_FULL(mbuf_block)  ((mbuf_block)->last == (mbuf_block)->end)
 
 void mbuf_pool_init(struct mbuf_pool *pool);
 void mbuf_pool_deinit(struct mbuf_pool *pool);
-size_t mbuf_pool_data_size(struct mbuf_pool *pool);
+size_t mbuf_pool_data_size(const struct mbuf_pool *pool);
+size_t mbuf_pool_class_data_size(struct mbuf_pool *pool, unsigned int size_class);
+size_t mbuf_pool_max_data_size(struct mbuf_pool *pool);
+unsigned int mbuf_pool_size_class_for(struct mbuf_pool *pool, size_t size);
 unsigned int mbuf_pool_compact(struct mbuf_pool *pool);
+size_t mbuf_pool_active_bytes(const struct mbuf_pool *pool);
+size_t mbuf_pool_spare_bytes(const struct mbuf_pool *pool);
+size_t mbuf_pool_slab_bytes(const struct mbuf_pool *pool);
 
 struct mbuf_block *mbuf_block_get(struct mbuf_pool *pool);
+struct mbuf_block *mbuf_block_get_with_class(struct mbuf_pool *pool, unsigned int size_class);
 void mbuf_block_put(struct mbuf_block *mbuf_block);
 
 void mbuf_block_ref(struct mbuf_block *mbuf_block);
@@ -279,6 +327,7 @@ public:
 
 mbuf mbuf_block_subset(struct mbuf_block *mbuf_block, unsigned int start, unsigned int len);
 mbuf mbuf_get(struct mbuf_pool *pool);
+mbuf mbuf_get_with_class(struct mbuf_pool *pool, unsigned int size_class);
 mbuf mbuf_get_with_size(struct mbuf_pool *pool, size_t size);
 
 
@@ -153,6 +153,13 @@ psg_reset_pool(psg_pool_t *pool, size_t size)
 }
 
 
+size_t
+psg_pool_size(const psg_pool_t *pool)
+{
+	return (size_t) (pool->data.end - (const char *) pool);
+}
+
+
 void *
 psg_palloc(psg_pool_t *pool, size_t size)
 {
@@ -268,6 +275,7 @@ psg_palloc_large(psg_pool_t *pool, size_t size)
 	for (large = pool->large; large; large = large->next) {
 		if (large->alloc == NULL) {
 			large->alloc = p;
+			large->size = size;
 			return p;
 		}
 
@@ -283,6 +291,7 @@ psg_palloc_large(psg_pool_t *pool, size_t size)
 	}
 
 	large->alloc = p;
+	large->size = size;
 	large->next = pool->large;
 	pool->large = large;
 
@@ -308,6 +317,7 @@ psg_pmemalign(psg_pool_t *pool, size_t size, size_t alignment)
 	}
 
 	large->alloc = p;
+	large->size = size;
 	large->next = pool->large;
 	pool->large = large;
 
@@ -363,3 +373,24 @@ psg_pcalloc(psg_pool_t *pool, size_t size)
 
 	return p;
 }
+
+
+void
+psg_pool_add_stats(const psg_pool_t *pool, psg_pool_stats_t *stats)
+{
+	const psg_pool_t        *p;
+	const psg_pool_large_t  *l;
+
+	for (p = pool; p; p = p->data.next) {
+		stats->blocks++;
+		stats->block_bytes += (size_t) (p->data.end - (const char *) p);
+		stats->used_bytes += (size_t) (p->data.last - (const char *) p);
+	}
+
+	for (l = pool->large; l; l = l->next) {
+		if (l->alloc) {
+			stats->large_allocations++;
+			stats->large_bytes += l->size;
+		}
+	}
+}
@@ -74,6 +74,7 @@ typedef struct psg_pool_large_s  psg_pool_large_t;
 typedef struct psg_pool_large_s {
 	psg_pool_large_s     *next;
 	void                 *alloc;
+	size_t                size;
 } psg_pool_large_t;
 
 typedef struct {
@@ -83,6 +84,15 @@ typedef struct {
 	unsigned int        failed;
 } psg_pool_data_t;
 
+/** Memory usage statistics, as returned by psg_pool_add_stats(). */
+typedef struct {
+	size_t  blocks;             /** Number of blocks, including the pool's first one. */
+	size_t  block_bytes;        /** Memory reserved by the blocks. */
+	size_t  used_bytes;         /** Memory allocated from the blocks. */
+	size_t  large_allocations;  /** Number of live large allocations. */
+	size_t  large_bytes;        /** Memory in live large allocations. */
+} psg_pool_stats_t;
+
 struct psg_pool_s {
 	psg_pool_data_t       data;
 
@@ -101,6 +111,11 @@ psg_pool_t *psg_create_pool(size_t size);
 void psg_destroy_pool(psg_pool_t *pool);
 bool psg_reset_pool(psg_pool_t *pool, size_t size);
 
+/** Returns the size with which the pool was created. psg_reset_pool() must
+ * be passed this same size.
+ */
+size_t psg_pool_size(const psg_pool_t *pool);
+
 /** Allocate `size` bytes from the pool, aligned on platform word size. */
 void *psg_palloc(psg_pool_t *pool, size_t size);
 
@@ -124,5 +139,11 @@ Passenger::StaticString psg_pstrdup(psg_pool_t *pool, const Passenger::StaticStr
  */
 bool  psg_pfree(psg_pool_t *pool, void *p);
 
+/** Adds the memory usage of the given pool to `stats`, so that the usage
+ * of multiple pools can be summed up. `stats` must be zero-initialized
+ * before the first call.
+ */
+void  psg_pool_add_stats(const psg_pool_t *pool, psg_pool_stats_t *stats);
+
 
 #endif /* _PASSENGER_MEMORY_KIT_PALLOC_H_INCLUDED_ */
@@ -38,6 +38,7 @@
 
 #include <ConfigKit/ConfigKit.h>
 #include <FileTools/PathManip.h>
+#include <StaticString.h>
 #include <Constants.h>
 #include <Utils.h>
 
@@ -47,6 +48,34 @@ namespace ServerKit {
 using namespace std;
 
 
+/**
+ * How a FileBufferedChannel stores the data that it buffers beyond its threshold.
+ */
+enum FileBufferedChannelBackend {
+	/** A named temp file in the buffer dir, which is unlinked right after creation. */
+	FBCB_FILE,
+	/** An unnamed temp file in the buffer dir (`O_TMPFILE`). Falls back to FBCB_FILE. */
+	FBCB_TMPFILE,
+	/** An anonymous file that lives in the page cache only (`memfd_create()`).
+	 * Falls back to FBCB_FILE.
+	 */
+	FBCB_MEMFD,
+	FBCB_UNKNOWN
+};
+
+inline FileBufferedChannelBackend
+parseFileBufferedChannelBackend(const StaticString &backend) {
+	if (backend == "file") {
+		return FBCB_FILE;
+	} else if (backend == "tmpfile") {
+		return FBCB_TMPFILE;
+	} else if (backend == "memfd") {
+		return FBCB_MEMFD;
+	} else {
+		return FBCB_UNKNOWN;
+	}
+}
+
 /*
  * BEGIN ConfigKit schema: Passenger::ServerKit::Schema
  * (do not edit: following text is automatically generated
@@ -54,11 +83,15 @@ using namespace std;
  *
  *   file_buffered_channel_auto_start_mover               boolean            -   default(true)
  *   file_buffered_channel_auto_truncate_file             boolean            -   default(true)
+ *   file_buffered_channel_backend                        string             -   default("file")
  *   file_buffered_channel_buffer_dir                     string             -   default
  *   file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -   default(0)
+ *   file_buffered_channel_io_uring                       boolean            -   default(false),read_only
  *   file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -   default(0)
+ *   file_buffered_channel_max_file_size                  unsigned integer   -   default(0)
  *   file_buffered_channel_threshold                      unsigned integer   -   default(131072)
  *   mbuf_block_chunk_size                                unsigned integer   -   default(4096),read_only
+ *   mbuf_huge_pages                                      boolean            -   default(false),read_only
  *   secure_mode_password                                 string             -   secret
  *
  * END
@@ -69,6 +102,15 @@ private:
 		return getSystemTempDir();
 	}
 
+	static void validate(const ConfigKit::Store &config, vector<ConfigKit::Error> &errors) {
+		if (parseFileBufferedChannelBackend(config["file_buffered_channel_backend"].asString())
+			== FBCB_UNKNOWN)
+		{
+			errors.push_back(ConfigKit::Error(
+				"'{{file_buffered_channel_backend}}' must be one of 'file', 'tmpfile' or 'memfd'"));
+		}
+	}
+
 	static Json::Value normalize(const Json::Value &effectiveValues) {
 		Json::Value updates;
 
@@ -89,13 +131,18 @@ public:
 		add("file_buffered_channel_delay_in_file_mode_switching", UINT_TYPE, OPTIONAL, 0);
 		add("file_buffered_channel_max_disk_chunk_read_size", UINT_TYPE, OPTIONAL, 0);
 		add("file_buffered_channel_auto_truncate_file", BOOL_TYPE, OPTIONAL, true);
+		add("file_buffered_channel_backend", STRING_TYPE, OPTIONAL, "file");
+		add("file_buffered_channel_max_file_size", UINT_TYPE, OPTIONAL, 0);
+		add("file_buffered_channel_io_uring", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
 		// For unit testing purposes
 		add("file_buffered_channel_auto_start_mover", BOOL_TYPE, OPTIONAL, true);
 
 		add("mbuf_block_chunk_size", UINT_TYPE, OPTIONAL | READ_ONLY,
 			DEFAULT_MBUF_CHUNK_SIZE);
+		add("mbuf_huge_pages", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
 		add("secure_mode_password", STRING_TYPE, OPTIONAL | SECRET);
 
+		addValidator(validate);
 		addNormalizer(normalize);
 
 		finalize();
@@ -107,6 +154,8 @@ struct FileBufferedChannelConfig {
 	unsigned int threshold;
 	unsigned int delayInFileModeSwitching;
 	unsigned int maxDiskChunkReadSize;
+	unsigned int maxFileSize;
+	FileBufferedChannelBackend backend;
 	bool autoTruncateFile;
 	bool autoStartMover;
 
@@ -115,6 +164,8 @@ struct FileBufferedChannelConfig {
 		  threshold(config["file_buffered_channel_threshold"].asUInt()),
 		  delayInFileModeSwitching(config["file_buffered_channel_delay_in_file_mode_switching"].asUInt()),
 		  maxDiskChunkReadSize(config["file_buffered_channel_max_disk_chunk_read_size"].asUInt()),
+		  maxFileSize(config["file_buffered_channel_max_file_size"].asUInt()),
+		  backend(parseFileBufferedChannelBackend(config["file_buffered_channel_backend"].asString())),
 		  autoTruncateFile(config["file_buffered_channel_auto_truncate_file"].asBool()),
 		  autoStartMover(config["file_buffered_channel_auto_start_mover"].asBool())
 		{ }
@@ -124,6 +175,8 @@ struct FileBufferedChannelConfig {
 		std::swap(threshold, other.threshold);
 		std::swap(delayInFileModeSwitching, other.delayInFileModeSwitching);
 		std::swap(maxDiskChunkReadSize, other.maxDiskChunkReadSize);
+		std::swap(maxFileSize, other.maxFileSize);
+		std::swap(backend, other.backend);
 		std::swap(autoTruncateFile, other.autoTruncateFile);
 		std::swap(autoStartMover, other.autoStartMover);
 	}
@@ -30,6 +30,7 @@
 #include <boost/config.hpp>
 
 #include <ServerKit/Config.h>
+#include <ServerKit/IoUring.h>
 #include <ConfigKit/ConfigKit.h>
 #include <MemoryKit/mbuf.h>
 #include <LoggingKit/Assert.h>
@@ -62,6 +63,12 @@ public:
 	// Others
 	Config config;
 	struct MemoryKit::mbuf_pool mbuf_pool;
+	/**
+	 * Used by FileBufferedChannel for disk I/O, if the
+	 * `file_buffered_channel_io_uring` option is set and the kernel
+	 * supports it. Otherwise, disk I/O goes through libuv.
+	 */
+	IoUring ioUring;
 
 	Context(const Schema &schema, const Json::Value &initialConfig = Json::Value(),
 		const ConfigKit::Translator &translator = ConfigKit::DummyTranslator())
@@ -71,6 +78,8 @@ public:
 		{ }
 
 	~Context() {
+		// In-flight requests may still reference mbufs.
+		ioUring.deinitialize();
 		MemoryKit::mbuf_pool_deinit(&mbuf_pool);
 	}
 
@@ -84,6 +93,14 @@ public:
 
 		mbuf_pool.mbuf_block_chunk_size = configStore["mbuf_block_chunk_size"].asUInt();
 		MemoryKit::mbuf_pool_init(&mbuf_pool);
+		mbuf_pool.mbuf_huge_pages = configStore["mbuf_huge_pages"].asBool();
+
+		if (configStore["file_buffered_channel_io_uring"].asBool()
+		 && !ioUring.initialize(libev->getLoop()))
+		{
+			P_NOTICE("io_uring is not available on this system;"
+				" file buffering will use libuv's thread pool instead");
+		}
 	}
 
 	bool configure(const Json::Value &updates, vector<ConfigKit::Error> &errors) {
@@ -120,12 +137,27 @@ public:
 
 		mbufDoc["free_blocks"] = (Json::UInt) mbuf_pool.nfree_mbuf_blockq;
 		mbufDoc["active_blocks"] = (Json::UInt) mbuf_pool.nactive_mbuf_blockq;
+		mbufDoc["active_standalone_blocks"] = (Json::UInt)
+			mbuf_pool.nactive_standalone_mbuf_blockq;
 		mbufDoc["chunk_size"] = (Json::UInt) mbuf_pool.mbuf_block_chunk_size;
 		mbufDoc["offset"] = (Json::UInt) mbuf_pool.mbuf_block_offset;
-		mbufDoc["spare_memory"] = byteSizeToJson(mbuf_pool.nfree_mbuf_blockq
-			* mbuf_pool.mbuf_block_chunk_size);
-		mbufDoc["active_memory"] = byteSizeToJson(mbuf_pool.nactive_mbuf_blockq
-			* mbuf_pool.mbuf_block_chunk_size);
+		mbufDoc["data_size"] = (Json::UInt) MemoryKit::mbuf_pool_data_size(&mbuf_pool);
+		mbufDoc["spare_memory"] = byteSizeToJson(
+			MemoryKit::mbuf_pool_spare_bytes(&mbuf_pool));
+		mbufDoc["active_memory"] = byteSizeToJson(
+			MemoryKit::mbuf_pool_active_bytes(&mbuf_pool));
+		mbufDoc["slab_memory"] = byteSizeToJson(
+			MemoryKit::mbuf_pool_slab_bytes(&mbuf_pool));
+		mbufDoc["huge_pages"] = mbuf_pool.mbuf_huge_pages;
+		for (unsigned int i = 0; i < MBUF_POOL_NCLASSES; i++) {
+			const struct MemoryKit::mbuf_size_class &cls = mbuf_pool.classes[i];
+			Json::Value classDoc;
+			classDoc["chunk_size"] = (Json::UInt) cls.mbuf_block_chunk_size;
+			classDoc["free_blocks"] = (Json::UInt) cls.nfree_mbuf_blockq;
+			classDoc["active_blocks"] = (Json::UInt) cls.nactive_mbuf_blockq;
+			classDoc["slabs"] = (Json::UInt) cls.nslabs;
+			mbufDoc["size_classes"].append(classDoc);
+		}
 		#ifdef MBUF_ENABLE_DEBUGGING
 			struct MemoryKit::active_mbuf_block_list *list =
 				const_cast<struct MemoryKit::active_mbuf_block_list *>(
@@ -148,6 +180,7 @@ public:
 		#endif
 
 		doc["mbuf_pool"] = mbufDoc;
+		doc["io_uring"] = ioUring.inspectStateAsJson();
 
 		return doc;
 	}
@@ -46,6 +46,12 @@ class FdSourceChannel: protected Channel {
 private:
 	ev_io watcher;
 	MemoryKit::mbuf buffer;
+	/**
+	 * The mbuf size class to read into. Starts at the smallest class,
+	 * grows when reads fill the entire buffer (the peer is sending
+	 * a lot of data) and shrinks back when they don't.
+	 */
+	unsigned int sizeClass;
 
 	static void _onReadable(EV_P_ ev_io *io, int revents) {
 		static_cast<FdSourceChannel *>(io->data)->onReadable(io, revents);
@@ -73,7 +79,7 @@ private:
 
 		for (i = 0; i < burstReadCount && !done; i++) {
 			if (buffer.empty()) {
-				buffer = MemoryKit::mbuf_get(&ctx->mbuf_pool);
+				buffer = MemoryKit::mbuf_get_with_class(&ctx->mbuf_pool, sizeClass);
 			}
 
 			origBufferSize = buffer.size();
@@ -85,8 +91,17 @@ private:
 				if (size_t(ret) == size_t(buffer.size())) {
 					// Unref mbuf_block
 					buffer = MemoryKit::mbuf();
+					if (sizeClass < MBUF_POOL_NCLASSES - 1
+					 && size_t(ret) == origBufferSize
+					 && origBufferSize == mbuf_pool_class_data_size(&ctx->mbuf_pool, sizeClass))
+					{
+						sizeClass++;
+					}
 				} else {
 					buffer = MemoryKit::mbuf(buffer, ret);
+					if (sizeClass > 0) {
+						sizeClass--;
+					}
 				}
 				feedWithoutRefGuard(boost::move(buffer2));
 				if (generation != this->generation) {
@@ -135,6 +150,7 @@ private:
 
 	void initialize() {
 		burstReadCount = 1;
+		sizeClass = 0;
 		watcher.active = false;
 		watcher.fd = -1;
 		watcher.data = this;
@@ -168,6 +184,7 @@ public:
 	void reinitialize(int fd) {
 		Channel::reinitialize();
 		ev_io_init(&watcher, _onReadable, fd, EV_READ);
+		sizeClass = 0;
 	}
 
 	void deinitialize() {
@@ -32,6 +32,9 @@
 #include <boost/move/move.hpp>
 #include <boost/atomic.hpp>
 #include <sys/types.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <uv.h>
 #include <jsoncpp/json.h>
 #include <cassert>
@@ -67,6 +70,10 @@ using namespace std;
 #define FBC_CRITICAL_FROM_CALLBACK(context, expr) \
 	P_CRITICAL("[FBC " << (void *) context->logbase << "] " << expr)
 
+#if defined(__linux__) && defined(SYS_memfd_create) && !defined(MFD_CLOEXEC)
+	#define MFD_CLOEXEC 0x0001U
+#endif
+
 
 /**
  * Adds "unlimited" buffering capability to a Channel. A Channel has a buffer size
@@ -169,7 +176,9 @@ public:
 		 * The writer isn't active. It will be activated next time
 		 * `feed()` notices that the threshold has passed.
 		 *
-		 * @invariant !passedThreshold()
+		 * The writer also stays in this state while the buffer file has
+		 * reached `config->maxFileSize`. The remaining buffers then stay
+		 * in memory until the reader has drained the file.
 		 */
 		WS_INACTIVE,
 
@@ -253,6 +262,9 @@ private:
 			  libuv(_self->ctx->libuv),
 			  logbase(_self)
 		{
+			// Allows uv_fs_req_cleanup() on requests that were never
+			// passed to libuv, e.g. anonymous buffer file creation.
+			memset(&req, 0, sizeof(req));
 			req.type = UV_UNKNOWN_REQ;
 			req.result = -1;
 			req.data = this;
@@ -332,6 +344,13 @@ private:
 		 */
 		int fd;
 
+		/**
+		 * The backend that the file was created with. This differs from
+		 * the configured backend if the latter is not supported. Only
+		 * meaningful if `fd != -1`.
+		 */
+		FileBufferedChannelBackend backend;
+
 
 		/***** Reader state *****/
 
@@ -350,7 +369,7 @@ private:
 
 		/**
 		 * The write operation that the writer is currently performing. Might be
-		 * an `uv_fs_open()`, `uv_fs_write()`, or whatever.
+		 * an `uv_fs_open()`, `uv_fs_write()`, an io_uring write, or whatever.
 		 *
 		 * @invariant
 		 *     (writerRequest != NULL) == (writerState == WS_CREATING_FILE || writerState == WS_MOVING)
@@ -378,6 +397,7 @@ private:
 		InFileMode(uv_loop_t *_libuv)
 			: libuv(_libuv),
 			  fd(-1),
+			  backend(FBCB_FILE),
 			  readRequest(NULL),
 			  writerState(WS_INACTIVE),
 			  writerRequest(NULL),
@@ -724,22 +744,26 @@ private:
 	void readNextChunkFromFile() {
 		assert(inFileMode->written > 0);
 		size_t size = std::min<size_t>(inFileMode->written,
-			mbuf_pool_data_size(&ctx->mbuf_pool));
+			mbuf_pool_max_data_size(&ctx->mbuf_pool));
 		if (config->maxDiskChunkReadSize > 0 && size > config->maxDiskChunkReadSize) {
 			size = config->maxDiskChunkReadSize;
 		}
 		FBC_DEBUG("Reader: reading next chunk from file, " << size << " bytes");
 		verifyInvariants();
 		ReadContext *readContext = new ReadContext(this);
-		readContext->buffer = MemoryKit::mbuf_get(&ctx->mbuf_pool);
+		readContext->buffer = MemoryKit::mbuf_get_with_size(&ctx->mbuf_pool, size);
 		readContext->inFileMode = inFileMode;
 		readContext->uvBuffer = uv_buf_init(readContext->buffer.start, size);
 		readerState = RS_READING_FROM_FILE;
 		inFileMode->readRequest = readContext;
 
-		uv_fs_read(ctx->libuv, &readContext->req, inFileMode->fd,
-			&readContext->uvBuffer, 1, inFileMode->readOffset,
-			_nextChunkDoneReading);
+		int result = readFromFile(readContext, &readContext->uvBuffer,
+			inFileMode->readOffset, _nextChunkDoneReading);
+		if (result != 0) {
+			readContext->req.result = result;
+			ctx->libev->runLater(boost::bind(_nextChunkDoneReading,
+				&readContext->req));
+		}
 		verifyInvariants();
 	}
 
@@ -829,6 +853,43 @@ private:
 	}
 
 
+	/***** Disk I/O *****/
+
+	/**
+	 * Reads from the buffer file through the Context's io_uring if it has one,
+	 * or through libuv's thread pool otherwise, or if the ring is full.
+	 * Returns 0 if `callback` will be called.
+	 */
+	int readFromFile(FileIOContext *ioContext, uv_buf_t *buf, boost::int64_t offset,
+		uv_fs_cb callback)
+	{
+		if (ctx->ioUring.isInitialized()) {
+			int result = ctx->ioUring.read(&ioContext->req, inFileMode->fd,
+				buf->base, buf->len, offset, callback);
+			if (result != UV_EAGAIN) {
+				return result;
+			}
+		}
+		return uv_fs_read(ctx->libuv, &ioContext->req, inFileMode->fd,
+			buf, 1, offset, callback);
+	}
+
+	/** Like `readFromFile()`, but writes. */
+	int writeToFile(FileIOContext *ioContext, uv_buf_t *buf, boost::int64_t offset,
+		uv_fs_cb callback)
+	{
+		if (ctx->ioUring.isInitialized()) {
+			int result = ctx->ioUring.write(&ioContext->req, inFileMode->fd,
+				buf->base, buf->len, offset, callback);
+			if (result != UV_EAGAIN) {
+				return result;
+			}
+		}
+		return uv_fs_write(ctx->libuv, &ioContext->req, inFileMode->fd,
+			buf, 1, offset, callback);
+	}
+
+
 	/***** Switching to or resetting in-file mode *****/
 
 	void switchToInFileMode() {
@@ -864,6 +925,12 @@ private:
 	/***** File creator *****/
 
 	struct FileCreationContext: public FileIOContext {
+		FileBufferedChannelBackend backend;
+		/**
+		 * The path of the buffer file. Empty if the file is anonymous
+		 * (FBCB_TMPFILE and FBCB_MEMFD), in which case there is
+		 * nothing to unlink.
+		 */
 		string path;
 
 		FileCreationContext(FileBufferedChannel *self)
@@ -872,23 +939,28 @@ private:
 	};
 
 	void createBufferFile() {
+		createBufferFile(config->backend);
+	}
+
+	void createBufferFile(FileBufferedChannelBackend backend) {
 		P_ASSERT_EQ(mode, IN_FILE_MODE);
 		P_ASSERT_EQ(inFileMode->writerState, WS_INACTIVE);
 		P_ASSERT_EQ(inFileMode->fd, -1);
 
 		FileCreationContext *fcContext = new FileCreationContext(this);
-		fcContext->path = config->bufferDir;
-		fcContext->path.append("/buffer.");
-		fcContext->path.append(toString(rand()));
+		fcContext->backend = backend;
+		if (backend == FBCB_FILE) {
+			fcContext->path = config->bufferDir;
+			fcContext->path.append("/buffer.");
+			fcContext->path.append(toString(rand()));
+		}
 
 		inFileMode->writerState = WS_CREATING_FILE;
 		inFileMode->writerRequest = fcContext;
 
 		if (config->delayInFileModeSwitching == 0) {
-			FBC_DEBUG("Writer: creating file " << fcContext->path);
-			int result = uv_fs_open(ctx->libuv, &fcContext->req,
-				fcContext->path.c_str(), O_RDWR | O_CREAT | O_EXCL,
-				0600, _bufferFileCreated);
+			FBC_DEBUG("Writer: creating " << describeBufferFile(fcContext));
+			int result = openBufferFile(fcContext);
 			if (result != 0) {
 				fcContext->req.result = result;
 				ctx->libev->runLater(boost::bind(_bufferFileCreated,
@@ -916,27 +988,95 @@ private:
 
 	void bufferFileDoneDelaying(FileCreationContext *fcContext) {
 		FBC_DEBUG("Writer: done delaying in-file mode switching. "
-			"Creating file: " << fcContext->path);
-		int result = uv_fs_open(ctx->libuv, &fcContext->req,
-			fcContext->path.c_str(), O_RDWR | O_CREAT | O_EXCL,
-			0600, _bufferFileCreated);
+			"Creating " << describeBufferFile(fcContext));
+		int result = openBufferFile(fcContext);
 		if (result != 0) {
 			fcContext->req.result = result;
 			_bufferFileCreated(&fcContext->req);
 		}
 	}
 
+	/**
+	 * Starts opening the buffer file in the background, or opens it right away
+	 * if the backend doesn't involve the filesystem. Returns 0 if
+	 * `_bufferFileCreated` will be called by libuv. Otherwise, returns the
+	 * file descriptor or a negative libuv error code, and the caller is
+	 * responsible for calling `_bufferFileCreated`.
+	 */
+	int openBufferFile(FileCreationContext *fcContext) {
+		switch (fcContext->backend) {
+		case FBCB_TMPFILE:
+			#ifdef O_TMPFILE
+				// An unnamed file in bufferDir. It never has a directory
+				// entry, so there is nothing to unlink later.
+				return uv_fs_open(ctx->libuv, &fcContext->req,
+					config->bufferDir.c_str(), O_RDWR | O_TMPFILE,
+					0600, _bufferFileCreated);
+			#else
+				return UV_ENOSYS;
+			#endif
+		case FBCB_MEMFD: {
+			// memfd_create() doesn't block, so we don't bother with
+			// the libuv thread pool.
+			#if defined(__linux__) && defined(SYS_memfd_create)
+				int fd = (int) syscall(SYS_memfd_create, "passenger-buffer",
+					MFD_CLOEXEC);
+				if (fd == -1) {
+					return -errno;
+				} else if (fd == 0) {
+					// 0 means that libuv will call the callback,
+					// so move the file descriptor elsewhere.
+					int fd2 = fcntl(fd, F_DUPFD_CLOEXEC, 1);
+					int e = errno;
+					close(fd);
+					return (fd2 == -1) ? -e : fd2;
+				} else {
+					return fd;
+				}
+			#else
+				return UV_ENOSYS;
+			#endif
+		}
+		default:
+			return uv_fs_open(ctx->libuv, &fcContext->req,
+				fcContext->path.c_str(), O_RDWR | O_CREAT | O_EXCL,
+				0600, _bufferFileCreated);
+		}
+	}
+
+	static string describeBufferFile(const FileCreationContext *fcContext) {
+		switch (fcContext->backend) {
+		case FBCB_TMPFILE:
+			return "anonymous file (O_TMPFILE)";
+		case FBCB_MEMFD:
+			return "anonymous file (memfd)";
+		default:
+			return "file " + fcContext->path;
+		}
+	}
+
+	static bool isBackendUnsupportedError(int errcode) {
+		return errcode == ENOSYS
+			|| errcode == EOPNOTSUPP
+			|| errcode == EISDIR
+			|| errcode == EINVAL;
+	}
+
 	static void _bufferFileCreated(uv_fs_t *req) {
 		FileCreationContext *fcContext = static_cast<FileCreationContext *>(req->data);
 		uv_fs_req_cleanup(req);
 		if (fcContext->isCanceled()) {
 			if (req->result >= 0) {
 				FBC_DEBUG_FROM_CALLBACK(fcContext,
-					"Writer: creation of file " << fcContext->path <<
-					"canceled. Deleting file in the background");
+					"Writer: creation of " << describeBufferFile(fcContext) <<
+					" canceled. Deleting file in the background");
 				closeBufferFileInBackground(fcContext);
-				// Will take care of deleting fcContext
-				unlinkBufferFileInBackground(fcContext);
+				if (fcContext->path.empty()) {
+					delete fcContext;
+				} else {
+					// Will take care of deleting fcContext
+					unlinkBufferFileInBackground(fcContext);
+				}
 			} else {
 				delete fcContext;
 			}
@@ -952,20 +1092,33 @@ private:
 		inFileMode->writerRequest = NULL;
 
 		if (fcContext->req.result >= 0) {
-			FBC_DEBUG("Writer: file created. Deleting file in the background");
 			P_LOG_FILE_DESCRIPTOR_OPEN4(fcContext->req.result, __FILE__, __LINE__,
 				"FileBufferedChannel buffer file");
 			inFileMode->fd = fcContext->req.result;
-			// Will take care of deleting fcContext
-			unlinkBufferFileInBackground(fcContext);
+			inFileMode->backend = fcContext->backend;
+			if (fcContext->path.empty()) {
+				FBC_DEBUG("Writer: anonymous file created");
+				delete fcContext;
+			} else {
+				FBC_DEBUG("Writer: file created. Deleting file in the background");
+				// Will take care of deleting fcContext
+				unlinkBufferFileInBackground(fcContext);
+			}
 			moveNextBufferToFile();
 		} else {
 			int errcode = -fcContext->req.result;
+			FileBufferedChannelBackend backend = fcContext->backend;
 			delete fcContext;
 			if (errcode == EEXIST) {
 				FBC_DEBUG("Writer: file already exists, retrying");
 				inFileMode->writerState = WS_INACTIVE;
-				createBufferFile();
+				createBufferFile(backend);
+				verifyInvariants();
+			} else if (backend != FBCB_FILE && isBackendUnsupportedError(errcode)) {
+				FBC_DEBUG("Writer: anonymous buffer files not supported (errno="
+					<< errcode << "), falling back to a named file");
+				inFileMode->writerState = WS_INACTIVE;
+				createBufferFile(FBCB_FILE);
 				verifyInvariants();
 			} else {
 				setError(errcode, __FILE__, __LINE__);
@@ -1082,6 +1235,12 @@ private:
 			FBC_DEBUG("Writer: EOF encountered. Transitioning to WS_TERMINATED");
 			inFileMode->writerState = WS_TERMINATED;
 			return;
+		} else if (fileSizeCapReached()) {
+			FBC_DEBUG("Writer: file size cap of " << config->maxFileSize <<
+				" bytes reached, keeping remaining buffers in memory. "
+				"Transitioning to WS_INACTIVE");
+			inFileMode->writerState = WS_INACTIVE;
+			return;
 		}
 
 		FBC_DEBUG("Writer: moving next buffer to file: " <<
@@ -1096,8 +1255,7 @@ private:
 
 		inFileMode->writerState = WS_MOVING;
 		inFileMode->writerRequest = moveContext;
-		int result = uv_fs_write(ctx->libuv, &moveContext->req, inFileMode->fd,
-			&moveContext->uvBuffer, 1,
+		int result = writeToFile(moveContext, &moveContext->uvBuffer,
 			inFileMode->readOffset + inFileMode->written,
 			_bufferWrittenToFile);
 		if (result != 0) {
@@ -1108,6 +1266,18 @@ private:
 		verifyInvariants();
 	}
 
+	/**
+	 * Whether moving the next buffer would make the file larger than
+	 * `config->maxFileSize`. Only enforced when the reader truncates the file,
+	 * because otherwise the buffers kept in memory would never be freed.
+	 */
+	bool fileSizeCapReached() {
+		return config->maxFileSize > 0
+			&& config->autoTruncateFile
+			&& (boost::uint64_t) (inFileMode->readOffset + inFileMode->written
+				+ peekBuffer().size()) > config->maxFileSize;
+	}
+
 	static void _bufferWrittenToFile(uv_fs_t *req) {
 		MoveContext *moveContext = static_cast<MoveContext *>(req->data);
 		uv_fs_req_cleanup(req);
@@ -1155,8 +1325,7 @@ private:
 				moveContext->uvBuffer = uv_buf_init(
 					moveContext->buffer.start + moveContext->written,
 					moveContext->buffer.size() - moveContext->written);
-				int result = uv_fs_write(ctx->libuv, &moveContext->req,
-					inFileMode->fd, &moveContext->uvBuffer, 1,
+				int result = writeToFile(moveContext, &moveContext->uvBuffer,
 					inFileMode->readOffset + inFileMode->written,
 					_bufferWrittenToFile);
 				if (result != 0) {
@@ -1504,6 +1673,14 @@ public:
 		return inFileMode->writerState;
 	}
 
+	/**
+	 * Returns the backend that the buffer file was created with.
+	 * Only meaningful in in-file mode, once the file has been created.
+	 */
+	FileBufferedChannelBackend getBufferFileBackend() const {
+		return inFileMode->backend;
+	}
+
 	/**
 	 * Returns the number of bytes buffered in memory.
 	 */
@@ -42,6 +42,7 @@
 #include <ServerKit/HttpRequestRef.h>
 #include <ServerKit/HttpHeaderParser.h>
 #include <ServerKit/HttpChunkedBodyParser.h>
+#include <ServerKit/RequestPoolSizer.h>
 #include <Algorithms/MovingAverage.h>
 #include <Integrations/LibevJsonUtils.h>
 #include <SystemTools/SystemTime.h>
@@ -167,6 +168,7 @@ private:
 
 	RequestHooksImpl requestHooksImpl;
 	object_pool<HttpHeaderParserState> headerParserStatePool;
+	RequestPoolSizer requestPoolSizer;
 
 
 	/***** Request object creation and destruction *****/
@@ -274,6 +276,22 @@ private:
 		}
 	}
 
+	/**
+	 * Resets the request's pool for reuse by the next request, after
+	 * recording its usage. The pool is destroyed instead if it had to grow,
+	 * or if it doesn't have the size that `requestPoolSizer` recommends
+	 * (anymore), so that the next request creates one of the right size.
+	 */
+	void resetRequestPool(Request *req) {
+		size_t size = psg_pool_size(req->pool);
+
+		requestPoolSizer.recordUsage(req->pool);
+		if (size != requestPoolSizer.getPoolSize() || !psg_reset_pool(req->pool, size)) {
+			psg_destroy_pool(req->pool);
+			req->pool = NULL;
+		}
+	}
+
 	void doneWithCurrentRequest(Client **client) {
 		Client *c = *client;
 		assert(c->currentRequest != NULL);
@@ -284,10 +302,7 @@ private:
 		P_ASSERT_EQ(req->httpState, Request::WAITING_FOR_REFERENCES);
 		assert(req->pool != NULL);
 		c->currentRequest = NULL;
-		if (!psg_reset_pool(req->pool, PSG_DEFAULT_POOL_SIZE)) {
-			psg_destroy_pool(req->pool);
-			req->pool = NULL;
-		}
+		resetRequestPool(req);
 		unrefRequest(req, __FILE__, __LINE__);
 		if (keepAlive) {
 			SKC_TRACE(c, 3, "Keeping alive connection, handling next request");
@@ -763,6 +778,25 @@ private:
 		}
 	}
 
+	static void addRequestMemoryUsage(const Client *client, unsigned int &requestCount,
+		psg_pool_stats_t &poolStats)
+	{
+		const Request *req;
+
+		if (client->currentRequest != NULL) {
+			requestCount++;
+			if (client->currentRequest->pool != NULL) {
+				psg_pool_add_stats(client->currentRequest->pool, &poolStats);
+			}
+		}
+		LIST_FOREACH (req, &client->lingeringRequests, nextRequest.lingeringRequest) {
+			requestCount++;
+			if (req->pool != NULL) {
+				psg_pool_add_stats(req->pool, &poolStats);
+			}
+		}
+	}
+
 protected:
 	/***** Hook overrides *****/
 
@@ -941,7 +975,7 @@ protected:
 		if (OXT_UNLIKELY(req->pool == NULL)) {
 			// We assume that most of the time, the pool from the
 			// last request is reset and reused.
-			req->pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			req->pool = psg_create_pool(requestPoolSizer.getPoolSize());
 		}
 		psg_lstr_init(&req->path);
 		req->bodyChannel.reinitialize();
@@ -984,9 +1018,8 @@ protected:
 			it.next();
 		}
 
-		if (req->pool != NULL && !psg_reset_pool(req->pool, PSG_DEFAULT_POOL_SIZE)) {
-			psg_destroy_pool(req->pool);
-			req->pool = NULL;
+		if (req->pool != NULL) {
+			resetRequestPool(req);
 		}
 
 		req->httpState = Request::WAITING_FOR_REFERENCES;
@@ -1275,8 +1308,8 @@ public:
 		configRlz.swap(*req.configRlz);
 	}
 
-	virtual Json::Value inspectStateAsJson() const {
-		Json::Value doc = ParentClass::inspectStateAsJson();
+	virtual Json::Value inspectServerStateAsJson() const {
+		Json::Value doc = ParentClass::inspectServerStateAsJson();
 		doc["free_request_count"] = freeRequestCount;
 		doc["total_requests_begun"] = (Json::UInt64) totalRequestsBegun;
 		doc["request_begin_speed"]["1m"] = averageSpeedToJson(
@@ -1288,6 +1321,49 @@ public:
 		return doc;
 	}
 
+	virtual Json::Value inspectMemoryUsageAsJson() const {
+		Json::Value doc = ParentClass::inspectMemoryUsageAsJson();
+		const Client *client;
+		const Request *req;
+		unsigned int requestCount = 0;
+		psg_pool_stats_t poolStats;
+
+		memset(&poolStats, 0, sizeof(poolStats));
+		TAILQ_FOREACH (client, &this->activeClients, nextClient.activeOrDisconnectedClient) {
+			addRequestMemoryUsage(client, requestCount, poolStats);
+		}
+		TAILQ_FOREACH (client, &this->disconnectedClients, nextClient.activeOrDisconnectedClient) {
+			addRequestMemoryUsage(client, requestCount, poolStats);
+		}
+		STAILQ_FOREACH (req, &freeRequests, nextRequest.freeRequest) {
+			if (req->pool != NULL) {
+				psg_pool_add_stats(req->pool, &poolStats);
+			}
+		}
+
+		doc["request_objects"]["active_count"] = requestCount;
+		doc["request_objects"]["free_count"] = freeRequestCount;
+		doc["request_objects"]["object_size"] = (Json::UInt) sizeof(Request);
+		doc["request_objects"]["memory"] = byteSizeToJson(
+			(requestCount + freeRequestCount) * sizeof(Request));
+
+		doc["request_pools"]["blocks"] = (Json::UInt) poolStats.blocks;
+		doc["request_pools"]["block_memory"] = byteSizeToJson(poolStats.block_bytes);
+		doc["request_pools"]["used"] = byteSizeToJson(poolStats.used_bytes);
+		doc["request_pools"]["large_allocations"] = (Json::UInt) poolStats.large_allocations;
+		doc["request_pools"]["large_memory"] = byteSizeToJson(poolStats.large_bytes);
+		doc["request_pools"]["pool_size"] = byteSizeToJson(requestPoolSizer.getPoolSize());
+		doc["request_pools"]["pool_resizes"] = requestPoolSizer.getResizeCount();
+		doc["request_pools"]["total_extra_blocks"] =
+			(Json::UInt64) requestPoolSizer.getTotalExtraBlocks();
+		doc["request_pools"]["total_large_allocations"] =
+			(Json::UInt64) requestPoolSizer.getTotalLargeAllocations();
+		doc["request_pools"]["total_large_memory"] =
+			byteSizeToJson(requestPoolSizer.getTotalLargeBytes());
+
+		return doc;
+	}
+
 	virtual Json::Value inspectClientStateAsJson(const Client *client) const {
 		Json::Value doc = ParentClass::inspectClientStateAsJson(client);
 		if (client->currentRequest) {
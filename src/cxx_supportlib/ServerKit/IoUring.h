@@ -0,0 +1,555 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_IO_URING_H_
+#define _PASSENGER_SERVER_KIT_IO_URING_H_
+
+#include <boost/cstdint.hpp>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <stdint.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ev.h>
+#include <uv.h>
+#include <jsoncpp/json.h>
+#include <algorithm>
+#include <vector>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <LoggingKit/LoggingKit.h>
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <sys/eventfd.h>
+		#include <linux/io_uring.h>
+		// IORING_OP_READ, IORING_OP_WRITE and IORING_REGISTER_PROBE
+		// appeared together with this flag, in Linux 5.6.
+		#ifdef IORING_FEAT_RW_CUR_POS
+			#define PASSENGER_IO_URING_SUPPORTED
+		#endif
+	#endif
+#endif
+
+namespace Passenger {
+namespace ServerKit {
+
+using namespace std;
+
+
+/**
+ * Performs asynchronous file reads and writes through Linux's io_uring,
+ * as an alternative to libuv's thread pool. It is driven by a libev loop:
+ *
+ *  - `read()` and `write()` only queue a submission. All submissions queued
+ *    during a loop iteration are passed to the kernel with a single
+ *    `io_uring_enter()` call, right before the loop blocks (ev_prepare).
+ *  - The kernel signals completions through an eventfd that the loop
+ *    watches. All completions available at that time are processed in
+ *    one go.
+ *
+ * Requests are described with `uv_fs_t` objects and completed with
+ * `uv_fs_cb` callbacks, just like `uv_fs_read()` and `uv_fs_write()`, so
+ * that callers can use the same completion code for both. Upon completion,
+ * `req->result` is the number of bytes transferred or a negative error code.
+ *
+ * `initialize()` returns false if the kernel doesn't support io_uring (or
+ * the operations we need), and `read()`/`write()` return UV_EAGAIN when
+ * the ring is full. Callers should use libuv in both cases.
+ *
+ * Not thread-safe: all methods must be called from the event loop thread.
+ */
+class IoUring {
+public:
+	static const unsigned int DEFAULT_ENTRIES = 256;
+
+private:
+	#ifdef PASSENGER_IO_URING_SUPPORTED
+		struct ev_loop *loop;
+		ev_io eventfdWatcher;
+		ev_prepare prepareWatcher;
+		int ringFd;
+		int eventFd;
+
+		void *sqRing;
+		void *cqRing;
+		struct io_uring_sqe *sqes;
+		size_t sqRingSize;
+		size_t cqRingSize;
+		size_t sqesSize;
+
+		unsigned int *sqHead;
+		unsigned int *sqTail;
+		unsigned int *sqMask;
+		unsigned int *sqArray;
+		unsigned int *cqHead;
+		unsigned int *cqTail;
+		unsigned int *cqMask;
+		struct io_uring_cqe *cqes;
+		unsigned int sqEntries;
+		unsigned int cqEntries;
+	#endif
+
+	/** Queued, but not yet passed to the kernel. */
+	unsigned int pending;
+	/** Queued or in progress in the kernel. */
+	unsigned int inflight;
+
+	boost::uint64_t submitted;
+	boost::uint64_t completed;
+	boost::uint64_t submitCalls;
+	boost::uint64_t completionBatches;
+	boost::uint64_t ringFull;
+
+	#ifdef PASSENGER_IO_URING_SUPPORTED
+		static int sysSetup(unsigned int entries, struct io_uring_params *params) {
+			return (int) syscall(__NR_io_uring_setup, entries, params);
+		}
+
+		static int sysEnter(int fd, unsigned int toSubmit, unsigned int minComplete,
+			unsigned int flags)
+		{
+			return (int) syscall(__NR_io_uring_enter, fd, toSubmit, minComplete,
+				flags, NULL, 0);
+		}
+
+		static int sysRegister(int fd, unsigned int opcode, void *arg,
+			unsigned int nargs)
+		{
+			return (int) syscall(__NR_io_uring_register, fd, opcode, arg, nargs);
+		}
+
+		static unsigned int *ringField(void *ring, boost::uint32_t offset) {
+			return (unsigned int *) ((char *) ring + offset);
+		}
+
+		bool mapRings(const struct io_uring_params &params) {
+			sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+			cqRingSize = params.cq_off.cqes
+				+ params.cq_entries * sizeof(struct io_uring_cqe);
+			if (params.features & IORING_FEAT_SINGLE_MMAP) {
+				sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+			}
+
+			sqRing = mmap(NULL, sqRingSize, PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+			if (sqRing == MAP_FAILED) {
+				sqRing = NULL;
+				return false;
+			}
+			if (params.features & IORING_FEAT_SINGLE_MMAP) {
+				cqRing = sqRing;
+			} else {
+				cqRing = mmap(NULL, cqRingSize, PROT_READ | PROT_WRITE,
+					MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+				if (cqRing == MAP_FAILED) {
+					cqRing = NULL;
+					return false;
+				}
+			}
+			sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+			sqes = (struct io_uring_sqe *) mmap(NULL, sqesSize, PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+			if (sqes == MAP_FAILED) {
+				sqes = NULL;
+				return false;
+			}
+
+			sqHead  = ringField(sqRing, params.sq_off.head);
+			sqTail  = ringField(sqRing, params.sq_off.tail);
+			sqMask  = ringField(sqRing, params.sq_off.ring_mask);
+			sqArray = ringField(sqRing, params.sq_off.array);
+			cqHead  = ringField(cqRing, params.cq_off.head);
+			cqTail  = ringField(cqRing, params.cq_off.tail);
+			cqMask  = ringField(cqRing, params.cq_off.ring_mask);
+			cqes    = (struct io_uring_cqe *) ((char *) cqRing + params.cq_off.cqes);
+			sqEntries = params.sq_entries;
+			cqEntries = params.cq_entries;
+			return true;
+		}
+
+		bool opsSupported() {
+			size_t size = sizeof(struct io_uring_probe)
+				+ 256 * sizeof(struct io_uring_probe_op);
+			struct io_uring_probe *probe = (struct io_uring_probe *) malloc(size);
+			if (probe == NULL) {
+				return false;
+			}
+			memset(probe, 0, size);
+			bool result = sysRegister(ringFd, IORING_REGISTER_PROBE, probe, 256) == 0
+				&& opSupported(probe, IORING_OP_READ)
+				&& opSupported(probe, IORING_OP_WRITE);
+			free(probe);
+			return result;
+		}
+
+		static bool opSupported(const struct io_uring_probe *probe, unsigned int op) {
+			return op <= probe->last_op
+				&& (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+		}
+
+		void unmapAndClose() {
+			if (sqes != NULL) {
+				munmap(sqes, sqesSize);
+				sqes = NULL;
+			}
+			if (cqRing != NULL && cqRing != sqRing) {
+				munmap(cqRing, cqRingSize);
+			}
+			cqRing = NULL;
+			if (sqRing != NULL) {
+				munmap(sqRing, sqRingSize);
+				sqRing = NULL;
+			}
+			if (eventFd != -1) {
+				P_LOG_FILE_DESCRIPTOR_CLOSE(eventFd);
+				close(eventFd);
+				eventFd = -1;
+			}
+			if (ringFd != -1) {
+				P_LOG_FILE_DESCRIPTOR_CLOSE(ringFd);
+				close(ringFd);
+				ringFd = -1;
+			}
+		}
+
+		int queue(boost::uint8_t opcode, uv_fs_t *req, int fd, char *buf,
+			unsigned int size, boost::int64_t offset, uv_fs_cb callback)
+		{
+			if (inflight >= cqEntries) {
+				// Don't let the completion queue overflow.
+				ringFull++;
+				return UV_EAGAIN;
+			}
+			if (pending == sqEntries) {
+				submitPending();
+				if (pending == sqEntries) {
+					ringFull++;
+					return UV_EAGAIN;
+				}
+			}
+
+			// The kernel only reads sqTail, so we don't need a barrier here.
+			unsigned int tail = *sqTail;
+			unsigned int index = tail & *sqMask;
+			struct io_uring_sqe *sqe = &sqes[index];
+
+			memset(sqe, 0, sizeof(*sqe));
+			sqe->opcode = opcode;
+			sqe->fd = fd;
+			sqe->off = offset;
+			sqe->addr = (boost::uint64_t) (uintptr_t) buf;
+			sqe->len = size;
+			sqe->user_data = (boost::uint64_t) (uintptr_t) req;
+			sqArray[index] = index;
+			req->cb = callback;
+			req->result = 0;
+			__atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+
+			pending++;
+			inflight++;
+			submitted++;
+			return 0;
+		}
+
+		void submitPending() {
+			while (pending > 0) {
+				int ret = sysEnter(ringFd, pending, 0, 0);
+				if (ret >= 0) {
+					submitCalls++;
+					pending -= std::min<unsigned int>(ret, pending);
+					if (ret == 0) {
+						break;
+					}
+				} else if (errno == EINTR) {
+					continue;
+				} else if (errno == EAGAIN || errno == EBUSY) {
+					// The kernel is short on resources, or the completion
+					// queue is full. Try again after processing completions.
+					break;
+				} else {
+					int e = errno;
+					failPending(e);
+				}
+			}
+		}
+
+		/**
+		 * Takes back the submissions that the kernel has not consumed,
+		 * and completes them with the given error.
+		 */
+		void failPending(int e) {
+			P_ERROR("io_uring_enter() failed: " << strerror(e) << " (errno=" << e << ")");
+			unsigned int head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+			unsigned int tail = *sqTail;
+			vector<uv_fs_t *> reqs;
+
+			// Callbacks may queue new requests into the freed slots,
+			// so collect the requests first.
+			reqs.reserve(tail - head);
+			while (head != tail) {
+				struct io_uring_sqe *sqe = &sqes[sqArray[head & *sqMask]];
+				reqs.push_back((uv_fs_t *) (uintptr_t) sqe->user_data);
+				head++;
+			}
+			__atomic_store_n(sqTail, tail - (unsigned int) reqs.size(), __ATOMIC_RELEASE);
+			pending = 0;
+
+			for (vector<uv_fs_t *>::iterator it = reqs.begin(); it != reqs.end(); it++) {
+				complete(*it, -e);
+			}
+		}
+
+		void complete(uv_fs_t *req, int result) {
+			inflight--;
+			completed++;
+			req->result = result;
+			req->cb(req);
+		}
+
+		unsigned int processCompletions() {
+			unsigned int head = *cqHead;
+			unsigned int count = 0;
+
+			while (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+				struct io_uring_cqe *cqe = &cqes[head & *cqMask];
+				uv_fs_t *req = (uv_fs_t *) (uintptr_t) cqe->user_data;
+				int result = cqe->res;
+
+				// Release the slot before calling the callback, which
+				// may queue new requests.
+				head++;
+				__atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+				count++;
+				complete(req, result);
+			}
+
+			if (count > 0) {
+				completionBatches++;
+			}
+			return count;
+		}
+
+		static void onPrepare(EV_P_ ev_prepare *watcher, int revents) {
+			IoUring *self = static_cast<IoUring *>(watcher->data);
+			self->submitPending();
+		}
+
+		static void onEventfdReadable(EV_P_ ev_io *watcher, int revents) {
+			IoUring *self = static_cast<IoUring *>(watcher->data);
+			boost::uint64_t counter;
+			ssize_t ret;
+
+			do {
+				ret = ::read(self->eventFd, &counter, sizeof(counter));
+			} while (ret == -1 && errno == EINTR);
+			self->processCompletions();
+		}
+	#endif
+
+public:
+	IoUring()
+		: pending(0),
+		  inflight(0),
+		  submitted(0),
+		  completed(0),
+		  submitCalls(0),
+		  completionBatches(0),
+		  ringFull(0)
+	{
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			loop = NULL;
+			ringFd = -1;
+			eventFd = -1;
+			sqRing = NULL;
+			cqRing = NULL;
+			sqes = NULL;
+		#endif
+	}
+
+	~IoUring() {
+		deinitialize();
+	}
+
+	/**
+	 * Sets up the ring and starts watching it in the given loop. Must be called
+	 * before the loop is started, or from the loop thread. Returns false if
+	 * io_uring is not available, in which case this object stays unusable.
+	 */
+	bool initialize(struct ev_loop *_loop, unsigned int entries = DEFAULT_ENTRIES) {
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			struct io_uring_params params;
+
+			memset(&params, 0, sizeof(params));
+			params.flags = IORING_SETUP_CLAMP;
+			ringFd = sysSetup(entries, &params);
+			if (ringFd == -1) {
+				P_DEBUG("io_uring not available: io_uring_setup() failed: "
+					<< strerror(errno) << " (errno=" << errno << ")");
+				return false;
+			}
+			P_LOG_FILE_DESCRIPTOR_OPEN4(ringFd, __FILE__, __LINE__, "io_uring");
+
+			if (!mapRings(params)) {
+				P_DEBUG("io_uring not available: cannot map rings: "
+					<< strerror(errno) << " (errno=" << errno << ")");
+				unmapAndClose();
+				return false;
+			}
+			if (!opsSupported()) {
+				P_DEBUG("io_uring not available: the kernel does not support"
+					" IORING_OP_READ and IORING_OP_WRITE");
+				unmapAndClose();
+				return false;
+			}
+
+			eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (eventFd == -1) {
+				P_DEBUG("io_uring not available: eventfd() failed: "
+					<< strerror(errno) << " (errno=" << errno << ")");
+				unmapAndClose();
+				return false;
+			}
+			P_LOG_FILE_DESCRIPTOR_OPEN4(eventFd, __FILE__, __LINE__, "io_uring eventfd");
+			if (sysRegister(ringFd, IORING_REGISTER_EVENTFD, &eventFd, 1) != 0) {
+				P_DEBUG("io_uring not available: cannot register eventfd: "
+					<< strerror(errno) << " (errno=" << errno << ")");
+				unmapAndClose();
+				return false;
+			}
+
+			loop = _loop;
+			ev_io_init(&eventfdWatcher, onEventfdReadable, eventFd, EV_READ);
+			eventfdWatcher.data = this;
+			ev_io_start(loop, &eventfdWatcher);
+			ev_prepare_init(&prepareWatcher, onPrepare);
+			prepareWatcher.data = this;
+			ev_prepare_start(loop, &prepareWatcher);
+			P_DEBUG("io_uring initialized with " << sqEntries << " entries");
+			return true;
+		#else
+			P_DEBUG("io_uring not available: not supported on this platform");
+			return false;
+		#endif
+	}
+
+	/**
+	 * Waits until all requests are completed, calling their callbacks,
+	 * and releases the ring. Must be called while the loop is not running,
+	 * or from the loop thread.
+	 */
+	void deinitialize() {
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			if (!isInitialized()) {
+				return;
+			}
+
+			// The kernel may still be using the buffers of in-flight requests.
+			while (inflight > 0) {
+				submitPending();
+				if (processCompletions() == 0) {
+					int ret = sysEnter(ringFd, 0, 1, IORING_ENTER_GETEVENTS);
+					if (ret == -1 && errno != EINTR && errno != EAGAIN) {
+						int e = errno;
+						P_ERROR("Cannot wait for io_uring completions: "
+							<< strerror(e) << " (errno=" << e << ")");
+						break;
+					}
+				}
+			}
+
+			ev_io_stop(loop, &eventfdWatcher);
+			ev_prepare_stop(loop, &prepareWatcher);
+			loop = NULL;
+			unmapAndClose();
+		#endif
+	}
+
+	bool isInitialized() const {
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			return loop != NULL;
+		#else
+			return false;
+		#endif
+	}
+
+	/**
+	 * Queues a `pread()`. Returns 0 if `callback` will be called, or a
+	 * negative libuv error code otherwise.
+	 */
+	int read(uv_fs_t *req, int fd, char *buf, unsigned int size,
+		boost::int64_t offset, uv_fs_cb callback)
+	{
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			return queue(IORING_OP_READ, req, fd, buf, size, offset, callback);
+		#else
+			return UV_ENOSYS;
+		#endif
+	}
+
+	/**
+	 * Queues a `pwrite()`. Returns 0 if `callback` will be called, or a
+	 * negative libuv error code otherwise.
+	 */
+	int write(uv_fs_t *req, int fd, const char *buf, unsigned int size,
+		boost::int64_t offset, uv_fs_cb callback)
+	{
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			return queue(IORING_OP_WRITE, req, fd, const_cast<char *>(buf),
+				size, offset, callback);
+		#else
+			return UV_ENOSYS;
+		#endif
+	}
+
+	unsigned int getInflight() const {
+		return inflight;
+	}
+
+	Json::Value inspectStateAsJson() const {
+		Json::Value doc;
+		doc["initialized"] = isInitialized();
+		#ifdef PASSENGER_IO_URING_SUPPORTED
+			if (isInitialized()) {
+				doc["entries"] = sqEntries;
+			}
+		#endif
+		doc["pending"] = pending;
+		doc["inflight"] = inflight;
+		doc["submitted"] = (Json::UInt64) submitted;
+		doc["completed"] = (Json::UInt64) completed;
+		doc["submit_calls"] = (Json::UInt64) submitCalls;
+		doc["completion_batches"] = (Json::UInt64) completionBatches;
+		doc["ring_full"] = (Json::UInt64) ringFull;
+		return doc;
+	}
+};
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_IO_URING_H_ */
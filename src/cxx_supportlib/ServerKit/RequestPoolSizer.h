@@ -0,0 +1,152 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_REQUEST_POOL_SIZER_H_
+#define _PASSENGER_SERVER_KIT_REQUEST_POOL_SIZER_H_
+
+#include <boost/cstdint.hpp>
+#include <cstring>
+#include <MemoryKit/palloc.h>
+#include <Algorithms/LatencyHistogram.h>
+
+namespace Passenger {
+namespace ServerKit {
+
+
+/**
+ * Learns how much memory requests allocate from their palloc pools, so that
+ * an HttpServer can create request pools of a size that fits most requests:
+ * large enough that few requests need extra blocks, yet small enough that
+ * small requests don't leave most of the pool unused.
+ *
+ * After every `SAMPLE_WINDOW` requests, the recommended pool size is
+ * recalculated as the `PERCENTILE`th percentile of the pool usage in
+ * that window, rounded up to a power of two and clamped between
+ * `MIN_POOL_SIZE` and `MAX_POOL_SIZE`. Until then, it is
+ * `PSG_DEFAULT_POOL_SIZE`.
+ *
+ * Not thread-safe. Each HttpServer, and thus each thread, has its own.
+ */
+class RequestPoolSizer {
+public:
+	static const unsigned int SAMPLE_WINDOW = 1024;
+	static const unsigned int PERCENTILE = 95;
+	static const size_t MIN_POOL_SIZE = 4 * 1024;
+	static const size_t MAX_POOL_SIZE = 64 * 1024;
+
+private:
+	LatencyHistogram window;
+	size_t poolSize;
+	unsigned int resizes;
+	boost::uint64_t totalExtraBlocks;
+	boost::uint64_t totalLargeAllocations;
+	boost::uint64_t totalLargeBytes;
+
+	static size_t roundUpToPowerOfTwo(size_t value) {
+		size_t result = 1;
+		while (result < value) {
+			result *= 2;
+		}
+		return result;
+	}
+
+	void recalculate() {
+		size_t newSize = roundUpToPowerOfTwo(
+			window.getValueAtPercentile(PERCENTILE));
+		if (newSize < MIN_POOL_SIZE) {
+			newSize = MIN_POOL_SIZE;
+		} else if (newSize > MAX_POOL_SIZE) {
+			newSize = MAX_POOL_SIZE;
+		}
+		if (newSize != poolSize) {
+			poolSize = newSize;
+			resizes++;
+		}
+		window.reset();
+	}
+
+public:
+	RequestPoolSizer()
+		: poolSize(PSG_DEFAULT_POOL_SIZE),
+		  resizes(0),
+		  totalExtraBlocks(0),
+		  totalLargeAllocations(0),
+		  totalLargeBytes(0)
+		{ }
+
+	/**
+	 * Records the usage of a request pool. Must be called right before
+	 * the pool is reset or destroyed. A pool that was already reset
+	 * carries no information and is ignored.
+	 */
+	void recordUsage(const psg_pool_t *pool) {
+		psg_pool_stats_t stats;
+
+		memset(&stats, 0, sizeof(stats));
+		psg_pool_add_stats(pool, &stats);
+		if (stats.blocks == 1 && stats.large_allocations == 0
+		 && stats.used_bytes <= sizeof(psg_pool_t))
+		{
+			return;
+		}
+
+		totalExtraBlocks += stats.blocks - 1;
+		totalLargeAllocations += stats.large_allocations;
+		totalLargeBytes += stats.large_bytes;
+		window.record(stats.used_bytes);
+		if (window.getCount() >= SAMPLE_WINDOW) {
+			recalculate();
+		}
+	}
+
+	/** The size with which new request pools should be created. */
+	size_t getPoolSize() const {
+		return poolSize;
+	}
+
+	unsigned int getResizeCount() const {
+		return resizes;
+	}
+
+	/** Total number of blocks that request pools had to add to their first one. */
+	boost::uint64_t getTotalExtraBlocks() const {
+		return totalExtraBlocks;
+	}
+
+	/** Total number of allocations too large to be served from request pools. */
+	boost::uint64_t getTotalLargeAllocations() const {
+		return totalLargeAllocations;
+	}
+
+	boost::uint64_t getTotalLargeBytes() const {
+		return totalLargeBytes;
+	}
+};
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_REQUEST_POOL_SIZER_H_ */
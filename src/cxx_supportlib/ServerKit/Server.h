@@ -69,6 +69,7 @@
 #include <Utils/ScopeGuard.h>
 #include <StrIntTools/StrIntUtils.h>
 #include <IOTools/IOUtils.h>
+#include <JsonTools/JsonWriter.h>
 #include <SystemTools/SystemTime.h>
 
 namespace Passenger {
@@ -902,6 +903,25 @@ public:
 			"Freed " << count << " spare client objects");
 	}
 
+	/**
+	 * Frees spare client objects (and whatever else subclasses keep around in
+	 * freelists) as well as the free blocks in the mbuf pool. Returns
+	 * the memory usage before and after compaction.
+	 */
+	Json::Value compactMemory(LoggingKit::Level logLevel = LoggingKit::NOTICE) {
+		Json::Value doc;
+		unsigned int mbufBlocksFreed;
+
+		doc["before"] = inspectMemoryUsageAsJson();
+		compact(logLevel);
+		mbufBlocksFreed = MemoryKit::mbuf_pool_compact(&ctx->mbuf_pool);
+		SKS_LOG(logLevel, __FILE__, __LINE__,
+			"Freed " << mbufBlocksFreed << " spare mbuf blocks");
+		doc["after"] = inspectMemoryUsageAsJson();
+		doc["mbuf_blocks_freed"] = mbufBlocksFreed;
+		return doc;
+	}
+
 
 	/***** Client management *****/
 
@@ -1123,16 +1143,59 @@ public:
 		return config.inspect();
 	}
 
-	virtual Json::Value inspectStateAsJson() const {
-		Json::Value doc = ctx->inspectStateAsJson();
+	/**
+	 * Inspects the state of this server, including the state of all clients.
+	 * With many clients, prefer `writeStateAsJson()`, which doesn't build
+	 * the whole document in memory.
+	 */
+	Json::Value inspectStateAsJson() const {
+		Json::Value doc = inspectServerStateAsJson();
+		Json::Value &activeClientsDoc = doc["active_clients"] = Json::Value(Json::objectValue);
+		Json::Value &disconnectedClientsDoc = doc["disconnected_clients"] = Json::Value(Json::objectValue);
 		const Client *client;
 
+		TAILQ_FOREACH (client, &activeClients, nextClient.activeOrDisconnectedClient) {
+			char clientName[16];
+
+			getClientName(client, clientName, sizeof(clientName));
+			activeClientsDoc[clientName] = inspectClientStateAsJson(client);
+		}
+
+		TAILQ_FOREACH (client, &disconnectedClients, nextClient.activeOrDisconnectedClient) {
+			char clientName[16];
+
+			getClientName(client, clientName, sizeof(clientName));
+			disconnectedClientsDoc[clientName] = inspectClientStateAsJson(client);
+		}
+
+		return doc;
+	}
+
+	/**
+	 * Writes the same document as `inspectStateAsJson()`, but only builds
+	 * the document of one client at a time.
+	 */
+	void writeStateAsJson(JsonWriter &writer) const {
+		writer.beginObject();
+		writer.members(inspectServerStateAsJson());
+		writer.key("active_clients");
+		writeClientsStateAsJson(writer, &activeClients);
+		writer.key("disconnected_clients");
+		writeClientsStateAsJson(writer, &disconnectedClients);
+		writer.endObject();
+	}
+
+	/**
+	 * Inspects the state of this server, except for the clients. Subclasses
+	 * extend this with their own state.
+	 */
+	virtual Json::Value inspectServerStateAsJson() const {
+		Json::Value doc = ctx->inspectStateAsJson();
+
 		doc["pid"] = (unsigned int) getpid();
 		doc["server_state"] = getServerStateString();
 		doc["free_client_count"] = freeClientCount;
-		Json::Value &activeClientsDoc = doc["active_clients"] = Json::Value(Json::objectValue);
 		doc["active_client_count"] = activeClientCount;
-		Json::Value &disconnectedClientsDoc = doc["disconnected_clients"] = Json::Value(Json::objectValue);
 		doc["disconnected_client_count"] = disconnectedClientCount;
 		doc["peak_active_client_count"] = peakActiveClientCount;
 		doc["client_accept_speed"]["1m"] = averageSpeedToJson(
@@ -1143,24 +1206,60 @@ public:
 			"minute", "1 hour", -1);
 		doc["total_clients_accepted"] = (Json::UInt64) totalClientsAccepted;
 		doc["total_bytes_consumed"] = (Json::UInt64) totalBytesConsumed;
+		doc["memory"] = inspectMemoryUsageAsJson();
 
-		TAILQ_FOREACH (client, &activeClients, nextClient.activeOrDisconnectedClient) {
-			Json::Value subdoc;
-			char clientName[16];
+		return doc;
+	}
 
-			getClientName(client, clientName, sizeof(clientName));
-			activeClientsDoc[clientName] = inspectClientStateAsJson(client);
-		}
+	/**
+	 * Reports how much memory this server uses, per subsystem. Subclasses
+	 * extend this with the objects that they manage.
+	 */
+	virtual Json::Value inspectMemoryUsageAsJson() const {
+		Json::Value doc;
+		const Client *client;
+		unsigned int clientCount = activeClientCount + disconnectedClientCount;
+		boost::uint64_t inMemory = 0, onDisk = 0;
+
+		doc["mbuf_pool"]["active"] = byteSizeToJson(
+			MemoryKit::mbuf_pool_active_bytes(&ctx->mbuf_pool));
+		doc["mbuf_pool"]["spare"] = byteSizeToJson(
+			MemoryKit::mbuf_pool_spare_bytes(&ctx->mbuf_pool));
+		doc["mbuf_pool"]["slabs"] = byteSizeToJson(
+			MemoryKit::mbuf_pool_slab_bytes(&ctx->mbuf_pool));
+
+		doc["client_objects"]["active_count"] = clientCount;
+		doc["client_objects"]["free_count"] = freeClientCount;
+		doc["client_objects"]["object_size"] = (Json::UInt) sizeof(Client);
+		doc["client_objects"]["memory"] = byteSizeToJson(
+			(clientCount + freeClientCount) * sizeof(Client));
 
+		TAILQ_FOREACH (client, &activeClients, nextClient.activeOrDisconnectedClient) {
+			inMemory += client->output.getBytesBuffered();
+			onDisk += client->output.getBytesBufferedOnDisk();
+		}
 		TAILQ_FOREACH (client, &disconnectedClients, nextClient.activeOrDisconnectedClient) {
-			Json::Value subdoc;
+			inMemory += client->output.getBytesBuffered();
+			onDisk += client->output.getBytesBufferedOnDisk();
+		}
+		doc["client_output_buffers"]["in_memory"] = byteSizeToJson(inMemory);
+		doc["client_output_buffers"]["on_disk"] = byteSizeToJson(onDisk);
+
+		return doc;
+	}
+
+	void writeClientsStateAsJson(JsonWriter &writer, const ClientList *clients) const {
+		const Client *client;
+
+		writer.beginObject();
+		TAILQ_FOREACH (client, clients, nextClient.activeOrDisconnectedClient) {
 			char clientName[16];
 
 			getClientName(client, clientName, sizeof(clientName));
-			disconnectedClientsDoc[clientName] = inspectClientStateAsJson(client);
+			writer.key(clientName);
+			writer.value(inspectClientStateAsJson(client));
 		}
-
-		return doc;
+		writer.endObject();
 	}
 
 	virtual Json::Value inspectClientStateAsJson(const Client *client) const {
@@ -0,0 +1,228 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_UTILS_OPEN_METRICS_H_
+#define _PASSENGER_UTILS_OPEN_METRICS_H_
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <algorithm>
+#include <cstdio>
+
+#include <StaticString.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * A monotonically increasing counter which can be read from any thread
+ * without locking.
+ *
+ * Counters are meant to have a single writer at a time: either a single
+ * thread (such as an event loop thread), or any thread holding a lock which
+ * protects the counter. This allows increments to be plain loads and stores
+ * instead of (much more expensive) atomic read-modify-write operations,
+ * while readers never see torn values.
+ */
+class MetricCounter {
+private:
+	boost::atomic<boost::uint64_t> value;
+
+public:
+	MetricCounter()
+		: value(0)
+		{ }
+
+	void add(boost::uint64_t amount = 1) {
+		value.store(value.load(boost::memory_order_relaxed) + amount,
+			boost::memory_order_relaxed);
+	}
+
+	boost::uint64_t get() const {
+		return value.load(boost::memory_order_relaxed);
+	}
+};
+
+/**
+ * A value that can go up and down, which can be read from any thread
+ * without locking. The same single writer rule as for MetricCounter applies.
+ */
+class MetricGauge {
+private:
+	boost::atomic<boost::int64_t> value;
+
+public:
+	MetricGauge()
+		: value(0)
+		{ }
+
+	void set(boost::int64_t newValue) {
+		value.store(newValue, boost::memory_order_relaxed);
+	}
+
+	boost::int64_t get() const {
+		return value.load(boost::memory_order_relaxed);
+	}
+};
+
+/**
+ * Padding to put between groups of metrics which are written by different
+ * threads, so that they do not share a cache line.
+ */
+struct MetricsCacheLinePadding {
+	char padding[64];
+};
+
+
+/**
+ * Formats metrics in the Prometheus/OpenMetrics text exposition format.
+ *
+ *     OpenMetricsWriter writer;
+ *     writer.declare("passenger_requests_total", "counter", "Number of requests");
+ *     writer.sample("passenger_requests_total", 1234, "thread", "1");
+ *     writer.finish();
+ *     writer.getOutput();
+ */
+class OpenMetricsWriter {
+private:
+	string output;
+
+	void appendEscapedLabelValue(const StaticString &value) {
+		const char *pos = value.data();
+		const char *end = value.data() + value.size();
+
+		while (pos < end) {
+			switch (*pos) {
+			case '\\':
+				output.append("\\\\", 2);
+				break;
+			case '"':
+				output.append("\\\"", 2);
+				break;
+			case '\n':
+				output.append("\\n", 2);
+				break;
+			default:
+				output.append(1, *pos);
+				break;
+			}
+			pos++;
+		}
+	}
+
+	void appendName(const StaticString &name, const StaticString &labelName,
+		const StaticString &labelValue)
+	{
+		output.append(name.data(), name.size());
+		if (!labelName.empty()) {
+			output.append(1, '{');
+			output.append(labelName.data(), labelName.size());
+			output.append("=\"", 2);
+			appendEscapedLabelValue(labelValue);
+			output.append("\"}", 2);
+		}
+		output.append(1, ' ');
+	}
+
+public:
+	OpenMetricsWriter() {
+		output.reserve(1024 * 4);
+	}
+
+	/**
+	 * Declares a metric family. `type` is one of "counter", "gauge" or
+	 * "unknown". Must be called before writing the family's samples.
+	 */
+	void declare(const StaticString &name, const StaticString &type,
+		const StaticString &help)
+	{
+		output.append("# TYPE ", 7);
+		output.append(name.data(), name.size());
+		output.append(1, ' ');
+		output.append(type.data(), type.size());
+		output.append("\n# HELP ", 8);
+		output.append(name.data(), name.size());
+		output.append(1, ' ');
+		output.append(help.data(), help.size());
+		output.append(1, '\n');
+	}
+
+	void sample(const StaticString &name, boost::uint64_t value,
+		const StaticString &labelName = StaticString(),
+		const StaticString &labelValue = StaticString())
+	{
+		char buf[sizeof(boost::uint64_t) * 3 + 1];
+		unsigned int size = integerToOtherBase<boost::uint64_t, 10>(value,
+			buf, sizeof(buf));
+		appendName(name, labelName, labelValue);
+		output.append(buf, size);
+		output.append(1, '\n');
+	}
+
+	void sample(const StaticString &name, boost::int64_t value,
+		const StaticString &labelName = StaticString(),
+		const StaticString &labelValue = StaticString())
+	{
+		if (value < 0) {
+			appendName(name, labelName, labelValue);
+			output.append(toString(value));
+			output.append(1, '\n');
+		} else {
+			sample(name, (boost::uint64_t) value, labelName, labelValue);
+		}
+	}
+
+	void sample(const StaticString &name, double value,
+		const StaticString &labelName = StaticString(),
+		const StaticString &labelValue = StaticString())
+	{
+		char buf[32];
+		int size = snprintf(buf, sizeof(buf), "%.6g", value);
+		appendName(name, labelName, labelValue);
+		output.append(buf, std::min<size_t>(size, sizeof(buf) - 1));
+		output.append(1, '\n');
+	}
+
+	/**
+	 * Terminates the exposition. Must be called exactly once, after
+	 * all metrics have been written.
+	 */
+	void finish() {
+		output.append("# EOF\n", 6);
+	}
+
+	const string &getOutput() const {
+		return output;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_UTILS_OPEN_METRICS_H_ */
@@ -0,0 +1,127 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2021 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SHARDED_CACHED_FILE_STAT_HPP_
+#define _PASSENGER_SHARDED_CACHED_FILE_STAT_HPP_
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <StaticString.h>
+#include <DataStructures/HashedStaticString.h>
+#include <Utils/CachedFileStat.hpp>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * A thread-safe CachedFileStat for use by many threads at the same time,
+ * such as the threads of an Apache worker process.
+ *
+ * It partitions files over a number of independent CachedFileStat shards by
+ * the hash of their filename. Each shard has its own lock, so threads only
+ * contend with each other when they stat files in the same shard at the same
+ * time. The throttling semantics are the same as those of CachedFileStat.
+ * The maximum size is divided evenly over the shards, so a file may be
+ * evicted a bit earlier than with a single CachedFileStat.
+ */
+class ShardedCachedFileStat: public boost::noncopyable {
+public:
+	static const unsigned int SHARD_COUNT = 16;
+
+private:
+	struct Shard {
+		boost::mutex syncher;
+		CachedFileStat cstat;
+	};
+
+	Shard shards[SHARD_COUNT];
+
+	Shard &getShard(const StaticString &filename) {
+		return shards[HashedStaticString(filename).hash() % SHARD_COUNT];
+	}
+
+public:
+	/**
+	 * @param maxSize The maximum total cache size. A size of 0 means unlimited.
+	 */
+	ShardedCachedFileStat(unsigned int maxSize = 0) {
+		setMaxSize(maxSize);
+	}
+
+	/**
+	 * Returns the CachedFileStat shard that caches `filename`, and the
+	 * mutex that must be held while using it. This allows passing a shard
+	 * to functions that accept a CachedFileStat and a mutex, such as
+	 * getFileType().
+	 */
+	CachedFileStat *getShard(const StaticString &filename, boost::mutex **syncher) {
+		Shard &shard = getShard(filename);
+		*syncher = &shard.syncher;
+		return &shard.cstat;
+	}
+
+	/**
+	 * Thread-safe version of CachedFileStat::stat().
+	 *
+	 * @throws SystemException
+	 * @throws boost::thread_interrupted
+	 */
+	int stat(const StaticString &filename, struct stat *buf, unsigned int throttleRate = 0) {
+		Shard &shard = getShard(filename);
+		boost::lock_guard<boost::mutex> l(shard.syncher);
+		return shard.cstat.stat(filename, buf, throttleRate);
+	}
+
+	/**
+	 * Changes the maximum total size of the cache. A size of 0 means unlimited.
+	 */
+	void setMaxSize(unsigned int maxSize) {
+		unsigned int shardMaxSize = (maxSize + SHARD_COUNT - 1) / SHARD_COUNT;
+		for (unsigned int i = 0; i < SHARD_COUNT; i++) {
+			boost::lock_guard<boost::mutex> l(shards[i].syncher);
+			shards[i].cstat.setMaxSize(shardMaxSize);
+		}
+	}
+
+	/**
+	 * Returns whether `filename` is in the cache.
+	 */
+	bool knows(const StaticString &filename) {
+		Shard &shard = getShard(filename);
+		boost::lock_guard<boost::mutex> l(shard.syncher);
+		return shard.cstat.knows(filename);
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_SHARDED_CACHED_FILE_STAT_HPP_ */
@@ -141,8 +141,33 @@ function tryWriteFile(path, contents) {
 	}
 }
 
+// With the compact spawn protocol, the work dir has no step directories.
+// See SpawningKit's README.md, section "The compact spawn protocol".
+function usesCompactSpawnProtocol(workDir) {
+	return !fs.existsSync(workDir + '/response/steps');
+}
+
+function reportJourneyStep(workDir, step, state, timeField) {
+	var path = workDir + '/response/finish';
+	var record = step.toLowerCase() + ' ' + state + ' ' + timeField + ' ' + (Date.now() / 1000) + '\n';
+	try {
+		var fd = fs.openSync(path, fs.constants.O_WRONLY | fs.constants.O_NONBLOCK);
+		try {
+			fs.writeSync(fd, record);
+		} finally {
+			fs.closeSync(fd);
+		}
+	} catch (e) {
+		console.error('Warning: unable to write to ' + path + ': ' + e.message);
+	}
+}
+
 function recordJourneyStepBegin(step, state) {
 	var workDir = process.env['PASSENGER_SPAWN_WORK_DIR'];
+	if (usesCompactSpawnProtocol(workDir)) {
+		reportJourneyStep(workDir, step, state, 'begin_time');
+		return;
+	}
 	var stepDir = workDir + '/response/steps/' + step.toLowerCase();
 	tryWriteFile(stepDir + '/state', 'STEP_IN_PROGRESS');
 	tryWriteFile(stepDir + '/begin_time', Date.now() / 1000);
@@ -150,6 +175,10 @@ function recordJourneyStepBegin(step, state) {
 
 function recordJourneyStepEnd(step, state) {
 	var workDir = process.env['PASSENGER_SPAWN_WORK_DIR'];
+	if (usesCompactSpawnProtocol(workDir)) {
+		reportJourneyStep(workDir, step, state, 'end_time');
+		return;
+	}
 	var stepDir = workDir + '/response/steps/' + step.toLowerCase();
 	tryWriteFile(stepDir + '/state', 'STEP_IN_PROGRESS');
 	if (!fs.existsSync(stepDir + '/begin_time') && !fs.existsSync(stepDir + '/begin_time_monotonic')) {
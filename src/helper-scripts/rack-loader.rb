@@ -46,14 +46,33 @@ def self.init_passenger
       record_journey_step_end('SUBPROCESS_EXEC_WRAPPER', 'STEP_PERFORMED')
       record_journey_step_begin('SUBPROCESS_WRAPPER_PREPARATION', 'STEP_IN_PROGRESS')
 
-      ruby_libdir = File.read("#{work_dir}/args/ruby_libdir").strip
-      passenger_root = File.read("#{work_dir}/args/passenger_root").strip
+      ruby_libdir = read_bootstrap_arg(work_dir, 'ruby_libdir')
+      passenger_root = read_bootstrap_arg(work_dir, 'passenger_root')
       require "#{ruby_libdir}/phusion_passenger"
       PhusionPassenger.locate_directories(passenger_root)
 
       PhusionPassenger.require_passenger_lib 'loader_shared_helpers'
     end
 
+    # With the compact spawn protocol, the work dir has no step directories
+    # and no args/ directory. See SpawningKit's README.md, section
+    # "The compact spawn protocol".
+    def self.compact_spawn_protocol?(work_dir)
+      !File.directory?("#{work_dir}/response/steps")
+    end
+
+    # Reads an argument that is needed for loading Passenger's Ruby
+    # libraries, which is why this cannot use Passenger's JSON parser.
+    # Paths contain no characters that args.json escapes, except " and \.
+    def self.read_bootstrap_arg(work_dir, name)
+      if compact_spawn_protocol?(work_dir)
+        File.read("#{work_dir}/args.json") =~ /"#{name}"\s*:\s*"((?:[^"\\]|\\.)*)"/
+        $1.gsub(/\\(.)/, '\\1')
+      else
+        File.read("#{work_dir}/args/#{name}").strip
+      end
+    end
+
     def self.try_write_file(path, contents)
       begin
         File.open(path, 'wb') do |f|
@@ -64,8 +83,21 @@ def self.try_write_file(path, contents)
       end
     end
 
+    def self.report_journey_step(work_dir, step, state, time_field)
+      path = "#{work_dir}/response/finish"
+      File.open(path, File::WRONLY | File::NONBLOCK) do |f|
+        f.syswrite("#{step.downcase} #{state} #{time_field} #{Time.now.to_f}\n")
+      end
+    rescue SystemCallError => e
+      STDERR.puts "Warning: unable to write to #{path}: #{e}"
+    end
+
     def self.record_journey_step_begin(step, state)
       dir = ENV['PASSENGER_SPAWN_WORK_DIR']
+      if compact_spawn_protocol?(dir)
+        report_journey_step(dir, step, state, 'begin_time')
+        return
+      end
       step_dir = "#{dir}/response/steps/#{step.downcase}"
       try_write_file("#{step_dir}/state", state)
       try_write_file("#{step_dir}/begin_time", Time.now.to_f)
@@ -73,6 +105,10 @@ def self.record_journey_step_begin(step, state)
 
     def self.record_journey_step_end(step, state)
       dir = ENV['PASSENGER_SPAWN_WORK_DIR']
+      if compact_spawn_protocol?(dir)
+        report_journey_step(dir, step, state, 'end_time')
+        return
+      end
       step_dir = "#{dir}/response/steps/#{step.downcase}"
       try_write_file("#{step_dir}/state", state)
       if !File.exist?("#{step_dir}/begin_time") && !File.exist?("#{step_dir}/begin_time_monotonic")
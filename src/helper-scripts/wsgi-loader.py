@@ -54,14 +54,37 @@ def read_startup_arguments():
 	with open(path, 'r') as f:
 		options = json.load(f)
 
+# With the compact spawn protocol, the work dir has no step directories.
+# See SpawningKit's README.md, section "The compact spawn protocol".
+def compact_spawn_protocol(work_dir):
+	return not os.path.isdir(work_dir + '/response/steps')
+
+def report_journey_step(work_dir, step, state, time_field):
+	path = work_dir + '/response/finish'
+	record = step.lower() + ' ' + state + ' ' + time_field + ' ' + str(time.time()) + '\n'
+	try:
+		fd = os.open(path, os.O_WRONLY | os.O_NONBLOCK)
+		try:
+			os.write(fd, record.encode('latin-1'))
+		finally:
+			os.close(fd)
+	except OSError as e:
+		logging.warn('Warning: unable to write to ' + path + ': ' + e.strerror)
+
 def record_journey_step_begin(step, state):
 	work_dir = os.getenv('PASSENGER_SPAWN_WORK_DIR')
+	if compact_spawn_protocol(work_dir):
+		report_journey_step(work_dir, step, state, 'begin_time')
+		return
 	step_dir = work_dir + '/response/steps/' + step.lower()
 	try_write_file(step_dir + '/state', state)
 	try_write_file(step_dir + '/begin_time', str(time.time()))
 
 def record_journey_step_end(step, state):
 	work_dir = os.getenv('PASSENGER_SPAWN_WORK_DIR')
+	if compact_spawn_protocol(work_dir):
+		report_journey_step(work_dir, step, state, 'end_time')
+		return
 	step_dir = work_dir + '/response/steps/' + step.lower()
 	try_write_file(step_dir + '/state', state)
 	if not os.path.exists(step_dir + '/begin_time') and not os.path.exists(step_dir + '/begin_time_monotonic'):
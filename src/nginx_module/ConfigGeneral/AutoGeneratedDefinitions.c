@@ -118,6 +118,22 @@
     offsetof(passenger_main_conf_t, autogenerated.socket_backlog),
     NULL
 },
+{
+    ngx_string("passenger_core_keepalive"),
+    NGX_HTTP_MAIN_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_core_keepalive,
+    NGX_HTTP_MAIN_CONF_OFFSET,
+    offsetof(passenger_main_conf_t, autogenerated.core_keepalive),
+    NULL
+},
+{
+    ngx_string("passenger_core_keepalive_timeout"),
+    NGX_HTTP_MAIN_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_core_keepalive_timeout,
+    NGX_HTTP_MAIN_CONF_OFFSET,
+    offsetof(passenger_main_conf_t, autogenerated.core_keepalive_timeout),
+    NULL
+},
 {
     ngx_string("passenger_core_file_descriptor_ulimit"),
     NGX_HTTP_MAIN_CONF | NGX_CONF_TAKE1,
@@ -358,6 +374,30 @@
     offsetof(passenger_loc_conf_t, autogenerated.min_instances),
     NULL
 },
+{
+    ngx_string("passenger_fair_share_weight"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_fair_share_weight,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.fair_share_weight),
+    NULL
+},
+{
+    ngx_string("passenger_rolling_restarts"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_FLAG,
+    passenger_conf_set_rolling_restarts,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.rolling_restarts),
+    NULL
+},
+{
+    ngx_string("passenger_warmup_uris"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_warmup_uris,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.warmup_uris),
+    NULL
+},
 {
     ngx_string("passenger_start_timeout"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
@@ -462,6 +502,14 @@
     offsetof(passenger_loc_conf_t, autogenerated.load_shell_envvars),
     NULL
 },
+{
+    ngx_string("passenger_shell_envvars_cache_ttl"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_shell_envvars_cache_ttl,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.shell_envvars_cache_ttl),
+    NULL
+},
 {
     ngx_string("passenger_max_request_queue_size"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
@@ -750,14 +798,6 @@
     0,
     NULL
 },
-{
-    ngx_string("passenger_rolling_restarts"),
-    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_FLAG,
-    passenger_enterprise_only,
-    NGX_HTTP_LOC_CONF_OFFSET,
-    0,
-    NULL
-},
 {
     ngx_string("passenger_resist_deployment_errors"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_FLAG,
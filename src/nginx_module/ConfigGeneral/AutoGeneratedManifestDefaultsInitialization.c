@@ -80,6 +80,18 @@ set_manifest_autogenerated_global_conf_defaults(manifest_gen_ctx_t *ctx) {
         sizeof("passenger_socket_backlog") - 1,
         2048);
 
+    add_manifest_options_container_static_default_uint(ctx,
+        ctx->global_config_container,
+        "passenger_core_keepalive",
+        sizeof("passenger_core_keepalive") - 1,
+        32);
+
+    add_manifest_options_container_static_default_uint(ctx,
+        ctx->global_config_container,
+        "passenger_core_keepalive_timeout",
+        sizeof("passenger_core_keepalive_timeout") - 1,
+        60);
+
     add_manifest_options_container_dynamic_default(ctx,
         ctx->global_config_container,
         "passenger_core_file_descriptor_ulimit",
@@ -227,6 +239,18 @@ set_manifest_autogenerated_app_conf_defaults(manifest_gen_ctx_t *ctx, PsgJsonVal
         sizeof("passenger_min_instances") - 1,
         1);
 
+    add_manifest_options_container_static_default_uint(ctx,
+        options_container,
+        "passenger_fair_share_weight",
+        sizeof("passenger_fair_share_weight") - 1,
+        1);
+
+    add_manifest_options_container_static_default_bool(ctx,
+        options_container,
+        "passenger_rolling_restarts",
+        sizeof("passenger_rolling_restarts") - 1,
+        0);
+
     add_manifest_options_container_static_default_uint(ctx,
         options_container,
         "passenger_start_timeout",
@@ -293,6 +317,12 @@ set_manifest_autogenerated_app_conf_defaults(manifest_gen_ctx_t *ctx, PsgJsonVal
         sizeof("passenger_load_shell_envvars") - 1,
         1);
 
+    add_manifest_options_container_static_default_uint(ctx,
+        options_container,
+        "passenger_shell_envvars_cache_ttl",
+        sizeof("passenger_shell_envvars_cache_ttl") - 1,
+        0);
+
     add_manifest_options_container_static_default_uint(ctx,
         options_container,
         "passenger_max_request_queue_size",
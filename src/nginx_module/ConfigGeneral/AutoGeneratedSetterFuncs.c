@@ -193,6 +193,30 @@ passenger_conf_set_socket_backlog(ngx_conf_t *cf, ngx_command_t *cmd, void *conf
     return ngx_conf_set_num_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_core_keepalive(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_main_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.core_keepalive_explicitly_set = 1;
+    record_main_conf_source_location(cf,
+        &passenger_conf->autogenerated.core_keepalive_source_file,
+        &passenger_conf->autogenerated.core_keepalive_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
+static char *
+passenger_conf_set_core_keepalive_timeout(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_main_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.core_keepalive_timeout_explicitly_set = 1;
+    record_main_conf_source_location(cf,
+        &passenger_conf->autogenerated.core_keepalive_timeout_source_file,
+        &passenger_conf->autogenerated.core_keepalive_timeout_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_core_file_descriptor_ulimit(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_main_conf_t *passenger_conf = conf;
@@ -553,6 +577,42 @@ passenger_conf_set_min_instances(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     return ngx_conf_set_num_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_fair_share_weight(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.fair_share_weight_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.fair_share_weight_source_file,
+        &passenger_conf->autogenerated.fair_share_weight_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
+static char *
+passenger_conf_set_rolling_restarts(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.rolling_restarts_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.rolling_restarts_source_file,
+        &passenger_conf->autogenerated.rolling_restarts_source_line);
+
+    return ngx_conf_set_flag_slot(cf, cmd, conf);
+}
+
+static char *
+passenger_conf_set_warmup_uris(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.warmup_uris_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.warmup_uris_source_file,
+        &passenger_conf->autogenerated.warmup_uris_source_line);
+
+    return ngx_conf_set_str_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_start_timeout(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_loc_conf_t *passenger_conf = conf;
@@ -709,6 +769,18 @@ passenger_conf_set_load_shell_envvars(ngx_conf_t *cf, ngx_command_t *cmd, void *
     return ngx_conf_set_flag_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_shell_envvars_cache_ttl(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.shell_envvars_cache_ttl_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.shell_envvars_cache_ttl_source_file,
+        &passenger_conf->autogenerated.shell_envvars_cache_ttl_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_max_request_queue_size(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_loc_conf_t *passenger_conf = conf;
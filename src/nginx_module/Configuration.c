@@ -37,6 +37,7 @@
 #include "ngx_http_passenger_module.h"
 #include "Configuration.h"
 #include "ContentHandler.h"
+#include "UpstreamKeepalive.h"
 #include "ConfigGeneral/AutoGeneratedManifestDefaultsInitialization.c"
 #include "ConfigGeneral/AutoGeneratedSetterFuncs.c"
 #include "ConfigGeneral/ManifestGeneration.c"
@@ -61,6 +62,9 @@ static ngx_str_t headers_to_hide[] = {
 
 passenger_main_conf_t passenger_main_conf;
 
+/* See passenger_loc_conf_t.config_id. */
+static ngx_uint_t last_config_id = 0;
+
 static ngx_path_init_t  ngx_http_proxy_temp_path = {
     ngx_string(NGX_HTTP_PROXY_TEMP_PATH), { 1, 2, 0 }
 };
@@ -115,6 +119,14 @@ passenger_init_main_conf(ngx_conf_t *cf, void *conf_pointer)
         conf->autogenerated.show_version_in_header = 1;
     }
 
+    if (conf->autogenerated.core_keepalive == NGX_CONF_UNSET_UINT) {
+        conf->autogenerated.core_keepalive = 32;
+    }
+
+    if (conf->autogenerated.core_keepalive_timeout == NGX_CONF_UNSET_UINT) {
+        conf->autogenerated.core_keepalive_timeout = 60;
+    }
+
     if (conf->autogenerated.default_user.len == 0) {
         conf->autogenerated.default_user.len  = sizeof(DEFAULT_WEB_APP_USER) - 1;
         conf->autogenerated.default_user.data = (u_char *) DEFAULT_WEB_APP_USER;
@@ -266,6 +278,7 @@ passenger_create_loc_conf(ngx_conf_t *cf)
     conf->options_cache.len   = 0;
     conf->env_vars_cache.data = NULL;
     conf->env_vars_cache.len  = 0;
+    conf->config_id = 0;
 
     return conf;
 }
@@ -340,8 +353,32 @@ serialize_loc_conf_to_headers(ngx_conf_t *cf, passenger_loc_conf_t *conf)
         conf->env_vars_cache.data = buf;
         conf->env_vars_cache.len = len;
         free(unencoded_buf);
+
+        /* Append the env vars header to options_cache, so that all
+         * location-wide headers can be sent as a single buffer.
+         */
+        len = conf->options_cache.len
+            + sizeof("!~PASSENGER_ENV_VARS: \r\n") - 1
+            + conf->env_vars_cache.len;
+        buf = ngx_palloc(cf->pool, len);
+        if (buf == NULL) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "cannot allocate buffer of %z bytes for options cache",
+                               len);
+            return NGX_ERROR;
+        }
+        pos = ngx_copy(buf, conf->options_cache.data, conf->options_cache.len);
+        pos = ngx_copy(pos, "!~PASSENGER_ENV_VARS: ",
+            sizeof("!~PASSENGER_ENV_VARS: ") - 1);
+        pos = ngx_copy(pos, conf->env_vars_cache.data, conf->env_vars_cache.len);
+        pos = ngx_copy(pos, "\r\n", sizeof("\r\n") - 1);
+
+        conf->options_cache.data = buf;
+        conf->options_cache.len = len;
     }
 
+    conf->config_id = ++last_config_id;
+
     return NGX_OK;
 }
 
@@ -1128,6 +1165,11 @@ passenger_enabled(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         if (passenger_conf->upstream_config.upstream == NULL) {
             return NGX_CONF_ERROR;
         }
+        /* Cache idle connections to the Passenger core. All locations share
+         * the same upstream, so this is idempotent.
+         */
+        passenger_conf->upstream_config.upstream->peer.init_upstream =
+            passenger_keepalive_init_upstream;
 
         clcf = ngx_http_conf_get_module_loc_conf(cf, ngx_http_core_module);
         clcf->handler = passenger_content_handler;
@@ -63,6 +63,9 @@ struct passenger_loc_conf_s {
     /** Raw HTTP header data for this location are cached here. */
     ngx_str_t    options_cache;
     ngx_str_t    env_vars_cache;
+    /** Identifies options_cache in the Passenger core's configuration
+     * snapshots. Unique within the configuration generation. */
+    ngx_uint_t   config_id;
 };
 
 #ifndef _PASSENGER_NGINX_MODULE_CONF_STRUCT_TYPEDEFS_H_
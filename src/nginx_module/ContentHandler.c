@@ -30,6 +30,7 @@
 #include "ngx_http_passenger_module.h"
 #include "ContentHandler.h"
 #include "StaticContentHandler.h"
+#include "UpstreamKeepalive.h"
 #include "Configuration.h"
 #include "cxx_supportlib/Constants.h"
 #include "cxx_supportlib/FileTools/PathManipCBindings.h"
@@ -50,6 +51,9 @@ static ngx_int_t process_status_line(ngx_http_request_t *r);
 static ngx_int_t parse_status_line(ngx_http_request_t *r,
     passenger_context_t *context);
 static ngx_int_t process_header(ngx_http_request_t *r);
+static ngx_int_t input_filter_init(void *data);
+static ngx_int_t copy_filter(ngx_event_pipe_t *p, ngx_buf_t *buf);
+static ngx_int_t non_buffered_copy_filter(void *data, ssize_t bytes);
 static void abort_request(ngx_http_request_t *r);
 static void finalize_request(ngx_http_request_t *r, ngx_int_t rc);
 
@@ -256,12 +260,12 @@ fix_peer_address(ngx_http_request_t *r) {
     const char                       *core_address;
     unsigned int                      core_address_len;
 
-    if (r->upstream->peer.get != ngx_http_upstream_get_round_robin_peer) {
+    rrp = passenger_keepalive_get_round_robin_peer_data(&r->upstream->peer);
+    if (rrp == NULL) {
         /* This function only supports the round-robin upstream method. */
         return;
     }
 
-    rrp        = r->upstream->peer.data;
     peers      = rrp->peers;
     core_address =
         psg_watchdog_launcher_get_core_address(psg_watchdog_launcher,
@@ -331,6 +335,20 @@ header_is_transfer_encoding(ngx_str_t *key)
         ngx_strncasecmp(key->data + 1, (u_char *) "ransfer-encodin", sizeof("ransfer-encodin") - 1) == 0;
 }
 
+/* Returns whether the given client request header should not be passed to
+ * the Passenger core because it conflicts with keeping the connection to the
+ * Passenger core alive. The client's Connection header only applies to the
+ * connection between the client and Nginx, unless it's a protocol upgrade.
+ */
+static int
+header_is_hop_by_hop_connection(ngx_http_request_t *r, ngx_str_t *key)
+{
+    return passenger_main_conf.autogenerated.core_keepalive > 0 &&
+        r->headers_in.upgrade == NULL &&
+        key->len == sizeof("connection") - 1 &&
+        ngx_strncasecmp(key->data, (u_char *) "connection", sizeof("connection") - 1) == 0;
+}
+
 /* Given an ngx_chain_t head and tail position, appends a new chain element at the end,
  * updates the head (if necessary) and returns the new element.
  *
@@ -740,7 +758,11 @@ construct_request_buffer(ngx_http_request_t *r, passenger_loc_conf_t *slcf,
         total_size += r->args.len + 1;
     }
 
-    PUSH_STATIC_STR(" HTTP/1.1\r\nConnection: close\r\n");
+    if (passenger_main_conf.autogenerated.core_keepalive > 0) {
+        PUSH_STATIC_STR(" HTTP/1.1\r\n");
+    } else {
+        PUSH_STATIC_STR(" HTTP/1.1\r\nConnection: close\r\n");
+    }
 
     part = &r->headers_in.headers.part;
     header = part->elts;
@@ -757,7 +779,8 @@ construct_request_buffer(ngx_http_request_t *r, passenger_loc_conf_t *slcf,
 
         if (ngx_hash_find(&slcf->headers_set_hash, header[i].hash,
                           header[i].lowcase_key, header[i].key.len)
-         || (!r->request_body_no_buffering && header_is_transfer_encoding(&header[i].key)))
+         || (!r->request_body_no_buffering && header_is_transfer_encoding(&header[i].key))
+         || header_is_hop_by_hop_connection(r, &header[i].key))
         {
             continue;
         }
@@ -977,22 +1000,10 @@ construct_request_buffer(ngx_http_request_t *r, passenger_loc_conf_t *slcf,
         PUSH_STATIC_STR("\r\n");
     }
 
-    if (b != NULL) {
-        b->last = ngx_copy(b->last, slcf->options_cache.data, slcf->options_cache.len);
-    }
-    total_size += slcf->options_cache.len;
-
-    if (slcf->env_vars_cache.data != NULL) {
-        PUSH_STATIC_STR("!~PASSENGER_ENV_VARS: ");
-        if (b != NULL) {
-            b->last = ngx_copy(b->last, slcf->env_vars_cache.data, slcf->env_vars_cache.len);
-        }
-        total_size += slcf->env_vars_cache.len;
-        PUSH_STATIC_STR("\r\n");
-    }
-
     /* D = Dechunk response
-     *     Prevent Nginx from rechunking the response.
+     *     Prevent Nginx from rechunking the response. Dechunked responses
+     *     are not framed, so the Passenger core closes the connection
+     *     after them instead of keeping it alive.
      * B = Buffer request body
      * C = Strip 100 Continue header
      * S = SSL
@@ -1008,7 +1019,11 @@ construct_request_buffer(ngx_http_request_t *r, passenger_loc_conf_t *slcf,
             PUSH_STATIC_STR("S");
         }
     #endif
-    PUSH_STATIC_STR("\r\n\r\n");
+    PUSH_STATIC_STR("\r\n");
+
+    /* The location-wide headers (slcf->options_cache) and the end of the
+     * header are added by create_request().
+     */
 
     return total_size;
 
@@ -1049,6 +1064,42 @@ create_request(ngx_http_request_t *r)
         return NGX_ERROR;
     }
     cl->buf = b;
+    context->header_link = cl;
+
+    /* The location-wide headers are sent directly from the configuration. */
+    if (slcf->options_cache.len > 0) {
+        b = ngx_calloc_buf(r->pool);
+        if (b == NULL) {
+            return NGX_ERROR;
+        }
+        b->memory = 1;
+        b->start = b->pos = slcf->options_cache.data;
+        b->end = b->last = slcf->options_cache.data + slcf->options_cache.len;
+
+        cl->next = ngx_alloc_chain_link(r->pool);
+        if (cl->next == NULL) {
+            return NGX_ERROR;
+        }
+        cl = cl->next;
+        cl->buf = b;
+        context->config_link = cl;
+    }
+
+    b = ngx_calloc_buf(r->pool);
+    if (b == NULL) {
+        return NGX_ERROR;
+    }
+    b->memory = 1;
+    b->start = b->pos = (u_char *) "\r\n";
+    b->end = b->last = b->start + sizeof("\r\n") - 1;
+
+    cl->next = ngx_alloc_chain_link(r->pool);
+    if (cl->next == NULL) {
+        return NGX_ERROR;
+    }
+    cl = cl->next;
+    cl->buf = b;
+    context->end_link = cl;
 
 
     /* Pass already received request body buffers. Make sure they come
@@ -1131,6 +1182,59 @@ create_request(ngx_http_request_t *r)
 }
 
 
+ngx_int_t
+passenger_select_config_headers(ngx_http_request_t *r,
+    passenger_config_slots_t *slots)
+{
+    passenger_loc_conf_t  *slcf;
+    passenger_context_t   *context;
+    ngx_buf_t             *b;
+    ngx_uint_t             i, registering;
+
+    context = ngx_http_get_module_ctx(r, ngx_http_passenger_module);
+    if (context == NULL || context->end_link == NULL) {
+        return NGX_OK;
+    }
+    slcf = ngx_http_get_module_loc_conf(r, ngx_http_passenger_module);
+
+    for (i = 0; i < PASSENGER_CONFIG_SLOTS; i++) {
+        if (slots->ids[i] == slcf->config_id) {
+            break;
+        }
+    }
+
+    registering = (i == PASSENGER_CONFIG_SLOTS);
+    if (registering) {
+        i = slots->next;
+        slots->next = (i + 1) % PASSENGER_CONFIG_SLOTS;
+        slots->ids[i] = slcf->config_id;
+    }
+
+    b = ngx_create_temp_buf(r->pool,
+        sizeof("!~PASSENGER_REGISTER_CONFIG: \r\n\r\n") - 1
+        + 2 * NGX_INT_T_LEN + 1);
+    if (b == NULL) {
+        return NGX_ERROR;
+    }
+    b->last = ngx_sprintf(b->last, "%s: %ui %ui\r\n\r\n",
+        registering ? (u_char *) "!~PASSENGER_REGISTER_CONFIG"
+            : (u_char *) "!~PASSENGER_CONFIG",
+        i, slcf->config_id);
+    b->flush = context->end_link->buf->flush;
+    context->end_link->buf = b;
+
+    /* This may be called again if the request is retried over another
+     * connection, so always relink.
+     */
+    if (registering && context->config_link != NULL) {
+        context->header_link->next = context->config_link;
+    } else {
+        context->header_link->next = context->end_link;
+    }
+
+    return NGX_OK;
+}
+
 static ngx_int_t
 reinit_request(ngx_http_request_t *r)
 {
@@ -1607,6 +1711,180 @@ process_header(ngx_http_request_t *r)
 }
 
 
+/* The input filters below are like the ones in Nginx's proxy module, minus
+ * chunked encoding support: the Passenger core dechunks responses for us.
+ * They keep track of the response body length, so that we know when a
+ * response has ended without the Passenger core having to close the
+ * connection. This is what allows the connection to be cached by the
+ * upstream keepalive cache.
+ */
+static ngx_int_t
+input_filter_init(void *data)
+{
+    ngx_http_request_t   *r = data;
+    ngx_http_upstream_t  *u;
+
+    u = r->upstream;
+
+    if (u->headers_in.status_n == NGX_HTTP_NO_CONTENT
+        || u->headers_in.status_n == NGX_HTTP_NOT_MODIFIED
+        || r->method == NGX_HTTP_HEAD)
+    {
+        /* 204, 304 and replies to HEAD requests don't have a body. */
+        u->pipe->length = 0;
+        u->length = 0;
+        u->keepalive = !u->headers_in.connection_close;
+
+    } else if (u->headers_in.content_length_n == 0) {
+        /* Empty body: special case as the filters won't be called. */
+        u->pipe->length = 0;
+        u->length = 0;
+        u->keepalive = !u->headers_in.connection_close;
+
+    } else {
+        /* Content length, or -1 if the body ends when the connection is closed. */
+        u->pipe->length = u->headers_in.content_length_n;
+        u->length = u->headers_in.content_length_n;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+copy_filter(ngx_event_pipe_t *p, ngx_buf_t *buf)
+{
+    ngx_buf_t           *b;
+    ngx_chain_t         *cl;
+    ngx_http_request_t  *r;
+
+    if (buf->pos == buf->last) {
+        return NGX_OK;
+    }
+
+    r = p->input_ctx;
+
+    if (p->upstream_done) {
+        ngx_log_debug0(NGX_LOG_DEBUG_HTTP, p->log, 0,
+                       "Passenger data after close");
+        return NGX_OK;
+    }
+
+    if (p->length == 0) {
+        ngx_log_error(NGX_LOG_WARN, p->log, 0,
+                      "upstream sent more data than specified in "
+                      "\"Content-Length\" header");
+        r->upstream->keepalive = 0;
+        p->upstream_done = 1;
+        return NGX_OK;
+    }
+
+    cl = ngx_chain_get_free_buf(p->pool, &p->free);
+    if (cl == NULL) {
+        return NGX_ERROR;
+    }
+
+    b = cl->buf;
+
+    ngx_memcpy(b, buf, sizeof(ngx_buf_t));
+    b->shadow = buf;
+    b->tag = p->tag;
+    b->last_shadow = 1;
+    b->recycled = 1;
+    buf->shadow = b;
+
+    if (p->in) {
+        *p->last_in = cl;
+    } else {
+        p->in = cl;
+    }
+    p->last_in = &cl->next;
+
+    if (p->length == -1) {
+        return NGX_OK;
+    }
+
+    if (b->last - b->pos > p->length) {
+        ngx_log_error(NGX_LOG_WARN, p->log, 0,
+                      "upstream sent more data than specified in "
+                      "\"Content-Length\" header");
+        b->last = b->pos + p->length;
+        p->upstream_done = 1;
+        return NGX_OK;
+    }
+
+    p->length -= b->last - b->pos;
+
+    if (p->length == 0) {
+        r->upstream->keepalive = !r->upstream->headers_in.connection_close;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+non_buffered_copy_filter(void *data, ssize_t bytes)
+{
+    ngx_http_request_t   *r = data;
+    ngx_buf_t            *b;
+    ngx_chain_t          *cl, **ll;
+    ngx_http_upstream_t  *u;
+
+    u = r->upstream;
+
+    if (u->length == 0) {
+        ngx_log_error(NGX_LOG_WARN, r->connection->log, 0,
+                      "upstream sent more data than specified in "
+                      "\"Content-Length\" header");
+        u->keepalive = 0;
+        return NGX_OK;
+    }
+
+    for (cl = u->out_bufs, ll = &u->out_bufs; cl; cl = cl->next) {
+        ll = &cl->next;
+    }
+
+    cl = ngx_chain_get_free_buf(r->pool, &u->free_bufs);
+    if (cl == NULL) {
+        return NGX_ERROR;
+    }
+
+    *ll = cl;
+
+    cl->buf->flush = 1;
+    cl->buf->memory = 1;
+
+    b = &u->buffer;
+
+    cl->buf->pos = b->last;
+    b->last += bytes;
+    cl->buf->last = b->last;
+    cl->buf->tag = u->output.tag;
+
+    if (u->length == -1) {
+        return NGX_OK;
+    }
+
+    if (bytes > u->length) {
+        ngx_log_error(NGX_LOG_WARN, r->connection->log, 0,
+                      "upstream sent more data than specified in "
+                      "\"Content-Length\" header");
+        cl->buf->last = cl->buf->pos + u->length;
+        u->length = 0;
+        return NGX_OK;
+    }
+
+    u->length -= bytes;
+
+    if (u->length == 0) {
+        u->keepalive = !u->headers_in.connection_close;
+    }
+
+    return NGX_OK;
+}
+
+
 static void
 abort_request(ngx_http_request_t *r)
 {
@@ -1824,9 +2102,13 @@ passenger_content_handler(ngx_http_request_t *r)
         return NGX_HTTP_INTERNAL_SERVER_ERROR;
     }
 
-    u->pipe->input_filter = ngx_event_pipe_copy_input_filter;
+    u->pipe->input_filter = copy_filter;
     u->pipe->input_ctx = r;
 
+    u->input_filter_init = input_filter_init;
+    u->input_filter = non_buffered_copy_filter;
+    u->input_filter_ctx = r;
+
     r->request_body_no_buffering = !slcf->upstream_config.request_buffering;
 
     rc = ngx_http_read_client_request_body(r, ngx_http_upstream_init);
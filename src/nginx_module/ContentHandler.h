@@ -53,10 +53,44 @@ typedef struct {
 
     /** Detected information about the app. */
     PsgAppTypeDetectorResult *detector_result;
+
+    /** The request header is sent as three chain links: the per-request
+     * headers, the location-wide headers (NULL if there are none) and
+     * the end of the header. See passenger_select_config_headers(). */
+    ngx_chain_t *header_link;
+    ngx_chain_t *config_link;
+    ngx_chain_t *end_link;
 } passenger_context_t;
 
+/* The maximum number of configuration snapshots per Passenger core
+ * connection. Must not exceed ConfigSnapshot::MAX_SLOTS in the core.
+ */
+#define PASSENGER_CONFIG_SLOTS 16
+
+/**
+ * The location configurations that have been registered on a Passenger
+ * core connection, by slot. Zero means that the slot is free.
+ */
+typedef struct {
+    ngx_uint_t  ids[PASSENGER_CONFIG_SLOTS];
+    ngx_uint_t  next;
+} passenger_config_slots_t;
+
 
 ngx_int_t passenger_content_handler(ngx_http_request_t *r);
 
+/**
+ * Called when the connection that the request will be sent over is known.
+ * If the location's configuration is already registered on the connection,
+ * then the location-wide headers are left out of the request header, and
+ * the Passenger core is told to use its snapshot of them instead. Otherwise
+ * they are sent and registered in the next slot, replacing the oldest
+ * registration if all slots are taken.
+ *
+ * If this is not called, then all headers are sent without registering.
+ */
+ngx_int_t passenger_select_config_headers(ngx_http_request_t *r,
+    passenger_config_slots_t *slots);
+
 
 #endif /* _PASSENGER_NGINX_CONTENT_HANDLER_H_ */
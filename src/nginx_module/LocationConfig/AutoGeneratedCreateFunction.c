@@ -52,6 +52,10 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->environment.len  = 0;
     conf->friendly_error_pages = NGX_CONF_UNSET;
     conf->min_instances = NGX_CONF_UNSET_UINT;
+    conf->fair_share_weight = NGX_CONF_UNSET_UINT;
+    conf->rolling_restarts = NGX_CONF_UNSET;
+    conf->warmup_uris.data = NULL;
+    conf->warmup_uris.len  = 0;
     conf->start_timeout = NGX_CONF_UNSET_UINT;
     conf->user.data = NULL;
     conf->user.len  = 0;
@@ -72,6 +76,7 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->direct_instance_request_address.data = NULL;
     conf->direct_instance_request_address.len  = 0;
     conf->load_shell_envvars = NGX_CONF_UNSET;
+    conf->shell_envvars_cache_ttl = NGX_CONF_UNSET_UINT;
     conf->max_request_queue_size = NGX_CONF_UNSET_UINT;
     conf->app_type.data = NULL;
     conf->app_type.len  = 0;
@@ -130,6 +135,18 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->min_instances_source_file.len = 0;
     conf->min_instances_source_line = 0;
     conf->min_instances_explicitly_set = 0;
+    conf->fair_share_weight_source_file.data = NULL;
+    conf->fair_share_weight_source_file.len = 0;
+    conf->fair_share_weight_source_line = 0;
+    conf->fair_share_weight_explicitly_set = 0;
+    conf->rolling_restarts_source_file.data = NULL;
+    conf->rolling_restarts_source_file.len = 0;
+    conf->rolling_restarts_source_line = 0;
+    conf->rolling_restarts_explicitly_set = 0;
+    conf->warmup_uris_source_file.data = NULL;
+    conf->warmup_uris_source_file.len = 0;
+    conf->warmup_uris_source_line = 0;
+    conf->warmup_uris_explicitly_set = 0;
     conf->start_timeout_source_file.data = NULL;
     conf->start_timeout_source_file.len = 0;
     conf->start_timeout_source_line = 0;
@@ -182,6 +199,10 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->load_shell_envvars_source_file.len = 0;
     conf->load_shell_envvars_source_line = 0;
     conf->load_shell_envvars_explicitly_set = 0;
+    conf->shell_envvars_cache_ttl_source_file.data = NULL;
+    conf->shell_envvars_cache_ttl_source_file.len = 0;
+    conf->shell_envvars_cache_ttl_source_line = 0;
+    conf->shell_envvars_cache_ttl_explicitly_set = 0;
     conf->max_request_queue_size_source_file.data = NULL;
     conf->max_request_queue_size_source_file.len = 0;
     conf->max_request_queue_size_source_line = 0;
@@ -96,6 +96,29 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         len += sizeof("\r\n") - 1;
     }
 
+    if (conf->autogenerated.fair_share_weight != NGX_CONF_UNSET_UINT) {
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.fair_share_weight);
+        len += sizeof("!~PASSENGER_FAIR_SHARE_WEIGHT: ") - 1;
+        len += end - int_buf;
+        len += sizeof("\r\n") - 1;
+    }
+
+    if (conf->autogenerated.rolling_restarts != NGX_CONF_UNSET) {
+        len += sizeof("!~PASSENGER_ROLLING_RESTARTS: ") - 1;
+        len += conf->autogenerated.rolling_restarts
+            ? sizeof("t\r\n") - 1
+            : sizeof("f\r\n") - 1;
+    }
+
+    if (conf->autogenerated.warmup_uris.data != NULL) {
+        len += sizeof("!~PASSENGER_WARMUP_URIS: ") - 1;
+        len += conf->autogenerated.warmup_uris.len;
+        len += sizeof("\r\n") - 1;
+    }
+
     if (conf->autogenerated.start_timeout != NGX_CONF_UNSET_UINT) {
         end = ngx_snprintf(int_buf,
             sizeof(int_buf) - 1,
@@ -172,6 +195,16 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
             : sizeof("f\r\n") - 1;
     }
 
+    if (conf->autogenerated.shell_envvars_cache_ttl != NGX_CONF_UNSET_UINT) {
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.shell_envvars_cache_ttl);
+        len += sizeof("!~PASSENGER_SHELL_ENVVARS_CACHE_TTL: ") - 1;
+        len += end - int_buf;
+        len += sizeof("\r\n") - 1;
+    }
+
     if (conf->autogenerated.max_request_queue_size != NGX_CONF_UNSET_UINT) {
         end = ngx_snprintf(int_buf,
             sizeof(int_buf) - 1,
@@ -336,6 +369,37 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         pos = ngx_copy(pos, int_buf, end - int_buf);
         pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
     }
+    if (conf->autogenerated.fair_share_weight != NGX_CONF_UNSET_UINT) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_FAIR_SHARE_WEIGHT: ",
+            sizeof("!~PASSENGER_FAIR_SHARE_WEIGHT: ") - 1);
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.fair_share_weight);
+        pos = ngx_copy(pos, int_buf, end - int_buf);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
+    if (conf->autogenerated.rolling_restarts != NGX_CONF_UNSET) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_ROLLING_RESTARTS: ",
+            sizeof("!~PASSENGER_ROLLING_RESTARTS: ") - 1);
+        if (conf->autogenerated.rolling_restarts) {
+            pos = ngx_copy(pos, "t\r\n", sizeof("t\r\n") - 1);
+        } else {
+            pos = ngx_copy(pos, "f\r\n", sizeof("f\r\n") - 1);
+        }
+    }
+
+    if (conf->autogenerated.warmup_uris.data != NULL) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_WARMUP_URIS: ",
+            sizeof("!~PASSENGER_WARMUP_URIS: ") - 1);
+        pos = ngx_copy(pos,
+            conf->autogenerated.warmup_uris.data,
+            conf->autogenerated.warmup_uris.len);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
     if (conf->autogenerated.start_timeout != NGX_CONF_UNSET_UINT) {
         pos = ngx_copy(pos,
             "!~PASSENGER_START_TIMEOUT: ",
@@ -443,6 +507,17 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         }
     }
 
+    if (conf->autogenerated.shell_envvars_cache_ttl != NGX_CONF_UNSET_UINT) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_SHELL_ENVVARS_CACHE_TTL: ",
+            sizeof("!~PASSENGER_SHELL_ENVVARS_CACHE_TTL: ") - 1);
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.shell_envvars_cache_ttl);
+        pos = ngx_copy(pos, int_buf, end - int_buf);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
     if (conf->autogenerated.max_request_queue_size != NGX_CONF_UNSET_UINT) {
         pos = ngx_copy(pos,
             "!~PASSENGER_MAX_REQUEST_QUEUE_SIZE: ",
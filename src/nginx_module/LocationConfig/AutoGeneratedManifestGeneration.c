@@ -142,6 +142,46 @@ generate_config_manifest_for_autogenerated_loc_conf(manifest_gen_ctx_t *ctx, pas
         psg_json_value_set_uint(hierarchy_member, "value",
             plcf->autogenerated.min_instances);
     }
+    if (plcf->autogenerated.fair_share_weight_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_fair_share_weight",
+            sizeof("passenger_fair_share_weight") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.fair_share_weight_source_file,
+            plcf->autogenerated.fair_share_weight_source_line);
+        psg_json_value_set_uint(hierarchy_member, "value",
+            plcf->autogenerated.fair_share_weight);
+    }
+    if (plcf->autogenerated.rolling_restarts_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_rolling_restarts",
+            sizeof("passenger_rolling_restarts") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.rolling_restarts_source_file,
+            plcf->autogenerated.rolling_restarts_source_line);
+        psg_json_value_set_bool(hierarchy_member, "value",
+            plcf->autogenerated.rolling_restarts);
+    }
+    if (plcf->autogenerated.warmup_uris_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_warmup_uris",
+            sizeof("passenger_warmup_uris") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.warmup_uris_source_file,
+            plcf->autogenerated.warmup_uris_source_line);
+        psg_json_value_set_str(hierarchy_member, "value",
+            (const char *) plcf->autogenerated.warmup_uris.data,
+            plcf->autogenerated.warmup_uris.len);
+    }
     if (plcf->autogenerated.start_timeout_explicitly_set) {
         find_or_create_manifest_app_and_loc_options_containers(ctx,
             plcf, cscf, clcf, &app_options_container, &loc_options_container);
@@ -318,6 +358,19 @@ generate_config_manifest_for_autogenerated_loc_conf(manifest_gen_ctx_t *ctx, pas
         psg_json_value_set_bool(hierarchy_member, "value",
             plcf->autogenerated.load_shell_envvars);
     }
+    if (plcf->autogenerated.shell_envvars_cache_ttl_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_shell_envvars_cache_ttl",
+            sizeof("passenger_shell_envvars_cache_ttl") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.shell_envvars_cache_ttl_source_file,
+            plcf->autogenerated.shell_envvars_cache_ttl_source_line);
+        psg_json_value_set_uint(hierarchy_member, "value",
+            plcf->autogenerated.shell_envvars_cache_ttl);
+    }
     if (plcf->autogenerated.max_request_queue_size_explicitly_set) {
         find_or_create_manifest_app_and_loc_options_containers(ctx,
             plcf, cscf, clcf, &app_options_container, &loc_options_container);
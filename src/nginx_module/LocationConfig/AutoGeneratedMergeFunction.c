@@ -64,6 +64,15 @@ passenger_merge_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t *conf,
     ngx_conf_merge_uint_value(conf->min_instances,
         prev->min_instances,
         1);
+    ngx_conf_merge_uint_value(conf->fair_share_weight,
+        prev->fair_share_weight,
+        1);
+    ngx_conf_merge_value(conf->rolling_restarts,
+        prev->rolling_restarts,
+        0);
+    ngx_conf_merge_str_value(conf->warmup_uris,
+        prev->warmup_uris,
+        NULL);
     ngx_conf_merge_uint_value(conf->start_timeout,
         prev->start_timeout,
         90);
@@ -107,6 +116,9 @@ passenger_merge_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t *conf,
     ngx_conf_merge_value(conf->load_shell_envvars,
         prev->load_shell_envvars,
         1);
+    ngx_conf_merge_uint_value(conf->shell_envvars_cache_ttl,
+        prev->shell_envvars_cache_ttl,
+        0);
     ngx_conf_merge_uint_value(conf->max_request_queue_size,
         prev->max_request_queue_size,
         100);
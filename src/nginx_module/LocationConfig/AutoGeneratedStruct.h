@@ -45,6 +45,7 @@ typedef struct {
     ngx_flag_t debugger;
     ngx_flag_t enabled;
     ngx_array_t *env_vars;
+    ngx_uint_t fair_share_weight;
     ngx_int_t force_max_concurrent_requests_per_process;
     ngx_flag_t friendly_error_pages;
     ngx_uint_t headers_hash_bucket_size;
@@ -57,6 +58,8 @@ typedef struct {
     ngx_uint_t min_instances;
     ngx_array_t *monitor_log_file;
     ngx_int_t request_queue_overflow_status_code;
+    ngx_flag_t rolling_restarts;
+    ngx_uint_t shell_envvars_cache_ttl;
     ngx_uint_t start_timeout;
     ngx_flag_t sticky_sessions;
     ngx_str_t app_group_name;
@@ -80,6 +83,7 @@ typedef struct {
     ngx_str_t sticky_sessions_cookie_name;
     ngx_str_t user;
     ngx_str_t vary_turbocache_by_cookie;
+    ngx_str_t warmup_uris;
 
     ngx_str_t abort_websockets_on_process_shutdown_source_file;
     ngx_str_t app_group_name_source_file;
@@ -96,6 +100,7 @@ typedef struct {
     ngx_str_t enabled_source_file;
     ngx_str_t env_vars_source_file;
     ngx_str_t environment_source_file;
+    ngx_str_t fair_share_weight_source_file;
     ngx_str_t force_max_concurrent_requests_per_process_source_file;
     ngx_str_t friendly_error_pages_source_file;
     ngx_str_t group_source_file;
@@ -113,7 +118,9 @@ typedef struct {
     ngx_str_t python_source_file;
     ngx_str_t request_queue_overflow_status_code_source_file;
     ngx_str_t restart_dir_source_file;
+    ngx_str_t rolling_restarts_source_file;
     ngx_str_t ruby_source_file;
+    ngx_str_t shell_envvars_cache_ttl_source_file;
     ngx_str_t spawn_method_source_file;
     ngx_str_t start_timeout_source_file;
     ngx_str_t startup_file_source_file;
@@ -133,6 +140,7 @@ typedef struct {
     ngx_str_t upstream_config_temp_path_source_file;
     ngx_str_t user_source_file;
     ngx_str_t vary_turbocache_by_cookie_source_file;
+    ngx_str_t warmup_uris_source_file;
 
     ngx_uint_t abort_websockets_on_process_shutdown_source_line;
     ngx_uint_t app_group_name_source_line;
@@ -149,6 +157,7 @@ typedef struct {
     ngx_uint_t enabled_source_line;
     ngx_uint_t env_vars_source_line;
     ngx_uint_t environment_source_line;
+    ngx_uint_t fair_share_weight_source_line;
     ngx_uint_t force_max_concurrent_requests_per_process_source_line;
     ngx_uint_t friendly_error_pages_source_line;
     ngx_uint_t group_source_line;
@@ -166,7 +175,9 @@ typedef struct {
     ngx_uint_t python_source_line;
     ngx_uint_t request_queue_overflow_status_code_source_line;
     ngx_uint_t restart_dir_source_line;
+    ngx_uint_t rolling_restarts_source_line;
     ngx_uint_t ruby_source_line;
+    ngx_uint_t shell_envvars_cache_ttl_source_line;
     ngx_uint_t spawn_method_source_line;
     ngx_uint_t start_timeout_source_line;
     ngx_uint_t startup_file_source_line;
@@ -186,6 +197,7 @@ typedef struct {
     ngx_uint_t upstream_config_temp_path_source_line;
     ngx_uint_t user_source_line;
     ngx_uint_t vary_turbocache_by_cookie_source_line;
+    ngx_uint_t warmup_uris_source_line;
 
     ngx_int_t abort_websockets_on_process_shutdown_explicitly_set;
     ngx_int_t app_group_name_explicitly_set;
@@ -202,6 +214,7 @@ typedef struct {
     ngx_int_t enabled_explicitly_set;
     ngx_int_t env_vars_explicitly_set;
     ngx_int_t environment_explicitly_set;
+    ngx_int_t fair_share_weight_explicitly_set;
     ngx_int_t force_max_concurrent_requests_per_process_explicitly_set;
     ngx_int_t friendly_error_pages_explicitly_set;
     ngx_int_t group_explicitly_set;
@@ -219,7 +232,9 @@ typedef struct {
     ngx_int_t python_explicitly_set;
     ngx_int_t request_queue_overflow_status_code_explicitly_set;
     ngx_int_t restart_dir_explicitly_set;
+    ngx_int_t rolling_restarts_explicitly_set;
     ngx_int_t ruby_explicitly_set;
+    ngx_int_t shell_envvars_cache_ttl_explicitly_set;
     ngx_int_t spawn_method_explicitly_set;
     ngx_int_t start_timeout_explicitly_set;
     ngx_int_t startup_file_explicitly_set;
@@ -239,4 +254,5 @@ typedef struct {
     ngx_int_t upstream_config_temp_path_explicitly_set;
     ngx_int_t user_explicitly_set;
     ngx_int_t vary_turbocache_by_cookie_explicitly_set;
+    ngx_int_t warmup_uris_explicitly_set;
 } passenger_autogenerated_loc_conf_t;
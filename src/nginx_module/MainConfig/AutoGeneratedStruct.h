@@ -42,6 +42,8 @@ typedef struct {
     ngx_flag_t abort_on_startup_error;
     ngx_uint_t app_file_descriptor_ulimit;
     ngx_uint_t core_file_descriptor_ulimit;
+    ngx_uint_t core_keepalive;
+    ngx_uint_t core_keepalive_timeout;
     ngx_array_t *ctl;
     ngx_flag_t disable_anonymous_telemetry;
     ngx_flag_t disable_log_prefix;
@@ -81,6 +83,8 @@ typedef struct {
     ngx_str_t anonymous_telemetry_proxy_source_file;
     ngx_str_t app_file_descriptor_ulimit_source_file;
     ngx_str_t core_file_descriptor_ulimit_source_file;
+    ngx_str_t core_keepalive_source_file;
+    ngx_str_t core_keepalive_timeout_source_file;
     ngx_str_t ctl_source_file;
     ngx_str_t data_buffer_dir_source_file;
     ngx_str_t default_group_source_file;
@@ -115,6 +119,8 @@ typedef struct {
     ngx_uint_t anonymous_telemetry_proxy_source_line;
     ngx_uint_t app_file_descriptor_ulimit_source_line;
     ngx_uint_t core_file_descriptor_ulimit_source_line;
+    ngx_uint_t core_keepalive_source_line;
+    ngx_uint_t core_keepalive_timeout_source_line;
     ngx_uint_t ctl_source_line;
     ngx_uint_t data_buffer_dir_source_line;
     ngx_uint_t default_group_source_line;
@@ -149,6 +155,8 @@ typedef struct {
     ngx_int_t anonymous_telemetry_proxy_explicitly_set;
     ngx_int_t app_file_descriptor_ulimit_explicitly_set;
     ngx_int_t core_file_descriptor_ulimit_explicitly_set;
+    ngx_int_t core_keepalive_explicitly_set;
+    ngx_int_t core_keepalive_timeout_explicitly_set;
     ngx_int_t ctl_explicitly_set;
     ngx_int_t data_buffer_dir_explicitly_set;
     ngx_int_t default_group_explicitly_set;
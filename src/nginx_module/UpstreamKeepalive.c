@@ -0,0 +1,354 @@
+/*
+ * Copyright (C) Maxim Dounin
+ * Copyright (C) Nginx, Inc.
+ * Copyright (c) 2021 Phusion Holding B.V.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+
+/*
+ * This is a trimmed-down version of Nginx's ngx_http_upstream_keepalive_module.
+ * The Passenger upstream only ever has a single peer (the Passenger core's
+ * request socket), so unlike the original we don't need to match cached
+ * connections against the peer address picked by the balancer.
+ */
+
+#include "UpstreamKeepalive.h"
+#include "Configuration.h"
+#include "ContentHandler.h"
+
+
+typedef struct {
+    ngx_queue_t               queue;
+    ngx_connection_t         *connection;
+    passenger_config_slots_t  config_slots;
+} keepalive_cache_item_t;
+
+typedef struct {
+    ngx_http_request_t      *request;
+    ngx_http_upstream_t     *upstream;
+    passenger_config_slots_t config_slots;
+    void                    *data;
+    ngx_event_get_peer_pt    original_get_peer;
+    ngx_event_free_peer_pt   original_free_peer;
+} keepalive_peer_data_t;
+
+/* The connection cache is per worker process, so it's lazily
+ * initialized when the first request is processed.
+ */
+static struct {
+    ngx_uint_t                       max_cached;
+    ngx_msec_t                       timeout;
+    ngx_queue_t                      cache;
+    ngx_queue_t                      free;
+    unsigned                         initialized: 1;
+    ngx_http_upstream_init_peer_pt   original_init_peer;
+} keepalive;
+
+
+static ngx_int_t init_keepalive_peer(ngx_http_request_t *r,
+    ngx_http_upstream_srv_conf_t *us);
+static ngx_int_t get_keepalive_peer(ngx_peer_connection_t *pc, void *data);
+static void free_keepalive_peer(ngx_peer_connection_t *pc, void *data,
+    ngx_uint_t state);
+static void keepalive_dummy_handler(ngx_event_t *ev);
+static void keepalive_close_handler(ngx_event_t *ev);
+static void close_keepalive_connection(ngx_connection_t *c);
+
+
+ngx_int_t
+passenger_keepalive_init_upstream(ngx_conf_t *cf, ngx_http_upstream_srv_conf_t *us)
+{
+    if (ngx_http_upstream_init_round_robin(cf, us) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    keepalive.original_init_peer = us->peer.init;
+    us->peer.init = init_keepalive_peer;
+
+    return NGX_OK;
+}
+
+ngx_http_upstream_rr_peer_data_t *
+passenger_keepalive_get_round_robin_peer_data(ngx_peer_connection_t *pc)
+{
+    keepalive_peer_data_t  *kp;
+
+    if (pc->get == get_keepalive_peer) {
+        kp = pc->data;
+        if (kp->original_get_peer == ngx_http_upstream_get_round_robin_peer) {
+            return kp->data;
+        }
+    } else if (pc->get == ngx_http_upstream_get_round_robin_peer) {
+        return pc->data;
+    }
+
+    return NULL;
+}
+
+static ngx_int_t
+init_keepalive_cache(void)
+{
+    keepalive_cache_item_t  *items;
+    ngx_uint_t               i;
+
+    keepalive.max_cached = passenger_main_conf.autogenerated.core_keepalive;
+    keepalive.timeout = passenger_main_conf.autogenerated.core_keepalive_timeout * 1000;
+
+    ngx_queue_init(&keepalive.cache);
+    ngx_queue_init(&keepalive.free);
+
+    if (keepalive.max_cached > 0) {
+        items = ngx_pcalloc(ngx_cycle->pool,
+                            sizeof(keepalive_cache_item_t) * keepalive.max_cached);
+        if (items == NULL) {
+            return NGX_ERROR;
+        }
+
+        for (i = 0; i < keepalive.max_cached; i++) {
+            ngx_queue_insert_head(&keepalive.free, &items[i].queue);
+        }
+    }
+
+    keepalive.initialized = 1;
+    return NGX_OK;
+}
+
+static ngx_int_t
+init_keepalive_peer(ngx_http_request_t *r, ngx_http_upstream_srv_conf_t *us)
+{
+    keepalive_peer_data_t  *kp;
+
+    if (keepalive.original_init_peer(r, us) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    if (!keepalive.initialized && init_keepalive_cache() != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    if (keepalive.max_cached == 0) {
+        return NGX_OK;
+    }
+
+    kp = ngx_palloc(r->pool, sizeof(keepalive_peer_data_t));
+    if (kp == NULL) {
+        return NGX_ERROR;
+    }
+
+    kp->request = r;
+    kp->upstream = r->upstream;
+    kp->data = r->upstream->peer.data;
+    kp->original_get_peer = r->upstream->peer.get;
+    kp->original_free_peer = r->upstream->peer.free;
+
+    r->upstream->peer.data = kp;
+    r->upstream->peer.get = get_keepalive_peer;
+    r->upstream->peer.free = free_keepalive_peer;
+
+    return NGX_OK;
+}
+
+static ngx_int_t
+get_keepalive_peer(ngx_peer_connection_t *pc, void *data)
+{
+    keepalive_peer_data_t   *kp = data;
+    keepalive_cache_item_t  *item;
+    ngx_int_t                rc;
+    ngx_queue_t             *q;
+    ngx_connection_t        *c;
+
+    /* Let the balancer fill in the peer address and name. */
+    rc = kp->original_get_peer(pc, kp->data);
+    if (rc != NGX_OK) {
+        return rc;
+    }
+
+    if (ngx_queue_empty(&keepalive.cache)) {
+        /* A new connection has no configurations registered. */
+        ngx_memzero(&kp->config_slots, sizeof(passenger_config_slots_t));
+        return passenger_select_config_headers(kp->request, &kp->config_slots);
+    }
+
+    q = ngx_queue_head(&keepalive.cache);
+    ngx_queue_remove(q);
+    ngx_queue_insert_head(&keepalive.free, q);
+    item = ngx_queue_data(q, keepalive_cache_item_t, queue);
+    c = item->connection;
+
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
+                   "reusing cached Passenger core connection %p", c);
+
+    kp->config_slots = item->config_slots;
+
+    c->idle = 0;
+    c->sent = 0;
+    c->data = NULL;
+    c->log = pc->log;
+    c->read->log = pc->log;
+    c->write->log = pc->log;
+    c->pool->log = pc->log;
+
+    if (c->read->timer_set) {
+        ngx_del_timer(c->read);
+    }
+
+    pc->connection = c;
+    pc->cached = 1;
+
+    if (passenger_select_config_headers(kp->request, &kp->config_slots) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    return NGX_DONE;
+}
+
+static void
+free_keepalive_peer(ngx_peer_connection_t *pc, void *data, ngx_uint_t state)
+{
+    keepalive_peer_data_t   *kp = data;
+    keepalive_cache_item_t  *item;
+    ngx_queue_t             *q;
+    ngx_connection_t        *c;
+    ngx_http_upstream_t     *u;
+
+    u = kp->upstream;
+    c = pc->connection;
+
+    /* The Passenger core responds with "Connection: close" (and thus
+     * u->keepalive is never set) if it did not read the entire request
+     * body, so we don't have to check for that here.
+     */
+    if (state & NGX_PEER_FAILED
+        || c == NULL
+        || c->read->eof
+        || c->read->error
+        || c->read->timedout
+        || c->write->error
+        || c->write->timedout
+        || !u->keepalive
+        || ngx_terminate
+        || ngx_exiting
+        || ngx_handle_read_event(c->read, 0) != NGX_OK)
+    {
+        goto invalid;
+    }
+
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
+                   "caching Passenger core connection %p", c);
+
+    if (ngx_queue_empty(&keepalive.free)) {
+        q = ngx_queue_last(&keepalive.cache);
+        ngx_queue_remove(q);
+        item = ngx_queue_data(q, keepalive_cache_item_t, queue);
+        close_keepalive_connection(item->connection);
+    } else {
+        q = ngx_queue_head(&keepalive.free);
+        ngx_queue_remove(q);
+        item = ngx_queue_data(q, keepalive_cache_item_t, queue);
+    }
+
+    ngx_queue_insert_head(&keepalive.cache, q);
+
+    item->connection = c;
+    item->config_slots = kp->config_slots;
+    pc->connection = NULL;
+
+    c->read->delayed = 0;
+    ngx_add_timer(c->read, keepalive.timeout);
+
+    if (c->write->timer_set) {
+        ngx_del_timer(c->write);
+    }
+
+    c->write->handler = keepalive_dummy_handler;
+    c->read->handler = keepalive_close_handler;
+
+    c->data = item;
+    c->idle = 1;
+    c->log = ngx_cycle->log;
+    c->read->log = ngx_cycle->log;
+    c->write->log = ngx_cycle->log;
+    c->pool->log = ngx_cycle->log;
+
+    if (c->read->ready) {
+        keepalive_close_handler(c->read);
+    }
+
+invalid:
+
+    kp->original_free_peer(pc, kp->data, state);
+}
+
+static void
+keepalive_dummy_handler(ngx_event_t *ev)
+{
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ev->log, 0,
+                   "Passenger core keepalive dummy handler");
+}
+
+/* Called when a cached connection becomes readable, times out, or when
+ * the worker is shutting down. The Passenger core doesn't send anything
+ * on an idle connection, so readability means that it closed the
+ * connection.
+ */
+static void
+keepalive_close_handler(ngx_event_t *ev)
+{
+    keepalive_cache_item_t  *item;
+    ngx_connection_t        *c;
+    int                      n;
+    char                     buf[1];
+
+    c = ev->data;
+
+    if (c->close || c->read->timedout) {
+        goto close;
+    }
+
+    n = recv(c->fd, buf, 1, MSG_PEEK);
+
+    if (n == -1 && ngx_socket_errno == NGX_EAGAIN) {
+        ev->ready = 0;
+
+        if (ngx_handle_read_event(c->read, 0) != NGX_OK) {
+            goto close;
+        }
+
+        return;
+    }
+
+close:
+
+    item = c->data;
+    close_keepalive_connection(c);
+    ngx_queue_remove(&item->queue);
+    ngx_queue_insert_head(&keepalive.free, &item->queue);
+}
+
+static void
+close_keepalive_connection(ngx_connection_t *c)
+{
+    ngx_destroy_pool(c->pool);
+    ngx_close_connection(c);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) Maxim Dounin
+ * Copyright (C) Nginx, Inc.
+ * Copyright (c) 2021 Phusion Holding B.V.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+
+#ifndef _PASSENGER_NGINX_UPSTREAM_KEEPALIVE_H_
+#define _PASSENGER_NGINX_UPSTREAM_KEEPALIVE_H_
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+/**
+ * A cache of idle connections to the Passenger core, so that requests
+ * don't have to set up a new connection (and the Passenger core doesn't
+ * have to set up a new client) every time. This works like the `keepalive`
+ * directive of Nginx's upstream module: it wraps the round-robin balancer
+ * of the Passenger upstream and keeps up to `passenger_core_keepalive` idle
+ * connections per worker process, each for at most
+ * `passenger_core_keepalive_timeout` seconds.
+ *
+ * A connection is only put back in the cache if the response was fully
+ * read and properly framed. The content handler signals that by setting
+ * `u->keepalive`.
+ *
+ * Each connection also remembers which location configurations have been
+ * registered on it, so that requests over reused connections don't have to
+ * resend them. See passenger_select_config_headers().
+ */
+
+ngx_int_t passenger_keepalive_init_upstream(ngx_conf_t *cf,
+                                            ngx_http_upstream_srv_conf_t *us);
+
+/**
+ * Returns the round-robin balancer data of the given upstream peer connection,
+ * regardless of whether it's wrapped by the connection cache. Returns NULL
+ * if the peer doesn't use the round-robin balancer.
+ */
+ngx_http_upstream_rr_peer_data_t *passenger_keepalive_get_round_robin_peer_data(
+    ngx_peer_connection_t *pc);
+
+#endif /* _PASSENGER_NGINX_UPSTREAM_KEEPALIVE_H_ */
@@ -388,6 +388,25 @@
     :header    => 'PASSENGER_MIN_PROCESSES',
     :desc      => 'The minimum number of application instances to keep when cleaning idle instances.'
   },
+  {
+    :name      => 'PassengerFairShareWeight',
+    :type      => :integer,
+    :min_value => 1,
+    :default   => 1,
+    :desc      => 'The weight of this application when dividing the pool capacity between applications.'
+  },
+  {
+    :name      => 'PassengerRollingRestarts',
+    :type      => :flag,
+    :default   => false,
+    :desc      => 'Whether to turn on rolling restarts.'
+  },
+  {
+    :name      => 'PassengerWarmupURIs',
+    :type      => :string,
+    :header    => 'PASSENGER_WARMUP_URIS',
+    :desc      => 'A space-separated list of URIs to request on new application instances, during rolling restarts, before they start receiving traffic.'
+  },
   {
     :name      => 'PassengerUser',
     :type      => :string,
@@ -437,6 +456,14 @@
     :default   => true,
     :desc      => 'Whether to load environment variables from the shell before running the application.'
   },
+  {
+    :name      => 'PassengerShellEnvvarsCacheTTL',
+    :type      => :integer,
+    :min_value => 0,
+    :default   => 0,
+    :header    => 'PASSENGER_SHELL_ENVVARS_CACHE_TTL',
+    :desc      => 'The number of seconds for which the environment variables loaded from the shell may be cached and reused by later application instances. 0 disables caching.'
+  },
   {
     :name      => 'PassengerSpawnMethod',
     :type      => :string,
@@ -609,13 +636,6 @@
     :field     => nil,
     :desc      => "The maximum number of instances for the current application that #{PROGRAM_NAME} may spawn."
   },
-  {
-    :name      => 'PassengerRollingRestarts',
-    :type      => :flag,
-    :function  => 'cmd_passenger_enterprise_only',
-    :field     => nil,
-    :desc      => "Whether to turn on rolling restarts."
-  },
   {
     :name      => 'PassengerResistDeploymentErrors',
     :type      => :flag,
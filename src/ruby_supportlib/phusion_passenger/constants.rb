@@ -68,6 +68,9 @@ module SharedConstants
     DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK = 1024 * 1024 * 128
     DEFAULT_MAX_REQUEST_QUEUE_SIZE = 100
     DEFAULT_STAT_THROTTLE_RATE = 10
+    DEFAULT_EVENT_LOOP_STALL_THRESHOLD = 1000
+    DEFAULT_EVENT_LOOP_STALL_LOG_INTERVAL = 60
+    DEFAULT_REQUEST_TRACE_BUFFER_SIZE = 4096
     DEFAULT_ANALYTICS_LOG_USER = DEFAULT_WEB_APP_USER
     DEFAULT_ANALYTICS_LOG_GROUP = ""
     DEFAULT_ANALYTICS_LOG_PERMISSIONS = "u=rwx,g=rx,o=rx"
@@ -83,6 +86,7 @@ module SharedConstants
     SPAWNINGKIT_MAX_PROPERTIES_JSON_SIZE = 1024 * 32
     SPAWNINGKIT_MAX_ERROR_CATEGORY_SIZE = 32
     SPAWNINGKIT_MAX_JOURNEY_STEP_FILE_SIZE = 32
+    SPAWNINGKIT_MAX_JOURNEY_STEP_RECORD_SIZE = 256
     # Small mbuf sizes avoid memory overhead (up to 1 blocksize per request), but
     # also introduce context switching and smaller transfer writes. The size is picked
     # to balance this out.
@@ -185,6 +185,22 @@
     :context  => [:main],
     :struct   => "NGX_HTTP_MAIN_CONF_OFFSET"
   },
+  {
+    :name     => 'passenger_core_keepalive',
+    :scope    => :global,
+    :type     => :uinteger,
+    :default  => 32,
+    :context  => [:main],
+    :struct   => 'NGX_HTTP_MAIN_CONF_OFFSET'
+  },
+  {
+    :name     => 'passenger_core_keepalive_timeout',
+    :scope    => :global,
+    :type     => :uinteger,
+    :default  => 60,
+    :context  => [:main],
+    :struct   => 'NGX_HTTP_MAIN_CONF_OFFSET'
+  },
   {
     :name     => 'passenger_core_file_descriptor_ulimit',
     :scope    => :global,
@@ -410,6 +426,23 @@
     :default  => 1,
     :header   => 'PASSENGER_MIN_PROCESSES'
   },
+  {
+    :name     => 'passenger_fair_share_weight',
+    :scope    => :application,
+    :type     => :uinteger,
+    :default  => 1
+  },
+  {
+    :name     => 'passenger_rolling_restarts',
+    :scope    => :application,
+    :type     => :flag,
+    :default  => false
+  },
+  {
+    :name     => 'passenger_warmup_uris',
+    :scope    => :application,
+    :type     => :string
+  },
   {
     :name     => 'passenger_start_timeout',
     :scope    => :application,
@@ -488,6 +521,12 @@
     :type     => :flag,
     :default  => true
   },
+  {
+    :name     => 'passenger_shell_envvars_cache_ttl',
+    :scope    => :application,
+    :type     => :uinteger,
+    :default  => 0
+  },
   {
     :name     => 'passenger_max_request_queue_size',
     :scope    => :application,
@@ -747,13 +786,6 @@
     :function => 'passenger_enterprise_only',
     :field    => nil
   },
-  {
-    :name     => 'passenger_rolling_restarts',
-    :scope    => :application,
-    :type     => :flag,
-    :function => 'passenger_enterprise_only',
-    :field    => nil
-  },
   {
     :name     => 'passenger_resist_deployment_errors',
     :scope    => :application,
@@ -0,0 +1,657 @@
+/*
+ * passenger-bench: an end-to-end load benchmark for the Core controller.
+ *
+ * Starts a Core controller in-process, backed by an ApplicationPool that uses
+ * the DummySpawner. The dummy processes point to a minimal session protocol
+ * echo app running inside this process, so that no real application is
+ * involved. A number of client threads then send keep-alive requests to the
+ * controller, once for every benchmark point (see `benchmark_mode` in
+ * Core/Controller/Config.h), and the throughput and latency percentiles of
+ * each point are reported. Comparing the numbers of adjacent points tells
+ * how much time the controller spends in each part of the request path.
+ */
+#include <boost/bind/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+#include <Shared/Fundamentals/Initialization.h>
+#include <ConfigKit/ConfigKit.h>
+#include <LoggingKit/LoggingKit.h>
+// Must be included after LoggingKit, which it uses.
+#include <oxt/dynamic_thread_group.hpp>
+#include <BackgroundEventLoop.h>
+#include <FileDescriptor.h>
+#include <Exceptions.h>
+#include <ServerKit/Context.h>
+#include <WrapperRegistry/Registry.h>
+#include <Core/Controller.h>
+#include <Core/ApplicationPool/Pool.h>
+#include <Core/SpawningKit/Context.h>
+#include <Core/SpawningKit/Factory.h>
+#include <Algorithms/LatencyHistogram.h>
+#include <IOTools/IOUtils.h>
+#include <FileTools/FileManip.h>
+#include <SystemTools/SystemTime.h>
+#include <StrIntTools/StrIntUtils.h>
+
+using namespace std;
+using namespace oxt;
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace Passenger::ApplicationPool2;
+
+
+struct BenchOptions {
+	unsigned int concurrency;
+	unsigned int duration;
+	unsigned int warmup;
+	unsigned int responseSize;
+	bool tcp;
+	vector<string> points;
+
+	BenchOptions()
+		: concurrency(16),
+		  duration(5),
+		  warmup(1),
+		  responseSize(12),
+		  tcp(false)
+		{ }
+};
+
+static BenchOptions options;
+static LoggingKit::Level logLevel = LoggingKit::WARN;
+static string tmpDir;
+
+static const char * const ALL_POINTS[] = {
+	"after_accept",
+	"before_checkout",
+	"after_checkout",
+	"response_begin",
+	"full"
+};
+
+
+/****** Helpers ******/
+
+static string
+createListenAddress(const string &name, int *fd) {
+	if (options.tcp) {
+		struct sockaddr_in addr;
+		socklen_t len = sizeof(addr);
+
+		*fd = createTcpServer("127.0.0.1", 0, 0, __FILE__, __LINE__);
+		if (getsockname(*fd, (struct sockaddr *) &addr, &len) == -1) {
+			int e = errno;
+			throw SystemException("getsockname() failed", e);
+		}
+		return "tcp://127.0.0.1:" + toString(ntohs(addr.sin_port));
+	} else {
+		string path = tmpDir + "/" + name + ".sock";
+		*fd = createUnixServer(path, 0, true, __FILE__, __LINE__);
+		return "unix:" + path;
+	}
+}
+
+
+/****** Echo app ******/
+
+/**
+ * A minimal application that speaks the session protocol. It uses one
+ * thread per connection and answers every request with a fixed-size
+ * response, keeping the connection open for the next request.
+ */
+class EchoApp {
+private:
+	int serverFd;
+	string response;
+	oxt::thread *acceptor;
+	dynamic_thread_group connectionThreads;
+
+	void acceptMain() {
+		while (!boost::this_thread::interruption_requested()) {
+			int fd = syscalls::accept(serverFd, NULL, NULL);
+			if (fd == -1) {
+				int e = errno;
+				throw SystemException("Echo app cannot accept a connection", e);
+			}
+			connectionThreads.create_thread(
+				boost::bind(&EchoApp::connectionMain, this, fd),
+				"Echo app connection: " + toString(fd),
+				128 * 1024);
+		}
+	}
+
+	void connectionMain(int _fd) {
+		FileDescriptor fd(_fd, __FILE__, __LINE__);
+		string header, body;
+
+		try {
+			while (true) {
+				boost::uint32_t size;
+				if (readExact(fd, &size, sizeof(size)) != sizeof(size)) {
+					return;
+				}
+				size = ntohl(size);
+				header.resize(size);
+				if (size > 0 && readExact(fd, &header[0], size) != size) {
+					return;
+				}
+
+				unsigned long long contentLength = getContentLength(header);
+				if (contentLength > 0) {
+					body.resize(contentLength);
+					if (readExact(fd, &body[0], contentLength) != contentLength) {
+						return;
+					}
+				}
+
+				writeExact(fd, response);
+			}
+		} catch (const SystemException &) {
+			// The controller closed the connection.
+		}
+	}
+
+	static unsigned long long getContentLength(const string &header) {
+		static const StaticString KEY("CONTENT_LENGTH", sizeof("CONTENT_LENGTH"));
+		string::size_type pos = 0;
+
+		// The header consists of NULL-terminated key-value pairs.
+		while (pos < header.size()) {
+			const char *key = header.data() + pos;
+			size_t keyLen = strnlen(key, header.size() - pos);
+			string::size_type valuePos = pos + keyLen + 1;
+			if (valuePos >= header.size()) {
+				break;
+			}
+
+			const char *value = header.data() + valuePos;
+			size_t valueLen = strnlen(value, header.size() - valuePos);
+			if (keyLen + 1 == KEY.size() && memcmp(key, KEY.data(), keyLen) == 0) {
+				return stringToULL(StaticString(value, valueLen));
+			}
+			pos = valuePos + valueLen + 1;
+		}
+		return 0;
+	}
+
+public:
+	string address;
+
+	EchoApp(unsigned int bodySize)
+		: serverFd(-1),
+		  acceptor(NULL)
+	{
+		string body(bodySize, 'x');
+		response = "HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Content-Length: " + toString(bodySize) + "\r\n"
+			"\r\n" + body;
+		address = createListenAddress("app", &serverFd);
+	}
+
+	~EchoApp() {
+		if (acceptor != NULL) {
+			acceptor->interrupt_and_join();
+			delete acceptor;
+		}
+		connectionThreads.interrupt_and_join_all();
+		safelyClose(serverFd);
+	}
+
+	void start() {
+		acceptor = new oxt::thread(boost::bind(&EchoApp::acceptMain, this),
+			"Echo app acceptor", 128 * 1024);
+	}
+};
+
+
+/****** Load generator ******/
+
+/**
+ * Sends requests over a single keep-alive connection for as long as the
+ * benchmark runs. Latencies are only recorded during the measurement window,
+ * i.e. after the warmup period.
+ */
+struct LoadClient {
+	string address;
+	MonotonicTimeUsec measureStart;
+	MonotonicTimeUsec measureEnd;
+	LatencyHistogram histogram;
+	unsigned long long errors;
+
+	LoadClient()
+		: errors(0)
+		{ }
+
+	void run() {
+		static const StaticString request(
+			"GET / HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+		FileDescriptor fd;
+		string buffer;
+
+		while (true) {
+			MonotonicTimeUsec begin = SystemTime::getMonotonicUsec();
+			if (begin >= measureEnd) {
+				break;
+			}
+
+			try {
+				if (fd == -1) {
+					fd.assign(connectToServer(address, __FILE__, __LINE__),
+						__FILE__, __LINE__);
+				}
+				writeExact(fd, request);
+				if (!readResponse(fd, buffer)) {
+					errors++;
+					fd.close();
+					buffer.clear();
+					continue;
+				}
+			} catch (const SystemException &) {
+				errors++;
+				fd.close();
+				buffer.clear();
+				continue;
+			} catch (const IOException &) {
+				errors++;
+				fd.close();
+				buffer.clear();
+				continue;
+			}
+
+			if (begin >= measureStart) {
+				histogram.record(SystemTime::getMonotonicUsec() - begin);
+			}
+		}
+	}
+
+	/**
+	 * Reads one response with a Content-Length body. Leftover data belonging
+	 * to the next response stays in `buffer`.
+	 */
+	static bool readResponse(int fd, string &buffer) {
+		string::size_type headerEnd;
+		char tmp[16 * 1024];
+
+		while ((headerEnd = buffer.find("\r\n\r\n")) == string::npos) {
+			if (!readMore(fd, buffer, tmp, sizeof(tmp))) {
+				return false;
+			}
+		}
+		headerEnd += 4;
+
+		string header = buffer.substr(0, headerEnd);
+		if (!startsWith(header, "HTTP/1.1 200 ")) {
+			return false;
+		}
+		string lowerHeader = header;
+		for (string::size_type i = 0; i < lowerHeader.size(); i++) {
+			lowerHeader[i] = tolower(lowerHeader[i]);
+		}
+		string::size_type pos = lowerHeader.find("\r\ncontent-length:");
+		if (pos == string::npos) {
+			return false;
+		}
+		unsigned long long contentLength = stringToULL(
+			lowerHeader.substr(pos + sizeof("\r\ncontent-length:") - 1));
+
+		while (buffer.size() < headerEnd + contentLength) {
+			if (!readMore(fd, buffer, tmp, sizeof(tmp))) {
+				return false;
+			}
+		}
+		buffer.erase(0, headerEnd + contentLength);
+		return true;
+	}
+
+	static bool readMore(int fd, string &buffer, char *tmp, size_t size) {
+		ssize_t ret = syscalls::read(fd, tmp, size);
+		if (ret == -1) {
+			int e = errno;
+			throw SystemException("Cannot read response", e);
+		} else if (ret == 0) {
+			return false;
+		} else {
+			buffer.append(tmp, ret);
+			return true;
+		}
+	}
+};
+
+
+/****** In-process Core ******/
+
+class Bench {
+private:
+	BackgroundEventLoop bg;
+	ServerKit::Schema skSchema;
+	ServerKit::Context context;
+	WrapperRegistry::Registry wrapperRegistry;
+	ControllerSchema schema;
+	ControllerSingleAppModeSchema singleAppModeSchema;
+	SpawningKit::Context::Schema skContextSchema;
+	SpawningKit::Context::DebugSupport skDebugSupport;
+	SpawningKit::Context skContext;
+	SpawningKit::FactoryPtr spawningKitFactory;
+	ApplicationPool2::Context apContext;
+	PoolPtr appPool;
+	EchoApp app;
+
+	void createController(Controller **controller, const string &point, int serverFd) {
+		Json::Value config, singleAppModeConfig;
+
+		config["thread_number"] = 1;
+		config["multi_app"] = false;
+		config["default_server_name"] = "localhost";
+		config["default_server_port"] = 80;
+		config["default_spawn_method"] = "dummy";
+		config["user_switching"] = false;
+		if (point != "full") {
+			config["benchmark_mode"] = point;
+		}
+
+		singleAppModeConfig["app_root"] = tmpDir;
+		singleAppModeConfig["app_type"] = "rack";
+		singleAppModeConfig["startup_file"] = "none";
+
+		*controller = new Controller(&context, schema, config,
+			ConfigKit::DummyTranslator(), &singleAppModeSchema,
+			&singleAppModeConfig, ConfigKit::DummyTranslator());
+		(*controller)->resourceLocator = Agent::Fundamentals::context->resourceLocator;
+		(*controller)->wrapperRegistry = &wrapperRegistry;
+		(*controller)->appPool = appPool;
+		(*controller)->initialize();
+		(*controller)->listen(serverFd);
+	}
+
+	static void getServerState(Controller *controller, Controller::State *state) {
+		*state = controller->serverState;
+	}
+
+	static void destroyController(Controller *controller) {
+		delete controller;
+	}
+
+	void shutdownController(Controller *controller) {
+		Controller::State state;
+
+		// Silence the disconnection messages about any keep-alive
+		// connections that the controller has not noticed are closed.
+		LoggingKit::setLevel(LoggingKit::CRIT);
+		bg.safe->runSync(boost::bind(&Controller::shutdown, controller, true));
+		do {
+			syscalls::usleep(10000);
+			bg.safe->runSync(boost::bind(getServerState, controller, &state));
+		} while (state != Controller::FINISHED_SHUTDOWN);
+		bg.safe->runSync(boost::bind(destroyController, controller));
+		LoggingKit::setLevel(logLevel);
+	}
+
+public:
+	Bench()
+		: bg(false, true),
+		  context(skSchema),
+		  singleAppModeSchema(&wrapperRegistry),
+		  skContext(skContextSchema),
+		  app(options.responseSize)
+	{
+		wrapperRegistry.finalize();
+
+		context.libev = bg.safe;
+		context.libuv = bg.libuv_loop;
+		context.initialize();
+
+		// A concurrency of 0 means unlimited, so that a single dummy
+		// process can serve all clients.
+		skDebugSupport.dummyConcurrency = 0;
+		skDebugSupport.dummySocketAddress = app.address;
+		skContext.resourceLocator = Agent::Fundamentals::context->resourceLocator;
+		skContext.wrapperRegistry = &wrapperRegistry;
+		skContext.integrationMode = "standalone";
+		skContext.debugSupport = &skDebugSupport;
+		skContext.finalize();
+
+		spawningKitFactory = boost::make_shared<SpawningKit::Factory>(&skContext);
+		apContext.spawningKitFactory = spawningKitFactory;
+		apContext.finalize();
+
+		appPool = boost::make_shared<Pool>(&apContext);
+		appPool->initialize();
+
+		app.start();
+		bg.start();
+	}
+
+	~Bench() {
+		appPool->destroy();
+		bg.stop();
+		appPool.reset();
+	}
+
+	void run(const string &point) {
+		Controller *controller;
+		int serverFd;
+		string address = createListenAddress("core", &serverFd);
+
+		bg.safe->runSync(boost::bind(&Bench::createController, this,
+			&controller, point, serverFd));
+
+		MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+		vector<LoadClient> clients(options.concurrency);
+		dynamic_thread_group threads;
+
+		for (unsigned int i = 0; i < options.concurrency; i++) {
+			clients[i].address = address;
+			clients[i].measureStart = now + options.warmup * 1000000ull;
+			clients[i].measureEnd = clients[i].measureStart
+				+ options.duration * 1000000ull;
+			threads.create_thread(boost::bind(&LoadClient::run, &clients[i]),
+				"Load client " + toString(i + 1), 128 * 1024);
+		}
+		threads.join_all();
+
+		shutdownController(controller);
+		safelyClose(serverFd);
+
+		LatencyHistogram histogram;
+		unsigned long long errors = 0;
+		for (unsigned int i = 0; i < options.concurrency; i++) {
+			histogram.merge(clients[i].histogram);
+			errors += clients[i].errors;
+		}
+		report(point, histogram, errors);
+	}
+
+	static void printReportHeader() {
+		printf("%-16s %12s %10s %9s %9s %9s %9s %9s %7s\n",
+			"point", "requests", "req/sec", "mean", "p50", "p90", "p99",
+			"p99.9", "errors");
+	}
+
+	static void report(const string &point, const LatencyHistogram &histogram,
+		unsigned long long errors)
+	{
+		printf("%-16s %12llu %10.0f %7.0fus %7lluus %7lluus %7lluus %7lluus %7llu\n",
+			point.c_str(),
+			(unsigned long long) histogram.getCount(),
+			histogram.getCount() / (double) options.duration,
+			histogram.getMean(),
+			(unsigned long long) histogram.getValueAtPercentile(50),
+			(unsigned long long) histogram.getValueAtPercentile(90),
+			(unsigned long long) histogram.getValueAtPercentile(99),
+			(unsigned long long) histogram.getValueAtPercentile(99.9),
+			errors);
+		fflush(stdout);
+	}
+};
+
+
+/****** Main ******/
+
+static ConfigKit::Schema *
+createSchema() {
+	using namespace ConfigKit;
+
+	ConfigKit::Schema *schema = new ConfigKit::Schema();
+	schema->add("passenger_root", STRING_TYPE, REQUIRED);
+	schema->finalize();
+
+	return schema;
+}
+
+static void
+usage(int exitCode) {
+	printf("Usage: passenger-bench [options]\n");
+	printf("Runs an end-to-end load benchmark against an in-process Core controller,\n");
+	printf("which forwards requests to a built-in echo app through the DummySpawner.\n");
+	printf("Must be run from the " PROGRAM_NAME " source root, or with --passenger-root.\n\n");
+	printf("Options:\n");
+	printf("  --points LIST        Comma-separated benchmark points to run. Available:\n");
+	printf("                       after_accept,before_checkout,after_checkout,\n");
+	printf("                       response_begin,full (default: all)\n");
+	printf("  --concurrency N      Number of concurrent keep-alive connections\n");
+	printf("                       (default: %u)\n", options.concurrency);
+	printf("  --duration SECS      Measurement duration per point (default: %u)\n", options.duration);
+	printf("  --warmup SECS        Warmup duration per point (default: %u)\n", options.warmup);
+	printf("  --response-size N    Size of the echo app's response body (default: %u)\n",
+		options.responseSize);
+	printf("  --unix               Use Unix domain sockets (default)\n");
+	printf("  --tcp                Use TCP sockets on 127.0.0.1\n");
+	printf("  --passenger-root DIR " PROGRAM_NAME " source root\n");
+	printf("  -l LEVEL             Log level (default: warn)\n");
+	printf("  -h                   Print this usage information.\n");
+	exit(exitCode);
+}
+
+static const char *
+requireArgument(int argc, const char *argv[], int i) {
+	if (i + 1 >= argc) {
+		fprintf(stderr, "*** ERROR: %s requires an argument.\n", argv[i]);
+		exit(1);
+	}
+	return argv[i + 1];
+}
+
+static bool
+isValidPoint(const string &point) {
+	for (unsigned int i = 0; i < sizeof(ALL_POINTS) / sizeof(ALL_POINTS[0]); i++) {
+		if (point == ALL_POINTS[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+static void
+parseOptions(int argc, const char *argv[], ConfigKit::Store &config) {
+	Json::Value updates;
+	char path[PATH_MAX + 1];
+	getcwd(path, PATH_MAX);
+	updates["passenger_root"] = path;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+			usage(0);
+		} else if (strcmp(argv[i], "--points") == 0) {
+			split(requireArgument(argc, argv, i), ',', options.points);
+			for (unsigned int j = 0; j < options.points.size(); j++) {
+				if (!isValidPoint(options.points[j])) {
+					fprintf(stderr, "*** ERROR: Invalid benchmark point '%s'.\n",
+						options.points[j].c_str());
+					exit(1);
+				}
+			}
+			i++;
+		} else if (strcmp(argv[i], "--concurrency") == 0) {
+			options.concurrency = std::max(1u,
+				stringToUint(requireArgument(argc, argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "--duration") == 0) {
+			options.duration = std::max(1u,
+				stringToUint(requireArgument(argc, argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "--warmup") == 0) {
+			options.warmup = stringToUint(requireArgument(argc, argv, i));
+			i++;
+		} else if (strcmp(argv[i], "--response-size") == 0) {
+			options.responseSize = stringToUint(requireArgument(argc, argv, i));
+			i++;
+		} else if (strcmp(argv[i], "--unix") == 0) {
+			options.tcp = false;
+		} else if (strcmp(argv[i], "--tcp") == 0) {
+			options.tcp = true;
+		} else if (strcmp(argv[i], "--passenger-root") == 0) {
+			updates["passenger_root"] = requireArgument(argc, argv, i);
+			i++;
+		} else if (strcmp(argv[i], "-l") == 0) {
+			logLevel = LoggingKit::parseLevel(requireArgument(argc, argv, i));
+			i++;
+		} else {
+			fprintf(stderr, "*** ERROR: Unknown option: %s\n", argv[i]);
+			fprintf(stderr, "Please pass -h for a list of valid options.\n");
+			exit(1);
+		}
+	}
+
+	if (options.points.empty()) {
+		options.points.assign(ALL_POINTS,
+			ALL_POINTS + sizeof(ALL_POINTS) / sizeof(ALL_POINTS[0]));
+	}
+
+	vector<ConfigKit::Error> errors;
+	if (!config.update(updates, errors)) {
+		P_BUG("Unable to set initial configuration: " <<
+			ConfigKit::toString(errors));
+	}
+}
+
+int
+main(int argc, char *argv[]) {
+	using namespace Agent::Fundamentals;
+
+	ConfigKit::Schema *schema = createSchema();
+	ConfigKit::Store *config = new ConfigKit::Store(*schema);
+	initializeAgent(argc, &argv, "passenger-bench", *config,
+		ConfigKit::DummyTranslator(), parseOptions);
+	LoggingKit::setLevel(logLevel);
+
+	char tmpDirTemplate[] = "/tmp/passenger-bench.XXXXXX";
+	if (mkdtemp(tmpDirTemplate) == NULL) {
+		int e = errno;
+		throw FileSystemException("Cannot create a temporary directory", e,
+			tmpDirTemplate);
+	}
+	tmpDir = tmpDirTemplate;
+
+	printf("Concurrency: %u, transport: %s, duration: %us (+%us warmup), "
+		"response body: %u bytes\n\n",
+		options.concurrency, options.tcp ? "tcp" : "unix",
+		options.duration, options.warmup, options.responseSize);
+	Bench::printReportHeader();
+	{
+		Bench bench;
+		for (unsigned int i = 0; i < options.points.size(); i++) {
+			bench.run(options.points[i]);
+		}
+	}
+
+	removeDirTree(tmpDir);
+	shutdownAgent(schema, config);
+	return 0;
+}
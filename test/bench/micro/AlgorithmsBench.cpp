@@ -0,0 +1,63 @@
+#include "MicroBench.h"
+#include "Corpus.h"
+#include <cstring>
+#include <Algorithms/Hasher.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace MicroBench::Corpus;
+
+
+static void
+benchmarkJenkinsHash(MicroBench::State &state, unsigned int size) {
+	string data = createBinaryData(size);
+
+	while (state.keepRunning()) {
+		JenkinsHash hash;
+		hash.update(data.data(), data.size());
+		MicroBench::doNotOptimize(hash.finalize());
+	}
+
+	state.setBytesProcessed(state.iterations() * size);
+}
+
+static void
+BM_JenkinsHash_16(MicroBench::State &state) {
+	// The size of a typical header name.
+	benchmarkJenkinsHash(state, 16);
+}
+MICRO_BENCHMARK(BM_JenkinsHash_16);
+
+static void
+BM_JenkinsHash_64(MicroBench::State &state) {
+	// The size of a typical response cache key.
+	benchmarkJenkinsHash(state, 64);
+}
+MICRO_BENCHMARK(BM_JenkinsHash_64);
+
+static void
+BM_JenkinsHash_1024(MicroBench::State &state) {
+	benchmarkJenkinsHash(state, 1024);
+}
+MICRO_BENCHMARK(BM_JenkinsHash_1024);
+
+static void
+BM_JenkinsHash_header_names(MicroBench::State &state) {
+	// Hashes every header name, like HttpHeaderParser does while parsing.
+	unsigned int bytes = 0;
+
+	for (unsigned int i = 0; i < HEADER_NAMES_COUNT; i++) {
+		bytes += strlen(HEADER_NAMES[i]);
+	}
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < HEADER_NAMES_COUNT; i++) {
+			JenkinsHash hash;
+			hash.update(HEADER_NAMES[i], strlen(HEADER_NAMES[i]));
+			MicroBench::doNotOptimize(hash.finalize());
+		}
+	}
+
+	state.setItemsProcessed(state.iterations() * HEADER_NAMES_COUNT);
+	state.setBytesProcessed(state.iterations() * bytes);
+}
+MICRO_BENCHMARK(BM_JenkinsHash_header_names);
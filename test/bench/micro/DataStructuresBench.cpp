@@ -0,0 +1,134 @@
+#include "MicroBench.h"
+#include "Corpus.h"
+#include <MemoryKit/palloc.h>
+#include <DataStructures/LString.h>
+#include <DataStructures/StringKeyTable.h>
+#include <DataStructures/HashedStaticString.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace MicroBench::Corpus;
+
+
+/***** StringKeyTable *****/
+
+static void
+createKeys(vector<HashedStaticString> &keys, const char * const *names,
+	unsigned int count)
+{
+	for (unsigned int i = 0; i < count; i++) {
+		keys.push_back(HashedStaticString(names[i]));
+	}
+}
+
+static void
+BM_StringKeyTable_insert(MicroBench::State &state) {
+	vector<HashedStaticString> keys;
+	StringKeyTable<int> table;
+
+	createKeys(keys, HEADER_NAMES, HEADER_NAMES_COUNT);
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < keys.size(); i++) {
+			table.insert(keys[i], i);
+		}
+		table.clear();
+	}
+
+	state.setItemsProcessed(state.iterations() * keys.size());
+}
+MICRO_BENCHMARK(BM_StringKeyTable_insert);
+
+static void
+BM_StringKeyTable_lookup_hit(MicroBench::State &state) {
+	vector<HashedStaticString> keys;
+	StringKeyTable<int> table;
+	const int *value;
+
+	createKeys(keys, HEADER_NAMES, HEADER_NAMES_COUNT);
+	for (unsigned int i = 0; i < keys.size(); i++) {
+		table.insert(keys[i], i);
+	}
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < keys.size(); i++) {
+			MicroBench::doNotOptimize(table.lookup(keys[i], &value));
+		}
+	}
+
+	state.setItemsProcessed(state.iterations() * keys.size());
+}
+MICRO_BENCHMARK(BM_StringKeyTable_lookup_hit);
+
+static void
+BM_StringKeyTable_lookup_miss(MicroBench::State &state) {
+	vector<HashedStaticString> keys, missingKeys;
+	StringKeyTable<int> table;
+	const int *value;
+
+	createKeys(keys, HEADER_NAMES, HEADER_NAMES_COUNT);
+	createKeys(missingKeys, MISSING_HEADER_NAMES, MISSING_HEADER_NAMES_COUNT);
+	for (unsigned int i = 0; i < keys.size(); i++) {
+		table.insert(keys[i], i);
+	}
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < missingKeys.size(); i++) {
+			MicroBench::doNotOptimize(table.lookup(missingKeys[i], &value));
+		}
+	}
+
+	state.setItemsProcessed(state.iterations() * missingKeys.size());
+}
+MICRO_BENCHMARK(BM_StringKeyTable_lookup_miss);
+
+
+/***** LString *****/
+
+// Header values that arrive in multiple socket reads consist of this many parts.
+static const unsigned int LSTRING_PARTS = 8;
+static const unsigned int LSTRING_PART_SIZE = 64;
+
+static void
+BM_LString_append(MicroBench::State &state) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+	string data = createBinaryData(LSTRING_PART_SIZE);
+	LString str;
+
+	while (state.keepRunning()) {
+		psg_lstr_init(&str);
+		for (unsigned int i = 0; i < LSTRING_PARTS; i++) {
+			psg_lstr_append(&str, pool, data.data(), data.size());
+		}
+		MicroBench::doNotOptimize(str.size);
+		psg_lstr_deinit(&str);
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setBytesProcessed(state.iterations() * LSTRING_PARTS * LSTRING_PART_SIZE);
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_LString_append);
+
+static void
+BM_LString_append_and_make_contiguous(MicroBench::State &state) {
+	// Subtract BM_LString_append to get the cost of making it contiguous.
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+	string data = createBinaryData(LSTRING_PART_SIZE);
+	LString str;
+
+	while (state.keepRunning()) {
+		psg_lstr_init(&str);
+		for (unsigned int i = 0; i < LSTRING_PARTS; i++) {
+			psg_lstr_append(&str, pool, data.data(), data.size());
+		}
+		LString *contiguous = psg_lstr_make_contiguous(&str, pool);
+		MicroBench::doNotOptimize(contiguous->start->data);
+		psg_lstr_deinit(contiguous);
+		psg_lstr_deinit(&str);
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setBytesProcessed(state.iterations() * LSTRING_PARTS * LSTRING_PART_SIZE);
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_LString_append_and_make_contiguous);
@@ -0,0 +1,114 @@
+#include "MicroBench.h"
+#include <Constants.h>
+#include <MemoryKit/palloc.h>
+#include <MemoryKit/mbuf.h>
+
+using namespace Passenger;
+using namespace Passenger::MemoryKit;
+
+
+/***** palloc *****/
+
+// The number of allocations between pool resets: roughly what a request
+// allocates from its pool.
+static const unsigned int ALLOCATIONS_PER_RESET = 64;
+
+static void
+BM_psg_palloc_small(MicroBench::State &state) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < ALLOCATIONS_PER_RESET; i++) {
+			MicroBench::doNotOptimize(psg_palloc(pool, 48));
+		}
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setItemsProcessed(state.iterations() * ALLOCATIONS_PER_RESET);
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_psg_palloc_small);
+
+static void
+BM_psg_palloc_exceeding_block(MicroBench::State &state) {
+	// Allocations that do not fit in the pool's first block, so that
+	// new blocks have to be allocated.
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < ALLOCATIONS_PER_RESET; i++) {
+			MicroBench::doNotOptimize(psg_palloc(pool, 1024));
+		}
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setItemsProcessed(state.iterations() * ALLOCATIONS_PER_RESET);
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_psg_palloc_exceeding_block);
+
+static void
+BM_psg_palloc_large(MicroBench::State &state) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+	while (state.keepRunning()) {
+		MicroBench::doNotOptimize(psg_palloc(pool, PSG_DEFAULT_POOL_SIZE * 2));
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setItemsProcessed(state.iterations());
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_psg_palloc_large);
+
+static void
+BM_psg_reset_pool(MicroBench::State &state) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+	while (state.keepRunning()) {
+		MicroBench::doNotOptimize(psg_palloc(pool, 48));
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setItemsProcessed(state.iterations());
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_psg_reset_pool);
+
+
+/***** mbuf *****/
+
+static void
+BM_mbuf_block_get_put(MicroBench::State &state) {
+	struct mbuf_pool pool;
+	pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+	mbuf_pool_init(&pool);
+
+	while (state.keepRunning()) {
+		struct mbuf_block *block = mbuf_block_get(&pool);
+		MicroBench::doNotOptimize(block);
+		block->refcount = 0;
+		mbuf_block_put(block);
+	}
+
+	state.setItemsProcessed(state.iterations());
+	mbuf_pool_deinit(&pool);
+}
+MICRO_BENCHMARK(BM_mbuf_block_get_put);
+
+static void
+BM_mbuf_get_and_subset(MicroBench::State &state) {
+	struct mbuf_pool pool;
+	pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+	mbuf_pool_init(&pool);
+
+	while (state.keepRunning()) {
+		mbuf buffer(mbuf_get(&pool));
+		mbuf subset(buffer, 10, 100);
+		MicroBench::doNotOptimize(subset.start);
+	}
+
+	state.setItemsProcessed(state.iterations());
+	mbuf_pool_deinit(&pool);
+}
+MICRO_BENCHMARK(BM_mbuf_get_and_subset);
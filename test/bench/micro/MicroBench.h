@@ -0,0 +1,147 @@
+/*
+ * A minimal microbenchmark harness in the style of Google Benchmark, so that
+ * the hot cxx_supportlib primitives can be measured without pulling in an
+ * external dependency.
+ *
+ * A benchmark is a function that runs the code under test for as long as
+ * `state.keepRunning()` returns true. The runner calls it with increasing
+ * iteration counts until a run takes at least the minimum time, and then
+ * reports the time per iteration:
+ *
+ *     static void BM_Something(MicroBench::State &state) {
+ *         // Setup, not timed.
+ *         while (state.keepRunning()) {
+ *             MicroBench::doNotOptimize(doSomething());
+ *         }
+ *         state.setItemsProcessed(state.iterations());
+ *     }
+ *     MICRO_BENCHMARK(BM_Something);
+ */
+#ifndef _PASSENGER_MICRO_BENCH_H_
+#define _PASSENGER_MICRO_BENCH_H_
+
+#include <string>
+#include <time.h>
+
+namespace MicroBench {
+
+using namespace std;
+
+
+inline double
+getTime(clockid_t clock) {
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+class State {
+private:
+	unsigned long long maxIterations;
+	unsigned long long remaining;
+	double realStart, cpuStart;
+	bool started;
+	bool timing;
+
+public:
+	double realTime, cpuTime;
+	unsigned long long itemsProcessed;
+	unsigned long long bytesProcessed;
+	string errorMessage;
+
+	State(unsigned long long iterations)
+		: maxIterations(iterations),
+		  remaining(iterations),
+		  realStart(0),
+		  cpuStart(0),
+		  started(false),
+		  timing(false),
+		  realTime(0),
+		  cpuTime(0),
+		  itemsProcessed(0),
+		  bytesProcessed(0)
+		{ }
+
+	/**
+	 * Returns whether the benchmark loop should run another iteration.
+	 * Timing starts on the first call and stops when the loop is done.
+	 */
+	bool keepRunning() {
+		if (__builtin_expect(!started, 0)) {
+			started = true;
+			resumeTiming();
+		}
+		if (__builtin_expect(remaining > 0 && errorMessage.empty(), 1)) {
+			remaining--;
+			return true;
+		} else {
+			if (timing) {
+				pauseTiming();
+			}
+			return false;
+		}
+	}
+
+	/** Excludes the following code from the measurement. Expensive. */
+	void pauseTiming() {
+		realTime += getTime(CLOCK_MONOTONIC) - realStart;
+		cpuTime += getTime(CLOCK_PROCESS_CPUTIME_ID) - cpuStart;
+		timing = false;
+	}
+
+	void resumeTiming() {
+		timing = true;
+		cpuStart = getTime(CLOCK_PROCESS_CPUTIME_ID);
+		realStart = getTime(CLOCK_MONOTONIC);
+	}
+
+	/** Aborts the benchmark; the runner reports it as failed. */
+	void skipWithError(const string &message) {
+		errorMessage = message;
+	}
+
+	unsigned long long iterations() const {
+		return maxIterations;
+	}
+
+	void setItemsProcessed(unsigned long long n) {
+		itemsProcessed = n;
+	}
+
+	void setBytesProcessed(unsigned long long n) {
+		bytesProcessed = n;
+	}
+};
+
+typedef void (*Function)(State &state);
+
+struct Registration {
+	Registration(const char *name, Function func);
+};
+
+/**
+ * Prevents the compiler from optimizing away the computation of `value`.
+ */
+template<typename T>
+inline void
+doNotOptimize(const T &value) {
+	__asm__ __volatile__("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Forces the compiler to assume that all memory may have been read
+ * and written.
+ */
+inline void
+clobberMemory() {
+	__asm__ __volatile__("" : : : "memory");
+}
+
+
+} // namespace MicroBench
+
+#define MICRO_BENCHMARK(func) \
+	static MicroBench::Registration _microBenchRegistration_ ## func(#func, func)
+
+#endif /* _PASSENGER_MICRO_BENCH_H_ */
@@ -0,0 +1,341 @@
+/*
+ * Runs the microbenchmarks registered with MICRO_BENCHMARK() and reports
+ * the results on the console, or as JSON in the same format as Google
+ * Benchmark's `--benchmark_format=json` so that results can be compared
+ * across versions with the usual tooling.
+ */
+#include <boost/cstdint.hpp>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <cerrno>
+#include <regex.h>
+#include <unistd.h>
+
+#include <oxt/initialize.hpp>
+#include <oxt/system_calls.hpp>
+#include <Constants.h>
+#include <Utils.h>
+#include <jsoncpp/json.h>
+#include "MicroBench.h"
+
+using namespace std;
+using namespace Passenger;
+using namespace MicroBench;
+
+
+namespace {
+	struct Benchmark {
+		string name;
+		Function func;
+	};
+
+	struct Result {
+		string name;
+		unsigned long long iterations;
+		double realTimeNs;
+		double cpuTimeNs;
+		double itemsPerSecond;
+		double bytesPerSecond;
+		string errorMessage;
+	};
+
+	struct Options {
+		const char *filter;
+		double minTime;
+		bool json;
+		const char *outputPath;
+
+		Options()
+			: filter(NULL),
+			  minTime(0.5),
+			  json(false),
+			  outputPath(NULL)
+			{ }
+	};
+}
+
+static vector<Benchmark> &
+getBenchmarks() {
+	// Function-local so that registrations in other translation units
+	// work regardless of static initialization order.
+	static vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+MicroBench::Registration::Registration(const char *name, Function func) {
+	Benchmark benchmark;
+	benchmark.name = name;
+	benchmark.func = func;
+	getBenchmarks().push_back(benchmark);
+}
+
+
+static Result
+runBenchmark(const Benchmark &benchmark, double minTime) {
+	static const unsigned long long MAX_ITERATIONS = 1000000000ull;
+	unsigned long long iterations = 1;
+	Result result;
+
+	result.name = benchmark.name;
+	while (true) {
+		State state(iterations);
+		benchmark.func(state);
+
+		if (!state.errorMessage.empty()) {
+			result.iterations = 0;
+			result.realTimeNs = 0;
+			result.cpuTimeNs = 0;
+			result.itemsPerSecond = 0;
+			result.bytesPerSecond = 0;
+			result.errorMessage = state.errorMessage;
+			return result;
+		}
+
+		if (state.realTime >= minTime || iterations >= MAX_ITERATIONS) {
+			result.iterations = iterations;
+			result.realTimeNs = state.realTime * 1e9 / iterations;
+			result.cpuTimeNs = state.cpuTime * 1e9 / iterations;
+			result.itemsPerSecond = (state.cpuTime > 0)
+				? state.itemsProcessed / state.cpuTime
+				: 0;
+			result.bytesPerSecond = (state.cpuTime > 0)
+				? state.bytesProcessed / state.cpuTime
+				: 0;
+			return result;
+		}
+
+		// Same growth strategy as Google Benchmark: aim for 1.4 times the
+		// minimum time, but grow by at most 10x per run.
+		double multiplier = minTime * 1.4 / std::max(state.realTime, 1e-9);
+		if (state.realTime / minTime <= 0.1) {
+			multiplier = 10;
+		}
+		multiplier = std::min(multiplier, 10.0);
+		unsigned long long next = (unsigned long long) (iterations * multiplier);
+		iterations = std::min(std::max(next, iterations + 1), MAX_ITERATIONS);
+	}
+}
+
+static string
+formatRate(double value, const char *unit) {
+	static const char *prefixes[] = { "", "k", "M", "G", "T" };
+	unsigned int i = 0;
+	char buf[64];
+
+	while (value >= 1000 && i < sizeof(prefixes) / sizeof(prefixes[0]) - 1) {
+		value /= 1000;
+		i++;
+	}
+	snprintf(buf, sizeof(buf), "%.3g%s%s/s", value, prefixes[i], unit);
+	return buf;
+}
+
+static void
+printConsoleHeader() {
+	printf("%-44s %13s %13s %12s  %s\n", "Benchmark", "Time", "CPU", "Iterations", "Rate");
+	printf("%s\n", string(100, '-').c_str());
+}
+
+static void
+printConsoleResult(const Result &result) {
+	if (!result.errorMessage.empty()) {
+		printf("%-44s ERROR: %s\n", result.name.c_str(), result.errorMessage.c_str());
+	} else {
+		string rate;
+		if (result.bytesPerSecond > 0) {
+			rate = formatRate(result.bytesPerSecond, "B");
+		}
+		if (result.itemsPerSecond > 0) {
+			if (!rate.empty()) {
+				rate.append(" ");
+			}
+			rate.append(formatRate(result.itemsPerSecond, " items"));
+		}
+		printf("%-44s %10.1f ns %10.1f ns %12llu  %s\n",
+			result.name.c_str(), result.realTimeNs, result.cpuTimeNs,
+			result.iterations, rate.c_str());
+	}
+	fflush(stdout);
+}
+
+static Json::Value
+createJsonReport(const vector<Result> &results, const char *executable) {
+	Json::Value doc, context, benchmarks(Json::arrayValue);
+	char date[64];
+	time_t now = time(NULL);
+	struct tm tm;
+
+	localtime_r(&now, &tm);
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", &tm);
+	context["date"] = date;
+	context["host_name"] = getHostName();
+	context["executable"] = executable;
+	context["num_cpus"] = (Json::Int) sysconf(_SC_NPROCESSORS_ONLN);
+	context["passenger_version"] = PASSENGER_VERSION;
+	#ifdef __OPTIMIZE__
+		context["library_build_type"] = "release";
+	#else
+		context["library_build_type"] = "debug";
+	#endif
+	doc["context"] = context;
+
+	for (vector<Result>::const_iterator it = results.begin(); it != results.end(); it++) {
+		Json::Value benchmark;
+		benchmark["name"] = it->name;
+		benchmark["run_name"] = it->name;
+		benchmark["run_type"] = "iteration";
+		benchmark["repetitions"] = 1;
+		benchmark["threads"] = 1;
+		if (!it->errorMessage.empty()) {
+			benchmark["error_occurred"] = true;
+			benchmark["error_message"] = it->errorMessage;
+		} else {
+			benchmark["iterations"] = (Json::UInt64) it->iterations;
+			benchmark["real_time"] = it->realTimeNs;
+			benchmark["cpu_time"] = it->cpuTimeNs;
+			benchmark["time_unit"] = "ns";
+			if (it->itemsPerSecond > 0) {
+				benchmark["items_per_second"] = it->itemsPerSecond;
+			}
+			if (it->bytesPerSecond > 0) {
+				benchmark["bytes_per_second"] = it->bytesPerSecond;
+			}
+		}
+		benchmarks.append(benchmark);
+	}
+	doc["benchmarks"] = benchmarks;
+	return doc;
+}
+
+static void
+usage(int exitCode) {
+	printf("Usage: microbench [options]\n");
+	printf("Runs microbenchmarks for the " PROGRAM_NAME " C++ support library.\n");
+	printf("Build with OPTIMIZE=1 for meaningful numbers.\n\n");
+	printf("Options:\n");
+	printf("  --filter REGEX    Only run benchmarks whose name matches REGEX\n");
+	printf("  --min-time SECS   Minimum time to run each benchmark (default: 0.5)\n");
+	printf("  --format FORMAT   Output format on stdout: console or json (default: console)\n");
+	printf("  --out PATH        Also write the JSON report to PATH\n");
+	printf("  --list            List available benchmarks\n");
+	printf("  -h                Print this usage information.\n");
+	exit(exitCode);
+}
+
+static const char *
+requireArgument(int argc, char *argv[], int i) {
+	if (i + 1 >= argc) {
+		fprintf(stderr, "*** ERROR: %s requires an argument.\n", argv[i]);
+		exit(1);
+	}
+	return argv[i + 1];
+}
+
+static Options
+parseOptions(int argc, char *argv[]) {
+	Options options;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+			usage(0);
+		} else if (strcmp(argv[i], "--filter") == 0) {
+			options.filter = requireArgument(argc, argv, i);
+			i++;
+		} else if (strcmp(argv[i], "--min-time") == 0) {
+			options.minTime = atof(requireArgument(argc, argv, i));
+			i++;
+		} else if (strcmp(argv[i], "--format") == 0) {
+			const char *format = requireArgument(argc, argv, i);
+			if (strcmp(format, "json") == 0) {
+				options.json = true;
+			} else if (strcmp(format, "console") == 0) {
+				options.json = false;
+			} else {
+				fprintf(stderr, "*** ERROR: Unknown format: %s\n", format);
+				exit(1);
+			}
+			i++;
+		} else if (strcmp(argv[i], "--out") == 0) {
+			options.outputPath = requireArgument(argc, argv, i);
+			i++;
+		} else if (strcmp(argv[i], "--list") == 0) {
+			const vector<Benchmark> &benchmarks = getBenchmarks();
+			for (unsigned int j = 0; j < benchmarks.size(); j++) {
+				printf("%s\n", benchmarks[j].name.c_str());
+			}
+			exit(0);
+		} else {
+			fprintf(stderr, "*** ERROR: Unknown option: %s\n", argv[i]);
+			fprintf(stderr, "Please pass -h for a list of valid options.\n");
+			exit(1);
+		}
+	}
+
+	return options;
+}
+
+int
+main(int argc, char *argv[]) {
+	Options options = parseOptions(argc, argv);
+	const vector<Benchmark> &benchmarks = getBenchmarks();
+	vector<Result> results;
+	regex_t filter;
+
+	// Some benchmarks run an event loop in a background thread.
+	oxt::initialize();
+	oxt::setup_syscall_interruption_support();
+
+	if (options.filter != NULL
+	 && regcomp(&filter, options.filter, REG_EXTENDED | REG_NOSUB) != 0)
+	{
+		fprintf(stderr, "*** ERROR: Invalid filter: %s\n", options.filter);
+		return 1;
+	}
+
+	if (!options.json) {
+		printConsoleHeader();
+	}
+	for (unsigned int i = 0; i < benchmarks.size(); i++) {
+		if (options.filter != NULL
+		 && regexec(&filter, benchmarks[i].name.c_str(), 0, NULL, 0) != 0)
+		{
+			continue;
+		}
+		results.push_back(runBenchmark(benchmarks[i], options.minTime));
+		if (!options.json) {
+			printConsoleResult(results.back());
+		}
+	}
+	if (options.filter != NULL) {
+		regfree(&filter);
+	}
+
+	Json::Value report = createJsonReport(results, argv[0]);
+	if (options.json) {
+		printf("%s", report.toStyledString().c_str());
+	}
+	if (options.outputPath != NULL) {
+		FILE *f = fopen(options.outputPath, "w");
+		if (f == NULL) {
+			int e = errno;
+			fprintf(stderr, "*** ERROR: Cannot open %s for writing: %s (errno=%d)\n",
+				options.outputPath, strerror(e), e);
+			return 1;
+		}
+		string str = report.toStyledString();
+		fwrite(str.data(), 1, str.size(), f);
+		fclose(f);
+	}
+
+	for (unsigned int i = 0; i < results.size(); i++) {
+		if (!results[i].errorMessage.empty()) {
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,180 @@
+#include "MicroBench.h"
+#include <ctime>
+#include <MemoryKit/palloc.h>
+#include <Core/Controller/Config.h>
+#include <Core/Controller/Request.h>
+#include <Core/Controller/AppResponse.h>
+#include <Core/ResponseCache.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace Passenger::ServerKit;
+
+
+namespace {
+	typedef ResponseCache<Request> ResponseCacheType;
+
+	/**
+	 * Sets up a request for a cacheable response, like the one in
+	 * test/cxx/Core/ResponseCacheTest.cpp.
+	 */
+	struct ResponseCacheFixture {
+		ResponseCacheType responseCache;
+		Request req;
+		ControllerSchema schema;
+		ConfigKit::Store config;
+		// Holds the request and response data. The request's own pool is
+		// only used for what the ResponseCache allocates, and is reset
+		// periodically so that memory usage does not grow while looping.
+		psg_pool_t *dataPool;
+		unsigned int operations;
+
+		ResponseCacheFixture()
+			: config(schema),
+			  operations(0)
+		{
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			dataPool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			config["multi_app"] = false;
+			config["default_server_name"] = "localhost";
+			config["default_server_port"] = "80";
+			req.config.reset(new ControllerRequestConfig(config));
+		}
+
+		~ResponseCacheFixture() {
+			req.headers.clear();
+			req.appResponse.headers.clear();
+			psg_destroy_pool(req.pool);
+			psg_destroy_pool(dataPool);
+		}
+
+		void resetScratchPool() {
+			if (++operations % 1024 == 0) {
+				psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+			}
+		}
+
+		void reset(unsigned int path) {
+			req.headers.clear();
+			req.secureHeaders.clear();
+			req.appResponse.headers.clear();
+			req.appResponse.secureHeaders.clear();
+			psg_reset_pool(dataPool, PSG_DEFAULT_POOL_SIZE);
+			resetScratchPool();
+
+			req.httpMajor = 1;
+			req.httpMinor = 1;
+			req.httpState = Request::COMPLETE;
+			req.bodyType  = Request::RBT_NO_BODY;
+			req.method    = HTTP_GET;
+			req.https     = false;
+			req.hasPragmaHeader = false;
+			req.cacheKey = HashedStaticString();
+			req.cacheControl = NULL;
+			req.varyCookie = NULL;
+
+			// LString does not copy the appended data.
+			char pathBuf[32];
+			int size = snprintf(pathBuf, sizeof(pathBuf), "/products/%u", path);
+			psg_lstr_init(&req.path);
+			StaticString pathStr = psg_pstrdup(dataPool, StaticString(pathBuf, size));
+			psg_lstr_append(&req.path, dataPool, pathStr.data(), pathStr.size());
+
+			LString *host = (LString *) psg_palloc(dataPool, sizeof(LString));
+			psg_lstr_init(host);
+			psg_lstr_append(host, dataPool, "www.example.com");
+			req.host = host;
+
+			req.headers.insert(dataPool, "host", "www.example.com");
+			req.headers.insert(dataPool, "accept", "text/html");
+			req.headers.insert(dataPool, "user-agent", "Mozilla/5.0");
+
+			req.appResponse.httpMajor  = 1;
+			req.appResponse.httpMinor  = 1;
+			req.appResponse.httpState  = AppResponse::COMPLETE;
+			req.appResponse.bodyType   = AppResponse::RBT_CONTENT_LENGTH;
+			req.appResponse.aux.bodyInfo.contentLength = 1024;
+			req.appResponse.statusCode = 200;
+			req.appResponse.date       = NULL;
+			req.appResponse.setCookie  = NULL;
+			req.appResponse.cacheControl  = NULL;
+			req.appResponse.expiresHeader = NULL;
+			req.appResponse.lastModifiedHeader = NULL;
+			req.appResponse.headers.insert(dataPool, "content-type", "text/html");
+			req.appResponse.headers.insert(dataPool, "cache-control",
+				"public,max-age=99999");
+		}
+
+		bool store(unsigned int path, time_t now) {
+			reset(path);
+			return responseCache.prepareRequest(this, &req)
+				&& responseCache.requestAllowsStoring(&req)
+				&& responseCache.prepareRequestForStoring(&req)
+				&& responseCache.store(&req, now, 100, 1024).valid();
+		}
+
+		bool fetch(time_t now) {
+			resetScratchPool();
+			return responseCache.prepareRequest(this, &req)
+				&& responseCache.requestAllowsFetching(&req)
+				&& responseCache.fetch(&req, now).valid();
+		}
+	};
+}
+
+static void
+BM_ResponseCache_lookup_hit(MicroBench::State &state) {
+	ResponseCacheFixture fixture;
+	time_t now = time(NULL);
+
+	if (!fixture.store(1, now)) {
+		state.skipWithError("Cannot store the response");
+	}
+	fixture.reset(1);
+	while (state.keepRunning()) {
+		if (!fixture.fetch(now)) {
+			state.skipWithError("Cannot fetch the response");
+		}
+	}
+
+	state.setItemsProcessed(state.iterations());
+}
+MICRO_BENCHMARK(BM_ResponseCache_lookup_hit);
+
+static void
+BM_ResponseCache_lookup_miss(MicroBench::State &state) {
+	ResponseCacheFixture fixture;
+	time_t now = time(NULL);
+
+	for (unsigned int i = 0; i < ResponseCacheType::MAX_ENTRIES; i++) {
+		fixture.store(i, now);
+	}
+	fixture.reset(ResponseCacheType::MAX_ENTRIES);
+	while (state.keepRunning()) {
+		if (fixture.fetch(now)) {
+			state.skipWithError("Unexpected cache hit");
+		}
+	}
+
+	state.setItemsProcessed(state.iterations());
+}
+MICRO_BENCHMARK(BM_ResponseCache_lookup_miss);
+
+static void
+BM_ResponseCache_store(MicroBench::State &state) {
+	// Includes preparing the request and response, like the Controller
+	// does before storing.
+	ResponseCacheFixture fixture;
+	time_t now = time(NULL);
+	unsigned int i = 0;
+
+	while (state.keepRunning()) {
+		if (!fixture.store(i++ % (ResponseCacheType::MAX_ENTRIES * 2), now)) {
+			state.skipWithError("Cannot store the response");
+		}
+	}
+
+	state.setItemsProcessed(state.iterations());
+}
+MICRO_BENCHMARK(BM_ResponseCache_store);
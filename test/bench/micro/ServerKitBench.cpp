@@ -0,0 +1,396 @@
+#include "MicroBench.h"
+#include "Corpus.h"
+#include <Constants.h>
+#include <MemoryKit/palloc.h>
+#include <MemoryKit/mbuf.h>
+#include <ServerKit/Context.h>
+#include <ServerKit/FileBufferedChannel.h>
+#include <ServerKit/HeaderTable.h>
+#include <ServerKit/HttpRequest.h>
+#include <ServerKit/HttpHeaderParser.h>
+#include <ServerKit/HttpChunkedBodyParser.h>
+// Not part of the common library: the agent compiles it into CoreMain.cpp.
+#include <BackgroundEventLoop.cpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::ServerKit;
+using namespace MicroBench::Corpus;
+
+
+/***** HeaderTable *****/
+
+static void
+BM_HeaderTable_insert(MicroBench::State &state) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+	HeaderTable table;
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < HEADER_NAMES_COUNT; i++) {
+			table.insert(pool, HEADER_NAMES[i], "value");
+		}
+		table.clear();
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	state.setItemsProcessed(state.iterations() * HEADER_NAMES_COUNT);
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_HeaderTable_insert);
+
+static void
+BM_HeaderTable_lookup(MicroBench::State &state) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+	vector<HashedStaticString> keys;
+	HeaderTable table;
+
+	for (unsigned int i = 0; i < HEADER_NAMES_COUNT; i++) {
+		table.insert(pool, HEADER_NAMES[i], "value");
+		keys.push_back(HashedStaticString(HEADER_NAMES[i]));
+	}
+	for (unsigned int i = 0; i < MISSING_HEADER_NAMES_COUNT; i++) {
+		keys.push_back(HashedStaticString(MISSING_HEADER_NAMES[i]));
+	}
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < keys.size(); i++) {
+			MicroBench::doNotOptimize(table.lookup(keys[i]));
+		}
+	}
+
+	state.setItemsProcessed(state.iterations() * keys.size());
+	table.clear();
+	psg_destroy_pool(pool);
+}
+MICRO_BENCHMARK(BM_HeaderTable_lookup);
+
+
+/***** HttpHeaderParser *****/
+
+namespace {
+	struct HeaderParserFixture {
+		ServerKit::Schema schema;
+		ServerKit::Context context;
+		HttpRequest req;
+		HttpHeaderParserState parserState;
+		MemoryKit::mbuf buffer;
+
+		HeaderParserFixture(const StaticString &data)
+			: context(schema)
+		{
+			context.mbuf_pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+			MemoryKit::mbuf_pool_init(&context.mbuf_pool);
+
+			MemoryKit::mbuf block(MemoryKit::mbuf_get(&context.mbuf_pool));
+			memcpy(block.start, data.data(), data.size());
+			buffer = MemoryKit::mbuf(block, 0, data.size());
+
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		}
+
+		~HeaderParserFixture() {
+			psg_destroy_pool(req.pool);
+			req.pool = NULL;
+		}
+
+		void reinitializeRequest() {
+			// Like HttpServer::reinitializeRequest().
+			req.httpMajor = 1;
+			req.httpMinor = 0;
+			req.httpState = HttpRequest::PARSING_HEADERS;
+			req.bodyType = HttpRequest::RBT_NO_BODY;
+			req.method = HTTP_GET;
+			req.wantKeepAlive = false;
+			psg_lstr_init(&req.path);
+			req.aux.bodyInfo.contentLength = 0;
+			req.queryStringIndex = -1;
+		}
+
+		void deinitializeRequest() {
+			// Like HttpServer::deinitializeRequest().
+			psg_lstr_deinit(&req.path);
+			deinitializeHeaders(req.headers);
+			deinitializeHeaders(req.secureHeaders);
+			psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+		}
+
+		static void deinitializeHeaders(HeaderTable &headers) {
+			HeaderTable::Iterator it(headers);
+			while (*it != NULL) {
+				psg_lstr_deinit(&it->header->key);
+				psg_lstr_deinit(&it->header->origKey);
+				psg_lstr_deinit(&it->header->val);
+				it.next();
+			}
+			headers.clear();
+		}
+	};
+}
+
+static void
+benchmarkHttpHeaderParser(MicroBench::State &state, const StaticString &data) {
+	HeaderParserFixture fixture(data);
+
+	while (state.keepRunning()) {
+		fixture.reinitializeRequest();
+		HttpHeaderParser<HttpRequest> parser(&fixture.context,
+			&fixture.parserState, &fixture.req, fixture.req.pool);
+		parser.initialize();
+		size_t ret = parser.feed(fixture.buffer);
+		// Depending on the request body, the parser ends in COMPLETE or
+		// PARSING_BODY.
+		if (ret != data.size()
+		 || fixture.req.httpState == HttpRequest::PARSING_HEADERS
+		 || fixture.req.httpState == HttpRequest::ERROR)
+		{
+			state.skipWithError("Cannot parse the request header");
+		}
+		fixture.deinitializeRequest();
+	}
+
+	state.setBytesProcessed(state.iterations() * data.size());
+	state.setItemsProcessed(state.iterations());
+}
+
+static void
+BM_HttpHeaderParser_small(MicroBench::State &state) {
+	benchmarkHttpHeaderParser(state, SMALL_REQUEST);
+}
+MICRO_BENCHMARK(BM_HttpHeaderParser_small);
+
+static void
+BM_HttpHeaderParser_browser(MicroBench::State &state) {
+	benchmarkHttpHeaderParser(state, BROWSER_REQUEST);
+}
+MICRO_BENCHMARK(BM_HttpHeaderParser_browser);
+
+static void
+BM_HttpHeaderParser_api(MicroBench::State &state) {
+	benchmarkHttpHeaderParser(state, API_REQUEST);
+}
+MICRO_BENCHMARK(BM_HttpHeaderParser_api);
+
+
+/***** HttpChunkedBodyParser *****/
+
+static unsigned int
+formatNoLoggingPrefix(char *buf, unsigned int bufsize, void *userData) {
+	return 0;
+}
+
+static void
+BM_HttpChunkedBodyParser(MicroBench::State &state) {
+	string body = createChunkedBody();
+	struct MemoryKit::mbuf_pool pool;
+	HttpChunkedBodyParserState parserState;
+	HttpChunkedBodyParser parser(&parserState, formatNoLoggingPrefix, NULL);
+
+	pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+	MemoryKit::mbuf_pool_init(&pool);
+	MemoryKit::mbuf block(MemoryKit::mbuf_get_with_size(&pool, body.size()));
+	memcpy(block.start, body.data(), body.size());
+	MemoryKit::mbuf buffer(block, 0, body.size());
+
+	while (state.keepRunning()) {
+		parser.initialize();
+		HttpChunkedEvent event(parser.feed(buffer, false));
+		if (event.type != HttpChunkedEvent::END || event.consumed != body.size()) {
+			state.skipWithError("Cannot parse the chunked body");
+		}
+	}
+
+	state.setBytesProcessed(state.iterations() * body.size());
+	block = MemoryKit::mbuf();
+	buffer = MemoryKit::mbuf();
+	MemoryKit::mbuf_pool_deinit(&pool);
+}
+MICRO_BENCHMARK(BM_HttpChunkedBodyParser);
+
+
+/***** FileBufferedChannel buffer files *****/
+
+namespace {
+	// Roughly a request body that exceeds the in-memory threshold.
+	const unsigned int BUFFER_FILE_DATA_SIZE = 64 * 1024;
+
+	/**
+	 * Buffers data in a FileBufferedChannel past its threshold, like the
+	 * Controller does for a request body that the application doesn't read
+	 * yet, and then reads it all back. This measures the real buffer file
+	 * path: the file is created, and with the 'file' backend unlinked, on
+	 * the libuv threadpool, and the data goes through the channel's mover
+	 * and reader.
+	 *
+	 * The work happens on an event loop thread and the libuv threadpool.
+	 * The CPU time is process-wide, so it includes those threads too.
+	 */
+	struct FileBufferedChannelBench: public ServerKit::Hooks {
+		BackgroundEventLoop bg;
+		ServerKit::Schema skSchema;
+		ServerKit::Context context;
+		FileBufferedChannel channel;
+		string data;
+		string errorMessage;
+		boost::mutex syncher;
+		boost::condition_variable cond;
+		FileBufferedChannelBackend backend;
+		unsigned int bytesReceived;
+		unsigned int pausedSize;
+		bool paused;
+		bool done;
+
+		FileBufferedChannelBench(const char *backendName)
+			: bg(false, true),
+			  context(skSchema),
+			  channel(&context),
+			  data(createBinaryData(BUFFER_FILE_DATA_SIZE)),
+			  backend(parseFileBufferedChannelBackend(backendName)),
+			  bytesReceived(0),
+			  pausedSize(0),
+			  paused(false),
+			  done(false)
+		{
+			Json::Value config;
+			vector<ConfigKit::Error> errors;
+
+			context.libev = bg.safe;
+			context.libuv = bg.libuv_loop;
+			context.initialize();
+			config["file_buffered_channel_threshold"] = BUFFER_FILE_DATA_SIZE / 4;
+			config["file_buffered_channel_backend"] = backendName;
+			if (!context.configure(config, errors)) {
+				errorMessage = "Cannot configure the context: "
+					+ ConfigKit::toString(errors);
+			}
+
+			channel.setDataCallback(onData);
+			channel.setBuffersFlushedCallback(onBuffersFlushed);
+			channel.setHooks(this);
+			Hooks::impl = NULL;
+			Hooks::userData = NULL;
+			bg.start();
+		}
+
+		~FileBufferedChannelBench() {
+			bg.safe->runSync(boost::bind(&FileBufferedChannel::deinitialize, &channel));
+			bg.stop();
+		}
+
+		/** Buffers and reads back BUFFER_FILE_DATA_SIZE bytes. */
+		bool run() {
+			boost::unique_lock<boost::mutex> l(syncher);
+			done = false;
+			bg.safe->runLater(boost::bind(&FileBufferedChannelBench::start, this));
+			while (!done) {
+				cond.wait(l);
+			}
+			return errorMessage.empty();
+		}
+
+		void start() {
+			unsigned int pos = 0;
+
+			channel.deinitialize();
+			channel.reinitialize();
+			bytesReceived = 0;
+			paused = false;
+
+			// The first buffer reaches the data callback right away, which
+			// doesn't consume it yet, so the rest is buffered to the file.
+			while (pos < data.size()) {
+				MemoryKit::mbuf buffer = MemoryKit::mbuf_get(&context.mbuf_pool);
+				unsigned int size = std::min<unsigned int>(buffer.size(),
+					data.size() - pos);
+				memcpy(buffer.start, data.data() + pos, size);
+				channel.feed(MemoryKit::mbuf(buffer, 0, size));
+				pos += size;
+			}
+		}
+
+		void finish(const string &error = string()) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			if (!error.empty()) {
+				errorMessage = error;
+			}
+			done = true;
+			cond.notify_one();
+		}
+
+		static Channel::Result onData(Channel *_channel, const MemoryKit::mbuf &buffer,
+			int errcode)
+		{
+			FileBufferedChannel *channel = reinterpret_cast<FileBufferedChannel *>(_channel);
+			FileBufferedChannelBench *self = static_cast<FileBufferedChannelBench *>(
+				channel->getHooks());
+
+			if (errcode != 0) {
+				self->finish("Buffer file I/O error: " + string(strerror(errcode)));
+				return Channel::Result(0, true);
+			} else if (self->bytesReceived == 0 && !self->paused) {
+				self->paused = true;
+				self->pausedSize = buffer.size();
+				return Channel::Result(-1, false);
+			}
+
+			self->bytesReceived += buffer.size();
+			if (self->bytesReceived == self->data.size()) {
+				self->finish();
+			}
+			return Channel::Result(buffer.size(), false);
+		}
+
+		/** Called once the mover has written all buffers to the file. */
+		static void onBuffersFlushed(FileBufferedChannel *channel) {
+			FileBufferedChannelBench *self = static_cast<FileBufferedChannelBench *>(
+				channel->getHooks());
+
+			if (channel->getMode() != FileBufferedChannel::IN_FILE_MODE || !self->paused) {
+				return;
+			} else if (channel->getBufferFileBackend() != self->backend) {
+				self->finish("The buffer file backend is not supported on this system");
+				return;
+			}
+
+			self->paused = false;
+			self->bytesReceived += self->pausedSize;
+			channel->consumed(self->pausedSize, false);
+		}
+	};
+}
+
+static void
+benchmarkFileBufferedChannel(MicroBench::State &state, const char *backendName) {
+	FileBufferedChannelBench bench(backendName);
+
+	if (!bench.errorMessage.empty()) {
+		state.skipWithError(bench.errorMessage);
+	}
+	while (state.keepRunning()) {
+		if (!bench.run()) {
+			state.skipWithError(bench.errorMessage);
+		}
+	}
+	state.setBytesProcessed(state.iterations() * BUFFER_FILE_DATA_SIZE);
+}
+
+static void
+BM_FileBufferedChannel_buffer_file_named(MicroBench::State &state) {
+	benchmarkFileBufferedChannel(state, "file");
+}
+MICRO_BENCHMARK(BM_FileBufferedChannel_buffer_file_named);
+
+static void
+BM_FileBufferedChannel_buffer_file_tmpfile(MicroBench::State &state) {
+	benchmarkFileBufferedChannel(state, "tmpfile");
+}
+MICRO_BENCHMARK(BM_FileBufferedChannel_buffer_file_tmpfile);
+
+static void
+BM_FileBufferedChannel_buffer_file_memfd(MicroBench::State &state) {
+	benchmarkFileBufferedChannel(state, "memfd");
+}
+MICRO_BENCHMARK(BM_FileBufferedChannel_buffer_file_memfd);
@@ -0,0 +1,50 @@
+#include "MicroBench.h"
+#include "Corpus.h"
+#include <cstring>
+#include <ctime>
+#include <StrIntTools/DateParsing.h>
+
+using namespace Passenger;
+using namespace MicroBench::Corpus;
+
+
+static void
+BM_parseImfFixdate(MicroBench::State &state) {
+	struct tm tm;
+	int zone;
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < HTTP_DATES_COUNT; i++) {
+			const char *date = HTTP_DATES[i];
+			memset(&tm, 0, sizeof(tm));
+			if (!parseImfFixdate(date, date + strlen(date), tm, zone)) {
+				state.skipWithError("Cannot parse the date");
+			}
+			MicroBench::doNotOptimize(tm);
+		}
+	}
+
+	state.setItemsProcessed(state.iterations() * HTTP_DATES_COUNT);
+}
+MICRO_BENCHMARK(BM_parseImfFixdate);
+
+static void
+BM_parseImfFixdate_to_timestamp(MicroBench::State &state) {
+	// Includes the mktime() call that ResponseCache does after parsing.
+	struct tm tm;
+	int zone;
+
+	while (state.keepRunning()) {
+		for (unsigned int i = 0; i < HTTP_DATES_COUNT; i++) {
+			const char *date = HTTP_DATES[i];
+			memset(&tm, 0, sizeof(tm));
+			if (!parseImfFixdate(date, date + strlen(date), tm, zone)) {
+				state.skipWithError("Cannot parse the date");
+			}
+			MicroBench::doNotOptimize(parsedDateToTimestamp(tm, zone));
+		}
+	}
+
+	state.setItemsProcessed(state.iterations() * HTTP_DATES_COUNT);
+}
+MICRO_BENCHMARK(BM_parseImfFixdate_to_timestamp);
@@ -0,0 +1,96 @@
+#include <TestSupport.h>
+#include <Algorithms/LatencyHistogram.h>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct Algorithms_LatencyHistogramTest: public TestBase {
+		LatencyHistogram histogram;
+	};
+
+	DEFINE_TEST_GROUP(Algorithms_LatencyHistogramTest);
+
+	TEST_METHOD(1) {
+		set_test_name("An empty histogram reports zeroes");
+
+		ensure_equals(histogram.getCount(), 0u);
+		ensure_equals(histogram.getMin(), 0u);
+		ensure_equals(histogram.getMax(), 0u);
+		ensure_equals(histogram.getMean(), 0.0);
+		ensure_equals(histogram.getValueAtPercentile(50), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Small values are recorded exactly");
+
+		for (unsigned int i = 1; i <= 20; i++) {
+			histogram.record(i);
+		}
+		ensure_equals(histogram.getCount(), 20u);
+		ensure_equals(histogram.getMin(), 1u);
+		ensure_equals(histogram.getMax(), 20u);
+		ensure_equals(histogram.getMean(), 10.5);
+		ensure_equals(histogram.getValueAtPercentile(50), 10u);
+		ensure_equals(histogram.getValueAtPercentile(100), 20u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Percentiles of large values are within the relative error bound");
+
+		for (unsigned int i = 1; i <= 100000; i++) {
+			histogram.record(i);
+		}
+
+		boost::uint64_t p50 = histogram.getValueAtPercentile(50);
+		boost::uint64_t p99 = histogram.getValueAtPercentile(99);
+		boost::uint64_t p999 = histogram.getValueAtPercentile(99.9);
+		ensure("p50 lower bound", p50 >= 50000);
+		ensure("p50 upper bound", p50 <= 50000 * 1.0625);
+		ensure("p99 lower bound", p99 >= 99000);
+		ensure("p99 upper bound", p99 <= 99000 * 1.0625);
+		ensure("p999 lower bound", p999 >= 99900);
+		ensure("p999 is capped by the maximum", p999 <= 100000);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Values that are too large are clamped into the last bucket");
+
+		histogram.record(1);
+		histogram.record(boost::uint64_t(1) << 40);
+		ensure_equals(histogram.getMax(), boost::uint64_t(1) << 40);
+		ensure_equals(histogram.getValueAtPercentile(100), boost::uint64_t(1) << 40);
+		ensure_equals(histogram.getValueAtPercentile(50), 1u);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Merging combines counts, minimum and maximum");
+
+		LatencyHistogram other;
+
+		histogram.record(100);
+		histogram.record(200);
+		other.record(50);
+		other.record(5000);
+		histogram.merge(other);
+
+		ensure_equals(histogram.getCount(), 4u);
+		ensure_equals(histogram.getMin(), 50u);
+		ensure_equals(histogram.getMax(), 5000u);
+		ensure_equals(histogram.getMean(), 1337.5);
+		ensure("p25 lower bound", histogram.getValueAtPercentile(25) >= 50);
+		ensure("p25 upper bound", histogram.getValueAtPercentile(25) <= 53);
+		ensure_equals(histogram.getValueAtPercentile(100), 5000u);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("Merging into an empty histogram takes over the minimum");
+
+		LatencyHistogram other;
+
+		other.record(300);
+		histogram.merge(other);
+		ensure_equals(histogram.getMin(), 300u);
+		ensure_equals(histogram.getCount(), 1u);
+	}
+}
@@ -0,0 +1,147 @@
+#include <TestSupport.h>
+#include <boost/make_shared.hpp>
+#include <IOTools/IOUtils.h>
+#include "../../../src/apache2_module/BucketState.h"
+
+using namespace Passenger;
+using namespace Passenger::Apache2Module;
+using namespace std;
+
+namespace tut {
+	struct Apache2Module_BucketStateTest: public TestBase {
+		CoreConnectionPool pool;
+		SocketPair conn;
+		boost::shared_ptr<PassengerBucketState> state;
+
+		Apache2Module_BucketStateTest()
+			: pool(2)
+		{
+			conn = createUnixSocketPair(__FILE__, __LINE__);
+		}
+
+		/**
+		 * Sets up the bucket state like Hooks::handleRequest() does after
+		 * it has read the response header, plus `rest`, from the core.
+		 */
+		void init(const string &header, const string &rest = string(),
+			bool headerOnly = false)
+		{
+			state = boost::make_shared<PassengerBucketState>(conn.first);
+			state->analyzeResponseHeader(header, headerOnly);
+			state->bufferedData = rest;
+			state->connectionPool = &pool;
+			conn.first = FileDescriptor();
+			if (state->bodyEnded()) {
+				state->finish();
+			}
+		}
+
+		/** Reads the body like PassengerBucket does. */
+		string readBody() {
+			string result;
+			char buf[16];
+			ssize_t ret;
+
+			while (!state->completed) {
+				ret = state->readBody(buf, sizeof(buf));
+				if (ret > 0) {
+					result.append(buf, ret);
+					if (state->bodyEnded()) {
+						state->finish();
+					}
+				} else {
+					if (ret == -1) {
+						state->errorCode = errno;
+					}
+					state->finish();
+				}
+			}
+			return result;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Apache2Module_BucketStateTest);
+
+	TEST_METHOD(1) {
+		set_test_name("A body with a Content-Length ends after that many bytes, "
+			"after which the connection is reused");
+
+		init("HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\n", "hel");
+		ensure_equals("(1)", state->bodyType, RBT_CONTENT_LENGTH);
+		ensure("(2)", state->keepAlive);
+		writeExact(conn.second, "lo");
+		ensure_equals("(3)", readBody(), "hello");
+		ensure("(4)", pool.checkout() != -1);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Chunked bodies are decoded");
+
+		init("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n",
+			"5\r\nhello\r\n");
+		ensure_equals("(1)", state->bodyType, RBT_CHUNKED);
+		writeExact(conn.second, "6\r\n world\r\n0\r\n\r\n");
+		ensure_equals("(2)", readBody(), "hello world");
+		ensure_equals("(3)", state->errorCode, 0);
+		ensure("(4)", pool.checkout() != -1);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Responses to HEAD requests, and 204 and 304 responses, have no body");
+
+		init("HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\n", "", true);
+		ensure_equals("(1)", state->bodyType, RBT_NO_BODY);
+		ensure("(2)", state->completed);
+		ensure("(3)", pool.checkout() != -1);
+
+		conn = createUnixSocketPair(__FILE__, __LINE__);
+		init("HTTP/1.1 204 No Content\r\n\r\n");
+		ensure_equals("(4)", state->bodyType, RBT_NO_BODY);
+
+		conn = createUnixSocketPair(__FILE__, __LINE__);
+		init("HTTP/1.1 304 Not Modified\r\n\r\n");
+		ensure_equals("(5)", state->bodyType, RBT_NO_BODY);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Without a Content-Length or chunked encoding, the body ends "
+			"when the core closes the connection");
+
+		init("HTTP/1.1 200 OK\r\n\r\n", "hello");
+		ensure_equals("(1)", state->bodyType, RBT_UNTIL_EOF);
+		ensure("(2)", !state->keepAlive);
+		writeExact(conn.second, " world");
+		conn.second.close();
+		ensure_equals("(3)", readBody(), "hello world");
+		ensure_equals("(4)", (int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("All data after a 101 Switching Protocols response is forwarded "
+			"until the core closes the connection");
+
+		init("HTTP/1.1 101 Switching Protocols\r\n"
+			"Connection: Upgrade\r\n"
+			"Upgrade: websocket\r\n\r\n",
+			string("\x81\x05hello", 7));
+		ensure_equals("(1)", state->bodyType, RBT_UNTIL_EOF);
+		ensure("(2)", !state->keepAlive);
+		ensure("(3)", !state->completed);
+		writeExact(conn.second, string("\x81\x06 world", 8));
+		conn.second.close();
+		ensure_equals("(4)", readBody(),
+			string("\x81\x05hello\x81\x06 world", 15));
+		ensure_equals("(5)", (int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("Data after the end of a chunked body prevents the connection "
+			"from being reused");
+
+		init("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n",
+			"5\r\nhello\r\n0\r\n\r\ngarbage");
+		ensure_equals("(1)", readBody(), "hello");
+		ensure("(2)", !state->keepAlive);
+		ensure_equals("(3)", (int) pool.checkout(), -1);
+	}
+}
@@ -0,0 +1,197 @@
+#include <TestSupport.h>
+#include "../../../src/apache2_module/ChunkedBodyDecoder.h"
+
+using namespace Passenger;
+using namespace Passenger::Apache2Module;
+using namespace std;
+
+namespace tut {
+	struct Apache2Module_ChunkedBodyDecoderTest: public TestBase {
+		ChunkedBodyDecoder decoder;
+		size_t consumed;
+
+		Apache2Module_ChunkedBodyDecoderTest()
+			: consumed(0)
+			{ }
+
+		string feed(const string &input) {
+			string buf = input;
+			size_t size = decoder.feed(&buf[0], buf.size(), consumed);
+			return buf.substr(0, size);
+		}
+
+		/**
+		 * Feeds `input` in pieces of `pieceSize` bytes, like a series of
+		 * short reads, and returns the decoded body.
+		 */
+		string feedInPieces(const string &input, size_t pieceSize) {
+			string result;
+			size_t pos = 0;
+
+			while (pos < input.size() && !decoder.done() && !decoder.hasError()) {
+				result.append(feed(input.substr(pos, pieceSize)));
+				pos += consumed;
+			}
+			return result;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Apache2Module_ChunkedBodyDecoderTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It decodes a body that arrives in a single read");
+
+		string input = "5\r\nhello\r\n7\r\n, world\r\n0\r\n\r\n";
+		ensure_equals(feed(input), "hello, world");
+		ensure_equals(consumed, input.size());
+		ensure(decoder.done());
+		ensure(!decoder.hasError());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It stops at the end of the body, leaving the next response unconsumed");
+
+		string body = "3\r\nabc\r\n0\r\n\r\n";
+		ensure_equals(feed(body + "HTTP/1.1 200 OK\r\n"), "abc");
+		ensure_equals(consumed, body.size());
+		ensure(decoder.done());
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It handles chunk sizes that are split across reads");
+
+		string input = "1a\r\nabcdefghijklmnopqrstuvwxyz\r\nA\r\n0123456789\r\n0\r\n\r\n";
+		ensure_equals(feed("1"), "");
+		ensure_equals(consumed, 1u);
+		ensure(!decoder.done());
+		ensure(!decoder.hasError());
+
+		ensure_equals(feed(input.substr(1)),
+			"abcdefghijklmnopqrstuvwxyz0123456789");
+		ensure(decoder.done());
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("It decodes a body that arrives one byte at a time");
+
+		string input = "1a\r\nabcdefghijklmnopqrstuvwxyz\r\nA\r\n0123456789\r\n0\r\n\r\n";
+		ensure_equals(feedInPieces(input, 1),
+			"abcdefghijklmnopqrstuvwxyz0123456789");
+		ensure(decoder.done());
+		ensure(!decoder.hasError());
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("It skips chunk extensions");
+
+		string input = "5;name=value\r\nhello\r\n"
+			"6 ; foo=\"bar\"\r\n world\r\n"
+			"0;last\r\n\r\n";
+		ensure_equals(feed(input), "hello world");
+		ensure_equals(consumed, input.size());
+		ensure(decoder.done());
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("It handles CRLFs that are split across reads");
+
+		string result;
+		result.append(feed("5\r"));
+		result.append(feed("\nhello\r"));
+		result.append(feed("\n0\r"));
+		result.append(feed("\n\r"));
+		ensure(!decoder.done());
+		result.append(feed("\n"));
+		ensure_equals(result, "hello");
+		ensure(decoder.done());
+		ensure(!decoder.hasError());
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("It skips trailers");
+
+		string input = "5\r\nhello\r\n0\r\nX-Foo: bar\r\nX-Baz: qux\r\n\r\n";
+		ensure_equals(feed(input + "next"), "hello");
+		ensure_equals(consumed, input.size());
+		ensure(decoder.done());
+	}
+
+	TEST_METHOD(8) {
+		set_test_name("It skips trailers that are split across reads");
+
+		string input = "5\r\nhello\r\n0\r\nX-Foo: bar\r\nX-Baz: qux\r\n\r\n";
+		ensure_equals(feedInPieces(input, 2), "hello");
+		ensure(decoder.done());
+		ensure(!decoder.hasError());
+	}
+
+	TEST_METHOD(9) {
+		set_test_name("It rejects malformed chunk sizes");
+
+		feed("xyz\r\n");
+		ensure("(1)", decoder.hasError());
+		ensure_equals("(2)", consumed, 0u);
+
+		ChunkedBodyDecoder decoder2;
+		string buf = "\r\nhello\r\n";
+		decoder2.feed(&buf[0], buf.size(), consumed);
+		ensure("(3)", decoder2.hasError());
+
+		ChunkedBodyDecoder decoder3;
+		buf = "5x\r\nhello\r\n";
+		decoder3.feed(&buf[0], buf.size(), consumed);
+		ensure("(4)", decoder3.hasError());
+
+		ChunkedBodyDecoder decoder4;
+		buf = "5\rhello\r\n";
+		decoder4.feed(&buf[0], buf.size(), consumed);
+		ensure("(5)", decoder4.hasError());
+	}
+
+	TEST_METHOD(10) {
+		set_test_name("It rejects chunks that are not followed by a CRLF");
+
+		ensure_equals(feed("5\r\nhelloXX"), "hello");
+		ensure(decoder.hasError());
+		ensure(!decoder.done());
+		ensure_equals(consumed, strlen("5\r\nhelloX"));
+	}
+
+	TEST_METHOD(11) {
+		set_test_name("It rejects chunk sizes with too many digits");
+
+		feed("0000000000000001");
+		ensure(decoder.hasError());
+		ensure_equals(consumed, 15u);
+	}
+
+	TEST_METHOD(12) {
+		set_test_name("It accepts chunk sizes with the maximum number of digits");
+
+		ensure_equals(feed("00000000000000a\r\n0123456789\r\n0\r\n\r\n"), "0123456789");
+		ensure(decoder.done());
+		ensure(!decoder.hasError());
+	}
+
+	TEST_METHOD(13) {
+		set_test_name("When the input ends in the middle of a chunk, it returns the data "
+			"so far and waits for more");
+
+		ensure_equals(feed("a\r\nhello"), "hello");
+		ensure(!decoder.done());
+		ensure(!decoder.hasError());
+
+		ensure_equals(feed("world\r\n0\r\n\r\n"), "world");
+		ensure(decoder.done());
+	}
+
+	TEST_METHOD(14) {
+		set_test_name("It does not consume anything after an error");
+
+		feed("5\r\nhello\r\nzz\r\n");
+		ensure(decoder.hasError());
+		ensure_equals(feed("0\r\n\r\n"), "");
+		ensure_equals(consumed, 0u);
+		ensure(!decoder.done());
+	}
+}
@@ -0,0 +1,126 @@
+#include <TestSupport.h>
+#include <IOTools/IOUtils.h>
+#include "../../../src/apache2_module/CoreConnectionPool.h"
+
+using namespace Passenger;
+using namespace Passenger::Apache2Module;
+using namespace std;
+
+namespace tut {
+	struct Apache2Module_CoreConnectionPoolTest: public TestBase {
+		CoreConnectionPool pool;
+
+		Apache2Module_CoreConnectionPoolTest()
+			: pool(2)
+			{ }
+
+		/**
+		 * Whether the other end of the given socket was closed, i.e.
+		 * whether it becomes readable and then reads EOF. If the other
+		 * end was closed with unread data then the read fails with
+		 * ECONNRESET instead.
+		 */
+		bool peerClosed(const FileDescriptor &fd) {
+			unsigned long long timeout = 1000000;
+			char buf;
+
+			if (!waitUntilReadable(fd, &timeout)) {
+				return false;
+			}
+			return read(fd, &buf, 1) <= 0;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Apache2Module_CoreConnectionPoolTest);
+
+	TEST_METHOD(1) {
+		set_test_name("Checking out from an empty pool returns an empty file descriptor");
+
+		ensure_equals((int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("A checked in connection is returned by the next checkout, but only once");
+
+		SocketPair conn = createUnixSocketPair(__FILE__, __LINE__);
+		pool.checkin(conn.first);
+		ensure_equals((int) pool.checkout(), (int) conn.first);
+		ensure_equals((int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Connections that are checked in when the pool is full are closed");
+
+		SocketPair conn1 = createUnixSocketPair(__FILE__, __LINE__);
+		SocketPair conn2 = createUnixSocketPair(__FILE__, __LINE__);
+		SocketPair conn3 = createUnixSocketPair(__FILE__, __LINE__);
+		pool.checkin(conn1.first);
+		pool.checkin(conn2.first);
+		pool.checkin(conn3.first);
+		conn1.first = FileDescriptor();
+		conn2.first = FileDescriptor();
+		conn3.first = FileDescriptor();
+
+		ensure("(1)", peerClosed(conn3.second));
+		ensure("(2)", pool.checkout() != -1);
+		ensure("(3)", pool.checkout() != -1);
+		ensure_equals("(4)", (int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Checkout skips and closes connections that were closed by the core");
+
+		SocketPair conn1 = createUnixSocketPair(__FILE__, __LINE__);
+		SocketPair conn2 = createUnixSocketPair(__FILE__, __LINE__);
+		pool.checkin(conn1.first);
+		pool.checkin(conn2.first);
+		conn2.second.close();
+
+		ensure_equals("(1)", (int) pool.checkout(), (int) conn1.first);
+		ensure_equals("(2)", (int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Checkout skips and closes connections with unexpected data");
+
+		SocketPair conn = createUnixSocketPair(__FILE__, __LINE__);
+		pool.checkin(conn.first);
+		conn.first = FileDescriptor();
+		writeExact(conn.second, "x", 1);
+
+		ensure_equals("(1)", (int) pool.checkout(), -1);
+		ensure("(2)", peerClosed(conn.second));
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("Lowering the maximum number of idle connections closes the excess ones");
+
+		SocketPair conn1 = createUnixSocketPair(__FILE__, __LINE__);
+		SocketPair conn2 = createUnixSocketPair(__FILE__, __LINE__);
+		pool.checkin(conn1.first);
+		pool.checkin(conn2.first);
+		conn1.first = FileDescriptor();
+		conn2.first = FileDescriptor();
+
+		pool.setMaxIdleConnections(1);
+		ensure("(1)", peerClosed(conn2.second));
+		ensure("(2)", pool.checkout() != -1);
+		ensure_equals("(3)", (int) pool.checkout(), -1);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("clear() closes all idle connections");
+
+		SocketPair conn1 = createUnixSocketPair(__FILE__, __LINE__);
+		SocketPair conn2 = createUnixSocketPair(__FILE__, __LINE__);
+		pool.checkin(conn1.first);
+		pool.checkin(conn2.first);
+		conn1.first = FileDescriptor();
+		conn2.first = FileDescriptor();
+
+		pool.clear();
+		ensure("(1)", peerClosed(conn1.second));
+		ensure("(2)", peerClosed(conn2.second));
+		ensure_equals("(3)", (int) pool.checkout(), -1);
+	}
+}
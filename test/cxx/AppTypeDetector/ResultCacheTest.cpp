@@ -0,0 +1,76 @@
+#include <TestSupport.h>
+#include <AppTypeDetector/ResultCache.h>
+#include <WrapperRegistry/Registry.h>
+#include <SystemTools/SystemTime.h>
+#include <FileTools/FileManip.h>
+
+using namespace Passenger;
+using namespace Passenger::AppTypeDetector;
+using namespace std;
+
+namespace tut {
+	struct AppTypeDetector_ResultCacheTest: public TestBase {
+		WrapperRegistry::Registry registry;
+		ShardedCachedFileStat cstat;
+		ResultCache cache;
+		string appRoot;
+
+		AppTypeDetector_ResultCacheTest() {
+			registry.finalize();
+			makeDirTree("tmp.app/public");
+			createFile("tmp.app/config.ru", "");
+			SystemTime::force(10);
+		}
+
+		~AppTypeDetector_ResultCacheTest() {
+			SystemTime::release();
+			removeDirTree("tmp.app");
+		}
+
+		Detector::Result checkDocumentRoot(unsigned int throttleRate) {
+			Detector detector(registry, &cstat, 0);
+			return cache.checkDocumentRoot(detector, throttleRate,
+				"tmp.app/public", false, &appRoot);
+		}
+	};
+
+	DEFINE_TEST_GROUP(AppTypeDetector_ResultCacheTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It reuses results until the throttle rate has passed");
+
+		Detector::Result result = checkDocumentRoot(2);
+		ensure("(1)", result.wrapperRegistryEntry != NULL);
+		ensure_equals("(2)", result.wrapperRegistryEntry->language, "ruby");
+		ensure_equals("(3)", appRoot, "tmp.app");
+
+		unlink("tmp.app/config.ru");
+		appRoot.clear();
+		SystemTime::force(11);
+		result = checkDocumentRoot(2);
+		ensure("(4)", result.wrapperRegistryEntry != NULL);
+		ensure_equals("(5)", appRoot, "tmp.app");
+
+		SystemTime::force(12);
+		ensure("(6)", checkDocumentRoot(2).isNull());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It does not cache if the throttle rate is 0");
+
+		ensure("(1)", !checkDocumentRoot(0).isNull());
+		unlink("tmp.app/config.ru");
+		ensure("(2)", checkDocumentRoot(0).isNull());
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It caches results per application root");
+
+		Detector detector(registry, &cstat, 0);
+		ensure("(1)", !cache.checkAppRoot(detector, 2, "tmp.app").isNull());
+		unlink("tmp.app/config.ru");
+		ensure("(2)", !cache.checkAppRoot(detector, 2, "tmp.app").isNull());
+		cache.clear();
+		ensure("(3)", cache.checkAppRoot(detector, 2, "tmp.app").isNull());
+	}
+}
@@ -1,5 +1,6 @@
 #include <TestSupport.h>
 #include <Utils/CachedFileStat.hpp>
+#include <Utils/ShardedCachedFileStat.hpp>
 #include <SystemTools/SystemTime.h>
 #include <sys/types.h>
 #include <utime.h>
@@ -399,4 +400,40 @@ namespace tut {
 		ensure("(4)", stat.knows("test4.txt"));
 		ensure("(5)", stat.knows("test5.txt"));
 	}
+
+	/************ ShardedCachedFileStat ************/
+
+	TEST_METHOD(17) {
+		// ShardedCachedFileStat has the same throttling semantics.
+		ShardedCachedFileStat stat(1024);
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		touch("test2.txt", 2);
+		ensure_equals(stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals(stat.stat("test2.txt", &buf, 1), 0);
+
+		touch("test.txt", 1000);
+		stat.stat("test.txt", &buf, 1);
+		ensure_equals("Cached value was used", buf.st_mtime, (time_t) 1);
+
+		SystemTime::force(6);
+		stat.stat("test.txt", &buf, 1);
+		ensure_equals("Cache has been invalidated", buf.st_mtime, (time_t) 1000);
+		stat.stat("test2.txt", &buf, 1);
+		ensure_equals(buf.st_mtime, (time_t) 2);
+	}
+
+	TEST_METHOD(18) {
+		// ShardedCachedFileStat::getShard() returns the shard that caches the file.
+		ShardedCachedFileStat stat(1024);
+		boost::mutex *syncher;
+
+		touch("test.txt");
+		stat.stat("test.txt", &buf, 1);
+		CachedFileStat *shard = stat.getShard("test.txt", &syncher);
+		ensure(shard->knows("test.txt"));
+		ensure(stat.knows("test.txt"));
+		ensure(!stat.knows("test2.txt"));
+	}
 }
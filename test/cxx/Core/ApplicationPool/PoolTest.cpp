@@ -949,6 +949,105 @@ namespace tut {
 		);
 	}
 
+	TEST_METHOD(26) {
+		// If the pool is full, and one tries to get() from a nonexistant group,
+		// then it will kill an idle process from the group that uses the
+		// largest part of its fair share, even if that is not the oldest
+		// idle process.
+		Options options = createOptions();
+		SessionPtr session;
+		pid_t pid1, pid2;
+		pool->setMax(2);
+		options.minProcesses = 0;
+
+		// Create a group /foo with a large weight.
+		options.appRoot = "/foo";
+		options.fairShareWeight = 3;
+		SystemTime::force(1);
+		session = pool->get(options, &ticket);
+		pid1 = session->getPid();
+		session.reset();
+
+		// Create a group /bar with a small weight.
+		options.appRoot = "/bar";
+		options.fairShareWeight = 1;
+		SystemTime::force(2);
+		session = pool->get(options, &ticket);
+		pid2 = session->getPid();
+		session.reset();
+
+		// Wait until both processes are idle.
+		EVENTUALLY(5,
+			LockGuard l(pool->syncher);
+			vector<ProcessPtr> processes = pool->getProcesses(false);
+			result = processes.size() == 2
+				&& processes[0]->busyness() == 0
+				&& processes[1]->busyness() == 0;
+		);
+
+		// Get from /baz. The process for /bar should be killed now,
+		// even though the process for /foo has been idle for longer.
+		options.appRoot = "/baz";
+		SystemTime::force(3);
+		session = pool->get(options, &ticket);
+
+		LockGuard l(pool->syncher);
+		vector<ProcessPtr> processes = pool->getProcesses(false);
+		ensure_equals("(1)", processes.size(), 2u);
+		ensure("(2)", processes[0]->getPid() == pid1 || processes[1]->getPid() == pid1);
+		ensure("(3)", processes[0]->getPid() != pid2 && processes[1]->getPid() != pid2);
+	}
+
+	TEST_METHOD(27) {
+		// If the pool is full, and one tries to get() from a nonexistant group,
+		// then it will not kill an idle process from a group that uses no more
+		// than its minProcesses, even if that group uses the largest part of
+		// its fair share and has the oldest idle process.
+		Options options = createOptions();
+		SessionPtr session;
+		pid_t pid1, pid2;
+		pool->setMax(2);
+
+		// Create a group /bar with a small weight, at its minProcesses.
+		options.appRoot = "/bar";
+		options.fairShareWeight = 1;
+		options.minProcesses = 1;
+		SystemTime::force(1);
+		session = pool->get(options, &ticket);
+		pid1 = session->getPid();
+		session.reset();
+
+		// Create a group /foo with a large weight and no minProcesses.
+		options.appRoot = "/foo";
+		options.fairShareWeight = 3;
+		options.minProcesses = 0;
+		SystemTime::force(2);
+		session = pool->get(options, &ticket);
+		pid2 = session->getPid();
+		session.reset();
+
+		// Wait until both processes are idle.
+		EVENTUALLY(5,
+			LockGuard l(pool->syncher);
+			vector<ProcessPtr> processes = pool->getProcesses(false);
+			result = processes.size() == 2
+				&& processes[0]->busyness() == 0
+				&& processes[1]->busyness() == 0;
+		);
+
+		// Get from /baz. The process for /foo should be killed now,
+		// even though /bar uses a larger part of its fair share.
+		options.appRoot = "/baz";
+		SystemTime::force(3);
+		session = pool->get(options, &ticket);
+
+		LockGuard l(pool->syncher);
+		vector<ProcessPtr> processes = pool->getProcesses(false);
+		ensure_equals("(1)", processes.size(), 2u);
+		ensure("(2)", processes[0]->getPid() == pid1 || processes[1]->getPid() == pid1);
+		ensure("(3)", processes[0]->getPid() != pid2 && processes[1]->getPid() != pid2);
+	}
+
 
 	/*********** Test detachProcess() ***********/
 
@@ -2068,6 +2167,193 @@ namespace tut {
 	//       when the session's connection has been released by the app.
 
 
+	/*********** Test demand forecasting ***********/
+
+	TEST_METHOD(80) {
+		// The group forecasts the number of processes it needs from the
+		// request arrival rate and the average service time, and spawns
+		// processes ahead of demand.
+		Options options = createOptions();
+		SessionPtr session;
+		GroupPtr group;
+		unsigned long long now = 100000000;
+		pool->setMax(5);
+
+		// 4 requests per second, each taking 0.5 seconds, for 10 seconds.
+		// That's 2 requests in progress on average. With headroom
+		// that calls for 3 processes.
+		for (int i = 0; i < 40; i++) {
+			SystemTime::forceAll(now);
+			session = pool->get(options, &ticket);
+			group = session->getGroup()->shared_from_this();
+			SystemTime::forceAll(now + 500000);
+			session.reset();
+			now += 250000;
+		}
+
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getPredictedProcessesNeeded(), 3u);
+		}
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 3;
+		);
+	}
+
+	TEST_METHOD(81) {
+		// The forecast never exceeds maxProcesses.
+		Options options = createOptions();
+		SessionPtr session;
+		GroupPtr group;
+		unsigned long long now = 100000000;
+		options.maxProcesses = 2;
+		pool->setMax(5);
+
+		for (int i = 0; i < 40; i++) {
+			SystemTime::forceAll(now);
+			session = pool->get(options, &ticket);
+			group = session->getGroup()->shared_from_this();
+			SystemTime::forceAll(now + 500000);
+			session.reset();
+			now += 250000;
+		}
+
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getPredictedProcessesNeeded(), 2u);
+		}
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = pool->getProcessCount() > 2;
+		);
+	}
+
+
+	/*********** Test rolling restarts ***********/
+
+	TEST_METHOD(82) {
+		// A rolling restart replaces all processes while the number of
+		// enabled processes never drops below the pre-restart level.
+		ensureMinProcesses(2);
+		pool->setMax(4);
+		GroupPtr group = pool->getGroup("stub/rack")->shared_from_this();
+		set<string> oldGupids;
+		{
+			LockGuard l(pool->syncher);
+			foreach (const ProcessPtr &process, group->enabledProcesses) {
+				oldGupids.insert(process->getGupid().toString());
+			}
+		}
+
+		Pool::RestartOptions restartOptions = Pool::RestartOptions::makeAuthorized();
+		restartOptions.method = RM_ROLLING;
+		ensure(pool->restartGroupByName("stub/rack", restartOptions));
+
+		bool done = false;
+		for (int i = 0; i < 5000 && !done; i++) {
+			ScopedLock l(pool->syncher);
+			ensure("Enabled process count never drops",
+				group->enabledProcesses.size() >= 2);
+			done = group->enabledProcesses.size() == 2;
+			foreach (const ProcessPtr &process, group->enabledProcesses) {
+				done = done && oldGupids.count(process->getGupid().toString()) == 0;
+			}
+			if (!done) {
+				l.unlock();
+				usleep(1000);
+			}
+		}
+		ensure("All processes have been replaced", done);
+		ensure(!group->restarting());
+	}
+
+	TEST_METHOD(83) {
+		// If there is no spare capacity then a rolling restart
+		// replaces one process at a time without exceeding the pool limits.
+		ensureMinProcesses(2);
+		pool->setMax(2);
+		GroupPtr group = pool->getGroup("stub/rack")->shared_from_this();
+		set<string> oldGupids;
+		{
+			LockGuard l(pool->syncher);
+			foreach (const ProcessPtr &process, group->enabledProcesses) {
+				oldGupids.insert(process->getGupid().toString());
+			}
+		}
+
+		Pool::RestartOptions restartOptions = Pool::RestartOptions::makeAuthorized();
+		restartOptions.method = RM_ROLLING;
+		ensure(pool->restartGroupByName("stub/rack", restartOptions));
+
+		bool done = false;
+		for (int i = 0; i < 5000 && !done; i++) {
+			ScopedLock l(pool->syncher);
+			ensure("Pool limits are respected", pool->capacityUsedUnlocked() <= 2);
+			ensure("At least one process stays enabled",
+				!group->enabledProcesses.empty());
+			done = group->enabledProcesses.size() == 2;
+			foreach (const ProcessPtr &process, group->enabledProcesses) {
+				done = done && oldGupids.count(process->getGupid().toString()) == 0;
+			}
+			if (!done) {
+				l.unlock();
+				usleep(1000);
+			}
+		}
+		ensure("All processes have been replaced", done);
+	}
+
+	TEST_METHOD(84) {
+		// A rolling restart sends the warm-up requests to each new process
+		// before it is attached.
+		TempDirCopy dir("stub/wsgi", "tmp.wsgi");
+		Options options = createOptions();
+		options.appRoot = "tmp.wsgi";
+		options.appType = "wsgi";
+		options.startupFile = "passenger_wsgi.py";
+		options.spawnMethod = "direct";
+		options.rollingRestart = true;
+		options.warmupURIs = "/warm1 /warm2?x=1";
+		pool->setMax(2);
+
+		ensure_equals(sendRequest(options, "/"), "front page");
+
+		writeFile("tmp.wsgi/passenger_wsgi.py",
+			"import os\n"
+			"def application(env, start_response):\n"
+			"	with open('warmup.log', 'a') as f:\n"
+			"		f.write('%d %s?%s\\n' % (os.getpid(), env['PATH_INFO'], env.get('QUERY_STRING', '')))\n"
+			"	start_response('200 OK', [('Content-Type', 'text/html')])\n"
+			"	return [b'restarted']\n");
+		// The app may run as a different user.
+		createFile("tmp.wsgi/warmup.log", "", 0666);
+		ensure(pool->restartGroupByName(options.getAppGroupName()));
+
+		vector<string> lines;
+		EVENTUALLY(10,
+			lines.clear();
+			if (fileExists("tmp.wsgi/warmup.log")) {
+				split(unsafeReadFile("tmp.wsgi/warmup.log"), '\n', lines);
+			}
+			result = lines.size() >= 2;
+		);
+		string pid = lines[0].substr(0, lines[0].find(' '));
+		ensure_equals(lines[0], pid + " /warm1?");
+		ensure_equals(lines[1], pid + " /warm2?x=1");
+
+		// The warmed up process replaces the old one.
+		EVENTUALLY(5,
+			LockGuard l(pool->syncher);
+			GroupPtr group = pool->getGroup(options.getAppGroupName().toString().c_str());
+			result = group->enabledProcesses.size() == 1
+				&& toString(group->enabledProcesses[0]->getPid()) == pid;
+		);
+		ensure_equals(sendRequest(options, "/"), "restarted");
+	}
+
+
 	/*********** Test previously discovered bugs ***********/
 
 	TEST_METHOD(85) {
@@ -2089,5 +2375,180 @@ namespace tut {
 	}
 
 
+	/*********** Test metrics ***********/
+
+	TEST_METHOD(86) {
+		// Spawns and the resulting pool state are published as metrics.
+		Options options = createOptions();
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+
+		const Pool::Metrics &metrics = pool->metrics;
+		ensure_equals("(1)", metrics.processesSpawned.get(), 1u);
+		ensure_equals("(2)", metrics.spawnErrors.get(), 0u);
+		ensure_equals("(3)", metrics.groups.get(), 1);
+		ensure_equals("(4)", metrics.processes.get(), 1);
+		ensure_equals("(5)", metrics.busySessions.get(), 1);
+		ensure_equals("(6)", metrics.queuedRequests.get(), 0);
+		ensure_equals("(7)", metrics.maxCapacity.get(), (boost::int64_t) pool->max);
+	}
+
+
+	/*********** Test state snapshots ***********/
+
+	TEST_METHOD(87) {
+		// getSnapshot() returns a copy of the pool state which
+		// the inspection functions format.
+		Options options = createOptions();
+		SessionPtr session = pool->get(options, &ticket);
+
+		PoolSnapshotPtr snapshot = pool->getSnapshot();
+		ensure_equals("(1)", snapshot->groups.size(), 1u);
+		ensure_equals("(2)", snapshot->processCount, 1u);
+		ensure_equals("(3)", snapshot->max, pool->max);
+		const GroupSnapshot &group = snapshot->groups[0];
+		ensure_equals("(4)", group.name, options.getAppGroupName().toString());
+		ensure_equals("(5)", group.enabledProcesses.size(), 1u);
+		ensure_equals("(6)", group.enabledProcesses[0].pid,
+			session->getProcess()->getPid());
+		ensure_equals("(7)", group.enabledProcesses[0].sessions, 1);
+
+		ensure(containsSubstring(pool->toXml(),
+			"<pid>" + toString(session->getProcess()->getPid()) + "</pid>"));
+		ensure(containsSubstring(pool->inspect(), "Sessions: 1"));
+	}
+
+	TEST_METHOD(88) {
+		// getSnapshot() reuses the latest snapshot if it is young enough.
+		Options options = createOptions();
+		SessionPtr session = pool->get(options, &ticket);
+
+		PoolSnapshotPtr snapshot = pool->getSnapshot();
+		session.reset();
+		ensure("(1)", pool->getSnapshot(60 * 1000000) == snapshot);
+		ensure_equals("(2)", pool->getSnapshot(60 * 1000000)->groups[0]
+			.enabledProcesses[0].sessions, 1);
+
+		PoolSnapshotPtr snapshot2;
+		EVENTUALLY(5,
+			snapshot2 = pool->getSnapshot();
+			result = snapshot2->groups[0].enabledProcesses[0].sessions == 0;
+		);
+		ensure("(3)", snapshot2 != snapshot);
+		ensure_equals("(4)", snapshot->groups[0].enabledProcesses[0].sessions, 1);
+	}
+
+	TEST_METHOD(89) {
+		// The state inspection functions reuse the latest snapshot
+		// only if the caller allows it through maxSnapshotAge.
+		Options options = createOptions();
+		SessionPtr session = pool->get(options, &ticket);
+		ProcessPtr process = session->getProcess()->shared_from_this();
+
+		pool->getSnapshot();
+		session.reset();
+		EVENTUALLY(5,
+			LockGuard l(pool->syncher);
+			result = process->sessions == 0;
+		);
+
+		Pool::InspectOptions inspectOptions = Pool::InspectOptions::makeAuthorized();
+		inspectOptions.maxSnapshotAge = 60 * 1000000;
+		ensure("(1)", containsSubstring(pool->inspect(inspectOptions), "Sessions: 1"));
+
+		Pool::ToXmlOptions xmlOptions = Pool::ToXmlOptions::makeAuthorized();
+		ensure("(2)", containsSubstring(pool->toXml(xmlOptions), "<sessions>0</sessions>"));
+		xmlOptions.maxSnapshotAge = 60 * 1000000;
+		ensure("(3)", containsSubstring(pool->toXml(xmlOptions), "<sessions>0</sessions>"));
+	}
+
+
+	TEST_METHOD(90) {
+		// writePropertiesInAdminPanelFormat() writes the properties of
+		// every group, formatted like GroupSnapshot does.
+		Options options1 = createOptions();
+		options1.appGroupName = "test1";
+		Options options2 = createOptions();
+		options2.appGroupName = "test2";
+		SessionPtr session1 = pool->get(options1, &ticket);
+		SessionPtr session2 = pool->get(options2, &ticket);
+		session1.reset();
+		session2.reset();
+
+		PoolSnapshotPtr snapshot = pool->getSnapshot();
+		Json::Value expected(Json::objectValue);
+		foreach (const GroupSnapshot &group, snapshot->groups) {
+			Json::Value groupDoc(Json::objectValue);
+			group.inspectPropertiesInAdminPanelFormat(groupDoc);
+			expected[group.name] = groupDoc;
+		}
+
+		string output;
+		JsonWriter writer(output);
+		pool->writePropertiesInAdminPanelFormat(writer);
+
+		Json::Value doc;
+		Json::Reader reader;
+		ensure("(1)", reader.parse(output, doc));
+		ensure_equals("(2)", doc.size(), 2u);
+		ensure("(3)", doc.isMember("test1"));
+		ensure("(4)", doc.isMember("test2"));
+		ensure_equals("(5)", Json::FastWriter().write(doc),
+			Json::FastWriter().write(expected));
+	}
+
+	TEST_METHOD(91) {
+		// writePropertiesInAdminPanelFormat() only writes the groups that
+		// the caller is authorized for and that pass the application ID filter.
+		Options options1 = createOptions();
+		options1.appGroupName = "test1";
+		Options options2 = createOptions();
+		options2.appGroupName = "test2";
+		SessionPtr session1 = pool->get(options1, &ticket);
+		SessionPtr session2 = pool->get(options2, &ticket);
+		ApiKey apiKey1 = session1->getApiKey();
+		session1.reset();
+		session2.reset();
+
+		Json::Value doc;
+		Json::Reader reader;
+		Pool::ToJsonOptions jsonOptions;
+		jsonOptions.apiKey = apiKey1;
+		{
+			string output;
+			JsonWriter writer(output);
+			pool->writePropertiesInAdminPanelFormat(writer, jsonOptions);
+			ensure("(1)", reader.parse(output, doc));
+			ensure_equals("(2)", doc.size(), 1u);
+			ensure("(3)", doc.isMember("test1"));
+		}
+
+		Json::Value filter;
+		filter["application_ids"].append("test2");
+		jsonOptions = Pool::ToJsonOptions::makeAuthorized();
+		jsonOptions.set(filter);
+		{
+			string output;
+			JsonWriter writer(output);
+			pool->writePropertiesInAdminPanelFormat(writer, jsonOptions);
+			ensure("(4)", reader.parse(output, doc));
+			ensure_equals("(5)", doc.size(), 1u);
+			ensure("(6)", doc.isMember("test2"));
+		}
+
+		jsonOptions = Pool::ToJsonOptions();
+		jsonOptions.apiKey = ApiKey("0123456789abcdef");
+		try {
+			string output;
+			JsonWriter writer(output);
+			pool->writePropertiesInAdminPanelFormat(writer, jsonOptions);
+			fail("SecurityException expected");
+		} catch (const SecurityException &) {
+			// Pass.
+		}
+	}
+
 	/*****************************/
 }
@@ -158,11 +158,16 @@ namespace tut {
 		}
 
 		void useTestSessionObject() {
-			bg.safe->runSync(boost::bind(&Core_ControllerTest::_setTestSessionObject, this));
+			useTestSessionObject(testSession);
 		}
 
-		void _setTestSessionObject() {
-			controller->sessionToReturn.reset(&testSession, false);
+		void useTestSessionObject(TestSession &session) {
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_setTestSessionObject,
+				this, &session));
+		}
+
+		void _setTestSessionObject(TestSession *session) {
+			controller->sessionToReturn.reset(session, false);
 		}
 
 		MyController::State getServerState() {
@@ -187,6 +192,37 @@ namespace tut {
 			*result = controller->inspectStateAsJson();
 		}
 
+		LatencyStatsSnapshot snapshotLatencyStats() {
+			LatencyStatsSnapshot result;
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_snapshotLatencyStats,
+				this, &result));
+			return result;
+		}
+
+		void _snapshotLatencyStats(LatencyStatsSnapshot *result) {
+			controller->snapshotLatencyStats(*result);
+		}
+
+		RequestTraceSnapshot snapshotRequestTraces() {
+			vector<RequestTraceEvent> events;
+			RequestTraceSnapshot result;
+			bg.safe->runSync(boost::bind(&Controller::copyRequestTraceEvents,
+				controller, boost::ref(events)));
+			result.add(controller->getThreadNumber(), events);
+			return result;
+		}
+
+		Json::Value compactMemory() {
+			Json::Value result;
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_compactMemory,
+				this, &result));
+			return result;
+		}
+
+		void _compactMemory(Json::Value *result) {
+			*result = controller->compactMemory(LoggingKit::DEBUG);
+		}
+
 		unsigned long long getTotalBytesConsumed() {
 			unsigned long long result;
 			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getTotalBytesConsumed,
@@ -1118,4 +1154,379 @@ namespace tut {
 		string header = readResponseHeader();
 		ensure(containsSubstring(header, "HTTP/1.1 502"));
 	}
+
+
+	/***** Latency statistics *****/
+
+	TEST_METHOD(60) {
+		set_test_name("It records the latency of each request phase,"
+			" overall and per app group");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+		readResponseHeader();
+		readResponseBody();
+
+		LatencyStatsSnapshot snapshot;
+		EVENTUALLY(5,
+			snapshot = snapshotLatencyStats();
+			result = snapshot.total.histograms[RP_TOTAL].getCount() == 1;
+		);
+		for (unsigned int i = 0; i < RP_COUNT; i++) {
+			ensure_equals(requestPhaseToString((RequestPhase) i),
+				snapshot.total.histograms[i].getCount(), 1u);
+		}
+		ensure_equals(snapshot.appGroups.size(), 1u);
+		ensure_equals(snapshot.appGroups.begin()->second
+			.histograms[RP_CHECKOUT_WAIT].getCount(), 1u);
+	}
+
+
+	/***** Metrics *****/
+
+	TEST_METHOD(61) {
+		set_test_name("Its metrics can be read from other threads"
+			" and count requests as they begin and finish");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		ensure_equals(controller->metrics.requestsBegun.get(), 1u);
+		ensure_equals(controller->metrics.requestsFinished.get(), 0u);
+		ensure_equals(controller->metrics.activeClients.get(), 1);
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+		readResponseHeader();
+		readResponseBody();
+
+		EVENTUALLY(5,
+			result = controller->metrics.requestsFinished.get() == 1;
+		);
+		ensure_equals(controller->metrics.requestsBegun.get(), 1u);
+		ensure_equals(controller->metrics.sessionCheckoutErrors.get(), 0u);
+	}
+
+
+	/***** Request tracing *****/
+
+	TEST_METHOD(62) {
+		set_test_name("It records the events of each request in the"
+			" request trace flight recorder");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 201 Created\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+		readResponseHeader();
+		readResponseBody();
+
+		RequestTraceSnapshot snapshot;
+		EVENTUALLY(5,
+			snapshot = snapshotRequestTraces();
+			result = snapshot.traces.size() == 1;
+		);
+		const RequestTrace &trace = snapshot.traces[0];
+		for (unsigned int i = 0; i < RTE_COUNT; i++) {
+			ensure(requestTraceEventTypeToString((RequestTraceEventType) i),
+				trace.has((RequestTraceEventType) i));
+		}
+		ensure_equals(trace.data[RTE_END], 201u);
+		ensure(trace.times[RTE_HEADERS_PARSED] <= trace.times[RTE_CHECKOUT_QUEUED]);
+		ensure(trace.times[RTE_FIRST_APP_BYTE] <= trace.times[RTE_END]);
+	}
+
+	TEST_METHOD(63) {
+		set_test_name("Request tracing can be disabled");
+
+		config["request_trace_buffer_size"] = 0;
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+		readResponseHeader();
+		readResponseBody();
+
+		EVENTUALLY(5,
+			result = controller->metrics.requestsFinished.get() == 1;
+		);
+		ensure_equals(snapshotRequestTraces().traces.size(), 0u);
+	}
+
+	TEST_METHOD(64) {
+		set_test_name("It reports memory usage per subsystem and can compact"
+			" its freelists on demand");
+
+		config["client_freelist_limit"] = 10;
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		Json::Value memory = inspectStateAsJson()["memory"];
+		ensure_equals("(1)", memory["client_objects"]["active_count"].asUInt(), 1u);
+		ensure_equals("(2)", memory["request_objects"]["active_count"].asUInt(), 1u);
+		ensure("(3)", memory["request_pools"]["blocks"].asUInt() >= 1);
+		ensure("(4)", memory["mbuf_pool"]["active"]["bytes"].asUInt64() > 0);
+		ensure("(5)", memory.isMember("request_body_buffers"));
+		ensure("(6)", memory.isMember("request_trace_buffer"));
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+		readResponseHeader();
+		readResponseBody();
+
+		EVENTUALLY(5,
+			result = inspectStateAsJson()["memory"]["client_objects"]["free_count"].asUInt() == 1;
+		);
+
+		Json::Value result = compactMemory();
+		ensure_equals("(7)", result["before"]["client_objects"]["free_count"].asUInt(), 1u);
+		ensure_equals("(8)", result["after"]["client_objects"]["free_count"].asUInt(), 0u);
+		ensure_equals("(9)", result["after"]["request_objects"]["free_count"].asUInt(), 0u);
+		ensure_equals("(10)", result["after"]["mbuf_pool"]["spare"]["bytes"].asUInt64(), 0u);
+	}
+
+	/***** Response framing for web server connection reuse *****/
+
+	TEST_METHOD(65) {
+		set_test_name("It keeps the web server connection alive after responses"
+			" with a fixed length");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: CD\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+
+		string header = readResponseHeader();
+		ensure(containsSubstring(header, "Content-Length: 5\r\n"));
+		ensure(!containsSubstring(header, "Connection: close"));
+		char body[5];
+		ensure_equals(clientConnectionIO.read(body, sizeof(body)), 5u);
+		ensure_equals(string(body, sizeof(body)), "hello");
+		SHOULD_NEVER_HAPPEN(100,
+			result = inspectStateAsJson()["active_clients"].size() == 0;
+		);
+	}
+
+	TEST_METHOD(66) {
+		set_test_name("It closes the web server connection after dechunked responses,"
+			" because those are not framed");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: CD\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Transfer-Encoding: chunked\r\n\r\n"
+			"5\r\nhello\r\n0\r\n\r\n");
+
+		string header = readResponseHeader();
+		ensure(containsSubstring(header, "Connection: close\r\n"));
+		ensure(!containsSubstring(header, "Transfer-Encoding"));
+		ensure_equals(readResponseBody(), "hello");
+	}
+
+	/***** Configuration snapshots *****/
+
+	TEST_METHOD(67) {
+		set_test_name("Requests can reference the secure headers of a configuration"
+			" that was registered earlier on the same connection");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: C\r\n"
+			"!~PASSENGER_REGISTER_CONFIG: 3 42\r\n"
+			"!~PASSENGER_ENV_VARS: Rk9PAGJhcgA=\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		ensure("(1)", containsSubstring(peerRequestHeader, P_STATIC_STRING("FOO\0bar\0")));
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+		readResponseHeader();
+		char body[5];
+		ensure_equals(clientConnectionIO.read(body, sizeof(body)), 5u);
+		EVENTUALLY(5,
+			result = controller->metrics.requestsFinished.get() == 1;
+		);
+
+		TestSession testSession2;
+		useTestSessionObject(testSession2);
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: C\r\n"
+			"!~PASSENGER_CONFIG: 3 42\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+		EVENTUALLY(5,
+			result = testSession2.fd() != -1;
+		);
+
+		ensure("(2)", containsSubstring(readScalarMessage(testSession2.peerFd()),
+			P_STATIC_STRING("FOO\0bar\0")));
+		testSession2.closePeerFd();
+		clientConnection.close();
+		// testSession2 must outlive the request.
+		EVENTUALLY(5,
+			result = inspectStateAsJson()["active_clients"].size() == 0;
+		);
+	}
+
+	TEST_METHOD(68) {
+		set_test_name("Requests that reference an unknown configuration are rejected");
+
+		init();
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_CONFIG: 3 42\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+
+		string header = readResponseHeader();
+		ensure(containsSubstring(header, "HTTP/1.1 400 Bad Request\r\n"));
+		ensure(containsSubstring(readResponseBody(), "Unknown !~PASSENGER_CONFIG value"));
+		EVENTUALLY(5,
+			result = controller->metrics.requestsFinished.get() == 1;
+		);
+		ensure_equals("No requests in progress",
+			controller->metrics.requestsBegun.get(), 1u);
+	}
+
+	TEST_METHOD(69) {
+		set_test_name("shutdownAndDrain() lets requests in progress finish"
+			" even if graceful exit is disabled");
+
+		config["graceful_exit"] = false;
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		bg.safe->runSync(boost::bind(&MyController::shutdownAndDrain, controller));
+		ensure_equals(getServerState(), MyController::SHUTTING_DOWN);
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+
+		string header = readResponseHeader();
+		string body = readResponseBody();
+		ensure(containsSubstring(header, "HTTP/1.1 200 OK\r\n"));
+		ensure_equals(body, "hello");
+		EVENTUALLY(5,
+			result = getServerState() == MyController::FINISHED_SHUTDOWN;
+		);
+	}
 }
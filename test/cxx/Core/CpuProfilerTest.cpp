@@ -0,0 +1,99 @@
+#include <TestSupport.h>
+#include <ctime>
+#include <Core/CpuProfiler.h>
+
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace tut {
+	struct Core_CpuProfilerTest: public TestBase {
+		void burnCpu(clock_t duration) {
+			volatile unsigned int x = 0;
+			clock_t deadline = clock() + duration;
+
+			while (clock() < deadline) {
+				for (unsigned int i = 0; i < 10000; i++) {
+					x += i;
+				}
+			}
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_CpuProfilerTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It samples the stacks of threads that use CPU");
+
+		CpuProfiler profiler(1000, 10000);
+		ensure("(1)", profiler.start());
+		burnCpu(CLOCKS_PER_SEC / 5);
+		profiler.stop();
+		ensure("(2)", !profiler.isRunning());
+
+		unsigned int count = profiler.getSampleCount();
+		ensure("(3)", count > 10);
+		ensure_equals("(4)", profiler.getDroppedSampleCount(), 0u);
+		ensure("(5)", profiler.getSample(0).nframes > 0);
+		ensure_equals("(6)", string(profiler.getSample(0).threadName), "Main thread");
+
+		CpuProfiler::FoldedStacks stacks;
+		CpuProfiler::FoldedStacks::const_iterator it;
+		unsigned int total = 0;
+		profiler.collectFoldedStacks(stacks);
+		for (it = stacks.begin(); it != stacks.end(); it++) {
+			ensure("(7)", startsWith(it->first, "Main thread;"));
+			total += it->second;
+		}
+		ensure_equals("(8)", total, count);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Only one profiler can run at a time");
+
+		CpuProfiler profiler(100, 100);
+		CpuProfiler profiler2(100, 100);
+		ensure("(1)", profiler.start());
+		ensure("(2)", !profiler2.start());
+		profiler.stop();
+		ensure("(3)", profiler2.start());
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Samples that do not fit in the buffer are counted as dropped");
+
+		CpuProfiler profiler(1000, 1);
+		ensure(profiler.start());
+		burnCpu(CLOCKS_PER_SEC / 10);
+		profiler.stop();
+		ensure_equals("(1)", profiler.getSampleCount(), 1u);
+		ensure("(2)", profiler.getDroppedSampleCount() > 0);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("The folded stacks are formatted one stack per line,"
+			" followed by the number of samples");
+
+		CpuProfiler profiler(1000, 10000);
+		ensure(profiler.start());
+		burnCpu(CLOCKS_PER_SEC / 10);
+		profiler.stop();
+
+		Json::Value doc = profiler.inspectAsJson();
+		string folded = doc["folded_stacks"].asString();
+		ensure_equals("(1)", doc["frequency"].asUInt(), 1000u);
+		ensure_equals("(2)", doc["samples"].asUInt(), profiler.getSampleCount());
+		ensure("(3)", !folded.empty());
+		ensure_equals("(4)", folded[folded.size() - 1], '\n');
+
+		vector<string> lines;
+		unsigned int total = 0;
+		split(folded.substr(0, folded.size() - 1), '\n', lines);
+		for (unsigned int i = 0; i < lines.size(); i++) {
+			string::size_type pos = lines[i].rfind(' ');
+			ensure("(5)", pos != string::npos);
+			total += stringToUint(lines[i].substr(pos + 1));
+		}
+		ensure_equals("(6)", total, profiler.getSampleCount());
+	}
+}
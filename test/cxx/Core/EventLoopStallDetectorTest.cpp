@@ -0,0 +1,113 @@
+#include <TestSupport.h>
+#include <boost/atomic.hpp>
+#include <BackgroundEventLoop.h>
+#include <SafeLibev.h>
+#include <Core/EventLoopStallDetector.h>
+
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace tut {
+	struct Core_EventLoopStallDetectorTest: public TestBase {
+		BackgroundEventLoop bg1, bg2;
+		EventLoopStallDetector detector;
+		boost::atomic<bool> blocking;
+
+		Core_EventLoopStallDetectorTest()
+			: bg1(false, true),
+			  bg2(false, true),
+			  detector(50, 60),
+			  blocking(false)
+		{
+			if (defaultLogLevel == (LoggingKit::Level) DEFAULT_LOG_LEVEL) {
+				// If the user did not customize the test's log level,
+				// then we'll want to tone down the noise.
+				LoggingKit::setLevel(LoggingKit::CRIT);
+			}
+			bg1.start("Event loop 1");
+			bg2.start("Event loop 2");
+			detector.add(&bg1, "Event loop 1");
+			detector.add(&bg2, "Event loop 2");
+		}
+
+		~Core_EventLoopStallDetectorTest() {
+			unblock();
+			detector.stop();
+			bg1.stop();
+			bg2.stop();
+		}
+
+		void block(BackgroundEventLoop &bg) {
+			blocking.store(true);
+			bg.safe->runLater(boost::bind(
+				&Core_EventLoopStallDetectorTest::blockLoop, this));
+		}
+
+		void blockLoop() {
+			while (blocking.load()) {
+				usleep(1000);
+			}
+		}
+
+		void unblock() {
+			blocking.store(false);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_EventLoopStallDetectorTest);
+
+	TEST_METHOD(1) {
+		set_test_name("Idle event loops are not considered stalled");
+
+		usleep(150000);
+		detector.check();
+		ensure_equals(detector.getStallCount(0), 0u);
+		ensure_equals(detector.getStallCount(1), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("A blocked event loop is counted as stalled once per stall");
+
+		block(bg2);
+		EVENTUALLY(5,
+			detector.check();
+			result = detector.getStallCount(1) == 1;
+		);
+		usleep(60000);
+		detector.check();
+		ensure_equals("The same stall is not counted twice",
+			detector.getStallCount(1), 1u);
+		ensure("The longest stall is tracked while the stall lasts",
+			detector.getLongestStall(1) >= 100000);
+		ensure_equals("Other event loops are not affected",
+			detector.getStallCount(0), 0u);
+
+		unblock();
+		bg2.safe->runSync(boost::bind(&BackgroundEventLoop::isStarted, &bg2));
+		detector.check();
+		ensure_equals(detector.getStallCount(1), 1u);
+
+		block(bg2);
+		EVENTUALLY(5,
+			detector.check();
+			result = detector.getStallCount(1) == 2;
+		);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("The background thread detects stalls");
+
+		detector.start();
+		block(bg1);
+		EVENTUALLY(5,
+			result = detector.getStallCount(0) == 1;
+		);
+		unblock();
+
+		Json::Value doc = detector.inspectAsJson();
+		ensure_equals(doc["threshold_msec"].asUInt(), 50u);
+		ensure_equals(doc["event_loops"]["Event loop 1"]["stalls"].asUInt(), 1u);
+		ensure_equals(doc["event_loops"]["Event loop 2"]["stalls"].asUInt(), 0u);
+	}
+}
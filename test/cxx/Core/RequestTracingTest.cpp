@@ -0,0 +1,129 @@
+#include <TestSupport.h>
+#include <Core/Controller/RequestTracing.h>
+
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace tut {
+	struct Core_RequestTracingTest: public TestBase {
+		RequestTraceRecorder recorder;
+		vector<RequestTraceEvent> events;
+
+		Core_RequestTracingTest()
+			: recorder(8)
+			{ }
+
+		void recordRequest(MonotonicTimeUsec start, MonotonicTimeUsec duration,
+			unsigned int status = 200)
+		{
+			boost::uint32_t number = recorder.newRequestNumber();
+			recorder.record(number, RTE_ACCEPTED, start);
+			recorder.record(number, RTE_END, start + duration, status);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_RequestTracingTest);
+
+	TEST_METHOD(1) {
+		set_test_name("The capacity is rounded up to a power of two");
+
+		RequestTraceRecorder recorder2(5);
+		ensure_equals(recorder2.getCapacity(), 8u);
+		recorder2.setCapacity(0);
+		ensure(!recorder2.isEnabled());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It only keeps the most recent events, oldest first");
+
+		for (unsigned int i = 1; i <= 10; i++) {
+			recorder.record(i, RTE_ACCEPTED, i * 10);
+		}
+		recorder.copyEvents(events);
+		ensure_equals(events.size(), 8u);
+		ensure_equals(events[0].requestNumber, 3u);
+		ensure_equals(events[7].requestNumber, 10u);
+		ensure_equals(events[7].time, 100u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It does nothing when disabled");
+
+		recorder.setCapacity(0);
+		recorder.record(1, RTE_ACCEPTED, 10);
+		recorder.copyEvents(events);
+		ensure_equals(events.size(), 0u);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Snapshots only contain complete requests"
+			" that took at least the minimum duration");
+
+		RequestTraceSnapshot snapshot(100);
+		recordRequest(1000, 50);
+		recordRequest(2000, 150, 404);
+		// In progress
+		recorder.record(recorder.newRequestNumber(), RTE_ACCEPTED, 3000);
+		recorder.copyEvents(events);
+
+		snapshot.add(2, events);
+		ensure_equals(snapshot.traces.size(), 1u);
+		ensure_equals(snapshot.traces[0].getId(), "2-2");
+		ensure_equals(snapshot.traces[0].getDuration(), 150u);
+		ensure_equals(snapshot.traces[0].data[RTE_END], 404u);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Requests whose first events were overwritten are"
+			" left out of snapshots");
+
+		RequestTraceSnapshot snapshot;
+		boost::uint32_t number = recorder.newRequestNumber();
+		recorder.record(number, RTE_ACCEPTED, 1000);
+		for (unsigned int i = 0; i < 4; i++) {
+			recordRequest(2000 + i * 100, 10);
+		}
+		recorder.record(number, RTE_END, 3000);
+		recorder.copyEvents(events);
+
+		snapshot.add(1, events);
+		ensure_equals(snapshot.traces.size(), 3u);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("keepMostRecent() keeps the requests that ended last");
+
+		RequestTraceSnapshot snapshot;
+		recordRequest(1000, 500);
+		recordRequest(1100, 100);
+		recordRequest(1200, 100);
+		recorder.copyEvents(events);
+
+		snapshot.add(1, events);
+		snapshot.keepMostRecent(2);
+		ensure_equals(snapshot.traces.size(), 2u);
+		ensure_equals(snapshot.traces[0].requestNumber, 3u);
+		ensure_equals(snapshot.traces[1].requestNumber, 1u);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("It can format traces in the Chrome trace event format");
+
+		RequestTraceSnapshot snapshot;
+		boost::uint32_t number = recorder.newRequestNumber();
+		recorder.record(number, RTE_ACCEPTED, 1000);
+		recorder.record(number, RTE_HEADERS_PARSED, 1010);
+		recorder.record(number, RTE_END, 1100, 200);
+		recorder.copyEvents(events);
+		snapshot.add(1, events);
+
+		Json::Value doc = snapshot.inspectAsChromeTrace();
+		// process_name metadata, the request and its header_parse span
+		ensure_equals(doc["traceEvents"].size(), 3u);
+		ensure_equals(doc["traceEvents"][1]["name"].asString(), "request 1-1");
+		ensure_equals(doc["traceEvents"][1]["dur"].asUInt(), 100u);
+		ensure_equals(doc["traceEvents"][2]["name"].asString(), "header_parse");
+		ensure_equals(doc["traceEvents"][2]["dur"].asUInt(), 10u);
+	}
+}
@@ -189,6 +189,54 @@ namespace tut {
 		);
 	}
 
+	TEST_METHOD(4) {
+		set_test_name("With the compact spawn protocol, it finishes when the app"
+			" has sent the finish signal, and loads step states reported through"
+			" the finish FIFO");
+
+		config.startsUsingWrapper = true;
+		init(SPAWN_DIRECTLY);
+		TempThread thr(boost::bind(&Core_SpawningKit_HandshakePerformTest::execute, this));
+
+		writeFile(session->responseDir + "/finish",
+			"subprocess_exec_wrapper STEP_PERFORMED end_time 1541433651.25\n");
+		SHOULD_NEVER_HAPPEN(100,
+			result = counter > 0;
+		);
+
+		createFile(session->responseDir + "/properties.json",
+			createGoodPropertiesJson().toStyledString());
+		writeFile(session->responseDir + "/finish",
+			"subprocess_listen STEP_PERFORMED end_time 1541433651.5\n1");
+
+		EVENTUALLY(1,
+			result = counter == 1;
+		);
+		ensure_equals(session->journey.getStepInfo(SUBPROCESS_EXEC_WRAPPER).state,
+			STEP_PERFORMED);
+		ensure_equals(session->journey.getStepInfo(SUBPROCESS_LISTEN).state,
+			STEP_PERFORMED);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("With the compact spawn protocol, it raises an error containing"
+			" the reported step states if the app has sent an error finish signal");
+
+		config.startsUsingWrapper = true;
+		init(SPAWN_DIRECTLY);
+
+		writeFile(session->responseDir + "/finish",
+			"subprocess_app_load_or_exec STEP_ERRORED end_time 1541433651.25\n0");
+
+		try {
+			execute();
+			fail("SpawnException expected");
+		} catch (const SpawnException &) {
+			ensure_equals(session->journey.getFirstFailedStep(),
+				SUBPROCESS_APP_LOAD_OR_EXEC);
+		}
+	}
+
 	TEST_METHOD(10) {
 		set_test_name("It raises an error if the process exits prematurely");
 
@@ -208,4 +208,46 @@ namespace tut {
 			ensure_equals(session->journey.getFirstFailedStep(), SPAWNING_KIT_PREPARATION);
 		}
 	}
+
+	TEST_METHOD(18) {
+		set_test_name("When using one of Passenger's own wrappers, it only dumps"
+			" arguments into args.json");
+
+		config.startsUsingWrapper = true;
+		initAndExec(SPAWN_DIRECTLY);
+
+		ensure(session->compactSpawnProtocol);
+		ensure(fileExists(session->workDir->getPath() + "/args.json"));
+		ensure_equals(getFileType(session->workDir->getPath() + "/args"), FT_NONEXISTANT);
+	}
+
+	TEST_METHOD(19) {
+		set_test_name("When using one of Passenger's own wrappers, it does not"
+			" create step directories, and keeps the finish FIFO open instead");
+
+		config.startsUsingWrapper = true;
+		initAndExec(SPAWN_THROUGH_PRELOADER);
+
+		ensure_equals(getFileType(session->responseDir + "/finish"), FT_OTHER);
+		ensure_equals(getFileType(session->responseDir + "/steps"), FT_NONEXISTANT);
+		ensure(session->stepDirFds.empty());
+		ensure(session->finishFifoFd != -1);
+	}
+
+	TEST_METHOD(20) {
+		set_test_name("When using a third-party wrapper, it creates the full"
+			" args and step directory layout");
+
+		config.startsUsingWrapper = true;
+		config.wrapperSuppliedByThirdParty = true;
+		initAndExec(SPAWN_THROUGH_PRELOADER);
+
+		ensure(!session->compactSpawnProtocol);
+		ensure(fileExists(session->workDir->getPath() + "/args/app_root"));
+		ensure_equals(getFileType(session->responseDir + "/steps/subprocess_listen"),
+			FT_DIRECTORY);
+		ensure_equals(getFileType(session->responseDir + "/steps/preloader_finish"),
+			FT_DIRECTORY);
+		ensure(session->finishFifoFd == -1);
+	}
 }
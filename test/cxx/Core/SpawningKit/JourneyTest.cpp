@@ -1,5 +1,6 @@
 #include <TestSupport.h>
 #include <Core/SpawningKit/Journey.h>
+#include <Core/SpawningKit/JourneyStats.h>
 
 using namespace Passenger;
 using namespace Passenger::SpawningKit;
@@ -39,4 +40,48 @@ namespace tut {
 		ensure("(3)", journey.hasStep(SPAWNING_KIT_CONNECT_TO_PRELOADER));
 		ensure("(4)", journey.hasStep(SUBPROCESS_PREPARE_AFTER_FORKING_FROM_PRELOADER));
 	}
+
+	TEST_METHOD(4) {
+		set_test_name("getPerformedStepDurations() returns the durations of"
+			" performed steps only");
+		Journey journey(SPAWN_DIRECTLY, false);
+		journey.setStepPerformed(SPAWNING_KIT_PREPARATION);
+		journey.setStepBeginTime(SPAWNING_KIT_PREPARATION, 1000);
+		journey.setStepEndTime(SPAWNING_KIT_PREPARATION, 3000);
+		journey.setStepErrored(SPAWNING_KIT_HANDSHAKE_PERFORM, true);
+
+		JourneyStepDurations durations = journey.getPerformedStepDurations();
+		ensure_equals("(1)", durations.size(), 1u);
+		ensure_equals("(2)", durations[SPAWNING_KIT_PREPARATION], 2000u);
+
+		// A step ends when the next step begins.
+		journey.setStepBeginTime(SPAWNING_KIT_FORK_SUBPROCESS, 2500);
+		durations = journey.getPerformedStepDurations();
+		ensure_equals("(3)", durations[SPAWNING_KIT_PREPARATION], 1500u);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("JourneyStats aggregates step durations in journey order");
+		JourneyStats stats, stats2;
+		JourneyStepDurations durations;
+
+		durations[SPAWNING_KIT_HANDSHAKE_PERFORM] = 300;
+		durations[SPAWNING_KIT_PREPARATION] = 100;
+		stats.record(durations, 500);
+		durations.erase(SPAWNING_KIT_HANDSHAKE_PERFORM);
+		stats2.record(durations, 200);
+		stats.merge(stats2);
+
+		ensure_equals("(1)", stats.getCount(), 2u);
+		ensure_equals("(2)", stats.getTotal().getMax(), 500u);
+
+		Json::Value doc = stats.inspectAsJson();
+		ensure_equals("(3)", doc["steps"].size(), 2u);
+		ensure_equals("(4)", doc["steps"][0]["step"].asString(),
+			"spawning_kit_preparation");
+		ensure_equals("(5)", doc["steps"][0]["count"].asUInt(), 2u);
+		ensure_equals("(6)", doc["steps"][1]["step"].asString(),
+			"spawning_kit_handshake_perform");
+		ensure_equals("(7)", doc["steps"][1]["count"].asUInt(), 1u);
+	}
 }
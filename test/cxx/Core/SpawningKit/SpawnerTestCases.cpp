@@ -11,6 +11,8 @@
 		SpawnerPtr spawner = createSpawner(options);
 		result = spawner->spawn(options);
 		ensure_equals(result.sockets.size(), 1u);
+		ensure("Journey step durations are supplied",
+			result.journeyStepDurations.count(SPAWNING_KIT_HANDSHAKE_PERFORM) > 0);
 
 		FileDescriptor fd(connectToServer(result.sockets[0].address,
 			__FILE__, __LINE__), NULL, 0);
@@ -0,0 +1,156 @@
+#include <TestSupport.h>
+#include <JsonTools/JsonWriter.h>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct JsonTools_JsonWriterTest: public TestBase {
+		string output;
+		JsonWriter writer;
+
+		JsonTools_JsonWriterTest()
+			: writer(output)
+			{ }
+
+		Json::Value parse() {
+			Json::Value doc;
+			Json::Reader reader;
+			ensure("The output is valid JSON: " + output, reader.parse(output, doc));
+			return doc;
+		}
+	};
+
+	DEFINE_TEST_GROUP(JsonTools_JsonWriterTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It separates object members and array elements with commas");
+
+		writer.beginObject();
+		writer.key("a");
+		writer.value(1);
+		writer.key("b");
+		writer.beginArray();
+		writer.value(true);
+		writer.nullValue();
+		writer.beginObject();
+		writer.endObject();
+		writer.endArray();
+		writer.key("c");
+		writer.value("x");
+		writer.endObject();
+		ensure_equals(output, "{\"a\":1,\"b\":[true,null,{}],\"c\":\"x\"}");
+		ensure_equals(writer.getDepth(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It escapes strings");
+
+		const char str[] = "quote\" backslash\\ newline\n tab\t ctrl\x01 nul\0 end";
+		writer.value(StaticString(str, sizeof(str) - 1));
+		ensure_equals(output,
+			"\"quote\\\" backslash\\\\ newline\\n tab\\t ctrl\\u0001 nul\\u0000 end\"");
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It writes integers, including the extreme values");
+
+		writer.beginArray();
+		writer.value(0);
+		writer.value(-1);
+		writer.value((long long) -9223372036854775807LL - 1);
+		writer.value((unsigned long long) 18446744073709551615ULL);
+		writer.value(4294967295u);
+		writer.endArray();
+		ensure_equals(output,
+			"[0,-1,-9223372036854775808,18446744073709551615,4294967295]");
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("It writes Json::Value trees, which parse back to the same tree");
+
+		Json::Value doc;
+		doc["string"] = "hello \"world\"";
+		doc["int"] = -42;
+		doc["uint"] = (Json::UInt64) 12345678901234ULL;
+		doc["real"] = 1.5;
+		doc["bool"] = false;
+		doc["null"] = Json::Value();
+		doc["array"].append(1);
+		doc["array"].append("two");
+		doc["object"]["nested"]["key"] = "value";
+		doc["empty_array"] = Json::Value(Json::arrayValue);
+
+		writer.value(doc);
+		ensure_equals(parse(), doc);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("members() merges a Json::Value object into the current object,"
+			" and rawValue() embeds preformatted JSON");
+
+		Json::Value doc;
+		doc["a"] = 1;
+		doc["b"] = 2;
+
+		writer.beginObject();
+		writer.key("first");
+		writer.value(0);
+		writer.members(doc);
+		writer.key("raw");
+		writer.rawValue("[1,2]");
+		writer.endObject();
+		ensure_equals(output, "{\"first\":0,\"a\":1,\"b\":2,\"raw\":[1,2]}");
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("In pretty mode, it puts every member and element on its own"
+			" indented line");
+
+		JsonWriter prettyWriter(output, true);
+		prettyWriter.beginObject();
+		prettyWriter.key("a");
+		prettyWriter.value(1);
+		prettyWriter.key("b");
+		prettyWriter.beginArray();
+		prettyWriter.value(true);
+		prettyWriter.beginObject();
+		prettyWriter.endObject();
+		prettyWriter.endArray();
+		prettyWriter.endObject();
+		ensure_equals(output,
+			"{\n"
+			"   \"a\" : 1,\n"
+			"   \"b\" : [\n"
+			"      true,\n"
+			"      {}\n"
+			"   ]\n"
+			"}");
+		ensure_equals(prettyWriter.getDepth(), 0u);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("In pretty mode, rawValue() indents multi-line values to the"
+			" current nesting level");
+
+		string inner;
+		JsonWriter innerWriter(inner, true);
+		innerWriter.beginObject();
+		innerWriter.key("x");
+		innerWriter.value("line\nbreak");
+		innerWriter.endObject();
+
+		JsonWriter prettyWriter(output, true);
+		prettyWriter.beginObject();
+		prettyWriter.key("inner");
+		prettyWriter.rawValue(inner);
+		prettyWriter.endObject();
+		ensure_equals(output,
+			"{\n"
+			"   \"inner\" : {\n"
+			"      \"x\" : \"line\\nbreak\"\n"
+			"   }\n"
+			"}");
+		ensure_equals(parse()["inner"]["x"].asString(), "line\nbreak");
+	}
+}
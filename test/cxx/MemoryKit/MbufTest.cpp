@@ -254,14 +254,109 @@ namespace tut {
 	TEST_METHOD(23) {
 		set_test_name("mbuf_get_with_size (large)");
 		{
-			mbuf buffer(mbuf_get_with_size(&pool, mbuf_pool_data_size(&pool) + 10));
+			mbuf buffer(mbuf_get_with_size(&pool, mbuf_pool_max_data_size(&pool) + 10));
 			ensure_equals("(1)", pool.nfree_mbuf_blockq, 0u);
 			ensure_equals("(2)", pool.nactive_mbuf_blockq, 1u);
-			ensure_equals("(3)", buffer.size(), mbuf_pool_data_size(&pool) + 10);
+			ensure_equals("(3)", buffer.size(), mbuf_pool_max_data_size(&pool) + 10);
 			memcpy(buffer.start, "hello", 6);
 			ensure_equals("(4)", string(buffer.start), "hello");
 		}
 		ensure_equals("(5)", pool.nfree_mbuf_blockq, 0u);
 		ensure_equals("(6)", pool.nactive_mbuf_blockq, 0u);
 	}
+
+	TEST_METHOD(24) {
+		set_test_name("Memory accounting of regular and standalone blocks");
+		{
+			mbuf buffer(mbuf_get(&pool));
+			mbuf buffer2(mbuf_get_with_size(&pool, mbuf_pool_max_data_size(&pool) + 10));
+			ensure_equals("(1)", pool.nactive_mbuf_blockq, 2u);
+			ensure_equals("(2)", pool.nactive_standalone_mbuf_blockq, 1u);
+			ensure_equals("(3)", mbuf_pool_active_bytes(&pool),
+				pool.mbuf_block_chunk_size + MBUF_BLOCK_HSIZE
+				+ mbuf_pool_max_data_size(&pool) + 10);
+			ensure_equals("(4)", mbuf_pool_spare_bytes(&pool), 0u);
+		}
+		ensure_equals("(5)", pool.nactive_standalone_mbuf_blockq, 0u);
+		ensure_equals("(6)", mbuf_pool_active_bytes(&pool), 0u);
+		ensure_equals("(7)", mbuf_pool_spare_bytes(&pool),
+			(size_t) pool.mbuf_block_chunk_size);
+
+		ensure_equals("(8)", mbuf_pool_compact(&pool), 1u);
+		ensure_equals("(9)", mbuf_pool_spare_bytes(&pool), 0u);
+	}
+
+	TEST_METHOD(25) {
+		set_test_name("mbuf_get_with_size picks the smallest size class that fits");
+		size_t largeSize = mbuf_pool_class_data_size(&pool, 1) + 1;
+		mbuf buffer(mbuf_get_with_size(&pool, 6));
+		mbuf buffer2(mbuf_get_with_size(&pool, mbuf_pool_data_size(&pool) + 1));
+		mbuf buffer3(mbuf_get_with_size(&pool, largeSize));
+
+		ensure_equals("(1)", pool.classes[0].nactive_mbuf_blockq, 1u);
+		ensure_equals("(2)", pool.classes[1].nactive_mbuf_blockq, 1u);
+		ensure_equals("(3)", pool.classes[2].nactive_mbuf_blockq, 1u);
+		ensure_equals("(4)", pool.nactive_standalone_mbuf_blockq, 0u);
+		ensure_equals("(5)", buffer3.size(), largeSize);
+		ensure_equals("(6)", (size_t) (buffer3.mbuf_block->end - buffer3.mbuf_block->start),
+			mbuf_pool_max_data_size(&pool));
+		ensure_equals("(7)", mbuf_pool_active_bytes(&pool),
+			pool.mbuf_block_chunk_size * (1 + MBUF_CLASS_FACTOR
+				+ MBUF_CLASS_FACTOR * MBUF_CLASS_FACTOR));
+
+		buffer2 = mbuf();
+		ensure_equals("(8)", pool.classes[1].nfree_mbuf_blockq, 1u);
+		buffer2 = mbuf_get_with_class(&pool, 1);
+		ensure_equals("(9)", pool.classes[1].nfree_mbuf_blockq, 0u);
+		ensure_equals("(10)", pool.classes[1].nactive_mbuf_blockq, 1u);
+	}
+
+	TEST_METHOD(26) {
+		set_test_name("Blocks are carved out of slabs, which are only released"
+			" when all their blocks are free");
+		mbuf buffer(mbuf_get(&pool));
+		mbuf buffer2(mbuf_get(&pool));
+		ensure_equals("(1)", pool.classes[0].nslabs, 1u);
+		ensure_equals("(2)", mbuf_pool_slab_bytes(&pool), (size_t) MBUF_SLAB_SIZE);
+		ensure_equals("(3)", buffer2.start, buffer.start + pool.mbuf_block_chunk_size);
+
+		buffer = mbuf();
+		ensure_equals("(4)", mbuf_pool_compact(&pool), 0u);
+		ensure_equals("(5)", pool.nfree_mbuf_blockq, 1u);
+		ensure_equals("(6)", pool.classes[0].nslabs, 1u);
+
+		buffer2 = mbuf();
+		ensure_equals("(7)", mbuf_pool_compact(&pool), 2u);
+		ensure_equals("(8)", pool.nfree_mbuf_blockq, 0u);
+		ensure_equals("(9)", pool.classes[0].nslabs, 0u);
+		ensure_equals("(10)", mbuf_pool_slab_bytes(&pool), 0u);
+
+		buffer = mbuf_get(&pool);
+		ensure_equals("(11)", pool.classes[0].nslabs, 1u);
+	}
+
+	TEST_METHOD(27) {
+		set_test_name("A new slab is allocated when the current one is exhausted");
+		unsigned int capacity = MBUF_SLAB_SIZE / pool.mbuf_block_chunk_size;
+		vector<mbuf> buffers;
+
+		for (unsigned int i = 0; i <= capacity; i++) {
+			buffers.push_back(mbuf_get(&pool));
+		}
+		ensure_equals("(1)", pool.classes[0].nslabs, 2u);
+		ensure_equals("(2)", mbuf_pool_slab_bytes(&pool), (size_t) MBUF_SLAB_SIZE * 2);
+
+		buffers.pop_back();
+		ensure_equals("(3)", mbuf_pool_compact(&pool), 1u);
+		ensure_equals("(4)", pool.classes[0].nslabs, 1u);
+	}
+
+	TEST_METHOD(28) {
+		set_test_name("Slabs backed by huge pages fall back to normal pages");
+		pool.mbuf_huge_pages = true;
+		mbuf buffer(mbuf_get(&pool));
+		ensure("(1)", !buffer.is_null());
+		ensure_equals("(2)", mbuf_pool_slab_bytes(&pool), (size_t) MBUF_HUGE_SLAB_SIZE);
+		memset(buffer.start, 'x', buffer.size());
+	}
 }
@@ -439,4 +439,32 @@ namespace tut {
 		ensure("psg_reset_pool fails",
 			!psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE));
 	}
+
+	TEST_METHOD(21) {
+		set_test_name("psg_pool_add_stats() reports blocks and live large allocations");
+		pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		psg_pool_stats_t stats;
+
+		memset(&stats, 0, sizeof(stats));
+		psg_pool_add_stats(pool, &stats);
+		ensure_equals("(1)", stats.blocks, 1u);
+		ensure_equals("(2)", stats.block_bytes, (size_t) PSG_DEFAULT_POOL_SIZE);
+		ensure_equals("(3)", stats.large_allocations, 0u);
+
+		size_t usedBefore = stats.used_bytes;
+		psg_pnalloc(pool, 8);
+		void *large1 = psg_palloc(pool, PSG_DEFAULT_POOL_SIZE * 2);
+		psg_palloc(pool, PSG_DEFAULT_POOL_SIZE * 3);
+		psg_pfree(pool, large1);
+
+		memset(&stats, 0, sizeof(stats));
+		psg_pool_add_stats(pool, &stats);
+		ensure("(4)", stats.used_bytes >= usedBefore + 8);
+		ensure_equals("(5)", stats.large_allocations, 1u);
+		ensure_equals("(6)", stats.large_bytes, (size_t) PSG_DEFAULT_POOL_SIZE * 3);
+
+		// Stats are accumulated over multiple pools.
+		psg_pool_add_stats(pool, &stats);
+		ensure_equals("(7)", stats.large_allocations, 2u);
+	}
 }
@@ -0,0 +1,66 @@
+#include <TestSupport.h>
+#include <Utils/OpenMetrics.h>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct OpenMetricsTest: public TestBase {
+		OpenMetricsWriter writer;
+	};
+
+	DEFINE_TEST_GROUP(OpenMetricsTest);
+
+	/***** MetricCounter and MetricGauge *****/
+
+	TEST_METHOD(1) {
+		set_test_name("Counters start at zero and accumulate");
+
+		MetricCounter counter;
+		ensure_equals(counter.get(), 0u);
+		counter.add();
+		counter.add(41);
+		ensure_equals(counter.get(), 42u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Gauges hold the last value set, which may be negative");
+
+		MetricGauge gauge;
+		ensure_equals(gauge.get(), 0);
+		gauge.set(10);
+		gauge.set(-3);
+		ensure_equals(gauge.get(), -3);
+	}
+
+
+	/***** OpenMetricsWriter *****/
+
+	TEST_METHOD(10) {
+		set_test_name("It writes metric families in the text exposition format");
+
+		writer.declare("foo", "counter", "Number of foos.");
+		writer.sample("foo_total", (boost::uint64_t) 123);
+		writer.declare("bar", "gauge", "Current bar.");
+		writer.sample("bar", (boost::int64_t) -5, "thread", "1");
+		writer.sample("bar", 0.5, "thread", "2");
+		writer.finish();
+		ensure_equals(writer.getOutput(),
+			"# TYPE foo counter\n"
+			"# HELP foo Number of foos.\n"
+			"foo_total 123\n"
+			"# TYPE bar gauge\n"
+			"# HELP bar Current bar.\n"
+			"bar{thread=\"1\"} -5\n"
+			"bar{thread=\"2\"} 0.5\n"
+			"# EOF\n");
+	}
+
+	TEST_METHOD(11) {
+		set_test_name("It escapes label values");
+
+		writer.sample("foo", (boost::uint64_t) 1, "name", "a\"b\\c\nd");
+		ensure_equals(writer.getOutput(),
+			"foo{name=\"a\\\"b\\\\c\\nd\"} 1\n");
+	}
+}
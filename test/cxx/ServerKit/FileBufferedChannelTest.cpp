@@ -170,6 +170,17 @@ namespace tut {
 			*result = channel.getWriterState();
 		}
 
+		FileBufferedChannelBackend getChannelBufferFileBackend() {
+			FileBufferedChannelBackend result;
+			bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_getChannelBufferFileBackend,
+				this, &result));
+			return result;
+		}
+
+		void _getChannelBufferFileBackend(FileBufferedChannelBackend *result) {
+			*result = channel.getBufferFileBackend();
+		}
+
 		unsigned int getChannelBytesBuffered() {
 			unsigned int result;
 			bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_getChannelBytesBuffered,
@@ -220,6 +231,48 @@ namespace tut {
 		void _setChannelDataCallback(FileBufferedChannel::DataCallback callback) {
 			channel.setDataCallback(callback);
 		}
+
+		void _inspectIoUring(Json::Value *doc) {
+			*doc = context.ioUring.inspectStateAsJson();
+		}
+
+		/**
+		 * Buffers data to a file with the backend that is configured as
+		 * `backendName`, checks that the file was created with
+		 * `expectedBackend` and that the data is read back from it.
+		 */
+		void testBufferFileBackend(const char *backendName,
+			FileBufferedChannelBackend expectedBackend)
+		{
+			Json::Value config;
+			vector<ConfigKit::Error> errors;
+			config["file_buffered_channel_threshold"] = 1;
+			config["file_buffered_channel_backend"] = backendName;
+			ensure(context.configure(config, errors));
+
+			toConsume = -1;
+			startLoop();
+
+			feedChannel("hello");
+			feedChannel("world!");
+			EVENTUALLY(5,
+				result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+			);
+			EVENTUALLY(5,
+				result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+			);
+			ensure_equals(getChannelBytesBuffered(), 0u);
+			ensure_equals("The buffer file was created with the expected backend",
+				getChannelBufferFileBackend(), expectedBackend);
+
+			channelConsumed(sizeof("hello") - 1, false);
+			EVENTUALLY(5,
+				boost::lock_guard<boost::mutex> l(syncher);
+				result = log ==
+					"Data: hello\n"
+					"Data: world!\n";
+			);
+		}
 	};
 
 	DEFINE_TEST_GROUP_WITH_LIMIT(ServerKit_FileBufferedChannelTest, 100);
@@ -1003,6 +1056,71 @@ namespace tut {
 	}
 
 
+	/***** Buffer file backends *****/
+
+	TEST_METHOD(42) {
+		set_test_name("The tmpfile backend buffers to an anonymous file");
+		#ifdef O_TMPFILE
+			testBufferFileBackend("tmpfile", FBCB_TMPFILE);
+		#else
+			testBufferFileBackend("tmpfile", FBCB_FILE);
+		#endif
+	}
+
+	TEST_METHOD(43) {
+		set_test_name("The memfd backend buffers to an anonymous file");
+		#if defined(__linux__) && defined(SYS_memfd_create)
+			testBufferFileBackend("memfd", FBCB_MEMFD);
+		#else
+			testBufferFileBackend("memfd", FBCB_FILE);
+		#endif
+	}
+
+	TEST_METHOD(44) {
+		set_test_name("Buffers that would make the file exceed the maximum file size "
+			"are kept in memory until the file is truncated");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		config["file_buffered_channel_max_file_size"] = 5;
+		ensure(context.configure(config, errors));
+
+		toConsume = -1;
+		startLoop();
+
+		feedChannel("hello");
+		feedChannel("world!");
+		feedChannel("bye");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getChannelBytesBuffered() != sizeof("world!bye") - 1;
+		);
+
+		{
+			LOCK();
+			toConsume = CONSUME_FULLY;
+		}
+		channelConsumed(sizeof("hello") - 1, false);
+		EVENTUALLY(5,
+			LOCK();
+			result = log ==
+				"Data: hello\n"
+				"Data: world!\n"
+				"Data: bye\n";
+		);
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_MEMORY_MODE;
+		);
+		ensure_equals(getChannelBytesBuffered(), 0u);
+	}
+
+
 	/***** When stopped *****/
 
 	TEST_METHOD(45) {
@@ -1079,4 +1197,50 @@ namespace tut {
 			ensure_equals(counter, 2u);
 		}
 	}
+
+
+	/***** When using io_uring *****/
+
+	TEST_METHOD(47) {
+		set_test_name("It moves buffers to disk and reads them back through io_uring,"
+			" or through libuv if io_uring is not available");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		ensure(context.configure(config, errors));
+		bool ioUringAvailable = context.ioUring.initialize(bg.safe->getLoop());
+
+		toConsume = -1;
+		startLoop();
+
+		feedChannel("hello");
+		feedChannel("world!");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+		ensure_equals(getChannelBytesBuffered(), 0u);
+
+		channelConsumed(sizeof("hello") - 1, false);
+		EVENTUALLY(5,
+			LOCK();
+			result = log ==
+				"Data: hello\n"
+				"Data: world!\n";
+		);
+
+		Json::Value doc;
+		bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_inspectIoUring,
+			this, &doc));
+		ensure_equals(doc["initialized"].asBool(), ioUringAvailable);
+		if (ioUringAvailable) {
+			// hello was written, world! was written and read back.
+			ensure_equals(doc["submitted"].asUInt(), 3u);
+			ensure_equals(doc["completed"].asUInt(), 3u);
+			ensure_equals(doc["inflight"].asUInt(), 0u);
+		}
+	}
 }
@@ -0,0 +1,80 @@
+#include <TestSupport.h>
+#include <ServerKit/RequestPoolSizer.h>
+
+using namespace Passenger;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace tut {
+	struct ServerKit_RequestPoolSizerTest: public TestBase {
+		RequestPoolSizer sizer;
+
+		void simulateRequests(unsigned int count, size_t allocationSize,
+			unsigned int allocations = 1)
+		{
+			for (unsigned int i = 0; i < count; i++) {
+				psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+				for (unsigned int j = 0; j < allocations; j++) {
+					psg_palloc(pool, allocationSize);
+				}
+				sizer.recordUsage(pool);
+				psg_destroy_pool(pool);
+			}
+		}
+	};
+
+	DEFINE_TEST_GROUP(ServerKit_RequestPoolSizerTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It recommends the default pool size until it has"
+			" seen a full window of requests");
+		simulateRequests(RequestPoolSizer::SAMPLE_WINDOW - 1, 100);
+		ensure_equals(sizer.getPoolSize(), (size_t) PSG_DEFAULT_POOL_SIZE);
+		ensure_equals(sizer.getResizeCount(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It shrinks the pool size for small requests");
+		simulateRequests(RequestPoolSizer::SAMPLE_WINDOW, 100);
+		ensure_equals(sizer.getPoolSize(), (size_t) RequestPoolSizer::MIN_POOL_SIZE);
+		ensure_equals(sizer.getResizeCount(), 1u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It sizes the pool to a percentile of the usage");
+		// 20 allocations of 1000 bytes need a 32 KB pool, but fewer than
+		// 5% of the requests make them.
+		simulateRequests(RequestPoolSizer::SAMPLE_WINDOW - 40, 1000, 5);
+		simulateRequests(40, 1000, 20);
+		ensure_equals(sizer.getPoolSize(), (size_t) 8 * 1024);
+
+		simulateRequests(RequestPoolSizer::SAMPLE_WINDOW, 1000, 20);
+		ensure_equals(sizer.getPoolSize(), (size_t) 32 * 1024);
+		ensure_equals(sizer.getResizeCount(), 2u);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("It does not recommend pools larger than MAX_POOL_SIZE");
+		simulateRequests(RequestPoolSizer::SAMPLE_WINDOW, 4000, 40);
+		ensure_equals(sizer.getPoolSize(), (size_t) RequestPoolSizer::MAX_POOL_SIZE);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("It keeps track of extra blocks and large allocations");
+		simulateRequests(2, 1000, 20);
+		simulateRequests(3, 10000);
+		ensure_equals("(1)", sizer.getTotalExtraBlocks(), 2u);
+		ensure_equals("(2)", sizer.getTotalLargeAllocations(), 3u);
+		ensure_equals("(3)", sizer.getTotalLargeBytes(), 30000u);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("It ignores pools that were already reset");
+		psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		for (unsigned int i = 0; i < RequestPoolSizer::SAMPLE_WINDOW; i++) {
+			sizer.recordUsage(pool);
+		}
+		psg_destroy_pool(pool);
+		ensure_equals(sizer.getResizeCount(), 0u);
+	}
+}
@@ -10,6 +10,7 @@
 #include <LoggingKit/LoggingKit.h>
 #include <FileDescriptor.h>
 #include <IOTools/IOUtils.h>
+#include <JsonTools/JsonWriter.h>
 
 using namespace Passenger;
 using namespace Passenger::ServerKit;
@@ -158,6 +159,20 @@ namespace tut {
 		void _clientIsConnected(Client *client, bool *result) {
 			*result = client->connected();
 		}
+
+		void inspectState(Json::Value *doc, string *written, string *writtenPretty) {
+			bg.safe->runSync(boost::bind(&ServerKit_ServerTest::_inspectState,
+				this, doc, written, writtenPretty));
+		}
+
+		void _inspectState(Json::Value *doc, string *written, string *writtenPretty) {
+			JsonWriter writer(*written);
+			JsonWriter prettyWriter(*writtenPretty, true);
+
+			*doc = server->inspectStateAsJson();
+			server->writeStateAsJson(writer);
+			server->writeStateAsJson(prettyWriter);
+		}
 	};
 
 	DEFINE_TEST_GROUP(ServerKit_ServerTest);
@@ -453,4 +468,57 @@ namespace tut {
 			result = !clientIsConnected(client.get());
 		);
 	}
+
+
+	/****** State inspection *****/
+
+	TEST_METHOD(35) {
+		set_test_name("writeStateAsJson() writes the same document as inspectStateAsJson(),"
+			" including active and disconnected clients");
+
+		vector<ClientRefType> clients;
+		config["client_freelist_limit"] = 10;
+		init();
+		startServer();
+
+		FileDescriptor fd1(connectToServer1());
+		FileDescriptor fd2(connectToServer1());
+		FileDescriptor fd3(connectToServer1());
+		FileDescriptor fd4(connectToServer1());
+		EVENTUALLY(5,
+			result = getActiveClientCount() == 4u;
+		);
+
+		clients = getActiveClients();
+		fd1.close();
+		fd2.close();
+		EVENTUALLY(5,
+			result = getDisconnectedClientCount() == 2u;
+		);
+
+		Json::Value doc, writtenDoc, writtenPrettyDoc;
+		string written, writtenPretty;
+		Json::Reader reader;
+		inspectState(&doc, &written, &writtenPretty);
+		clients.clear();
+
+		ensure_equals("(1)", doc["active_clients"].size(), 2u);
+		ensure_equals("(2)", doc["disconnected_clients"].size(), 2u);
+		ensure("(3)", reader.parse(written, writtenDoc));
+		ensure_equals("(4)", Json::FastWriter().write(writtenDoc),
+			Json::FastWriter().write(doc));
+		ensure("(5)", reader.parse(writtenPretty, writtenPrettyDoc));
+		ensure_equals("(6)", Json::FastWriter().write(writtenPrettyDoc),
+			Json::FastWriter().write(doc));
+	}
+
+	TEST_METHOD(36) {
+		set_test_name("The context's state reports the data size of the smallest mbuf size class");
+
+		Json::Value doc = context.inspectStateAsJson()["mbuf_pool"];
+		ensure_equals(doc["data_size"].asUInt(),
+			context.mbuf_pool.mbuf_block_chunk_size - MBUF_BLOCK_HSIZE);
+		ensure_equals(doc["data_size"].asUInt(),
+			mbuf_pool_data_size(&context.mbuf_pool));
+	}
 }
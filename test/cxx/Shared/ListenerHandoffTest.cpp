@@ -0,0 +1,181 @@
+#include <TestSupport.h>
+#include <Shared/ListenerHandoff.h>
+#include <IOTools/IOUtils.h>
+#include <IOTools/MessageIO.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+using namespace Passenger;
+using namespace Passenger::ListenerHandoff;
+using namespace std;
+
+namespace tut {
+	struct Shared_ListenerHandoffTest: public TestBase {
+		// `first` is the Watchdog's end, `second` is the Core's end.
+		SocketPair feedbackFds;
+		vector<FileDescriptor> watchdogListeners;
+		bool watchdogHandedOff;
+
+		Shared_ListenerHandoffTest()
+			: watchdogHandedOff(false)
+		{
+			feedbackFds = createUnixSocketPair(__FILE__, __LINE__);
+		}
+
+		static FileDescriptor createListener() {
+			return FileDescriptor(createTcpServer("127.0.0.1", 0, 0, __FILE__, __LINE__),
+				__FILE__, __LINE__);
+		}
+
+		static ino_t getInode(int fd) {
+			struct stat buf;
+			if (fstat(fd, &buf) == -1) {
+				int e = errno;
+				throw SystemException("fstat() failed", e);
+			}
+			return buf.st_ino;
+		}
+
+		/**
+		 * Acts like the Watchdog's CoreWatcher while the Core starts.
+		 */
+		void fakeWatchdog() {
+			vector<string> args;
+			if (readArrayMessage(feedbackFds.first, args)
+			 && args.size() == 1 && args[0] == "listener handoff")
+			{
+				watchdogHandedOff = handOffListeners(feedbackFds.first,
+					watchdogListeners);
+			}
+		}
+
+		/**
+		 * Acts like a Watchdog that dies right after the Core has asked
+		 * for the listener sockets.
+		 */
+		void fakeDyingWatchdog() {
+			vector<string> args;
+			readArrayMessage(feedbackFds.first, args);
+			feedbackFds.first.close();
+		}
+
+		static vector<int> toInts(const vector<FileDescriptor> &fds) {
+			vector<int> result;
+			vector<FileDescriptor>::const_iterator it;
+			for (it = fds.begin(); it != fds.end(); it++) {
+				result.push_back(*it);
+			}
+			return result;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Shared_ListenerHandoffTest);
+
+	TEST_METHOD(1) {
+		set_test_name("The Core adopts the sockets that the Watchdog kept from the "
+			"previous Core, and hands them back");
+
+		watchdogListeners.push_back(createListener());
+		watchdogListeners.push_back(createListener());
+		ino_t inode1 = getInode(watchdogListeners[0]);
+		ino_t inode2 = getInode(watchdogListeners[1]);
+		TempThread thr(boost::bind(&Shared_ListenerHandoffTest::fakeWatchdog, this));
+
+		vector<FileDescriptor> adopted;
+		ensure("(1)", requestListeners(feedbackFds.second, 2, adopted));
+		ensure_equals("(2)", adopted.size(), 2u);
+		ensure_equals("(3)", getInode(adopted[0]), inode1);
+		ensure_equals("(4)", getInode(adopted[1]), inode2);
+
+		sendListeners(feedbackFds.second, toInts(adopted));
+		thr.join();
+		ensure("(5)", watchdogHandedOff);
+		ensure_equals("(6)", watchdogListeners.size(), 2u);
+		ensure_equals("(7)", getInode(watchdogListeners[0]), inode1);
+		ensure_equals("(8)", getInode(watchdogListeners[1]), inode2);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("If the Watchdog has no sockets, then the Core creates them "
+			"and hands them over");
+
+		TempThread thr(boost::bind(&Shared_ListenerHandoffTest::fakeWatchdog, this));
+
+		vector<FileDescriptor> adopted;
+		ensure("(1)", !requestListeners(feedbackFds.second, 1, adopted));
+		ensure("(2)", adopted.empty());
+
+		vector<FileDescriptor> created;
+		created.push_back(createListener());
+		sendListeners(feedbackFds.second, toInts(created));
+		thr.join();
+		ensure("(3)", watchdogHandedOff);
+		ensure_equals("(4)", watchdogListeners.size(), 1u);
+		ensure_equals("(5)", getInode(watchdogListeners[0]), getInode(created[0]));
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("If the number of sockets that the Watchdog has doesn't match "
+			"the configuration, then the Core creates new ones, which replace "
+			"the Watchdog's");
+
+		watchdogListeners.push_back(createListener());
+		TempThread thr(boost::bind(&Shared_ListenerHandoffTest::fakeWatchdog, this));
+
+		vector<FileDescriptor> adopted;
+		ensure("(1)", !requestListeners(feedbackFds.second, 2, adopted));
+		ensure("(2)", adopted.empty());
+
+		vector<FileDescriptor> created;
+		created.push_back(createListener());
+		created.push_back(createListener());
+		sendListeners(feedbackFds.second, toInts(created));
+		thr.join();
+		ensure("(3)", watchdogHandedOff);
+		ensure_equals("(4)", watchdogListeners.size(), 2u);
+		ensure_equals("(5)", getInode(watchdogListeners[0]), getInode(created[0]));
+		ensure_equals("(6)", getInode(watchdogListeners[1]), getInode(created[1]));
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("The Watchdog keeps its sockets if the Core exits during the handoff");
+
+		watchdogListeners.push_back(createListener());
+		ino_t inode = getInode(watchdogListeners[0]);
+		TempThread thr(boost::bind(&Shared_ListenerHandoffTest::fakeWatchdog, this));
+
+		vector<FileDescriptor> adopted;
+		ensure("(1)", requestListeners(feedbackFds.second, 1, adopted));
+		feedbackFds.second.close();
+		thr.join();
+		ensure("(2)", !watchdogHandedOff);
+		ensure_equals("(3)", watchdogListeners.size(), 1u);
+		ensure_equals("(4)", getInode(watchdogListeners[0]), inode);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("The Core fails if the Watchdog exits during the handoff");
+
+		TempThread thr(boost::bind(&Shared_ListenerHandoffTest::fakeDyingWatchdog, this));
+		vector<FileDescriptor> adopted;
+		try {
+			requestListeners(feedbackFds.second, 1, adopted);
+			fail("EOFException expected");
+		} catch (const EOFException &) {
+			// Pass.
+		}
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("Invalid listener handoff messages are rejected");
+
+		writeArrayMessage(feedbackFds.first, "foo", "1", NULL);
+		vector<FileDescriptor> fds;
+		try {
+			receiveListeners(feedbackFds.second, fds);
+			fail("IOException expected");
+		} catch (const IOException &) {
+			// Pass.
+		}
+	}
+}
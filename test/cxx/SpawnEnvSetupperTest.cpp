@@ -59,6 +59,17 @@ namespace tut {
 			}
 			return runShellCommand(command) == 0;
 		}
+
+		string readFinishFifo() {
+			string result;
+			char buf[1024];
+			ssize_t ret;
+
+			while ((ret = read(session->finishFifoFd, buf, sizeof(buf))) > 0) {
+				result.append(buf, ret);
+			}
+			return result;
+		}
 	};
 
 	DEFINE_TEST_GROUP(SpawnEnvSetupperTest);
@@ -264,10 +275,12 @@ namespace tut {
 		init(SPAWN_DIRECTLY);
 		ensure("SpawnEnvSetupper succeeds", execute("--before"));
 
-		ensure_equals(
-			unsafeReadFile(session->workDir->getPath()
-				+ "/response/steps/subprocess_exec_wrapper/state"),
-			"STEP_IN_PROGRESS");
+		// Passenger's own wrappers use the compact spawn protocol, so the
+		// step state is reported through the finish FIFO.
+		ensure_equals(getFileType(session->workDir->getPath() + "/response/steps"),
+			FT_NONEXISTANT);
+		ensure(readFinishFifo().find("subprocess_exec_wrapper STEP_IN_PROGRESS ")
+			!= string::npos);
 	}
 
 	TEST_METHOD(24) {
@@ -282,10 +295,10 @@ namespace tut {
 		init(SPAWN_DIRECTLY, extraArgs);
 		ensure("SpawnEnvSetupper fails", !execute("--before", true));
 
-		ensure_equals(
-			unsafeReadFile(session->workDir->getPath()
-				+ "/response/steps/subprocess_exec_wrapper/state"),
-			"STEP_ERRORED");
+		ensure_equals(getFileType(session->workDir->getPath() + "/response/steps"),
+			FT_NONEXISTANT);
+		ensure(readFinishFifo().find("subprocess_exec_wrapper STEP_ERRORED ")
+			!= string::npos);
 	}
 
 	TEST_METHOD(25) {
@@ -322,6 +335,36 @@ namespace tut {
 			"STEP_ERRORED");
 	}
 
+	TEST_METHOD(27) {
+		set_test_name("If shellEnvvarsCacheTtl is set, then the next spawn reuses"
+			" the cached shell environment and skips the SUBPROCESS_OS_SHELL step");
+
+		// The same caveat as in test 21 applies.
+
+		TempDirCopy dir("stub/wsgi", "tmp.wsgi");
+		TempDir instanceDir("tmp.instance");
+		Json::Value extraArgs;
+		extraArgs["instance_dir"] = absolutizePath("tmp.instance");
+		config.loadShellEnvvars = true;
+		config.shellEnvvarsCacheTtl = 60;
+
+		init(SPAWN_DIRECTLY, extraArgs);
+		ensure("First SpawnEnvSetupper run succeeds", execute("--before"));
+		ensure_equals(
+			unsafeReadFile(session->workDir->getPath()
+				+ "/response/steps/subprocess_os_shell/state"),
+			"STEP_PERFORMED");
+		ensure("The cache directory is created",
+			getFileType("tmp.instance/shell_envvars_cache/" + toString(getuid())) == FT_DIRECTORY);
+
+		init(SPAWN_DIRECTLY, extraArgs);
+		ensure("Second SpawnEnvSetupper run succeeds", execute("--before"));
+		ensure_equals(
+			unsafeReadFile(session->workDir->getPath()
+				+ "/response/steps/subprocess_os_shell/state"),
+			"STEP_NOT_STARTED");
+	}
+
 
 	/***** Miscellaneous *****/
 
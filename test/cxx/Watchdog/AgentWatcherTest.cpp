@@ -0,0 +1,219 @@
+#include <TestSupport.h>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/make_shared.hpp>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <Constants.h>
+#include <Exceptions.h>
+#include <FileDescriptor.h>
+#include <LoggingKit/LoggingKit.h>
+#include <IOTools/IOUtils.h>
+#include <IOTools/MessageIO.h>
+#include <ProcessManagement/Utils.h>
+#include <Utils.h>
+#include <Utils/Timer.h>
+#include <Utils/ScopeGuard.h>
+#include <StrIntTools/StrIntUtils.h>
+
+using namespace std;
+using namespace oxt;
+using namespace Passenger;
+
+namespace Passenger {
+namespace Watchdog {
+	// The part of the Watchdog's WorkingObjects that AgentWatcher uses.
+	struct WorkingObjects {
+		EventFd errorEvent;
+
+		WorkingObjects()
+			: errorEvent(__FILE__, __LINE__, "WorkingObjects: errorEvent")
+			{ }
+	};
+
+	typedef boost::shared_ptr<WorkingObjects> WorkingObjectsPtr;
+}
+}
+
+using namespace Passenger::Watchdog;
+
+#include <Watchdog/AgentWatcher.cpp>
+
+namespace tut {
+	/**
+	 * Watches a shell that reports itself as initialized through the
+	 * feedback fd and then sleeps.
+	 */
+	class FakeAgentWatcher: public AgentWatcher {
+	protected:
+		virtual string getExeFilename() const {
+			return "/bin/sh";
+		}
+
+		virtual void execProgram() const {
+			// Writes the array message "initialized" to the feedback fd.
+			execl("/bin/sh", "sh", "-c",
+				"printf '\\000\\014initialized\\000' >&3; exec sleep 60",
+				(char *) 0);
+		}
+
+		virtual void sendStartupArguments(pid_t pid, FileDescriptor &fd) {
+			// Nothing to send.
+		}
+
+		virtual bool processStartupInfo(pid_t pid, FileDescriptor &fd, const vector<string> &args) {
+			starts++;
+			return args[0] == "initialized";
+		}
+
+		virtual void signalReplaced(pid_t pid, FileDescriptor &fd) {
+			if (terminateReplaced) {
+				AgentWatcher::signalReplaced(pid, fd);
+			}
+		}
+
+	public:
+		AtomicInt starts;
+		bool terminateReplaced;
+
+		FakeAgentWatcher(const WorkingObjectsPtr &wo)
+			: AgentWatcher(wo),
+			  terminateReplaced(true)
+			{ }
+
+		virtual const char *name() const {
+			return "Fake agent";
+		}
+
+		virtual void reportAgentStartupResult(Json::Value &report) {
+			// Nothing to report.
+		}
+
+		pid_t getPid() const {
+			boost::lock_guard<boost::mutex> l(lock);
+			return pid;
+		}
+
+		pid_t getRetiredPid() const {
+			boost::lock_guard<boost::mutex> l(lock);
+			return retiredPid;
+		}
+	};
+
+	struct Watchdog_AgentWatcherTest: public TestBase {
+		WorkingObjectsPtr wo;
+		boost::shared_ptr<FakeAgentWatcher> watcher;
+		bool watching;
+
+		Watchdog_AgentWatcherTest()
+			: wo(boost::make_shared<WorkingObjects>()),
+			  watching(false)
+		{
+			watcher = boost::make_shared<FakeAgentWatcher>(wo);
+		}
+
+		~Watchdog_AgentWatcherTest() {
+			if (watching) {
+				vector<AgentWatcherPtr> watchers;
+				watchers.push_back(watcher);
+				AgentWatcher::stopWatching(watchers);
+			}
+			watcher->forceShutdown();
+		}
+
+		void startWatching() {
+			watcher->start();
+			watcher->beginWatching();
+			watching = true;
+		}
+
+		static bool processExists(pid_t pid) {
+			return kill(pid, 0) == 0;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Watchdog_AgentWatcherTest);
+
+	TEST_METHOD(1) {
+		set_test_name("hotRestart() starts a new process, and the watcher thread "
+			"doesn't restart the replaced process when it exits");
+
+		startWatching();
+		pid_t oldPid = watcher->getPid();
+		ensure("(1)", watcher->hotRestart());
+		pid_t newPid = watcher->getPid();
+		ensure("(2)", newPid != oldPid);
+		ensure_equals("(3)", (int) watcher->starts, 2);
+
+		// The replaced process was told to shut down and has been
+		// reaped by the watcher thread.
+		EVENTUALLY(5,
+			result = watcher->getRetiredPid() == 0;
+		);
+		SHOULD_NEVER_HAPPEN(300,
+			result = watcher->starts != 2 || watcher->getPid() != newPid;
+		);
+		ensure("(4)", processExists(newPid));
+		ensure_equals("(5)", watcher->getErrorMessage(), "");
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("After a hot restart, the watcher thread restarts the new "
+			"process if it crashes");
+
+		startWatching();
+		ensure("(1)", watcher->hotRestart());
+		EVENTUALLY(5,
+			result = watcher->getRetiredPid() == 0;
+		);
+		pid_t newPid = watcher->getPid();
+
+		kill(newPid, SIGKILL);
+		EVENTUALLY(5,
+			pid_t pid = watcher->getPid();
+			result = watcher->starts == 3 && pid != 0 && pid != newPid;
+		);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("hotRestart() refuses to run while the process replaced by "
+			"the previous hot restart is still shutting down");
+
+		watcher->terminateReplaced = false;
+		startWatching();
+		pid_t oldPid = watcher->getPid();
+		ensure("(1)", watcher->hotRestart());
+		ensure_equals("(2)", watcher->getRetiredPid(), oldPid);
+
+		try {
+			watcher->hotRestart();
+			fail("RuntimeException expected");
+		} catch (const RuntimeException &) {
+			// Pass.
+		}
+		ensure_equals("(3)", (int) watcher->starts, 2);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("forceShutdown() also kills the process replaced by a hot "
+			"restart if it is still shutting down");
+
+		watcher->terminateReplaced = false;
+		startWatching();
+		pid_t oldPid = watcher->getPid();
+		ensure("(1)", watcher->hotRestart());
+		pid_t newPid = watcher->getPid();
+
+		vector<AgentWatcherPtr> watchers;
+		watchers.push_back(watcher);
+		AgentWatcher::stopWatching(watchers);
+		watching = false;
+
+		ensure("(2)", watcher->forceShutdown());
+		ensure_equals("(3)", watcher->getRetiredPid(), 0);
+		ensure("(4)", !processExists(oldPid));
+		ensure("(5)", !processExists(newPid));
+	}
+}
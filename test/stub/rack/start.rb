@@ -1,12 +1,14 @@
 #!/usr/bin/env ruby
 require 'socket'
+require 'json'
 
 STDOUT.sync = true
 STDERR.sync = true
 
 work_dir = ENV['PASSENGER_SPAWN_WORK_DIR']
-ruby_libdir = File.read("#{work_dir}/args/ruby_libdir").strip
-passenger_root = File.read("#{work_dir}/args/passenger_root").strip
+args = JSON.parse(File.read("#{work_dir}/args.json"))
+ruby_libdir = args['ruby_libdir']
+passenger_root = args['passenger_root']
 require "#{ruby_libdir}/phusion_passenger"
 PhusionPassenger.locate_directories(passenger_root)
 PhusionPassenger.require_passenger_lib 'utils/json'